@@ -44,6 +44,8 @@
 #define ASPEP_CTRL_SIZE          4
 #define ASPEP_DATACRC_SIZE       2U
 
+#define ASPEP_ASYNC_POOL_MAX     32U /* The free list of the async buffers is a 32 bits mask */
+
 #define ID_MASK                  ((uint32_t)0xF)
 #define DATA_PACKET              ((uint32_t)0x9)
 #define PING                     ((uint32_t)0x6)
@@ -56,6 +58,8 @@ typedef bool (*ASPEP_send_cb_t)    (void *pHW_Handle, void *txbuffer, uint16_t l
 typedef void (*ASPEP_receive_cb_t) (void *pHW_Handle, void *rxbuffer, uint16_t length);
 typedef void (*ASPEP_hwinit_cb_t)  (void *pHW_Handle);
 typedef void (*ASPEP_hwsync_cb_t)  (void *pHW_Handle);
+typedef uint16_t (*ASPEP_rxremaining_cb_t) (void *pHW_Handle);
+typedef bool (*ASPEP_crc_cb_t)     (void *pHW_Handle, const uint8_t *data, uint16_t length, uint16_t *crc);
 
 /** @addtogroup MCSDK
   * @{
@@ -115,18 +119,38 @@ typedef struct
   MCTL_Handle_t _Super;                    /** Transport Layer component handle */
   void *HWIp;                              /** Hardware components chosen for communication */
   uint8_t *rxBuffer;                       /** Contains the ASPEP Data payload */
+  uint8_t *rxRing;                         /** Circular reception buffer, followed by room for one wrapped payload */
+  uint16_t rxRingSize;                     /** Size of the circular reception buffer, 0 to re-arm the reception for each header and payload */
+  uint16_t rxRingRead;                     /** Index of the next byte to parse in the circular reception buffer */
+  uint16_t rxRingWrite;                    /** Index written by the DMA when the circular reception buffer was last parsed */
+  uint16_t rxRingFill;                     /** Number of bytes received in the circular reception buffer and not parsed yet */
+  uint16_t rxRingKept;                     /** Size of the payload kept in the circular reception buffer until it is processed */
+  uint16_t rxRingOverruns;                 /** Number of times the DMA wrapped over bytes not processed yet */
+  bool rxDiscard;                          /** The received bytes are skipped until the line goes idle */
   uint8_t rxHeader[4];                     /** Contains the ASPEP 32 bits header */
   ASPEP_ctrlBuff_t ctrlBuffer;             /** ASPEP protocol control buffer */
   MCTL_Buff_t syncBuffer;                  /** Buffer used for synchronous communication */
-  MCTL_Buff_t asyncBufferA;                /** First buffer used for asynchronous communication */
-  MCTL_Buff_t asyncBufferB;                /** Second buffer used for asynchronous communication */
+  MCTL_Buff_t *asyncPool;                  /** Pool of buffers used for asynchronous communication */
+  uint8_t *asyncPoolStorage;               /** Memory of the async buffers, asyncPoolSize blocks of asyncBufferStride bytes */
+  uint16_t asyncBufferStride;              /** Distance between two async buffers in asyncPoolStorage, multiple of 4 */
+  uint8_t asyncPoolSize;                   /** Number of async buffers, ASPEP_ASYNC_POOL_MAX at most */
+  uint8_t *asyncQueue;                     /** Transmit queue, indexes of the async buffers waiting for the HW resource */
+  uint8_t asyncQueueHead;                  /** Next entry written in asyncQueue, below asyncPoolSize */
+  uint8_t asyncQueueTail;                  /** Next entry read from asyncQueue, below asyncPoolSize */
+  uint8_t asyncQueueCount;                 /** Number of entries in asyncQueue. The queue is modified with interrupts
+                                               disabled */
+  volatile uint32_t asyncFreeMask;         /** Free list of the pool, bit N set when async buffer N is available */
+  uint16_t asyncHighWater;                 /** Maximum number of async buffers in use at once */
+  uint16_t asyncDropped;                   /** Number of async buffer requests that found the pool empty */
+  MCTL_Buff_t eventBuffer;                 /** Buffer used for asynchronous events, sent before the pending async buffers */
   MCTL_Buff_t *lastRequestedAsyncBuff;     /** Last buffer requested for asynchronous communication */
-  MCTL_Buff_t *asyncNextBuffer;            /** Next buffer that will be transmitted by asynchronous communication */
   void *lockBuffer;                        /** Buffer locked to avoid erasing data not yet transmitted */
   ASPEP_hwinit_cb_t fASPEP_HWInit;         /** Pointer to the initialization function */
   ASPEP_hwsync_cb_t fASPEP_HWSync;         /** Pointer to the starting function */
   ASPEP_receive_cb_t fASPEP_receive;       /** Pointer to the receiving packet function */
   ASPEP_send_cb_t fASPEP_send;             /** Pointer to the sending packet function */
+  ASPEP_rxremaining_cb_t fASPEP_rxRemaining; /** Pointer to the function returning the free running reception counter (circular reception only) */
+  ASPEP_crc_cb_t fASPEP_dataCRC;           /** Pointer to the hardware data CRC function, NULL to compute the data CRC in software */
   uint16_t rxLength;                       /** Length of the received data packet : payload and header */
   uint16_t maxRXPayload;                   /** Maximum payload size the performer can process */
   uint8_t syncPacketCount;                 /** Reset at startup only, this counter is incremented at each valid data packet received from controller */
@@ -137,6 +161,9 @@ typedef struct
   ASPEP_TL_sm_type ASPEP_TL_State;         /** Transport Layer state of the communication between performer and controller */
   ASPEP_packetType rxPacketType;           /** Type of the received packet */
   ASPEP_Capabilities_def Capabilities;     /** Minimum between Controller and Performer capabilities */
+  uint32_t dataCRCCycles;                  /** CPU cycles spent on the data CRC of the last packet */
+  uint32_t dataCRCMaxCycles;               /** Maximum CPU cycles spent on the data CRC of a packet */
+  uint16_t dataCRCMaxLength;               /** Length of the packet that took dataCRCMaxCycles */
 } ASPEP_Handle_t;
 
 void ASPEP_start(ASPEP_Handle_t *pHandle);
@@ -146,6 +173,7 @@ uint8_t ASPEP_sendPacket(MCTL_Handle_t *pHandle, void *txBuffer, uint16_t txData
 uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pHandle, uint16_t *packetLength);
 /*   */
 void ASPEP_HWDataReceivedIT(ASPEP_Handle_t *pHandle);
+void ASPEP_HWRxIdleIT(ASPEP_Handle_t *pHandle);
 void ASPEP_HWDataTransmittedIT(ASPEP_Handle_t *pHandle);
 /* Debugger stuff */
 void ASPEP_HWDMAReset(ASPEP_Handle_t *pHandle);
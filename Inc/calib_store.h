@@ -0,0 +1,132 @@
+
+/**
+  ******************************************************************************
+  * @file    calib_store.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Calibration Store component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup CalibStore
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CALIB_STORE_H
+#define CALIB_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup CalibStore
+  * @{
+  */
+
+#define CAL_RECORD_MAGIC    0xCA1BU
+#define CAL_RECORD_VERSION  1U
+
+/* Record content flags */
+#define CAL_FLAG_OFFSETS    0x01U  /* Phase current offsets are valid */
+#define CAL_FLAG_HALL       0x02U  /* Alignment angle and hall phase shift are valid */
+
+/* Flash area reserved by the linker scripts (CALIB memory region) */
+extern const uint32_t _scalib[];
+extern const uint32_t _ecalib[];
+
+/* Plausibility window of the stored phase offsets (left aligned ADC values) */
+#define CAL_OFFSET_MIN      0x4000
+#define CAL_OFFSET_MAX      0xC000
+
+typedef enum
+{
+  CAL_IDLE    = 0,  /**< Nothing to write, the stored record is periodically re-verified. */
+  CAL_ERASE   = 1,  /**< The next page is being erased before writing the record in it. */
+  CAL_PROGRAM = 2,  /**< The record is being programmed, one double word per call. */
+  CAL_ERROR   = 3,  /**< A flash operation failed, the store is read only until next reset. */
+} CAL_State_t;
+
+/**
+  * @brief Calibration record, as stored in flash. Its size is a multiple of the
+  *        flash programming unit (double word).
+  */
+typedef struct
+{
+  uint16_t Magic;                 /**< @brief #CAL_RECORD_MAGIC */
+  uint8_t Version;                /**< @brief #CAL_RECORD_VERSION */
+  uint8_t Flags;                  /**< @brief Valid content, see CAL_FLAG_xxx */
+  uint32_t Sequence;              /**< @brief Incremented at each write, the highest valid one is the current record */
+  PolarizationOffsets_t Offsets;  /**< @brief Phase current measurement offsets */
+  int16_t AlignElAngle;           /**< @brief Electrical angle of the timed alignment, in s16degree */
+  int16_t HallPhaseShift;         /**< @brief Hall phase shift measured at the end of the alignment, in s16degree */
+  uint32_t Reserved;              /**< @brief Padding, written as zero */
+  uint32_t Crc;                   /**< @brief CRC-32 of all the previous fields */
+} CAL_Record_t;
+
+/**
+  * @brief Handle of a Calibration Store component
+  */
+typedef struct
+{
+  uint32_t StartAddress;          /**< @brief First address of the reserved flash area, set by CAL_Init() */
+  uint32_t EndAddress;            /**< @brief Address following the reserved flash area, set by CAL_Init() */
+  uint16_t VerifyPeriod;          /**< @brief Period of the background re-verification, in CAL_Exec() calls */
+  CAL_Record_t Record;            /**< @brief RAM copy of the current record */
+  uint32_t RecordAddress;         /**< @brief Flash address of the current record, 0 if none */
+  uint32_t WriteAddress;          /**< @brief Flash address of the record being written */
+  uint8_t WriteIndex;             /**< @brief Index of the next double word to program */
+  bool SaveRequest;               /**< @brief A new record must be written */
+  CAL_State_t State;              /**< @brief State of the background writer */
+  uint16_t VerifyCounter;         /**< @brief Calls remaining before the next re-verification */
+  uint16_t VerifyErrors;          /**< @brief Number of times the stored record did not match its RAM copy */
+} CAL_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Loads the most recent valid record from flash */
+bool CAL_Init(CAL_Handle_t *pHandle);
+
+/* Runs the background writer and re-verification, one step per call */
+void CAL_Exec(CAL_Handle_t *pHandle);
+
+/* Stores new phase current offsets */
+void CAL_SetOffsets(CAL_Handle_t *pHandle, const PolarizationOffsets_t *pOffsets);
+
+/* Returns the stored phase current offsets, if valid */
+bool CAL_GetOffsets(const CAL_Handle_t *pHandle, PolarizationOffsets_t *pOffsets);
+
+/* Stores a new alignment angle and hall phase shift */
+void CAL_SetHallCorrection(CAL_Handle_t *pHandle, int16_t hAlignElAngle, int16_t hPhaseShift);
+
+/* Returns the stored hall phase shift, if valid */
+bool CAL_GetHallCorrection(const CAL_Handle_t *pHandle, int16_t *pPhaseShift);
+
+/* Invalidates the stored calibration, forcing a full calibration at next start */
+void CAL_Erase(CAL_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* CALIB_STORE_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
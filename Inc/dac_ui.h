@@ -44,6 +44,22 @@
 #define DAC_CH_NBR  2
 #define DAC_CH_USER 2
 
+/* Output modes, see DAC_SetMode() */
+#define DAC_MODE_OFF     0U   /* DAC_Exec() is not called, the outputs are frozen */
+#define DAC_MODE_DIRECT  1U   /* Both channels are written and triggered by software in DAC_Exec() */
+#define DAC_MODE_DMA     2U   /* DAC_Exec() stores the samples in a ring, fed to both channels by DMA */
+
+#define DAC_RING_SIZE    8U   /* Samples of the DMA ring, power of 2. The output lags by half the ring */
+#define DAC_SCALE_UNITY  256  /* Scale of a channel that outputs the value unchanged */
+
+/* Resources of the DMA mode: TIM7 triggers both channels, DMA1 channel 3 writes the dual data register. The DAC can
+   not be triggered by TIM1, TIM7 is kept in phase with the High Frequency Task by DAC_Exec() */
+#define DAC_TIM          TIM7
+#define DAC_DMA          DMA1
+#define DAC_DMA_CHANNEL  LL_DMA_CHANNEL_3
+#define DAC_DMA_REQUEST  LL_DMA_REQUEST_6
+#define DAC_TIM_PERIOD   ((uint32_t)ADV_TIM_CLK_MHz * 1000000U / TF_REGULATION_RATE) /* APB1 and APB2 at the same clock */
+
 typedef enum
 {
   DAC_CH1,
@@ -56,6 +72,13 @@ typedef struct
 
   uint16_t *ptrDataCh[DAC_CH_NBR]; /* Pointer of the data dumped into DAC */
   uint16_t dataCh[DAC_CH_NBR];     /* ID of the data dumped into DAC */
+  int16_t scaleCh[DAC_CH_NBR];     /* Gain applied to the data, DAC_SCALE_UNITY for 1 */
+  uint16_t offsetCh[DAC_CH_NBR];   /* Output for a data equal to 0, 32768 for mid-scale */
+  uint32_t ring[DAC_RING_SIZE];    /* Samples of both channels, in the DAC dual 12 bits left aligned format */
+  uint8_t ringIndex;               /* Next sample written in the ring */
+  uint8_t mode;                    /* Output mode, DAC_MODE_xxx */
+  uint8_t decimation;              /* One sample every decimation+1 High Frequency Task calls */
+  uint8_t decimationCount;         /* High Frequency Task calls since the last sample */
 } DAC_Handle_t;
 
 extern DAC_Handle_t DAC_Handle;
@@ -68,6 +91,10 @@ uint16_t DAC_GetChannelConfig(DAC_Handle_t *pHandle, DAC_Channel_t bChannel);
 
 void DAC_Exec(DAC_Handle_t *pHandle);
 
+bool DAC_SetMode(DAC_Handle_t *pHandle, uint8_t mode);
+
+void DAC_SetDecimation(DAC_Handle_t *pHandle, uint8_t decimation);
+
 /**
   * @}
   */
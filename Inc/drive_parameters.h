@@ -37,17 +37,36 @@
 #define M1_SS_MEAS_ERRORS_BEFORE_FAULTS 3 /*!< Number of speed
                                                              measurement errors before
                                                              main sensor goes in fault */
+/* Motor 2 (zoom axis), only used when NBR_OF_MOTORS is 2 */
+#define MAX_APPLICATION_SPEED_RPM2      3000 /*!< rpm, mechanical */
+#define MIN_APPLICATION_SPEED_RPM2      0 /*!< rpm, mechanical,
+                                                           absolute value */
+#define M2_SS_MEAS_ERRORS_BEFORE_FAULTS 3 /*!< Number of speed
+                                                             measurement errors before
+                                                             main sensor goes in fault */
 /*** Encoder **********************/
 
 #define ENC_AVERAGING_FIFO_DEPTH        16 /*!< depth of the FIFO used to
                                                               average mechanical speed in
                                                               0.1Hz resolution */
+#define ENC_MT_SPEED_MEASUREMENT        /*!< Speed of the M1 encoder computed from the
+                                                              timestamps of its edges (M/T method)
+                                                              instead of the FIFO average. TIM5
+                                                              timestamps the edges, the encoder
+                                                              only runs with M1_ENCODER_FUSION */
+#define ENC_EDGE_TIMEOUT_MS             100 /*!< ms without encoder edge after which
+                                                              the M/T speed is zero */
 
 /* USER CODE BEGIN angle reconstruction M1 */
 #define PARK_ANGLE_COMPENSATION_FACTOR 0
 #define REV_PARK_ANGLE_COMPENSATION_FACTOR 0
 /* USER CODE END angle reconstruction M1 */
 
+/* USER CODE BEGIN angle reconstruction M2 */
+#define PARK_ANGLE_COMPENSATION_FACTOR2 0
+#define REV_PARK_ANGLE_COMPENSATION_FACTOR2 0
+/* USER CODE END angle reconstruction M2 */
+
 /**************************    DRIVE SETTINGS SECTION   **********************/
 /* PWM generation and current reading */
 
@@ -55,6 +74,17 @@
 #define PWM_FREQ_SCALING 1
 
 #define LOW_SIDE_SIGNALS_ENABLING        ES_GPIO
+/* #define M1_OVERMODULATION */            /*!< The motor 1 modulator enters the hexagon up to the six-step
+                                                              voltage, 2/pi of the bus instead of 1/sqrt(3). The
+                                                              currents are estimated when a low-side pulse is too
+                                                              short to be sampled. Scales the voltages by pi/(2*sqrt(3)) */
+#define DPWM_ENABLE_VOLTAGE             1000 /*!< Vqd magnitude above which the discontinuous PWM is enabled,
+                                                              in tenth of percentage of MAX_MODULE. 1000 keeps the
+                                                              continuous SVPWM until MC_REG_DPWM_THRESHOLD is written.
+                                                              Both motors */
+#define DPWM_DISABLE_VOLTAGE             900 /*!< Vqd magnitude below which the continuous SVPWM is restored,
+                                                              in tenth of percentage of MAX_MODULE. The hysteresis
+                                                              follows MC_REG_DPWM_THRESHOLD */
 
 /* Torque and flux regulation loops */
 #define REGULATION_EXECUTION_RATE     1    /*!< FOC execution rate in
@@ -96,7 +126,38 @@
 /* USER CODE END PID_SPEED_INTEGRAL_INIT_DIV */
 
 #define SPD_DIFFERENTIAL_TERM_ENABLING DISABLE
-#define IQMAX_A                          0.8
+
+/* Flux weakening settings, see FluxWeakeningCtrl */
+#define FW_VOLTAGE_REF                950  /*!< Vqd magnitude above which Id is made negative, in tenth of
+                                                percentage of MAX_MODULE. 1000 disables the flux weakening */
+#define FW_KP_GAIN                    3000 /*!< Default Kp gain of the voltage loop */
+#define FW_KI_GAIN                    5000 /*!< Default Ki gain of the voltage loop */
+#define FW_KPDIV                      32768
+#define FW_KIDIV                      32768
+#define FW_KPDIV_LOG                  LOG2((32768))
+#define FW_KIDIV_LOG                  LOG2((32768))
+#define M1_VQD_SW_FILTER_BW_FACTOR    128  /*!< Time constant of the Vqd filter, in FOC cycles */
+#define M1_VQD_SW_FILTER_BW_FACTOR_LOG LOG2((128))
+#define M1_PEAK_CURRENT_A                1.6 /*!< Torque limit of a cold motor, derated down to NOMINAL_CURRENT_A */
+#define IQMAX_A                          M1_PEAK_CURRENT_A
+
+/* Software overcurrent and thermal derating, see CurrentProtection */
+#define M1_SW_OC_THRESHOLD_A             2.4  /*!< Limit of the Iqd magnitude, below the hardware protection */
+#define M1_SW_OC_DEBOUNCE                2U   /*!< Consecutive FOC cycles above the threshold before the fault */
+#define M1_WINDING_TAU_S                 3.0f /*!< Thermal time constant of the winding, in seconds */
+#define M1_HOUSING_TAU_S                 120.0f /*!< Thermal time constant of the housing, in seconds */
+#define M1_HOUSING_SHARE                 0.6f /*!< Part of the steady state heating across the housing */
+#define M1_DERATING_START                0.8f /*!< Thermal load above which the torque limit is derated */
+
+/* Motor identification (MC_REG_SC_xxx), see MotorIdent */
+#define M1_ID_TEST_CURRENT_A             0.8f /*!< DC current of the resistance and inductance steps */
+#define M1_ID_TORQUE_CURRENT_A           0.3f /*!< Iq current of the torque pulses measuring the inertia */
+#define M1_ID_INJECTION_FREQ_HZ          (ISR_FREQUENCY_HZ / 4) /*!< AC voltage frequency of the inductance step */
+#define M1_ID_SETTLE_MS                  100  /*!< Settling time of each electrical step */
+#define M1_ID_MEASURE_MS                 200  /*!< Measurement window of each electrical step */
+#define M1_ID_PULSE_MS                   40   /*!< Duration of each torque pulse, the travel grows with its square */
+#define M1_ID_CURRENT_BANDWIDTH_HZ       1000.0f /*!< Target bandwidth of the tuned current loops */
+#define M1_ID_SPEED_BANDWIDTH_HZ         40.0f   /*!< Target bandwidth of the tuned speed loop */
 
 /* Default settings */
 #define DEFAULT_CONTROL_MODE           MCM_SPEED_MODE
@@ -116,6 +177,39 @@
 #define PID_POSITION_KDDIV_LOG			LOG2((16))
 #define PID_POSITION_ANGLE_STEP			10.0
 #define PID_POSITION_MOV_DURATION		10.0
+/* Position loop torque feed-forward, computed from the reference trajectory */
+#define POSITION_FF_INERTIA            0.0 /*!< digit/(rad/s^2) */
+#define POSITION_FF_VISCOUS            0.0 /*!< digit/(rad/s) */
+#define POSITION_FF_COULOMB            0.0 /*!< digit */
+#define POSITION_FF_COULOMB_DEADBAND   0.05 /*!< rad/s, no Coulomb feed-forward below this reference speed */
+
+/* Streamed setpoints (MC_REG_POSITION_STREAM) */
+#define SETPOINT_STREAM_DEPTH          64 /*!< Samples in the stream buffer, must be a power of 2 */
+#define SETPOINT_STREAM_PREFILL        8  /*!< Samples buffered before the stream starts playing */
+#define CALIB_STORE_VERIFY_PERIOD_MS   1000 /*!< Period of the background check of the stored calibration */
+
+/* Backlash compensation (MC_REG_BACKLASH_xxx), the table is learnt with MC_REG_BACKLASH_STATE */
+#define BACKLASH_TABLE_SIZE            16    /*!< Number of table points */
+#define BACKLASH_POSITION_MIN          0.0   /*!< Position of the first table point, rad */
+#define BACKLASH_POSITION_MAX          6.2832 /*!< Position of the last table point, rad */
+#define BACKLASH_HYSTERESIS            20    /*!< Reference reversal switching the flank, s16 mechanical angle */
+#define BACKLASH_TAKE_UP_RATE          8     /*!< Maximum correction change per position loop period, s16 */
+#define BACKLASH_ENGAGE_TORQUE         300   /*!< Position PID output detecting the flank contact, digit */
+#define BACKLASH_LEARN_SPEED           0.2   /*!< Reference speed during the reversal tests, rad/s */
+#define BACKLASH_LEARN_APPROACH        0.1   /*!< Approach distance and largest learnable backlash, rad */
+#define BACKLASH_LEARN_SETTLE_MS       200   /*!< Hold time before each reversal */
+
+/* High frequency capture (MC_REG_HF_CAPTURE_xxx) */
+#define HF_CAPTURE_BUFFER_SIZE         4096  /*!< Samples of the capture buffer, shared by the channels */
+
+/* Frequency response analyser (MC_REG_FREQ_RESP_xxx), sweep applied until reconfigured */
+#define FREQ_RESP_LOOP                 FRA_LOOP_CURRENT
+#define FREQ_RESP_POINTS               24    /*!< Frequencies of the sweep */
+#define FREQ_RESP_START_HZ             20.0f /*!< First frequency of the sweep */
+#define FREQ_RESP_STOP_HZ              4000.0f /*!< Last frequency, below half the rate of the measured loop */
+#define FREQ_RESP_AMPLITUDE            500   /*!< Perturbation, in the unit of the reference (s16A here) */
+#define FREQ_RESP_SETTLE_CYCLES        4     /*!< Periods discarded at each frequency */
+#define FREQ_RESP_MEASURE_CYCLES       16    /*!< Periods correlated at each frequency */
 
 /**************************    FIRMWARE PROTECTIONS SECTION   *****************/
 #define OV_VOLTAGE_THRESHOLD_V          34 /*!< Over-voltage
@@ -149,10 +243,22 @@
 #define M1_ALIGNMENT_DURATION              700 /*!< milliseconds */
 #define M1_ALIGNMENT_ANGLE_DEG             90 /*!< degrees [0...359] */
 #define FINAL_I_ALIGNMENT_A               0.8 /*!< s16A */
+#define M1_HALL_INSTANT_START              true /*!< Skip the alignment when the hall angle is plausible */
+#define M1_HALL_MIN_AMPLITUDE              200  /*!< ADC counts, smallest plausible hall vector */
+#define M1_HALL_MAX_AMPLITUDE              6000 /*!< ADC counts, largest plausible hall vector */
+#define M1_FUSION_HALL_GAIN                0.05f /*!< Part of the hall angle error corrected at each hall sample */
+#define M1_FUSION_MAX_ANGLE_ERROR_DEG      45   /*!< Electrical degrees, largest hall error consistent with the encoder */
+#define M1_FUSION_MAX_ERROR_SAMPLES        20   /*!< Consecutive inconsistent hall samples before an encoder fault */
+/* #define M1_ENCODER_FUSION */                 /*!< Fuses a quadrature encoder on TIM3 (PC6/PC7, PB4/PB5 with two
+                                                     motors) with the analog hall sensors. TIM3 is then an encoder timer and TIM15 triggers the ADC2
+                                                     hall conversions. Undefined, M1 runs on the hall sensors only */
 // With ALIGNMENT_ANGLE_DEG equal to 90 degrees final alignment
 // phase current = (FINAL_I_ALIGNMENT * 1.65/ Av)/(32767 * Rshunt)
 // being Av the voltage gain between Rshunt and A/D input
 
+#define M2_ALIGNMENT_DURATION              700 /*!< milliseconds, encoder alignment of the zoom axis */
+#define M2_ALIGNMENT_ANGLE_DEG             90 /*!< degrees [0...359] */
+
 #define TRANSITION_DURATION            25  /* Switch over duration, ms */
 
 /******************************   BUS VOLTAGE Motor 1  **********************/
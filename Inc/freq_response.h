@@ -0,0 +1,162 @@
+
+/**
+  ******************************************************************************
+  * @file    freq_response.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Frequency Response Analyser component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup FreqResponse
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FREQ_RESPONSE_H
+#define FREQ_RESPONSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup FreqResponse
+  * @{
+  */
+
+#define FRA_MAX_POINTS           32U  /* Maximum number of frequencies of a sweep */
+
+#define FRA_CONFIG_SIZE          16U  /* Size of the MC_REG_FREQ_RESP_CONFIG register */
+#define FRA_DATA_HEADER_SIZE     4U   /* Size of the MC_REG_FREQ_RESP_DATA header, points follow */
+#define FRA_POINT_SIZE           12U  /* Size of a point in MC_REG_FREQ_RESP_DATA */
+
+/* Commands written to MC_REG_FREQ_RESP_STATE */
+#define FRA_CMD_STOP             0U   /* Aborts a sweep in progress */
+#define FRA_CMD_START            1U   /* Starts a sweep, the results of the previous one are discarded */
+
+typedef enum
+{
+  FRA_IDLE    = 0,  /**< No sweep since the boot. */
+  FRA_RUNNING = 1,  /**< The perturbation is injected, points are measured. */
+  FRA_DONE    = 2,  /**< All the points of the sweep are measured. */
+  FRA_ABORTED = 3,  /**< Stopped by a command, a motor stop or a fault, the points measured so far are kept. */
+} FRA_State_t;
+
+typedef enum
+{
+  FRA_LOOP_NONE     = 0,  /**< Returned by FRA_GetLoop() when no sweep is running. */
+  FRA_LOOP_CURRENT  = 1,  /**< Perturbation on the Iq reference, Iq measured by the High Frequency Task. */
+  FRA_LOOP_SPEED    = 2,  /**< Perturbation on the speed reference, speed measured by the Medium Frequency Task. The
+                               position loop is suspended. */
+  FRA_LOOP_POSITION = 3,  /**< Perturbation on the position reference, position measured by the Medium Frequency
+                               Task. */
+} FRA_Loop_t;
+
+/**
+  * @brief Measured point of a sweep
+  */
+typedef struct
+{
+  float Frequency;                         /**< @brief Frequency of the perturbation, expressed in Hz */
+  float Gain;                              /**< @brief Ratio of the feedback and reference amplitudes */
+  float Phase;                             /**< @brief Phase of the feedback relative to the reference, expressed in
+                                                       degrees */
+} FRA_Point_t;
+
+/**
+  * @brief Handle of a Frequency Response Analyser component
+  */
+typedef struct
+{
+  uint16_t HFFrequencyHz;                  /**< @brief Call rate of FRA_Exec() for #FRA_LOOP_CURRENT, expressed in
+                                                       Hz */
+  uint16_t MFFrequencyHz;                  /**< @brief Call rate of FRA_Exec() for the other loops and of
+                                                       FRA_Process(), expressed in Hz */
+  FRA_Loop_t Loop;                         /**< @brief Loop measured by the sweep */
+  uint8_t NbrOfPoints;                     /**< @brief Number of frequencies of the sweep, up to #FRA_MAX_POINTS */
+  uint8_t SettleCycles;                    /**< @brief Periods of the perturbation discarded at each frequency */
+  uint8_t MeasureCycles;                   /**< @brief Periods of the perturbation correlated at each frequency */
+  int16_t Amplitude;                       /**< @brief Amplitude of the perturbation, in the unit of the reference:
+                                                       s16A, #SPEED_UNIT or s16degree */
+  float StartFrequency;                    /**< @brief First frequency of the sweep, expressed in Hz */
+  float StopFrequency;                     /**< @brief Last frequency of the sweep, expressed in Hz. The frequencies
+                                                       are spaced logarithmically */
+
+  volatile FRA_State_t State;              /**< @brief Sweep state */
+  volatile bool Sampling;                  /**< @brief Set by FRA_Process() when a point starts, cleared by
+                                                       FRA_Exec() at the end of its measurement window */
+  bool PointStarted;                       /**< @brief The point PointIndex is being measured */
+  uint8_t PointIndex;                      /**< @brief Point being measured */
+  uint8_t Completed;                       /**< @brief Points measured so far */
+  uint8_t ReadOffset;                      /**< @brief First point of the next MC_REG_FREQ_RESP_DATA upload */
+  uint32_t Phase;                          /**< @brief Phase of the perturbation, a full turn is 2^32 */
+  uint32_t PhaseStep;                      /**< @brief Phase increment per FRA_Exec() call */
+  uint16_t Cycles;                         /**< @brief Periods of the perturbation completed at the current point */
+  uint16_t EndCycles;                      /**< @brief SettleCycles + MeasureCycles */
+  uint32_t SampleCount;                    /**< @brief FRA_Exec() calls since the start of the current point */
+  int32_t InputOrigin;                     /**< @brief Reference at the start of the point, removed from the sums */
+  int32_t OutputOrigin;                    /**< @brief Feedback at the start of the point, removed from the sums */
+  int64_t InputCos;                        /**< @brief Sum of the reference times the cosine of the perturbation */
+  int64_t InputSin;                        /**< @brief Sum of the reference times the sine of the perturbation */
+  int64_t OutputCos;                       /**< @brief Sum of the feedback times the cosine of the perturbation */
+  int64_t OutputSin;                       /**< @brief Sum of the feedback times the sine of the perturbation */
+  FRA_Point_t Points[FRA_MAX_POINTS];      /**< @brief Measured points */
+} FRA_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Frequency Response Analyser component */
+void FRA_Init(FRA_Handle_t *pHandle);
+
+/* Sets the loop and the frequencies of the sweep */
+uint8_t FRA_SetConfig(FRA_Handle_t *pHandle, const uint8_t *pData, uint16_t size);
+
+/* Returns the configuration of the sweep */
+void FRA_GetConfig(const FRA_Handle_t *pHandle, uint8_t *pData);
+
+/* Starts or stops a sweep */
+uint8_t FRA_Command(FRA_Handle_t *pHandle, uint8_t command);
+
+/* Aborts the sweep, to be called when the PWM is switched off */
+void FRA_Stop(FRA_Handle_t *pHandle);
+
+/* Returns the loop measured by the running sweep */
+FRA_Loop_t FRA_GetLoop(const FRA_Handle_t *pHandle);
+
+/* Returns the perturbation and correlates the response, to be called at the rate of the measured loop */
+int32_t FRA_Exec(FRA_Handle_t *pHandle, int32_t Reference, int32_t Feedback);
+
+/* Computes the completed points and starts the next ones, to be called by the Medium Frequency Task */
+void FRA_Process(FRA_Handle_t *pHandle);
+
+/* Copies a chunk of the measured points, starting at ReadOffset */
+uint8_t FRA_ReadData(const FRA_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize, uint16_t *pSize);
+
+/* Returns the sweep state */
+FRA_State_t FRA_GetState(const FRA_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* FREQ_RESPONSE_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
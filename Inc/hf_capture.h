@@ -0,0 +1,136 @@
+
+/**
+  ******************************************************************************
+  * @file    hf_capture.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          High Frequency Capture component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup HFCapture
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HF_CAPTURE_H
+#define HF_CAPTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup HFCapture
+  * @{
+  */
+
+#define HFC_MAX_CHANNELS         8U   /* Maximum number of registers recorded in a capture */
+
+#define HFC_CONFIG_HEADER_SIZE   10U  /* Size of the MC_REG_HF_CAPTURE_CONFIG header, channel IDs follow */
+#define HFC_DATA_HEADER_SIZE     10U  /* Size of the MC_REG_HF_CAPTURE_DATA header, frames follow */
+
+/* Commands written to MC_REG_HF_CAPTURE_STATE */
+#define HFC_CMD_STOP             0U   /* Closes a capture in progress, or disarms */
+#define HFC_CMD_ARM              1U   /* Starts recording and waits for the trigger */
+#define HFC_CMD_FORCE            2U   /* Triggers an armed capture immediately */
+
+typedef enum
+{
+  HFC_IDLE      = 0,  /**< Nothing is recorded. */
+  HFC_ARMED     = 1,  /**< Pre-trigger frames are recorded, the trigger condition is checked. */
+  HFC_TRIGGERED = 2,  /**< Post-trigger frames are recorded. */
+  HFC_DONE      = 3,  /**< The capture is complete and can be uploaded. */
+} HFC_State_t;
+
+typedef enum
+{
+  HFC_TRIGGER_NONE    = 0,  /**< Triggers as soon as the pre-trigger frames are recorded. */
+  HFC_TRIGGER_ABOVE   = 1,  /**< Trigger channel greater than or equal to the level. */
+  HFC_TRIGGER_BELOW   = 2,  /**< Trigger channel lower than or equal to the level. */
+  HFC_TRIGGER_RISING  = 3,  /**< Trigger channel crossing the level upwards. */
+  HFC_TRIGGER_FALLING = 4,  /**< Trigger channel crossing the level downwards. */
+  HFC_TRIGGER_FAULT   = 5,  /**< Motor fault, reported with HFC_FaultTrigger(). */
+} HFC_TriggerMode_t;
+
+/**
+  * @brief Handle of a High Frequency Capture component
+  */
+typedef struct
+{
+  int16_t *pBuffer;                        /**< @brief Capture ring buffer, frames of NbrOfChannels samples */
+  uint16_t BufferSize;                     /**< @brief Number of samples of the buffer */
+  int16_t *pSource[HFC_MAX_CHANNELS];      /**< @brief Variables recorded, resolved from the channel IDs */
+  uint16_t ChannelID[HFC_MAX_CHANNELS];    /**< @brief Register IDs of the channels, as configured by the host */
+  uint8_t NbrOfChannels;                   /**< @brief Number of channels, 0 if not configured */
+  uint8_t Divider;                         /**< @brief One frame is recorded every Divider HF task calls */
+  HFC_TriggerMode_t TriggerMode;           /**< @brief Trigger condition */
+  uint8_t TriggerChannel;                  /**< @brief Channel compared with TriggerLevel */
+  int16_t TriggerLevel;                    /**< @brief Level of the level and edge triggers */
+  uint16_t PreTrigger;                     /**< @brief Frames recorded before the trigger frame */
+  uint16_t Depth;                          /**< @brief Frames of a capture, BufferSize / NbrOfChannels */
+  uint16_t EndIndex;                       /**< @brief Depth * NbrOfChannels, wrap point of WriteIndex */
+
+  volatile HFC_State_t State;              /**< @brief Capture state */
+  volatile bool TriggerRequest;            /**< @brief Forced or fault trigger, handled at the next frame */
+  uint16_t WriteIndex;                     /**< @brief Buffer index of the next frame */
+  uint16_t Recorded;                       /**< @brief Frames recorded since the capture was armed, up to Depth */
+  uint16_t Remaining;                      /**< @brief Post-trigger frames still to record */
+  uint16_t Length;                         /**< @brief Frames of the capture, trigger frame included */
+  uint16_t TriggerPos;                     /**< @brief Position of the trigger frame in the capture */
+  uint16_t StartIndex;                     /**< @brief Buffer index of the first frame of a complete capture */
+  uint8_t DividerCounter;                  /**< @brief HF task calls left before the next frame */
+  int16_t LastTriggerValue;                /**< @brief Previous value of the trigger channel, for edge triggers */
+  uint16_t ReadOffset;                     /**< @brief First frame of the next MC_REG_HF_CAPTURE_DATA upload */
+} HFC_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the High Frequency Capture component */
+void HFC_Init(HFC_Handle_t *pHandle);
+
+/* Sets the channels and the trigger of the capture */
+uint8_t HFC_SetConfig(HFC_Handle_t *pHandle, const uint8_t *pData, uint16_t size);
+
+/* Returns the configuration of the capture */
+uint16_t HFC_GetConfig(const HFC_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize);
+
+/* Arms, stops or forces the trigger of the capture */
+uint8_t HFC_Command(HFC_Handle_t *pHandle, uint8_t command);
+
+/* Records one frame, to be called by the High Frequency Task */
+void HFC_Exec(HFC_Handle_t *pHandle);
+
+/* Reports a motor fault to a capture armed with HFC_TRIGGER_FAULT */
+void HFC_FaultTrigger(HFC_Handle_t *pHandle);
+
+/* Copies a chunk of a complete capture, starting at ReadOffset */
+uint8_t HFC_ReadData(const HFC_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize, uint16_t *pSize);
+
+/* Returns the capture state */
+HFC_State_t HFC_GetState(const HFC_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* HF_CAPTURE_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
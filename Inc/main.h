@@ -108,6 +108,44 @@ void Error_Handler(void);
 #define M1_PWM_WH_GPIO_Port GPIOA
 
 /* USER CODE BEGIN Private defines */
+#if NBR_OF_MOTORS > 1
+/* On the 64-pin package TIM8_CH1 and TIM8_CH2 are only available on PC6 and PC7: the M1 encoder moves to the other
+   TIM3 pins, PB4 (NJTRST, free with SWD) and PB5 */
+#undef M1_ENCODER_A_Pin
+#undef M1_ENCODER_A_GPIO_Port
+#undef M1_ENCODER_B_Pin
+#undef M1_ENCODER_B_GPIO_Port
+#define M1_ENCODER_A_Pin GPIO_PIN_4
+#define M1_ENCODER_A_GPIO_Port GPIOB
+#define M1_ENCODER_B_Pin GPIO_PIN_5
+#define M1_ENCODER_B_GPIO_Port GPIOB
+
+/* Zoom axis (M2) */
+#define M2_PWM_UH_Pin GPIO_PIN_6
+#define M2_PWM_UH_GPIO_Port GPIOC
+#define M2_PWM_VH_Pin GPIO_PIN_7
+#define M2_PWM_VH_GPIO_Port GPIOC
+#define M2_PWM_WH_Pin GPIO_PIN_8
+#define M2_PWM_WH_GPIO_Port GPIOC
+#define M2_PWM_EN_U_Pin GPIO_PIN_9
+#define M2_PWM_EN_U_GPIO_Port GPIOC
+#define M2_PWM_EN_V_Pin GPIO_PIN_10
+#define M2_PWM_EN_V_GPIO_Port GPIOC
+#define M2_PWM_EN_W_Pin GPIO_PIN_11
+#define M2_PWM_EN_W_GPIO_Port GPIOC
+#define M2_DP_Pin GPIO_PIN_6
+#define M2_DP_GPIO_Port GPIOA
+#define M2_CURR_AMPL_U_Pin GPIO_PIN_7
+#define M2_CURR_AMPL_U_GPIO_Port GPIOA
+#define M2_CURR_AMPL_V_Pin GPIO_PIN_3
+#define M2_CURR_AMPL_V_GPIO_Port GPIOC
+#define M2_CURR_AMPL_W_Pin GPIO_PIN_5
+#define M2_CURR_AMPL_W_GPIO_Port GPIOC
+#define M2_ENCODER_A_Pin GPIO_PIN_6
+#define M2_ENCODER_A_GPIO_Port GPIOB
+#define M2_ENCODER_B_Pin GPIO_PIN_7
+#define M2_ENCODER_B_GPIO_Port GPIOB
+#endif
 
 /* USER CODE END Private defines */
 
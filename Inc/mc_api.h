@@ -175,6 +175,9 @@ uint16_t MC_GetCurrentFaultsMotor1(void);
 /* returns the current state of Motor 1 state machine */
 MCI_State_t  MC_GetSTMStateMotor1(void);
 
+/* returns the time from the last start command of Motor 1 to its RUN state, in microseconds */
+uint32_t MC_GetStartToTorqueTimeMotor1(void);
+
 /* returns the current power of Motor 1 in float_t format */
 float_t MC_GetAveragePowerMotor1_F(void);
 
@@ -34,6 +34,12 @@
 #include "r_divider_bus_voltage_sensor.h"
 #include "virtual_bus_voltage_sensor.h"
 #include "trajectory_ctrl.h"
+#include "setpoint_stream.h"
+#include "calib_store.h"
+#include "hf_capture.h"
+#include "freq_response.h"
+#include "current_protection.h"
+#include "motor_ident.h"
 #include "pqd_motor_power_measurement.h"
 
 #include "r3_1_l4xx_pwm_curr_fdbk.h"
@@ -42,8 +48,10 @@
 #include "hall_speed_pos_fdbk.h"
 #include "enc_align_ctrl.h"
 #include "hall_align_ctrl.h"
+#include "fused_speed_pos_fdbk.h"
 #include "ramp_ext_mngr.h"
 #include "circle_limitation.h"
+#include "flux_weakening_ctrl.h"
 
 /* USER CODE BEGIN Additional include */
 
@@ -52,10 +60,19 @@
 extern PID_Handle_t PIDSpeedHandle_M1;
 extern PID_Handle_t PIDIqHandle_M1;
 extern PID_Handle_t PIDIdHandle_M1;
+extern PID_Handle_t PIDFluxWeakeningHandle_M1;
+extern FW_Handle_t FW_M1;
 extern RegConv_t TempRegConv_M1;
 extern NTC_Handle_t TempSensor_M1;
 extern PID_Handle_t PID_PosParamsM1;
+extern BLC_Handle_t BacklashCompM1;
 extern PosCtrl_Handle_t PosCtrlM1;
+extern SPS_Handle_t SetpointStreamM1;
+extern CAL_Handle_t CalibStoreM1;
+extern HFC_Handle_t HFCaptureM1;
+extern FRA_Handle_t FreqRespM1;
+extern CPR_Handle_t CurrentProtM1;
+extern MID_Handle_t MotorIdentM1;
 
 extern PWMC_R3_1_Handle_t PWM_Handle_M1;
 
@@ -66,12 +83,32 @@ extern VirtualSpeedSensor_Handle_t VirtualSpeedSensorM1;
 extern ENCODER_Handle_t ENCODER_M1;
 extern HALL_Handle_t HALL_M1;
 extern HallAlign_Handle_t HallAlignCtrlM1;
+#ifdef M1_ENCODER_FUSION
+extern FUS_Handle_t FusedSensorM1;
+#endif
 extern EncAlign_Handle_t EncAlignCtrlM1;
 extern RegConv_t VbusRegConv_M1;
 extern RDivider_Handle_t BusVoltageSensor_M1;
 extern CircleLimitation_Handle_t CircleLimitationM1;
 extern RampExtMngr_Handle_t RampExtMngrHFParamsM1;
 
+#if NBR_OF_MOTORS > 1
+extern PID_Handle_t PIDSpeedHandle_M2;
+extern PID_Handle_t PIDIqHandle_M2;
+extern PID_Handle_t PIDIdHandle_M2;
+extern PID_Handle_t PID_PosParamsM2;
+extern PosCtrl_Handle_t PosCtrlM2;
+extern PWMC_R3_1_Handle_t PWM_Handle_M2;
+extern SpeednTorqCtrl_Handle_t SpeednTorqCtrlM2;
+extern CPR_Handle_t CurrentProtM2;
+extern PQD_MotorPowMeas_Handle_t PQD_MotorPowMeasM2;
+extern VirtualSpeedSensor_Handle_t VirtualSpeedSensorM2;
+extern ENCODER_Handle_t ENCODER_M2;
+extern EncAlign_Handle_t EncAlignCtrlM2;
+extern CircleLimitation_Handle_t CircleLimitationM2;
+extern RampExtMngr_Handle_t RampExtMngrHFParamsM2;
+#endif
+
 extern MCI_Handle_t Mci[NBR_OF_MOTORS];
 extern SpeednTorqCtrl_Handle_t *pSTC[NBR_OF_MOTORS];
 extern PID_Handle_t *pPIDIq[NBR_OF_MOTORS];
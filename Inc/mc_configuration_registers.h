@@ -118,8 +118,12 @@ typedef struct
 #define FLAG_MCP_OVER_UARTA        (1U << 1U)
 #define FLAG_MCP_OVER_UARTB        0U
 
-#define configurationFlag1_M1     (POSITION_CTRL_FLAG|VBUS_SENSING_FLAG|TEMP_SENSING_FLAG|DAC_CH1_FLAG|DAC_CH2_FLAG)
-#define configurationFlag2_M1     (DBG_MCU_LOAD_MEASURE_FLAG)
+#define configurationFlag1_M1     (FLUX_WEAKENING_FLAG|POSITION_CTRL_FLAG|VBUS_SENSING_FLAG|TEMP_SENSING_FLAG|DAC_CH1_FLAG|DAC_CH2_FLAG)
+#ifdef M1_OVERMODULATION
+#define configurationFlag2_M1     (OVERMODULATION_FLAG|DISCONTINUOUS_PWM_FLAG|DBG_MCU_LOAD_MEASURE_FLAG)
+#else
+#define configurationFlag2_M1     (DISCONTINUOUS_PWM_FLAG|DBG_MCU_LOAD_MEASURE_FLAG)
+#endif
 
 #define DRIVE_TYPE_M1              0
 #define PRIM_SENSOR_M1            EENCODER
@@ -128,6 +132,16 @@ typedef struct
 #define FOC_RATE_M1               1
 #define PWM_FREQ_M1               16000
 
+#define configurationFlag1_M2     (POSITION_CTRL_FLAG)
+#define configurationFlag2_M2     (DISCONTINUOUS_PWM_FLAG|DBG_MCU_LOAD_MEASURE_FLAG)
+
+#define DRIVE_TYPE_M2              0
+#define PRIM_SENSOR_M2            EENCODER
+#define AUX_SENSOR_M2             ENO_SENSOR
+#define TOPOLOGY_M2               0
+#define FOC_RATE_M2               1
+#define PWM_FREQ_M2               16000
+
 extern const char_t FIRMWARE_NAME[]; //cstat !MISRAC2012-Rule-18.8 !MISRAC2012-Rule-8.11
 extern const char_t CTL_BOARD[]; //cstat !MISRAC2012-Rule-18.8 !MISRAC2012-Rule-8.11
 extern const char_t *PWR_BOARD_NAME[NBR_OF_MOTORS];
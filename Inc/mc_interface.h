@@ -150,6 +150,8 @@ typedef struct
  uint16_t PastFaults;
  MCI_CommandState_t CommandState;        /*!< The status of the buffered command.*/
  MC_ControlMode_t LastModalitySetByUser; /*!< The last MC_ControlMode_t set by the user. */
+ uint32_t StartTimestamp;                /*!< Value of GLOBAL_TIMESTAMP when the last start command was accepted.*/
+ uint32_t StartToTorqueTime;             /*!< Time from the last start command to the #RUN state, in microseconds.*/
 } MCI_Handle_t;
 
 /* Exported functions ------------------------------------------------------- */
@@ -217,6 +219,8 @@ int16_t MCI_GetPhaseCurrentAmplitude(MCI_Handle_t *pHandle);
 int16_t MCI_GetPhaseVoltageAmplitude(MCI_Handle_t *pHandle);
 void MCI_Clear_Iqdref(MCI_Handle_t *pHandle);
 void MCI_Clear_PerfMeasure(MCI_Handle_t *pHandle, uint8_t bMotor);
+void MCI_StartupCompleted(MCI_Handle_t *pHandle);
+uint32_t MCI_GetStartToTorqueTime(MCI_Handle_t *pHandle);
 
 /**
   * @}
@@ -34,6 +34,12 @@ extern const R3_1_Params_t R3_1_ParamsM1;
 
 extern ScaleParams_t scaleParams_M1;
 
+#if NBR_OF_MOTORS > 1
+extern const R3_1_Params_t R3_1_ParamsM2;
+
+extern ScaleParams_t scaleParams_M2;
+#endif
+
 /* USER CODE BEGIN Additional extern */
 
 /* USER CODE END Additional extern */
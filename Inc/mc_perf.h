@@ -23,11 +23,15 @@ typedef enum
 {
   MEASURE_TSK_HighFrequencyTaskM1,
   MEASURE_TSK_MediumFrequencyTaskM1,
+#if NBR_OF_MOTORS > 1
+  MEASURE_TSK_HighFrequencyTaskM2,
+  MEASURE_TSK_MediumFrequencyTaskM2,
+#endif
 /*  Others functions to measure to be added here. */
 } MC_PERF_FUNCTIONS_LIST_t;
 
 /* Define max number of traces according to the list defined in MC_PERF_FUNCTIONS_LIST_t */
-#define  MC_PERF_NB_TRACES  2U
+#define  MC_PERF_NB_TRACES  (2U * NBR_OF_MOTORS) /* High and Medium frequency tasks of each motor */
 
 /* DWT (Data Watchpoint and Trace) registers, only exists on ARM Cortex with a DWT unit */
 /* The DWT is usually implemented in Cortex-M3 or higher, but not on Cortex-M0(+) (ie not present on G0) */
@@ -57,6 +61,8 @@ void MC_BG_Perf_Measure_Stop(MC_Perf_Handle_t *pHandle, uint8_t i);
 float_t MC_Perf_GetCPU_Load(const MC_Perf_Handle_t *pHandle);
 float_t MC_Perf_GetMaxCPU_Load(const MC_Perf_Handle_t *pHandle);
 float_t MC_Perf_GetMinCPU_Load(const MC_Perf_Handle_t *pHandle);
+float_t MC_Perf_GetAxisCPU_Load(const MC_Perf_Handle_t *pHandle, uint8_t bMotor);
+float_t MC_Perf_GetHFBudget(const MC_Perf_Handle_t *pHandle, uint8_t bMotor);
 
 #endif /* MC_PERF_H */
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
@@ -95,7 +95,10 @@
   #include "stm32l4xx_ll_opamp.h"
 
 /* Make this define visible for all projects */
+/* 1 drives the focus motor alone, 2 adds the zoom motor as M2 (TIM8, ADC2 injected, TIM4 encoder) */
+#ifndef NBR_OF_MOTORS
 #define NBR_OF_MOTORS             1
+#endif
 
 __STATIC_INLINE void LL_DMA_ClearFlag_TC(DMA_TypeDef *DMAx, uint32_t Channel)
 {
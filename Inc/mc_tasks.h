@@ -54,6 +54,10 @@ void TSK_SafetyTask(void);
 
 /* Executes the Motor Control duties that require a high frequency rate and a precise timing */
 uint8_t TSK_HighFrequencyTask(void);
+#if NBR_OF_MOTORS > 1
+/* Executes the Motor Control duties of motor 2 that require a high frequency rate and a precise timing */
+uint8_t TSK_HighFrequencyTaskM2(void);
+#endif
 
 void UI_HandleStartStopButton_cb(void);
 
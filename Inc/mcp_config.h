@@ -26,6 +26,7 @@
 #include "mcp.h"
 #include "aspep.h"
 #include "mcpa.h"
+#include "mcp_events.h"
 
 #define USARTA USART2
 #define DMA_RX_A DMA1
@@ -34,20 +35,38 @@
 #define DMACH_TX_A LL_DMA_CHANNEL_7
 
 #define MCP_USER_CALLBACK_MAX 2U
+#define MCP_REG_GROUP_MAX 4U          /* Number of register groups */
+#define MCP_REG_GROUP_ITEMS_MAX 32U   /* Number of registers in each group */
 
 #define MCP_TX_SYNC_PAYLOAD_MAX 128U
 #define MCP_RX_SYNC_PAYLOAD_MAX 128U
 #define MCP_TX_SYNCBUFFER_SIZE (MCP_TX_SYNC_PAYLOAD_MAX+ASPEP_HEADER_SIZE+ASPEP_DATACRC_SIZE)
 #define MCP_RX_SYNCBUFFER_SIZE (MCP_RX_SYNC_PAYLOAD_MAX+ASPEP_DATACRC_SIZE) // ASPEP_HEADER_SIZE is not stored in the RX buffer.
 
+/* Circular DMA reception with idle line framing, packets are parsed in place. The ring must hold at least one
+   complete request (header, payload and CRC). Comment out to re-arm the DMA for each header and payload. */
+#define ASPEP_RX_RING_SIZE 512U
+
+/* Pool of async buffers: one is filled by MCPA while the others are queued or transmitted, so that a sync answer
+   in flight does not starve the stream. Depth from 2 to ASPEP_ASYNC_POOL_MAX.
+   The payload size is the TXA maximum size negotiated with the controller, in steps of 64 bytes: 2048 bytes keeps
+   the async packets of the two buffers configuration. The pool takes MCP_TX_ASYNC_POOL_DEPTH_A times
+   MCP_TX_ASYNCBUFFER_STRIDE_A bytes of RAM, 8 KB by default. */
 #define MCP_TX_ASYNC_PAYLOAD_MAX_A 2048U
+#define MCP_TX_ASYNC_POOL_DEPTH_A 4U
 #define MCP_TX_ASYNCBUFFER_SIZE_A (MCP_TX_ASYNC_PAYLOAD_MAX_A+ASPEP_HEADER_SIZE+ASPEP_DATACRC_SIZE)
+#define MCP_TX_ASYNCBUFFER_STRIDE_A ((MCP_TX_ASYNCBUFFER_SIZE_A+3U)&~3U) /* Keeps each buffer 32 bits aligned */
 #define MCPA_OVER_UARTA_STREAM 10
 
+#define MCPE_QUEUE_SIZE_A 16U /* Events queued for UART_A, power of 2 */
+#define MCP_TX_EVENTBUFFER_SIZE_A ((MCPE_QUEUE_SIZE_A*MCPE_EVENT_SIZE)+2U+ASPEP_HEADER_SIZE+ASPEP_DATACRC_SIZE)
+
 extern ASPEP_Handle_t aspepOverUartA;
 extern MCP_Handle_t MCP_Over_UartA;
 extern MCPA_Handle_t MCPA_UART_A;
+extern MCPE_Handle_t MCPE_UART_A;
 extern MCP_user_cb_t MCP_UserCallBack[MCP_USER_CALLBACK_MAX];
+extern MCP_RegGroup_t MCP_RegGroup[MCP_REG_GROUP_MAX];
 #endif /* MCP_CONFIG_H */
 
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    mcp_events.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          MCP Events component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup MCPEvents
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MCP_EVENTS_H
+#define MCP_EVENTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "mcptl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup MCPEvents
+  * @{
+  */
+
+#define MCPE_ASYNC_ID            1U   /* Last byte of the event packets, MCPA packets end with 0 */
+#define MCPE_EVENT_SIZE          8U   /* Size of an event in the packets */
+
+/* Event classes, bit N of the MC_REG_EVENT_MASK register subscribes to class N */
+#define MCPE_CLASS_FAULT         0U   /* Code is MCPE_FAULT_xxx, Data holds the fault bits, see MC_NO_FAULTS */
+#define MCPE_CLASS_STATE         1U   /* Code is the new MCI_State_t, Data the previous one */
+#define MCPE_CLASS_MOTION        2U   /* Code is MCPE_MOTION_xxx, Data is 0 */
+
+#define MCPE_FAULT_SET           1U   /* Faults that appeared */
+#define MCPE_FAULT_CLEARED       2U   /* Faults that disappeared */
+
+#define MCPE_MOTION_TARGET_REACHED 1U /* The position control reached its target */
+
+/**
+  * @brief Event as stored in the queue and sent to the controller, little endian
+  */
+typedef struct
+{
+  uint32_t Timestamp;   /**< @brief GLOBAL_TIMESTAMP when the event was pushed */
+  uint8_t ClassMotor;   /**< @brief Class in bits 4 to 7, motor in bits 0 to 3 (0 for Motor 1) */
+  uint8_t Code;         /**< @brief Meaning depends on the class */
+  uint16_t Data;        /**< @brief Meaning depends on the class */
+} MCPE_Event_t;
+
+/**
+  * @brief Handle of an MCP Events component
+  *
+  * Events are pushed from any context, task or interrupt, into a multiple producers, single consumer ring. Slots are
+  * reserved with exclusive accesses on Head and published with their Valid flag. The ring is drained by MCPE_Exec()
+  * from the Medium Frequency Task only.
+  */
+typedef struct
+{
+  MCTL_Handle_t *pTransportLayer;     /**< @brief Transport layer the event packets are sent on */
+  MCPE_Event_t *pQueue;               /**< @brief Event ring */
+  volatile uint8_t *pValid;           /**< @brief One flag per slot, set once the event is written */
+  uint16_t QueueSize;                 /**< @brief Number of slots, power of 2 */
+  volatile uint32_t Head;             /**< @brief Number of slots reserved by the producers */
+  volatile uint32_t Tail;             /**< @brief Number of slots sent */
+  uint8_t Subscription;               /**< @brief Classes sent to the controller, bit N for class N */
+  uint16_t Dropped;                   /**< @brief Events lost because the ring was full */
+} MCPE_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Clears the event ring */
+void MCPE_Init(MCPE_Handle_t *pHandle);
+
+/* Queues an event, from any context */
+bool MCPE_Push(MCPE_Handle_t *pHandle, uint8_t eventClass, uint8_t motor, uint8_t code, uint16_t data);
+
+/* Sends the queued events, to be called by the Medium Frequency Task */
+void MCPE_Exec(MCPE_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MCP_EVENTS_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
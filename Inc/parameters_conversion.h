@@ -99,11 +99,14 @@
 #define OV_TEMPERATURE_HYSTERESIS_d            (DELTA_V_HYSTERESIS * INT_SUPPLY_VOLTAGE)
 
 #define ALIGNMENT_ANGLE_S16                    (int16_t)(M1_ALIGNMENT_ANGLE_DEG * 65536u / 360u)
+#define ALIGNMENT_ANGLE_S16_2                  (int16_t)(M2_ALIGNMENT_ANGLE_DEG * 65536u / 360u)
 #define FINAL_I_ALIGNMENT (uint16_t)(FINAL_I_ALIGNMENT_A * CURRENT_CONV_FACTOR)
 
 /*************** Timer for PWM generation & currenst sensing parameters  ******/
 #define PWM_PERIOD_CYCLES                      (uint16_t)(((uint32_t)ADV_TIM_CLK_MHz * (uint32_t)1000000u\
                                                / ((uint32_t)(PWM_FREQUENCY))) & (uint16_t)0xFFFE)
+/* Motor 2 runs at the same PWM frequency, its timer is staggered by half a period */
+#define PWM_PERIOD_CYCLES2                     PWM_PERIOD_CYCLES
 
 #define DEADTIME_NS                            HW_DEAD_TIME_NS
 
@@ -144,20 +147,30 @@
 /* USER CODE BEGIN temperature */
 
 #define M1_VIRTUAL_HEAT_SINK_TEMPERATURE_VALUE 25u
-#define M1_TEMP_SW_FILTER_BW_FACTOR            250u
+#define M1_TEMP_SW_FILTER_BW_FACTOR            256u /* Power of 2, 256 ms time constant at the safety task rate */
 
 /* USER CODE END temperature */
 
 #define PQD_CONVERSION_FACTOR                  (float_t)(((1.732 * ADC_REFERENCE_VOLTAGE) /\
                                                (RSHUNT * AMPLIFICATION_GAIN)) / 65536.0f)
 
+/* Bus voltage over the s16V full scale: sqrt(3) for the space vector modulation, pi/2 with the overmodulation where
+   32768 s16V is the fundamental of the six-step voltage */
+#ifdef M1_OVERMODULATION
+#define M1_VQD_BUS_RATIO                       1.5708
+#else
+#define M1_VQD_BUS_RATIO                       1.73205
+#endif
+#define M1_PQD_CONVERSION_FACTOR               (float_t)(((M1_VQD_BUS_RATIO * ADC_REFERENCE_VOLTAGE) /\
+                                               (RSHUNT * AMPLIFICATION_GAIN)) / 65536.0f)
+
 /****** Prepares the UI configurations according the MCconfxx settings ********/
 
 #define DAC_ENABLE | OPT_DAC
 #define DAC_OP_ENABLE | UI_CFGOPT_DAC
 
 /* Motor 1 settings */
-#define FW_ENABLE
+#define FW_ENABLE | UI_CFGOPT_FW
 
 #define DIFFTERM_ENABLE
 
@@ -193,11 +206,28 @@
 #define M1_PULSE_NBR                           ((4 * (M1_ENCODER_PPR)) - 1)
 #define M1_ENC_IC_FILTER_LL                   LL_TIM_IC_FILTER_FDIV1
 #define M1_ENC_IC_FILTER                      9
-//#define SPD_TIM_M1_IRQHandler                  TIM3_IRQHandler
+#ifdef ENC_MT_SPEED_MEASUREMENT
+#define M1_ENC_TIME_TIM                        TIM5           /* 32 bits timer timestamping the encoder edges */
+#define M1_ENC_TIME_ITR                        LL_TIM_TS_ITR1 /* TIM5 ITR1 is TIM3 TRGO */
+#else
+#define M1_ENC_TIME_TIM                        MC_NULL
+#define M1_ENC_TIME_ITR                        0U
+#endif
+#define M1_ENC_TIME_FREQ_HZ                    ((uint32_t)ADV_TIM_CLK_MHz * 1000000U) /* APB1 and APB2 at the same clock */
+#ifdef M1_ENCODER_FUSION
+#define SPD_TIM_M1_IRQHandler                  TIM3_IRQHandler
+#endif
+
+/**********  AUXILIARY ENCODER TIMER MOTOR 2 *************/
+#define M2_PULSE_NBR                           ((4 * (M2_ENCODER_PPR)) - 1)
+#define M2_ENC_IC_FILTER_LL                    LL_TIM_IC_FILTER_FDIV1
+#define M2_ENC_IC_FILTER                       9
 
 #define LPF_FILT_CONST                         ((int16_t)(32767 * 0.5))
 /* MMI Table Motor 1 MAX_MODULATION_100_PER_CENT */
 #define MAX_MODULE                             (uint16_t)((100* 32767)/100)
+#define DPWM_ENABLE_MODULE                     (uint16_t)(((uint32_t)MAX_MODULE * DPWM_ENABLE_VOLTAGE) / 1000U)
+#define DPWM_DISABLE_MODULE                    (uint16_t)(((uint32_t)MAX_MODULE * DPWM_DISABLE_VOLTAGE) / 1000U)
 
 #define SAMPLING_CYCLE_CORRECTION              0.5 /* Add half cycle required by STM32L476RGTx ADC */
 #define LL_ADC_SAMPLINGTIME_1CYCLES_5          LL_ADC_SAMPLINGTIME_1CYCLE_5
@@ -40,11 +40,17 @@
 
 #define TIMx_BRK_M1_IRQHandler TIM1_BRK_TIM15_IRQHandler
 
+#define TIMx_UP_M2_IRQHandler TIM8_UP_IRQHandler
+
+#define TIMx_BRK_M2_IRQHandler TIM8_BRK_IRQHandler
+
+#define SPD_TIM_M2_IRQHandler TIM4_IRQHandler
+
 /*************************  ADC Physical characteristics  ************/
 #define ADC_TRIG_CONV_LATENCY_CYCLES 3.5
 #define ADC_SAR_CYCLES 12.5
 
-#define M1_VBUS_SW_FILTER_BW_FACTOR      6u
+#define M1_VBUS_SW_FILTER_BW_FACTOR      6u /* Vbus faults detected within 6 ms at the safety task rate */
 
 #endif /*__PARAMETERS_CONVERSION_L4XX_H*/
 
@@ -67,5 +67,11 @@
 #define M1_ENCODER_PPR          400  /*!< Number of pulses per
                                             revolution */
 
+/***************** MOTOR 2 (zoom axis) ******************************/
+/* Electrical parameters, currents and gains are shared with motor 1 */
+#define POLE_PAIR_NUM2          2 /* Number of motor pole pairs */
+#define M2_ENCODER_PPR          400  /*!< Number of pulses per
+                                            revolution */
+
 #endif /* PMSM_MOTOR_PARAMETERS_H */
 /******************* (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
@@ -213,6 +213,11 @@ struct PWMC_Handle
                                                           *  @f$hDTCompCnt = (DT_s \cdot TimerFreq_{CLK})/2@f$ */
   uint16_t  Ton;                                       /**< Reserved. */
   uint16_t  Toff;                                      /**< Reserved. */
+  uint16_t  DPWMEnableModule;                          /**< @f$|V_{qd}|@f$ above which PWMC_DPWM_Update() enables the
+                                                            Discontinuous PWM mode, expressed in s16V. 32767 keeps the
+                                                            continuous modulation. */
+  uint16_t  DPWMDisableModule;                         /**< @f$|V_{qd}|@f$ below which PWMC_DPWM_Update() disables the
+                                                            Discontinuous PWM mode, expressed in s16V. */
   uint8_t   Motor;                                     /**< Motor reference number. */
   uint8_t   AlignFlag;                                 /**< Phase current 0 is reliable, 1 is not. */
   uint8_t   Sector;                                    /**< Space vector sector number. */
@@ -295,6 +300,15 @@ void PWMC_DPWM_ModeDisable(PWMC_Handle_t *pHandle);
 /* Returns the status of the Discontinuous PWM Mode stored in the @p pHandle PWMC component. */
 bool PWMC_GetDPWM_Mode(PWMC_Handle_t *pHandle);
 
+/* Enables or disables the Discontinuous PWM mode according to the applied voltage, with hysteresis. */
+void PWMC_DPWM_Update(PWMC_Handle_t *pHandle, qd_t Vqd);
+
+/* Sets the voltage above which the Discontinuous PWM mode is enabled, the hysteresis is kept. */
+void PWMC_DPWM_SetThreshold(PWMC_Handle_t *pHandle, uint16_t hEnableModule);
+
+/* Clamps the phase with the lowest duty cycle to the negative rail when the Discontinuous PWM mode is enabled. */
+void PWMC_DPWM_ClampLow(PWMC_Handle_t *pHandle);
+
 /* Enables the RL detection mode by calling the function in @p pHandle PWMC component. */
 void PWMC_RLDetectionModeEnable(PWMC_Handle_t *pHandle);
 
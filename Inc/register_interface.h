@@ -65,10 +65,19 @@
 #define  MC_REG_STATUS                   ((1U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_CONTROL_MODE             ((2U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_RUC_STAGE_NBR            ((3U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_POSITION_STREAM_STATE    ((4U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_HALL_INSTANT_START       ((5U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_CALIB_STORE              ((6U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_BACKLASH_STATE           ((7U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_BACKLASH_ENABLE          ((8U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_HF_CAPTURE_STATE         ((9U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_EVENT_MASK               ((10U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_DAC_MODE                 ((11U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_DAC_DECIMATION           ((12U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_PFC_STATUS               ((13U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_PFC_ENABLED              ((14U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_SC_CHECK                 ((15U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
-#define  MC_REG_SC_STATE                 ((16U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_SC_STATE                 ((16U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT) /* MID_State_t, write 1 to identify, 0 to abort */
 #define  MC_REG_SC_STEPS                 ((17U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_SC_PP                    ((18U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_SC_FOC_REP_RATE          ((19U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
@@ -82,6 +91,10 @@
 #define  MC_REG_FAST_DEMAG               ((27U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_QUASI_SYNCH              ((28U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 #define  MC_REG_PB_CHARACTERIZATION      ((29U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_FUSION_STATUS            ((30U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_FREQ_RESP_STATE          ((31U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT) /* FRA_State_t, write FRA_CMD_xxx */
+#define  MC_REG_FREQ_RESP_OFFSET         ((32U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
+#define  MC_REG_DPWM_STATE               ((33U << ELT_IDENTIFIER_POS) | TYPE_DATA_8BIT)
 
 /* TYPE_DATA_16BIT registers definition */
 #define  MC_REG_SPEED_KP                 ((2U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
@@ -188,6 +201,23 @@
 #define  MC_REG_BEMF_W                   ((111 << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
 #define  MC_REG_OVERVOLTAGETHRESHOLD     ((112U << ELT_IDENTIFIER_POS)| TYPE_DATA_16BIT )
 #define  MC_REG_UNDERVOLTAGETHRESHOLD    ((113U << ELT_IDENTIFIER_POS)| TYPE_DATA_16BIT )
+#define  MC_REG_POSITION_STREAM_LEVEL    ((114U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_POSITION_TORQUE_FF       ((115U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_POSITION_TORQUE_FB       ((116U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_HALL_AMPLITUDE           ((117U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_HALL_INSTANT_FALLBACKS   ((118U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_HF_CAPTURE_OFFSET        ((119U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_ASYNC_POOL_HIGH_WATER    ((120U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_ASYNC_POOL_DROPS         ((121U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_DAC_SCALE1               ((122U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_DAC_SCALE2               ((123U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_DAC_OFFSET1              ((124U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_DAC_OFFSET2              ((125U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_THERMAL_LOAD             ((126U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_CURRENT_LIMIT            ((127U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_FUSION_ANGLE_ERROR       ((128U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT)
+#define  MC_REG_DPWM_THRESHOLD           ((129U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT) /* s16V */
+#define  MC_REG_ASPEP_CRC_MAX_LENGTH     ((130U << ELT_IDENTIFIER_POS) | TYPE_DATA_16BIT) /* Bytes */
 
 /* TYPE_DATA_32BIT registers definition */
 #define  MC_REG_FAULTS_FLAGS             ((0 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
@@ -200,23 +230,32 @@
 #define  MC_REG_FF_1Q                    ((7 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* To check shifted by >> 16*/
 #define  MC_REG_FF_1D                    ((8 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* To check shifted by >> 16*/
 #define  MC_REG_FF_2                     ((9 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* To check shifted by >> 16*/
+#define  MC_REG_POSITION_STREAM_UNDERRUNS ((10 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_POSITION_FF_INERTIA      ((11 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_POSITION_FF_VISCOUS      ((12 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_POSITION_FF_COULOMB      ((13 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_START_TO_TORQUE_TIME     ((14 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_PERF_AXIS_CPU_LOAD       ((15 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, % of the CPU */
+#define  MC_REG_PERF_HF_BUDGET           ((16 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, % of the HF slot */
+#define  MC_REG_ASPEP_CRC_CYCLES         ((17 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* CPU cycles */
+#define  MC_REG_ASPEP_CRC_MAX_CYCLES     ((18 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* CPU cycles */
 #define  MC_REG_PFC_FAULTS               ((40 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_CURRENT_POSITION         ((41 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_PERF_CPU_LOAD            ((88 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_PERF_MIN_CPU_LOAD        ((89 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_PERF_MAX_CPU_LOAD        ((90 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_RS                    ((91 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_LS                    ((92 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_KE                    ((93 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_VBUS                  ((94 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_SC_RS                    ((91 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, ohms */
+#define  MC_REG_SC_LS                    ((92 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, henries */
+#define  MC_REG_SC_KE                    ((93 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, Vrms ph-ph per krpm */
+#define  MC_REG_SC_VBUS                  ((94 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, volts */
 #define  MC_REG_SC_MEAS_NOMINALSPEED     ((95 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_CURRENT               ((96 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_SPDBANDWIDTH          ((97 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_SC_CURRENT               ((96 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, test current in amperes */
+#define  MC_REG_SC_SPDBANDWIDTH          ((97 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, Hz */
 #define  MC_REG_SC_LDLQRATIO             ((98 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_SC_NOMINAL_SPEED         ((99 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_CURRBANDWIDTH         ((100 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_J                     ((101 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
-#define  MC_REG_SC_F                     ((102 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
+#define  MC_REG_SC_CURRBANDWIDTH         ((100 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, Hz */
+#define  MC_REG_SC_J                     ((101 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, kg.m^2 */
+#define  MC_REG_SC_F                     ((102 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT) /* Float, Coulomb friction in N.m */
 #define  MC_REG_SC_MAX_CURRENT           ((103 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_SC_STARTUP_SPEED         ((104 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
 #define  MC_REG_SC_STARTUP_ACC           ((105 << ELT_IDENTIFIER_POS) | TYPE_DATA_32BIT)
@@ -234,11 +273,17 @@
 #define  MC_REG_APPLICATION_CONFIG       ((2U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_FOCFW_CONFIG             ((3U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_SCALE_CONFIG             ((4U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_POSITION_STREAM          ((5U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_SPEED_RAMP               ((6U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_TORQUE_RAMP              ((7U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_REVUP_DATA               ((8U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW) /* Configure all steps*/
+#define  MC_REG_BACKLASH_TABLE           ((9U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_HF_CAPTURE_CONFIG        ((10U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_HF_CAPTURE_DATA          ((11U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_CURRENT_REF              ((13U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_POSITION_RAMP            ((14U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_FREQ_RESP_CONFIG         ((15U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
+#define  MC_REG_FREQ_RESP_DATA           ((16U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_ASYNC_UARTA              ((20U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_ASYNC_UARTB              ((21U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_ASYNC_STLNK              ((22U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
@@ -248,17 +293,49 @@
 #define  MC_REG_BEMF_ADC_CONFIG          ((31U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 #define  MC_REG_BEMF_ONTIME_ADC_CONFIG   ((32U << ELT_IDENTIFIER_POS) | TYPE_DATA_RAW)
 
+/* Access rights and value location of the 8, 16 and 32 bits registers */
+#define RI_ACCESS_NONE                   0x00U /* Known register, written with MCP_ERROR_RO_REG and read with MCP_ERROR_UNKNOWN_REG */
+#define RI_ACCESS_READ                   0x01U
+#define RI_ACCESS_WRITE                  0x02U
+#define RI_ACCESS_RW                     (RI_ACCESS_READ | RI_ACCESS_WRITE)
+#define RI_WRITE_UNKNOWN                 0x04U /* Read only register written with MCP_ERROR_UNKNOWN_REG instead of MCP_ERROR_RO_REG */
+#define RI_VALUE_FOCVARS                 0x80U /* The value is located in the FOC variables of pObj (MCI handle) */
+
+typedef void (*RI_GetFct_t)(void *pObj, uint8_t *data);
+typedef uint8_t (*RI_SetFct_t)(void *pObj, const uint8_t *data);
+
+/**
+  * @brief Descriptor of an 8, 16 or 32 bits register. The descriptor tables are sorted by regID.
+  */
+typedef struct
+{
+  uint16_t regID;       /**< @brief Register ID, type included */
+  uint8_t flags;        /**< @brief Access rights and value location, see RI_ACCESS_xxx and #RI_VALUE_FOCVARS */
+  uint16_t offset;      /**< @brief Offset of the value in the FOC variables, used with #RI_VALUE_FOCVARS */
+  void *pValue;         /**< @brief Variable holding the value, NULL if there is none */
+  void *pObj;           /**< @brief Component handed to the accessors */
+  RI_GetFct_t getFct;   /**< @brief Reads the value, NULL to copy it from the variable */
+  RI_SetFct_t setFct;   /**< @brief Writes the value, NULL to copy it to the variable */
+} RI_Register_t;
+
 uint8_t RI_SetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable);
 
 uint8_t RI_SetRegisterMotor1(uint16_t regID,  uint8_t typeID,uint8_t *data, uint16_t *size, int16_t dataAvailable);
+#if NBR_OF_MOTORS > 1
+uint8_t RI_SetRegisterMotor2(uint16_t regID,  uint8_t typeID,uint8_t *data, uint16_t *size, int16_t dataAvailable);
+#endif
 
 uint8_t RI_GetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t * data, uint16_t *size, int16_t freeSpace);
 
 uint8_t RI_GetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t * data, uint16_t *size, int16_t freeSpace);
+#if NBR_OF_MOTORS > 1
+uint8_t RI_GetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t * data, uint16_t *size, int16_t freeSpace);
+#endif
 
 uint8_t RI_MovString(const char_t * srcString, char_t * destString, uint16_t *size, int16_t maxSize);
 
 uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr);
+uint8_t RI_GetDirectPtr(uint8_t motorID, uint16_t regID, void **dataPtr);
 uint8_t RI_GetIDSize(uint16_t dataID);
 
 #endif /* REGISTER_INTERFACE_H */
@@ -0,0 +1,134 @@
+
+/**
+  ******************************************************************************
+  * @file    setpoint_stream.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Setpoint Stream component of the Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup SetpointStream
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SETPOINT_STREAM_H
+#define SETPOINT_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "trajectory_ctrl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup PositionControl
+  * @{
+  */
+
+/** @addtogroup SetpointStream
+  * @{
+  */
+
+/* Block flags, see SPS_WriteBlock() */
+#define SPS_FLAG_SPEED    0x01U  /* Each sample carries a speed feed-forward (float, rad/s) */
+#define SPS_FLAG_TORQUE   0x02U  /* Each sample carries a torque feed-forward (int16, digit) */
+#define SPS_FLAG_ABORT    0x20U  /* Stops the stream and holds the current position, the rest of the block is ignored */
+#define SPS_FLAG_LAST     0x40U  /* Last block of the stream, no underrun is reported after it */
+#define SPS_FLAG_RESTART  0x80U  /* Flushes the buffer and starts a new stream with this block */
+
+#define SPS_BLOCK_HEADER_SIZE 8U
+
+typedef enum
+{
+  SPS_IDLE     = 0,  /**< No stream programmed. */
+  SPS_PREFILL  = 1,  /**< Stream programmed, waiting for the buffer to reach the prefill level. */
+  SPS_PLAYING  = 2,  /**< Setpoints are interpolated and fed to the position controller. */
+  SPS_UNDERRUN = 3,  /**< Buffer ran empty before the last block, last position is held. */
+  SPS_DONE     = 4,  /**< Last block has been played, last position is held. */
+} SPS_State_t;
+
+/**
+  * @brief Setpoint stored in the stream buffer
+  */
+typedef struct
+{
+  float Position;    /**< @brief Mechanical position, expressed in radians */
+  float Speed;       /**< @brief Mechanical speed, expressed in rad/s */
+  int16_t TorqueFF;  /**< @brief Torque feed-forward, expressed in digit */
+} SPS_Sample_t;
+
+/**
+  * @brief Handle of a Setpoint Stream component
+  */
+typedef struct
+{
+  PosCtrl_Handle_t *pPosCtrl;      /**< @brief Position controller fed by the stream */
+  SPS_Sample_t *pBuffer;           /**< @brief Sample ring buffer */
+  uint16_t BufferSize;             /**< @brief Number of samples of the ring buffer (power of 2) */
+  uint16_t PrefillLevel;           /**< @brief Number of buffered samples required to start playing */
+  volatile uint16_t WriteIndex;    /**< @brief Free running index of the next sample to write */
+  volatile uint16_t ReadIndex;     /**< @brief Free running index of the segment start sample */
+  uint16_t Level;                  /**< @brief Number of buffered samples, updated for the asynchronous log */
+  uint32_t NextTimestamp;          /**< @brief Timestamp expected for the next received sample */
+  uint16_t SamplePeriod;           /**< @brief Sample period of the stream, expressed in MF ticks */
+  uint16_t Phase;                  /**< @brief Position inside the current segment, expressed in MF ticks */
+  uint8_t Flags;                   /**< @brief Flags of the stream, set by its first block */
+  volatile bool AbortRequest;      /**< @brief Set by an abort block, served by the next SPS_Exec() */
+  SPS_State_t State;               /**< @brief Playback state */
+  uint32_t Underruns;              /**< @brief Number of times the buffer ran empty while playing */
+  uint32_t Overruns;               /**< @brief Number of samples dropped because the buffer was full */
+  uint32_t Discontinuities;        /**< @brief Number of timestamp gaps detected between blocks */
+} SPS_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Setpoint Stream component */
+void SPS_Init(SPS_Handle_t *pHandle, PosCtrl_Handle_t *pPosCtrl);
+
+/* Flushes the buffer and stops the stream */
+void SPS_Clear(SPS_Handle_t *pHandle);
+
+/* Stores a block of setpoints received from the host */
+uint8_t SPS_WriteBlock(SPS_Handle_t *pHandle, const uint8_t *pData, uint16_t size);
+
+/* Interpolates the next setpoint and feeds it to the position controller */
+void SPS_Exec(SPS_Handle_t *pHandle);
+
+/* Returns the number of samples waiting in the buffer */
+uint16_t SPS_GetLevel(const SPS_Handle_t *pHandle);
+
+/* Returns the playback state */
+SPS_State_t SPS_GetState(const SPS_Handle_t *pHandle);
+
+/* Returns the number of underruns */
+uint32_t SPS_GetUnderruns(const SPS_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* SETPOINT_STREAM_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    backlash_comp.h
+  * @author  LenseDrive
+  * @brief   This file provides all definitions and functions prototypes for the
+  *          the Backlash Compensation component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup BacklashComp
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef BACKLASH_COMP_H
+#define BACKLASH_COMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup PositionControl
+  * @{
+  */
+
+/** @addtogroup BacklashComp
+  * @{
+  */
+
+/* Size of the MC_REG_BACKLASH_TABLE header: TableSize (u8), reserved (u8), Hysteresis, TakeUpRate and
+   EngageTorque (int16), PositionMin and PositionMax (float). The table (int16) follows. */
+#define BLC_TABLE_HEADER_SIZE 16U
+
+typedef enum
+{
+  BLC_LEARN_IDLE     = 0,  /**< No learning in progress. */
+  BLC_LEARN_PRELOAD  = 1,  /**< Moving below the current table point, ahead of the approach. */
+  BLC_LEARN_APPROACH = 2,  /**< Approaching the table point in the positive direction. */
+  BLC_LEARN_SETTLE   = 3,  /**< Holding the table point, the positive flank is engaged. */
+  BLC_LEARN_REVERSE  = 4,  /**< Reversing until the negative flank is engaged. */
+  BLC_LEARN_DONE     = 5,  /**< All table points have been measured, compensation is enabled. */
+  BLC_LEARN_ERROR    = 6,  /**< No flank engaged within the approach distance, compensation is disabled. */
+} BLC_LearnState_t;
+
+/**
+  * @brief Handle of a Backlash Compensation component
+  */
+typedef struct
+{
+  int16_t *pTable;                 /**< @brief Backlash measured at each table point, expressed in s16 mechanical
+                                               angle of the motor shaft */
+  uint8_t TableSize;               /**< @brief Number of table points, evenly spread from PositionMin to
+                                               PositionMax */
+  float PositionMin;               /**< @brief Position of the first table point, expressed in radians */
+  float PositionMax;               /**< @brief Position of the last table point, expressed in radians */
+  int16_t Hysteresis;              /**< @brief Reversal of the reference needed to switch flank, expressed in s16
+                                               mechanical angle */
+  int16_t TakeUpRate;              /**< @brief Maximum change of the correction per call, expressed in s16
+                                               mechanical angle */
+  bool Enable;                     /**< @brief Compensation is applied to the position reference */
+
+  int32_t TableStart;              /**< @brief PositionMin, expressed in s16 mechanical angle */
+  int32_t TableStep;               /**< @brief Distance between two table points, expressed in s16 mechanical
+                                               angle */
+  int8_t Direction;                /**< @brief Flank currently engaged: 1 when moving forward, -1 backward, 0 if
+                                               not known yet */
+  bool RefValid;                   /**< @brief RefExtremum has been initialized */
+  int32_t RefExtremum;             /**< @brief Furthest reference reached in the current direction */
+  int32_t Offset;                  /**< @brief Correction currently added to the reference */
+
+  int16_t EngageTorque;            /**< @brief Position PID output detecting the flank contact while learning,
+                                               expressed in digit */
+  float LearnSpeed;                /**< @brief Reference speed while learning, expressed in rad/s */
+  float LearnApproach;             /**< @brief Approach distance, also the largest backlash that can be learnt,
+                                               expressed in radians */
+  uint16_t SettleTicks;            /**< @brief Duration of the settle phase, expressed in calls */
+  float SamplingTime;              /**< @brief Period of the calls, expressed in seconds */
+  BLC_LearnState_t LearnState;     /**< @brief State of the learning routine */
+  uint8_t LearnIndex;              /**< @brief Table point being measured */
+  uint16_t LearnCounter;           /**< @brief Calls remaining in the settle phase */
+  float LearnRef;                  /**< @brief Position reference generated by the learning routine */
+  float LearnStart;                /**< @brief Measured position at the end of the settle phase */
+} BLC_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Backlash Compensation component */
+void BLC_Init(BLC_Handle_t *pHandle);
+
+/* Resets the engaged flank and the applied correction */
+void BLC_Clear(BLC_Handle_t *pHandle);
+
+/* Returns the correction to add to the position reference */
+int32_t BLC_CalcOffset(BLC_Handle_t *pHandle, int32_t wMecAngleRef);
+
+/* Starts measuring the backlash table with reversal tests */
+void BLC_StartLearning(BLC_Handle_t *pHandle, float Position);
+
+/* Aborts the learning routine */
+void BLC_StopLearning(BLC_Handle_t *pHandle);
+
+/* Runs one step of the learning routine and returns the position reference to apply */
+bool BLC_LearnExec(BLC_Handle_t *pHandle, float Position, int16_t TorqueFB, float *pRef, float *pSpeed);
+
+/* Returns the state of the learning routine */
+BLC_LearnState_t BLC_GetLearnState(const BLC_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* BACKLASH_COMP_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file    current_protection.h
+  * @author  LenseDrive
+  * @brief   This file provides all definitions and functions prototypes for the
+  *          the Current Protection component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup CurrentProtection
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CURRENT_PROTECTION_H
+#define CURRENT_PROTECTION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "speed_torq_ctrl.h"
+#include "flux_weakening_ctrl.h"
+#include "pid_regulator.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup CurrentProtection
+  * @{
+  */
+
+#define CPR_SQUARE_SHIFT 8U   /* Right shift of the squared currents accumulated by the High Frequency Task */
+
+/**
+  * @brief Handle of a Current Protection component
+  */
+typedef struct
+{
+  SpeednTorqCtrl_Handle_t *pSTC;   /**< @brief Speed and torque controller whose torque limits are derated */
+  FW_Handle_t *pFW;                /**< @brief Flux weakening component whose current circle follows the torque
+                                               limit, MC_NULL if the motor has none */
+  PID_Handle_t *pPIDPos;           /**< @brief Position regulator whose torque output is derated, MC_NULL if the
+                                               motor has none */
+  uint16_t OCThreshold;            /**< @brief Software overcurrent threshold on the Iqd magnitude, expressed in
+                                               s16A */
+  uint8_t OCDebounce;              /**< @brief Consecutive samples above OCThreshold that raise MC_OVER_CURR */
+  uint16_t PeakCurrent;            /**< @brief Torque limit of a cold motor, expressed in s16A */
+  uint16_t NominalCurrent;         /**< @brief Continuous current rating, expressed in s16A. It is the torque
+                                               limit once the thermal load reaches 1 */
+  float WindingTau;                /**< @brief Thermal time constant of the winding node, expressed in seconds */
+  float HousingTau;                /**< @brief Thermal time constant of the housing node, expressed in seconds */
+  float HousingShare;              /**< @brief Part of the steady state heating across the housing node,
+                                               from 0 to 1 */
+  float DeratingStart;             /**< @brief Thermal load above which the torque limit is derated, from 0 to 1 */
+  uint16_t ThermalFrequencyHz;     /**< @brief Call rate of CPR_CalcThermal(), expressed in Hz */
+
+  uint32_t OCThresholdSquare;      /**< @brief OCThreshold squared */
+  uint8_t OCCount;                 /**< @brief Consecutive samples above OCThreshold */
+  volatile uint32_t SquareSum;     /**< @brief Free running sum of the squared Iqd magnitudes, shifted right by
+                                               CPR_SQUARE_SHIFT */
+  volatile uint32_t SquareCount;   /**< @brief Free running number of samples in SquareSum */
+  uint32_t LastSquareSum;          /**< @brief SquareSum at the previous CPR_CalcThermal() call */
+  uint32_t LastSquareCount;        /**< @brief SquareCount at the previous CPR_CalcThermal() call */
+  float NominalSquare;             /**< @brief NominalCurrent squared, shifted right by CPR_SQUARE_SHIFT */
+  float WindingAlpha;              /**< @brief Coefficient of the winding node first order filter */
+  float HousingAlpha;              /**< @brief Coefficient of the housing node first order filter */
+  float WindingRise;               /**< @brief Heating of the winding over the housing, relative to the thermal
+                                               limit */
+  float HousingRise;               /**< @brief Heating of the housing over the ambient, relative to the thermal
+                                               limit */
+  uint16_t ThermalLoad;            /**< @brief Heating of the winding over the ambient, relative to the thermal
+                                               limit, expressed in per mille */
+  uint16_t CurrentLimit;           /**< @brief Torque limit applied to the speed and torque controller, expressed
+                                               in s16A */
+} CPR_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Current Protection component, the motor is assumed cold */
+void CPR_Init(CPR_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC);
+
+/* Checks the current magnitude and accumulates its square, to be called by the High Frequency Task */
+uint16_t CPR_CheckCurrent(CPR_Handle_t *pHandle, qd_t Iqd);
+
+/* Updates the thermal model and derates the torque limits, to be called by the Medium Frequency Task */
+void CPR_CalcThermal(CPR_Handle_t *pHandle);
+
+/* Returns the thermal load, in per mille of the thermal limit */
+uint16_t CPR_GetThermalLoad(const CPR_Handle_t *pHandle);
+
+/* Returns the torque limit, in s16A */
+uint16_t CPR_GetCurrentLimit(const CPR_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* CURRENT_PROTECTION_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
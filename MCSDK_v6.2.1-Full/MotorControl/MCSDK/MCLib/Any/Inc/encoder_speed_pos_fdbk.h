@@ -47,6 +47,7 @@ extern "C" {
 #define GPIO_NoRemap_TIMx ((uint32_t)(0))
 #define ENC_DMA_PRIORITY DMA_Priority_High
 #define ENC_SPEED_ARRAY_SIZE  ((uint8_t)16)    /* 2^4 */
+#define ENC_EDGE_COUNTS       4U                /* Counts between two rising edges of channel A */
 
 /**
   * @brief  ENCODER class parameters definition
@@ -76,6 +77,21 @@ typedef struct
   volatile uint8_t DeltaCapturesIndex;               /*!< Buffer index */
   bool TimerOverflowError;                           /*!< true if the number of overflow  occurred is greater than
                                                           'define' ENC_MAX_OVERFLOW_NB*/
+
+  /* M/T speed measurement */
+  TIM_TypeDef *TimeTIMx;                             /*!< 32 bits timer that timestamps the rising edges of channel A,
+                                                          captured on the trigger output of TIMx. MC_NULL selects
+                                                          the averaging of the DeltaCapturesBuffer instead */
+  uint32_t TimeITR;                                  /*!< Internal trigger of TimeTIMx connected to TIMx TRGO */
+  uint32_t TimeFrequencyHz;                          /*!< Clock frequency of TimeTIMx, expressed in Hz */
+  uint16_t EdgeTimeoutMs;                            /*!< Time without edge after which the speed is zero,
+                                                          expressed in ms */
+  uint32_t EdgeTimeout;                              /*!< EdgeTimeoutMs, expressed in TimeTIMx ticks */
+  float MTConvFactor;                                /*!< Speed of one count per TimeTIMx tick, expressed in the
+                                                          unit defined by #SPEED_UNIT */
+  uint32_t LastEdgeTime;                             /*!< TimeTIMx capture of the last edge processed */
+  uint16_t LastEdgeCount;                            /*!< TIMx capture of the last edge processed */
+  bool LastEdgeValid;                                /*!< false until an edge has been processed */
 } ENCODER_Handle_t;
 
 
@@ -30,6 +30,7 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "mc_type.h"
 #include "pid_regulator.h"
+#include "speed_pos_fdbk.h"
 /** @addtogroup MCSDK
   * @{
   */
@@ -65,6 +66,15 @@ typedef struct
                                                definition. */
   uint16_t        hVqdLowPassFilterBWLOG; /**< @brief hVqdLowPassFilterBW expressed as power of 2.
                                                E.g. if gain divisor is 512 the value must be 9 because 2^9 = 512. */
+  SpeednPosFdbk_Handle_t *pSPD;           /**< @brief Speed sensor, used to bound the flux weakening current to the
+                                               one giving the smallest stator voltage. MC_NULL if only
+                                               hDemagCurrent applies. */
+  float           Rs;                     /**< @brief Stator resistance, expressed in ohms. */
+  float           Ls;                     /**< @brief Stator inductance, expressed in henries. */
+  float           Flux;                   /**< @brief Magnet flux linkage, expressed in webers. */
+  float           ElSpeedConv;            /**< @brief Electrical speed in rad/s per unit of mechanical speed
+                                               (#SPEED_UNIT). */
+  float           CurrentConv;            /**< @brief Current conversion factor, expressed in s16A per ampere. */
 } FW_Handle_t;
 
 /* Exported functions ------------------------------------------------------- */
@@ -84,6 +94,11 @@ void FW_Clear(FW_Handle_t *pHandle);
   */
 qd_t FW_CalcCurrRef(FW_Handle_t *pHandle, qd_t Iqdref);
 
+/**
+  * Sets the radius of the current circle, which Iqref is saturated to
+  */
+void FW_SetNominalCurrent(FW_Handle_t *pHandle, uint16_t hNominalCurrent);
+
 /**
   * Applies a low-pass filter on both  Vqd voltage components
   */
@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    fused_speed_pos_fdbk.h
+  * @author  LenseDrive
+  * @brief   This file contains all definitions and functions prototypes for the
+  *          Fused Hall & Encoder Speed & Position Feedback component of the
+  *          Motor Control SDK.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup FusedSpeednPosFdbk
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FUSED_SPEEDNPOSFDBK_H
+#define FUSED_SPEEDNPOSFDBK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "speed_pos_fdbk.h"
+#include "hall_speed_pos_fdbk.h"
+#include "encoder_speed_pos_fdbk.h"
+#include "hall_align_ctrl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @addtogroup FusedSpeednPosFdbk
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+#define FUS_STATUS_ENCODER_FAULT  ((uint8_t)0x01) /* The encoder disagrees with the hall sensors, it is ignored */
+#define FUS_STATUS_HALL_UNUSABLE  ((uint8_t)0x02) /* The hall angle is not plausible or its phase shift unknown */
+
+/**
+  * @brief  Fused Hall & Encoder class parameters definition
+  */
+typedef struct
+{
+  SpeednPosFdbk_Handle_t _Super;        /*!< SpeednPosFdbk handle definition. */
+  HALL_Handle_t *pHALL;                 /*!< Analog hall sensors, giving the absolute electrical angle. */
+  ENCODER_Handle_t *pENC;               /*!< Quadrature encoder, giving the incremental motion. */
+  HallAlign_Handle_t *pHAC;             /*!< Hall alignment controller, that knows if the hall phase shift is
+                                             calibrated. */
+  uint16_t SpeedSamplingFreqHz;         /*!< Frequency (Hz) at which FUS_CalcAvrgMecSpeedUnit() is called. */
+  float HallGain;                       /*!< Part of the hall angle error corrected at each hall sample, from 0 to 1.
+                                             The time constant of the correction is 1 / HallGain hall samples. */
+  int16_t MaxAngleError;                /*!< Largest hall angle error consistent with the encoder, expressed in
+                                             s16degree [(rotor angle unit)](measurement_units.md). */
+  uint16_t MaxErrorSamples;             /*!< Consecutive inconsistent hall samples after which the encoder is
+                                             declared faulty. */
+
+  int32_t PrevEncMecAngle;              /*!< Encoder wMecAngle at the previous FUS_CalcAngle() call. */
+  int16_t PrevElAngle;                  /*!< hElAngle at the previous FUS_CalcAvrgMecSpeedUnit() call. */
+  int16_t ElResidual;                   /*!< Electrical angle variation not yet converted to mechanical angle. */
+  uint16_t HallSampleCount;             /*!< SampleCount of the last hall sample used. */
+  uint16_t ErrorSamples;                /*!< Consecutive hall samples with an error larger than MaxAngleError. */
+  int16_t HallAngleError;               /*!< Last hall angle error, expressed in s16degree. */
+  uint8_t Status;                       /*!< Degradation status, see FUS_STATUS_xxx. */
+} FUS_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the fused sensor */
+void FUS_Init(FUS_Handle_t *pHandle);
+
+/* Restarts the fusion from the hall angle if usable, from the encoder angle otherwise */
+void FUS_Clear(FUS_Handle_t *pHandle);
+
+/* Updates both sensors and fuses the electrical and mechanical angles, to be called by the High Frequency Task */
+int16_t FUS_CalcAngle(FUS_Handle_t *pHandle);
+
+/* Computes the average mechanical speed and checks the sensors, to be called by the Medium Frequency Task */
+bool FUS_CalcAvrgMecSpeedUnit(FUS_Handle_t *pHandle, int16_t *pMecSpeedUnit);
+
+/* Returns the degradation status */
+uint8_t FUS_GetStatus(const FUS_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* FUSED_SPEEDNPOSFDBK_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
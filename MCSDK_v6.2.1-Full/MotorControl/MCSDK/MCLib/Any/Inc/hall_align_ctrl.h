@@ -33,6 +33,7 @@ extern "C" {
 #include "speed_torq_ctrl.h"
 #include "virtual_speed_sensor.h"
 #include "hall_speed_pos_fdbk.h"
+#include "encoder_speed_pos_fdbk.h"
 
 /** @addtogroup MCSDK
   * @{
@@ -65,6 +66,13 @@ typedef struct
   uint16_t hDurationms;                 /*!< Duration of the programmed alignment expressed in milliseconds.*/
   uint8_t bElToMecRatio;                /*!< Coefficient used to transform electrical to mechanical quantities and
                                              vice-versa. It usually coincides with motor pole pairs number. */
+  ENCODER_Handle_t *pENC;               /*!< Encoder seeded from the hall angle by an instant alignment,
+                                             MC_NULL when the hall sensors are the only position sensor. */
+  bool InstantStart;                    /*!< This flag is true if the alignment is replaced by the absolute hall
+                                             angle whenever it is plausible. */
+  uint16_t InstantFallbacks;            /*!< Number of instant alignments rejected by the hall plausibility checks. */
+  bool HallCalibrated;                  /*!< This flag is true if the hall phase shift has been measured by a timed
+                                             alignment or restored from the calibration store. */
 } HallAlign_Handle_t;
 
 
@@ -77,6 +85,12 @@ void HAC_Init(HallAlign_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC, Virtua
 /* Function used to start the encoder alignment procedure */
 void HAC_StartAlignment(HallAlign_Handle_t *pHandle);
 
+/* Function used to align the encoder on the absolute hall angle, without timed alignment */
+bool HAC_InstantAlignment(HallAlign_Handle_t *pHandle);
+
+/* Function used to restore a hall phase shift measured by a previous alignment */
+void HAC_SetHallPhaseShift(HallAlign_Handle_t *pHandle, int16_t hPhaseShift);
+
 /* Function used to execute the hall alignment controller */
 bool HAC_Exec(HallAlign_Handle_t *pHandle);
 
@@ -38,6 +38,9 @@ extern "C" {
 #define DEGREES_60 1u
 #define HALL_SIZE   3u
 
+/* Number of consecutive plausible samples required to trust the absolute angle */
+#define HALL_MIN_VALID_SAMPLES ((uint8_t)16)
+
 
 typedef struct
 {
@@ -121,6 +124,30 @@ typedef struct
 
   int16_t mech_Angle; 
 
+  uint16_t Amplitude;    /*!< Amplitude of the alpha-beta vector of the hall
+                              signals, expressed in ADC counts.*/
+
+  uint16_t MinAmplitude; /*!< Lower bound of a plausible hall vector amplitude,
+                              expressed in ADC counts.*/
+
+  uint16_t MaxAmplitude; /*!< Upper bound of a plausible hall vector amplitude,
+                              expressed in ADC counts.*/
+
+  volatile uint8_t ValidSamples; /*!< Number of consecutive samples with a
+                              plausible amplitude (saturated).*/
+
+  volatile uint16_t SampleCount; /*!< Free running number of hall samples
+                              processed, tells a new sample from the last one.*/
+
+  int16_t PrevElAngle;   /*!< Electrical angle of the last plausible sample,
+                              used to accumulate the mechanical angle.*/
+
+  int16_t ElAngleRemainder; /*!< Electrical angle not yet accounted for in
+                              the mechanical angle.*/
+
+  int16_t SpeedPrevElAngle; /*!< Electrical angle at the previous speed
+                              computation.*/
+
   //SpeednTorqCtrl_Handle_t *pSTC;
   //VirtualSpeedSensor_Handle_t *pVSS;
                                                      
@@ -140,4 +167,6 @@ bool HALL_CalcAvrgMecSpeedUnit(HALL_Handle_t *pHandle, int16_t *pMecSpeedUnit);
 
 void HALL_SetMecAngle(HALL_Handle_t *pHandle, int16_t hMecAngle);
 
+bool HALL_GetAbsoluteElAngle(const HALL_Handle_t *pHandle, int16_t *pElAngle);
+
 #endif
\ No newline at end of file
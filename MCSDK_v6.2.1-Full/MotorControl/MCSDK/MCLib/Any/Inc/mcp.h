@@ -46,6 +46,9 @@
 #define PFC_FAULT_ACK                    0x60
 #define PROFILER_CMD                     0x68
 #define SW_RESET                         0x78
+#define REG_GROUP_DEFINE                 0x80
+#define REG_GROUP_GET                    0x88
+#define REG_GROUP_SET                    0x90
 #define MCP_USER_CMD                     0x100U
 
 /* MCP ERROR CODE */
@@ -89,6 +92,29 @@
 typedef uint8_t (*MCP_user_cb_t)(uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength,
                                  uint8_t *txBuffer);
 
+/**
+  * @brief  Register of a register group, decoded once when the group is defined
+  */
+typedef struct
+{
+  void *dataPtr;                      /** Value read directly, NULL if read through the register getter */
+  uint16_t regID;                     /** Register ID without type and motor */
+  uint8_t typeID;                     /** Register type */
+  uint8_t motorID;                    /** 0 for global registers, motor number otherwise */
+  uint8_t size;                       /** Size of the value in the packed payload */
+} MCP_RegGroupItem_t;
+
+/**
+  * @brief  Register group, read or written with a single command
+  */
+typedef struct
+{
+  MCP_RegGroupItem_t *pItems;         /** Registers of the group */
+  uint8_t maxItems;                   /** Size of the pItems table */
+  uint8_t nbrOfItems;                 /** Number of registers defined, 0 if the group is not defined */
+  uint16_t size;                      /** Size of the packed payload */
+} MCP_RegGroup_t;
+
 /**
   * @brief  Handle structure for MCP related components
   */
@@ -27,6 +27,13 @@
 
 extern uint32_t GLOBAL_TIMESTAMP;
 
+/* Encoding of the HF values, optional last byte of the MCPA_cfgLog() configuration */
+#define MCPA_ENCODING_RAW           0U  /* 2 bytes per HF value */
+#define MCPA_ENCODING_DELTA_VARINT  1U  /* Zig-zag varint of the delta to the previous sample, 1 to 3 bytes */
+#define MCPA_ENCODING_BIT_PACKED    2U  /* Predicted values, residuals packed on a fixed width per buffer */
+#define MCPA_VARINT_MAX_SIZE        3U  /* Largest encoding of a 16 bits value */
+#define MCPA_PACKED_MAX_SIZE        4U  /* Largest bit packed value: escape code and raw value, 31 bits */
+
 /** @addtogroup MCSDK
   * @{
   */
@@ -36,6 +43,19 @@ extern uint32_t GLOBAL_TIMESTAMP;
   */
 
 
+/**
+  * @brief  Bit packing state of a HF value.
+  */
+typedef struct
+{
+  uint16_t last;                      /** Previous sample. */
+  uint16_t delta;                     /** Previous difference between two samples. */
+  uint16_t residualMax[2];            /** Largest zig-zag residual of the 1st and 2nd order predictions in the
+                                          current buffer, they set the width of the next one. */
+  uint8_t width;                      /** Width of the residuals in the current buffer, in bits. */
+  uint8_t order;                      /** Prediction order in the current buffer, 1 or 2. */
+} MCPA_Packing_t;
+
 /**
   * @brief  MCP asynchronous parameters handle.
   *
@@ -49,10 +69,15 @@ typedef struct
   void ** dataPtrTableBuff;           /** Buffered version of dataPtrTable. */
   uint8_t *dataSizeTable;             /** Table containing the sizes of the values to be returned.*/
   uint8_t *dataSizeTableBuff;         /** Buffered version of dataSizeTable. */
+  uint16_t *lastValueTable;           /** Previous sample of each HF value, reference of the delta encoding. */
+  MCPA_Packing_t *packingTable;       /** Bit packing state of each HF value, NULL if not supported. */
   uint8_t *currentBuffer;             /** Current buffer allocated. */
   uint16_t bufferIndex;               /** Index of the position inside the bufer, a new buffer is allocated when bufferIndex = 0. */
   uint16_t bufferTxTrigger;           /** Threshold upon which data is dumped. */
   uint16_t bufferTxTriggerBuff;       /** Buffered version of bufferTxTrigger. */
+  uint16_t packedFrames;              /** Number of frames in the current bit packed buffer. */
+  uint32_t packedBits;                /** Bits waiting for a complete byte, bit packed encoding. */
+  uint8_t packedBitCount;             /** Number of bits in packedBits. */
 #ifdef MCP_DEBUG_METRICS
   uint16_t bufferMissed;              /** Incremented each time a buffer is missed. Debug only. */
 #endif
@@ -69,11 +94,13 @@ typedef struct
   uint8_t MFNumBuff;                  /** Buffered version of MFNum. */
   uint8_t Mark;                       /** Configuration of the ASYNC communication. */
   uint8_t MarkBuff;                   /** Buffered version of Mark. */
+  uint8_t Encoding;                   /** Encoding of the HF values, see MCPA_ENCODING_xxx. */
+  uint8_t EncodingBuff;               /** Buffered version of Encoding. */
 } MCPA_Handle_t; /* MCP Async handle type */
 
 
 void MCPA_dataLog(MCPA_Handle_t *pHandle);
-uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata);
+uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata, uint16_t cfgSize);
 void MCPA_flushDataLog (MCPA_Handle_t *pHandle);
 
 #endif /* MCPA_H */
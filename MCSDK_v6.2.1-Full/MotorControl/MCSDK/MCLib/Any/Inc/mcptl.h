@@ -28,6 +28,7 @@
 
 #define MCTL_SYNC  ( uint8_t )0xAU
 #define MCTL_ASYNC ( uint8_t )0x9U
+#define MCTL_EVENT ( uint8_t )0x1U /* Asynchronous packet sent before the pending MCTL_ASYNC ones */
 #define MCTL_SYNC_NOT_EXPECTED 1
 
 
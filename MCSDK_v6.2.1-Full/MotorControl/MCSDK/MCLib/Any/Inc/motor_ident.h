@@ -0,0 +1,162 @@
+/**
+  ******************************************************************************
+  * @file    motor_ident.h
+  * @author  LenseDrive
+  * @brief   This file provides all definitions and functions prototypes for the
+  *          the Motor Identification component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup MotorIdent
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MOTOR_IDENT_H
+#define MOTOR_IDENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mc_type.h"
+#include "pid_regulator.h"
+#include "bus_voltage_sensor.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup MotorIdent
+  * @{
+  */
+
+typedef enum
+{
+  MID_IDLE             = 0,  /**< No identification in progress, nor done since the boot. */
+  MID_ARMED            = 1,  /**< Waiting for the motor to reach the RUN state. */
+  MID_RESISTANCE_LOW   = 2,  /**< DC current at half the test current, on the alpha axis. */
+  MID_RESISTANCE_HIGH  = 3,  /**< DC current at the test current, on the alpha axis. */
+  MID_INDUCTANCE       = 4,  /**< AC voltage injected over the DC current of the previous step. */
+  MID_MECHANICAL       = 5,  /**< Torque pulses measuring the flux and the inertia, the current loops are tuned. */
+  MID_DONE             = 6,  /**< Parameters identified, all the loops are tuned. */
+  MID_ERROR_RESISTANCE = 7,  /**< The test current could not be reached or gave a non-positive resistance. */
+  MID_ERROR_INDUCTANCE = 8,  /**< The AC impedance is not consistent with the resistance. */
+  MID_ERROR_MECHANICAL = 9,  /**< The rotor did not move enough to measure the flux or the inertia. */
+  MID_ABORTED          = 10, /**< Stopped by a stop command or a fault before completion. */
+} MID_State_t;
+
+/**
+  * @brief Handle of a Motor Identification component
+  */
+typedef struct
+{
+  PID_Handle_t *pPIDIq;            /**< @brief Iq current regulator, tuned at the end of the inductance step */
+  PID_Handle_t *pPIDId;            /**< @brief Id current regulator, tuned at the end of the inductance step */
+  PID_Handle_t *pPIDSpeed;         /**< @brief Speed regulator, tuned at the end of the mechanical step */
+  BusVoltageSensor_Handle_t *pVBS; /**< @brief Bus voltage sensor, to convert the voltages into volts */
+  float CurrentConv;               /**< @brief Current conversion factor, expressed in s16A per ampere */
+  float BusRatio;                  /**< @brief Bus voltage over the full scale of the applied voltage: sqrt(3), or
+                                               pi/2 with the overmodulation */
+  float NominalRs;                 /**< @brief Expected stator resistance, expressed in ohms. Only sets the gain of
+                                               the DC current regulation */
+  uint8_t PolePairs;               /**< @brief Number of pole pairs of the motor */
+  uint16_t SpeedUnit;              /**< @brief Speed unit of the speed regulator, see #SPEED_UNIT */
+  uint16_t HFFrequencyHz;          /**< @brief Call rate of MID_CalcVoltage(), expressed in Hz */
+  uint16_t MFFrequencyHz;          /**< @brief Call rate of MID_Exec() and of the speed regulator, expressed in Hz */
+  uint16_t InjectionFrequencyHz;   /**< @brief Frequency of the AC voltage of the inductance step, expressed in
+                                               Hz */
+  uint16_t SettleTicks;            /**< @brief Duration of the settling phase of each electrical step, expressed in
+                                               MID_Exec() calls */
+  uint16_t MeasureTicks;           /**< @brief Duration of the measurement window of each electrical step,
+                                               expressed in MID_Exec() calls */
+  uint16_t PulseTicks;             /**< @brief Duration of each torque pulse of the mechanical step, expressed in
+                                               MID_Exec() calls */
+  float TestCurrent;               /**< @brief DC current of the resistance step, expressed in amperes */
+  float TorqueCurrent;             /**< @brief Iq current of the torque pulses, expressed in amperes */
+  float CurrentBandwidth;          /**< @brief Target bandwidth of the current loops, expressed in Hz */
+  float SpeedBandwidth;            /**< @brief Target bandwidth of the speed loop, expressed in Hz */
+
+  volatile bool Injecting;         /**< @brief MID_CalcVoltage() replaces the current regulators */
+  int16_t Vdc;                     /**< @brief DC voltage applied on the alpha axis, expressed in s16V */
+  int16_t Vac;                     /**< @brief Amplitude of the AC voltage applied on the alpha axis, expressed in
+                                               s16V */
+  int16_t Angle;                   /**< @brief Phase of the AC voltage, expressed in s16degree */
+  int16_t AngleStep;               /**< @brief Phase increment of the AC voltage per MID_CalcVoltage() call */
+  volatile uint32_t SumI;          /**< @brief Free running sum of Ialpha, expressed in s16A */
+  volatile uint32_t SumIcos;       /**< @brief Free running sum of Ialpha times the cosine of the AC voltage */
+  volatile uint32_t SumIsin;       /**< @brief Free running sum of Ialpha times the sine of the AC voltage */
+  volatile uint32_t SampleCount;   /**< @brief Free running number of samples in the sums */
+  uint32_t LastSumI;               /**< @brief SumI at the previous MID_Exec() call */
+  uint32_t LastCount;              /**< @brief SampleCount at the previous MID_Exec() call */
+  uint32_t StartSumI;              /**< @brief SumI at the start of the measurement window */
+  uint32_t StartSumIcos;           /**< @brief SumIcos at the start of the measurement window */
+  uint32_t StartSumIsin;           /**< @brief SumIsin at the start of the measurement window */
+  uint32_t StartCount;             /**< @brief SampleCount at the start of the measurement window */
+  MID_State_t State;               /**< @brief State of the identification */
+  uint16_t Counter;                /**< @brief MID_Exec() calls since the start of the current step */
+  float VdcRef;                    /**< @brief Output of the DC current regulation, expressed in s16V */
+  float LowVoltage;                /**< @brief Voltage measured at half the test current, expressed in volts */
+  float LowCurrent;                /**< @brief Current measured at half the test current, expressed in amperes */
+  float Speed[4];                  /**< @brief Speed at the boundaries of the torque pulses, expressed in rad/s */
+  float FluxNum;                   /**< @brief Sum of the back-EMF times the electrical speed */
+  float FluxDen;                   /**< @brief Sum of the squared electrical speed */
+
+  float BusVoltage;                /**< @brief Bus voltage at the end of the last step, expressed in volts */
+  float Rs;                        /**< @brief Identified stator resistance, expressed in ohms */
+  float Ls;                        /**< @brief Identified stator inductance, expressed in henries */
+  float Flux;                      /**< @brief Identified magnet flux linkage, expressed in webers */
+  float Inertia;                   /**< @brief Identified inertia, expressed in kg.m^2 */
+  float Friction;                  /**< @brief Identified Coulomb friction torque, expressed in N.m */
+} MID_Handle_t;
+
+/* Exported functions ------------------------------------------------------- */
+
+/* Initializes the Motor Identification component */
+void MID_Init(MID_Handle_t *pHandle);
+
+/* Arms the identification, it starts when the motor reaches the RUN state */
+void MID_Start(MID_Handle_t *pHandle);
+
+/* Aborts the identification, to be called when the PWM is switched off */
+void MID_Stop(MID_Handle_t *pHandle);
+
+/* Returns true from MID_Start() until the identification is completed or fails */
+bool MID_IsRunning(const MID_Handle_t *pHandle);
+
+/* Returns true while MID_CalcVoltage() replaces the current regulators */
+bool MID_IsInjecting(const MID_Handle_t *pHandle);
+
+/* Returns the test voltages and accumulates the current, to be called by the High Frequency Task */
+alphabeta_t MID_CalcVoltage(MID_Handle_t *pHandle, alphabeta_t Ialphabeta);
+
+/* Runs one step of the identification and returns the current references, to be called by the Medium Frequency
+   Task in the RUN state */
+qd_t MID_Exec(MID_Handle_t *pHandle, qd_t Vqd, qd_t Iqd, int16_t hMecSpeedUnit);
+
+/* Returns the state of the identification */
+MID_State_t MID_GetState(const MID_Handle_t *pHandle);
+
+/* Returns the identified voltage constant, in Vrms phase to phase per krpm */
+float MID_GetKe(const MID_Handle_t *pHandle);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif /* __cpluplus */
+
+#endif /* MOTOR_IDENT_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -39,6 +39,9 @@ extern "C" {
   */
 
 
+#define NTC_TABLE_SIZE  33U   /* Entries of the temperature table, for u16Celsius values 0, 2048, ..., 65536 */
+#define NTC_TABLE_SHIFT 11U   /* log2 of the u16Celsius step between two entries of the temperature table */
+
 /**
   * @brief Structure used for temperature monitoring
   *
@@ -61,7 +64,9 @@ typedef struct
 
   uint16_t hLowPassFilterBW;        /**< used to configure the first order software filter bandwidth.
                                          hLowPassFilterBW = NTC_CalcBusReading
-                                         call rate [Hz]/ FilterBandwidth[Hz]. */
+                                         call rate [Hz]/ FilterBandwidth[Hz].
+                                         It is the time constant of the filter, in calls of NTC_CalcAvTemp,
+                                         and is rounded down to a power of 2. */
   uint16_t hOverTempThreshold;      /**< Represents the over voltage protection intervention threshold.
                                          This parameter is expressed in u16Celsius through formula:
                                          hOverTempThreshold =
@@ -79,6 +84,11 @@ typedef struct
                                          Used in through formula: V[V]=V0+dV/dT[V/°C]*(T-T0)[°C] */
   uint16_t hT0;                     /**< T0 temperature constant value used to convert the temperature into Volts
                                          Used in through formula: V[V]=V0+dV/dT[V/°C]*(T-T0)[°C] */
+  const int16_t *pTempTable;        /**< Temperatures in Celsius for the u16Celsius values i << NTC_TABLE_SHIFT,
+                                         with i from 0 to NTC_TABLE_SIZE - 1. When MC_NULL, the linear model
+                                         given by hSensitivity, wV0 and hT0 is used. */
+  uint32_t wAvTempSum;              /**< State of the software filter, hAvTemp_d << bLowPassFilterShift. */
+  uint8_t bLowPassFilterShift;      /**< log2 of hLowPassFilterBW, computed by NTC_Init. */
   uint8_t convHandle;                /*!< handle to the regular conversion. */
 
 } NTC_Handle_t;
@@ -50,10 +50,10 @@ extern "C" {
 typedef struct
 {
   BusVoltageSensor_Handle_t _Super;          /*!< Bus voltage sensor component handle. */
-  uint16_t       LowPassFilterBW;            /*!< Use this number to configure the Vbus
-                                                  first order software filter bandwidth.
-                                                  hLowPassFilterBW = VBS_CalcBusReading
-                                                  call rate [Hz]/ FilterBandwidth[Hz] */
+  uint16_t       LowPassFilterBW;            /*!< Length of the Vbus moving average, in
+                                                  samples. A step of the bus voltage is fully
+                                                  seen by the fault detection after
+                                                  LowPassFilterBW calls of RVBS_CalcAvVbus. */
   uint16_t       OverVoltageThreshold;       /*!< It represents the over voltage protection
                                                   intervention threshold. To be expressed
                                                   in digital value through formula:
@@ -75,6 +75,7 @@ typedef struct
                                                   Under Voltage Threshold (V) * 65536
                                                   / hConversionFactor */
   uint16_t       *aBuffer;                   /*!< Buffer used to compute average value.*/
+  uint32_t       SumBuffer;                  /*!< Running sum of the aBuffer elements.*/
   uint8_t        elem;                       /*!< Number of stored elements in the average buffer.*/
   uint8_t        index;                      /*!< Index of last stored element in the average buffer.*/
   uint8_t        convHandle;                 /*!< handle to the regular conversion */
@@ -34,6 +34,7 @@ extern "C" {
 #include "speed_torq_ctrl.h"
 #include "enc_align_ctrl.h"
 #include "hall_align_ctrl.h"
+#include "backlash_comp.h"
 
 #define RADTOS16 10430.378350470452725f             /* 2^15/Pi */
 
@@ -57,7 +58,8 @@ typedef enum
   TC_READY_FOR_COMMAND  = 0,
   TC_MOVEMENT_ON_GOING = 1,
   TC_TARGET_POSITION_REACHED = 2,
-  TC_FOLLOWING_ON_GOING = 3
+  TC_FOLLOWING_ON_GOING = 3,
+  TC_STREAMING_ON_GOING = 4
 } PosCtrlStatus_t;
 
 typedef enum
@@ -99,6 +101,20 @@ typedef struct
   bool PositionControlRegulation;      /**< @brief Flag to activate the position control regulation */
   bool EncoderAbsoluteAligned;         /**< @brief Flag to indicate that absolute zero alignment is done */
   int16_t MecAngleOffset;              /**< @brief Store rotor mechanical angle offset */
+  int16_t TorqueFeedForward;           /**< @brief Torque feed-forward added to the position PID output, expressed
+                                                   in digit */
+  float InertiaFF;                     /**< @brief Acceleration feed-forward gain (inertia), expressed in
+                                                   digit/(rad/s^2) */
+  float ViscousFF;                     /**< @brief Speed feed-forward gain (viscous friction), expressed in
+                                                   digit/(rad/s) */
+  float CoulombFF;                     /**< @brief Coulomb friction feed-forward applied in the direction of the
+                                                   speed, expressed in digit */
+  float CoulombDeadband;               /**< @brief Reference speed below which the Coulomb friction feed-forward
+                                                   is not applied, expressed in rad/s */
+  int16_t TorqueRefFF;                 /**< @brief Feed-forward contribution of the last torque reference */
+  int16_t TorqueRefFB;                 /**< @brief Feedback (PID) contribution of the last torque reference */
+  int32_t RefPerturbation;             /**< @brief Perturbation added to the position reference by the frequency
+                                                   response analyser, expressed in s16degree */
   uint32_t TcTick;                     /**< @brief Tick counter in follow mode */
   float SysTickPeriod;                 /**< @brief Time base of follow mode */
 
@@ -111,6 +127,8 @@ typedef struct
   HALL_Handle_t* pHALL;                /* */
   SpeednTorqCtrl_Handle_t *pSTC;       /**< @brief Speed and torque controller object used by the Position Regulator */
   PID_Handle_t *PIDPosRegulator;       /**< @brief PID controller object used by the Position Regulator */
+  BLC_Handle_t *pBacklash;             /**< @brief Backlash compensation applied to the position reference, MC_NULL
+                                                   if none */
 } PosCtrl_Handle_t;
 
 /* Exported functions ------------------------------------------------------- */
@@ -130,6 +148,9 @@ bool TC_MoveCommand(PosCtrl_Handle_t *pHandle, float startingAngle, float angleS
 /* Follows an angular position command */
 void TC_FollowCommand(PosCtrl_Handle_t *pHandle, float Angle);
 
+/* Applies a setpoint computed by an external trajectory generator */
+void TC_StreamCommand(PosCtrl_Handle_t *pHandle, float Angle, float Speed, float Acceleration, int16_t TorqueFF);
+
 /* Proceeds on the position control loop */
 void TC_PositionRegulation(PosCtrl_Handle_t *pHandle);
 
@@ -163,6 +184,18 @@ PosCtrlStatus_t TC_GetControlPositionStatus(PosCtrl_Handle_t *pHandle);
 /* Returns the status after the rotor alignment phase */
 AlignStatus_t TC_GetAlignmentStatus(PosCtrl_Handle_t *pHandle);
 
+/* Sets the feed-forward gains of the position controller */
+void TC_SetFeedForwardGains(PosCtrl_Handle_t *pHandle, float Inertia, float Viscous, float Coulomb);
+
+/* Returns the feed-forward contribution of the torque reference */
+int16_t TC_GetTorqueRefFF(PosCtrl_Handle_t *pHandle);
+
+/* Returns the feedback contribution of the torque reference */
+int16_t TC_GetTorqueRefFB(PosCtrl_Handle_t *pHandle);
+
+/* Sets the perturbation added to the position reference */
+void TC_SetRefPerturbation(PosCtrl_Handle_t *pHandle, int32_t Perturbation);
+
 /* Increments Tick counter used in follow mode */
 void TC_IncTick(PosCtrl_Handle_t *pHandle);
 
@@ -40,6 +40,9 @@ bool UASPEP_SEND_PACKET(void *pHWHandle, void *data, uint16_t length);
 void UASPEP_RECEIVE_BUFFER(void *pHWHandle, void *buffer, uint16_t length);
 void UASPEP_INIT(void *pHWHandle);
 void UASPEP_IDLE_ENABLE(void *pHWHandle);
+void UASPEP_RECEIVE_CIRCULAR(void *pHWHandle, void *buffer, uint16_t length);
+uint16_t UASPEP_RX_REMAINING(void *pHWHandle);
+bool UASPEP_DATA_CRC(void *pHWHandle, const uint8_t *data, uint16_t length, uint16_t *crc);
 
 #endif
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
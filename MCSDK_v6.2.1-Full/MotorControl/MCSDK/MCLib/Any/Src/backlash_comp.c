@@ -0,0 +1,525 @@
+/**
+  ******************************************************************************
+  * @file    backlash_comp.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the Backlash
+  *          Compensation component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup BacklashComp
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "backlash_comp.h"
+#include "trajectory_ctrl.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup PositionControl
+  * @{
+  */
+
+/**
+  * @defgroup BacklashComp Backlash Compensation
+  *
+  * @brief Direction aware correction of the position reference for geared axes
+  *
+  * The gear backlash seen from the motor shaft is stored in a table indexed by position. When the
+  * reference moves forward, the motor has to lead the load by half the local backlash, and lag it by
+  * the same amount when moving backward. The flank switch is detected on the reference, with an
+  * hysteresis so that noise on a still reference does not toggle it, and the correction is slewed at
+  * TakeUpRate to cross the gap without a torque step.
+  *
+  * The table can be learnt with reversal tests: each point is approached in the positive direction,
+  * then the reference is reversed slowly until the position PID output reaches EngageTorque, which
+  * means that the opposite flank is in contact. The distance travelled by the motor is the backlash.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Initializes the Backlash Compensation component.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  */
+void BLC_Init(BLC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_BLC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->TableStart = (int32_t)(pHandle->PositionMin * RADTOS16);
+    if (pHandle->TableSize > 1U)
+    {
+      pHandle->TableStep = (int32_t)(((pHandle->PositionMax - pHandle->PositionMin) * RADTOS16)
+                                     / (float)(pHandle->TableSize - 1U));
+    }
+    else
+    {
+      pHandle->TableStep = 0;
+    }
+    if (pHandle->TableStep < 1)
+    {
+      /* Degenerated table: the first point applies to all positions */
+      pHandle->TableStep = 1;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pHandle->LearnState = BLC_LEARN_IDLE;
+    BLC_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+}
+
+/**
+  * @brief  Resets the engaged flank and the applied correction.
+  *
+  * The flank is detected again on the next moves of the reference.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  */
+void BLC_Clear(BLC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_BLC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Direction = 0;
+    pHandle->RefValid = false;
+    pHandle->RefExtremum = 0;
+    pHandle->Offset = 0;
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the backlash interpolated from the table at a given position.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  * @param  wMecAngle position, expressed in s16 mechanical angle.
+  * @retval Backlash, expressed in s16 mechanical angle.
+  */
+static int32_t BLC_Interpolate(const BLC_Handle_t *pHandle, int32_t wMecAngle)
+{
+  int32_t wBacklash;
+  int32_t wRel = wMecAngle - pHandle->TableStart;
+  int32_t wIndex;
+  int32_t wFrac;
+
+  if ((0U == pHandle->TableSize) || (MC_NULL == pHandle->pTable))
+  {
+    wBacklash = 0;
+  }
+  else if (wRel <= 0)
+  {
+    wBacklash = pHandle->pTable[0];
+  }
+  else
+  {
+    wIndex = wRel / pHandle->TableStep;
+    if (wIndex >= ((int32_t)pHandle->TableSize - 1))
+    {
+      wBacklash = pHandle->pTable[pHandle->TableSize - 1U];
+    }
+    else
+    {
+      wFrac = wRel - (wIndex * pHandle->TableStep);
+      wBacklash = pHandle->pTable[wIndex]
+                + (((pHandle->pTable[wIndex + 1] - pHandle->pTable[wIndex]) * wFrac) / pHandle->TableStep);
+    }
+  }
+  return (wBacklash);
+}
+
+/**
+  * @brief  Returns the correction to add to the position reference.
+  *
+  * Shall be called at each position loop period, with the reference produced by the trajectory.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  * @param  wMecAngleRef position reference, expressed in s16 mechanical angle.
+  * @retval Correction, expressed in s16 mechanical angle.
+  */
+int32_t BLC_CalcOffset(BLC_Handle_t *pHandle, int32_t wMecAngleRef)
+{
+  int32_t wTarget;
+  int32_t wDelta;
+  int32_t wHysteresis;
+
+#ifdef NULL_PTR_CHECK_BLC
+  if (MC_NULL == pHandle)
+  {
+    wTarget = 0;
+  }
+  else
+  {
+#endif
+    wHysteresis = pHandle->Hysteresis;
+
+    /* Flank detection on the reference */
+    if (false == pHandle->RefValid)
+    {
+      pHandle->RefExtremum = wMecAngleRef;
+      pHandle->RefValid = true;
+    }
+    else if (pHandle->Direction > 0)
+    {
+      if (wMecAngleRef > pHandle->RefExtremum)
+      {
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else if ((pHandle->RefExtremum - wMecAngleRef) > wHysteresis)
+      {
+        pHandle->Direction = -1;
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else if (pHandle->Direction < 0)
+    {
+      if (wMecAngleRef < pHandle->RefExtremum)
+      {
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else if ((wMecAngleRef - pHandle->RefExtremum) > wHysteresis)
+      {
+        pHandle->Direction = 1;
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Flank not known yet, waits for the first move larger than the hysteresis */
+      if ((wMecAngleRef - pHandle->RefExtremum) > wHysteresis)
+      {
+        pHandle->Direction = 1;
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else if ((pHandle->RefExtremum - wMecAngleRef) > wHysteresis)
+      {
+        pHandle->Direction = -1;
+        pHandle->RefExtremum = wMecAngleRef;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+
+    if ((false == pHandle->Enable)
+        || ((pHandle->LearnState >= BLC_LEARN_PRELOAD) && (pHandle->LearnState <= BLC_LEARN_REVERSE)))
+    {
+      wTarget = 0;
+    }
+    else
+    {
+      wTarget = (pHandle->Direction * BLC_Interpolate(pHandle, wMecAngleRef)) / 2;
+    }
+
+    /* Crosses the gap at the take-up rate */
+    wDelta = wTarget - pHandle->Offset;
+    if ((pHandle->TakeUpRate > 0) && (wDelta > pHandle->TakeUpRate))
+    {
+      wDelta = pHandle->TakeUpRate;
+    }
+    else if ((pHandle->TakeUpRate > 0) && (wDelta < -pHandle->TakeUpRate))
+    {
+      wDelta = -pHandle->TakeUpRate;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pHandle->Offset += wDelta;
+    wTarget = pHandle->Offset;
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+  return (wTarget);
+}
+
+/**
+  * @brief  Starts measuring the backlash table with reversal tests.
+  *
+  * The motor must be running in position control. The compensation is suspended while learning.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  * @param  Position current position reference, expressed in radians.
+  */
+void BLC_StartLearning(BLC_Handle_t *pHandle, float Position)
+{
+#ifdef NULL_PTR_CHECK_BLC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((pHandle->TableSize > 0U) && (pHandle->LearnSpeed > 0.0f) && (pHandle->LearnApproach > 0.0f))
+    {
+      pHandle->LearnIndex = 0U;
+      pHandle->LearnRef = Position;
+      pHandle->LearnState = BLC_LEARN_PRELOAD;
+      BLC_Clear(pHandle);
+    }
+    else
+    {
+      pHandle->LearnState = BLC_LEARN_ERROR;
+    }
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+}
+
+/**
+  * @brief  Aborts the learning routine.
+  *
+  * The points already measured are kept, the compensation is disabled.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  */
+void BLC_StopLearning(BLC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_BLC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((BLC_LEARN_IDLE == pHandle->LearnState) || (BLC_LEARN_DONE == pHandle->LearnState)
+        || (BLC_LEARN_ERROR == pHandle->LearnState))
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      pHandle->Enable = false;
+      pHandle->LearnState = BLC_LEARN_IDLE;
+    }
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+}
+
+/**
+  * @brief  Moves the learning reference toward a target at the learning speed.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  * @param  Target position to reach, expressed in radians.
+  * @param  pSpeed returns the reference speed, expressed in rad/s.
+  * @retval true when the target is reached.
+  */
+static bool BLC_MoveTo(BLC_Handle_t *pHandle, float Target, float *pSpeed)
+{
+  float fStep = pHandle->LearnSpeed * pHandle->SamplingTime;
+  bool reached = false;
+
+  if ((Target - pHandle->LearnRef) > fStep)
+  {
+    pHandle->LearnRef += fStep;
+    *pSpeed = pHandle->LearnSpeed;
+  }
+  else if ((pHandle->LearnRef - Target) > fStep)
+  {
+    pHandle->LearnRef -= fStep;
+    *pSpeed = -pHandle->LearnSpeed;
+  }
+  else
+  {
+    pHandle->LearnRef = Target;
+    *pSpeed = 0.0f;
+    reached = true;
+  }
+  return (reached);
+}
+
+/**
+  * @brief  Runs one step of the learning routine.
+  *
+  * Shall be called at each position loop period before TC_PositionRegulation(). While it returns
+  * true, the returned reference must be applied to the position controller.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  * @param  Position measured motor position, expressed in radians.
+  * @param  TorqueFB last output of the position PID, expressed in digit.
+  * @param  pRef returns the position reference, expressed in radians.
+  * @param  pSpeed returns the reference speed, expressed in rad/s.
+  * @retval true while the learning routine drives the position reference.
+  */
+bool BLC_LearnExec(BLC_Handle_t *pHandle, float Position, int16_t TorqueFB, float *pRef, float *pSpeed)
+{
+  bool active = true;
+  float fPoint;
+  float fBacklash;
+
+#ifdef NULL_PTR_CHECK_BLC
+  if ((MC_NULL == pHandle) || (MC_NULL == pRef) || (MC_NULL == pSpeed))
+  {
+    active = false;
+  }
+  else
+  {
+#endif
+    if (pHandle->TableSize > 1U)
+    {
+      fPoint = pHandle->PositionMin + (((pHandle->PositionMax - pHandle->PositionMin) * (float)pHandle->LearnIndex)
+                                       / (float)(pHandle->TableSize - 1U));
+    }
+    else
+    {
+      fPoint = pHandle->PositionMin;
+    }
+    *pSpeed = 0.0f;
+
+    switch (pHandle->LearnState)
+    {
+      case BLC_LEARN_PRELOAD:
+      {
+        if (BLC_MoveTo(pHandle, fPoint - pHandle->LearnApproach, pSpeed))
+        {
+          pHandle->LearnState = BLC_LEARN_APPROACH;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case BLC_LEARN_APPROACH:
+      {
+        if (BLC_MoveTo(pHandle, fPoint, pSpeed))
+        {
+          pHandle->LearnCounter = pHandle->SettleTicks;
+          pHandle->LearnState = BLC_LEARN_SETTLE;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case BLC_LEARN_SETTLE:
+      {
+        if (pHandle->LearnCounter > 0U)
+        {
+          pHandle->LearnCounter--;
+        }
+        else
+        {
+          pHandle->LearnStart = Position;
+          pHandle->LearnState = BLC_LEARN_REVERSE;
+        }
+        break;
+      }
+
+      case BLC_LEARN_REVERSE:
+      {
+        if (TorqueFB <= -pHandle->EngageTorque)
+        {
+          /* Opposite flank engaged */
+          fBacklash = (pHandle->LearnStart - Position) * RADTOS16;
+          if (fBacklash < 0.0f)
+          {
+            fBacklash = 0.0f;
+          }
+          else if (fBacklash > (float)INT16_MAX)
+          {
+            fBacklash = (float)INT16_MAX;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          pHandle->pTable[pHandle->LearnIndex] = (int16_t)fBacklash;
+          pHandle->LearnIndex++;
+
+          /* Releases the contact force */
+          pHandle->LearnRef = Position;
+          if (pHandle->LearnIndex >= pHandle->TableSize)
+          {
+            pHandle->Enable = true;
+            pHandle->LearnState = BLC_LEARN_DONE;
+            BLC_Clear(pHandle);
+          }
+          else
+          {
+            pHandle->LearnState = BLC_LEARN_PRELOAD;
+          }
+        }
+        else if ((pHandle->LearnStart - pHandle->LearnRef) > pHandle->LearnApproach)
+        {
+          pHandle->LearnRef = Position;
+          pHandle->Enable = false;
+          pHandle->LearnState = BLC_LEARN_ERROR;
+        }
+        else
+        {
+          pHandle->LearnRef -= pHandle->LearnSpeed * pHandle->SamplingTime;
+          *pSpeed = -pHandle->LearnSpeed;
+        }
+        break;
+      }
+
+      default:
+      {
+        active = false;
+        break;
+      }
+    }
+    *pRef = pHandle->LearnRef;
+#ifdef NULL_PTR_CHECK_BLC
+  }
+#endif
+  return (active);
+}
+
+/**
+  * @brief  Returns the state of the learning routine.
+  * @param  pHandle handler of the current instance of the Backlash Compensation component.
+  */
+BLC_LearnState_t BLC_GetLearnState(const BLC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_BLC
+  return ((MC_NULL == pHandle) ? BLC_LEARN_IDLE : pHandle->LearnState);
+#else
+  return (pHandle->LearnState);
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
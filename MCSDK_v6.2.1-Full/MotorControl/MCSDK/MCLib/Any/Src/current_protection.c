@@ -0,0 +1,357 @@
+/**
+  ******************************************************************************
+  * @file    current_protection.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the Current
+  *          Protection component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup CurrentProtection
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "current_protection.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup CurrentProtection Current Protection
+  *
+  * @brief Software overcurrent check and thermal derating of the torque limits
+  *
+  * At each FOC cycle, the magnitude of the measured Iqd current is compared with a software threshold, below
+  * the hardware overcurrent protection. MC_OVER_CURR is raised after OCDebounce consecutive samples above it.
+  * The squared magnitude is also accumulated, which is all the High Frequency Task has to do for the thermal
+  * model.
+  *
+  * The Medium Frequency Task turns the mean square current into the heating of a two-node thermal model: the
+  * winding node, with a short time constant, over the housing node, with a long one. Both are expressed
+  * relative to the thermal limit, reached in steady state at the nominal current. The motor can then take
+  * bursts up to PeakCurrent while it is cold: above DeratingStart, the torque limits of the speed and torque
+  * controller are linearly derated down to NominalCurrent, reached at the thermal limit.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Limits the output and the integral term of a regulator whose output is a torque reference.
+  * @param  pPID regulator to limit.
+  * @param  limit torque limit, expressed in s16A.
+  */
+static void CPR_LimitRegulator(PID_Handle_t *pPID, uint16_t limit)
+{
+  PID_SetUpperOutputLimit(pPID, (int16_t)limit);
+  PID_SetLowerOutputLimit(pPID, -(int16_t)limit);
+  PID_SetUpperIntegralTermLimit(pPID, (int32_t)limit * (int32_t)pPID->hKiDivisor);
+  PID_SetLowerIntegralTermLimit(pPID, -(int32_t)limit * (int32_t)pPID->hKiDivisor);
+}
+
+/**
+  * @brief  Clamps the torque reference of the speed and torque controller in torque mode.
+  *
+  * STC_ExecRamp() refuses the targets beyond the torque limits, but neither the reference already applied
+  * nor a ramp started before the derating are checked by STC_CalcTorqueReference(). The target of the ramp
+  * is clamped, and the ramp is stopped at the limit when its next step would cross it.
+  *
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  */
+static void CPR_ClampTorqueRef(CPR_Handle_t *pHandle)
+{
+  SpeednTorqCtrl_Handle_t *pSTC = pHandle->pSTC;
+
+  if (MCM_TORQUE_MODE == pSTC->Mode)
+  {
+    int32_t limit = (int32_t)pHandle->CurrentLimit;
+    int32_t nextRef = pSTC->TorqueRef;
+
+    if (pSTC->RampRemainingStep > 1U)
+    {
+      nextRef += pSTC->IncDecAmount;
+    }
+    else
+    {
+      /* The reference is not ramped, or its last step applies TargetFinal */
+    }
+
+    if ((int32_t)pSTC->TargetFinal > limit)
+    {
+      pSTC->TargetFinal = (int16_t)limit;
+    }
+    else if ((int32_t)pSTC->TargetFinal < -limit)
+    {
+      pSTC->TargetFinal = -(int16_t)limit;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (nextRef > (limit * 65536))
+    {
+      STC_StopRamp(pSTC);
+      pSTC->TorqueRef = limit * 65536;
+    }
+    else if (nextRef < (-limit * 65536))
+    {
+      STC_StopRamp(pSTC);
+      pSTC->TorqueRef = -limit * 65536;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* In speed mode the torque reference is the output of the speed regulator, already limited */
+  }
+}
+
+/**
+  * @brief  Applies a torque limit to the speed and torque controller, to its active torque reference, to its
+  *         speed regulator, to the position regulator and to the flux weakening current circle.
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  * @param  limit torque limit, expressed in s16A.
+  */
+static void CPR_ApplyLimit(CPR_Handle_t *pHandle, uint16_t limit)
+{
+  pHandle->CurrentLimit = limit;
+  STC_SetNominalCurrent(pHandle->pSTC, limit);
+  CPR_ClampTorqueRef(pHandle);
+  CPR_LimitRegulator(pHandle->pSTC->PISpeed, limit);
+  if (pHandle->pPIDPos != MC_NULL)
+  {
+    CPR_LimitRegulator(pHandle->pPIDPos, limit);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if (pHandle->pFW != MC_NULL)
+  {
+    FW_SetNominalCurrent(pHandle->pFW, limit);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Initializes the Current Protection component, the motor is assumed cold.
+  *
+  * Must be called after STC_Init(), the torque limits are set to PeakCurrent.
+  *
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  * @param  pSTC speed and torque controller whose torque limits are derated.
+  */
+void CPR_Init(CPR_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC)
+{
+#ifdef NULL_PTR_CHECK_CPR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float frequency = (float)pHandle->ThermalFrequencyHz;
+
+    pHandle->pSTC = pSTC;
+    pHandle->OCThresholdSquare = (uint32_t)pHandle->OCThreshold * pHandle->OCThreshold;
+    pHandle->OCCount = 0U;
+    pHandle->NominalSquare = (float)(((uint32_t)pHandle->NominalCurrent * pHandle->NominalCurrent)
+                                     >> CPR_SQUARE_SHIFT);
+    pHandle->WindingAlpha = 1.0f / ((pHandle->WindingTau * frequency) + 1.0f);
+    pHandle->HousingAlpha = 1.0f / ((pHandle->HousingTau * frequency) + 1.0f);
+    pHandle->LastSquareSum = pHandle->SquareSum;
+    pHandle->LastSquareCount = pHandle->SquareCount;
+    pHandle->WindingRise = 0.0f;
+    pHandle->HousingRise = 0.0f;
+    pHandle->ThermalLoad = 0U;
+    CPR_ApplyLimit(pHandle, pHandle->PeakCurrent);
+#ifdef NULL_PTR_CHECK_CPR
+  }
+#endif
+}
+
+/**
+  * @brief  Checks the magnitude of the Iqd current and accumulates its square.
+  *
+  * To be called by the High Frequency Task after each current measurement. It costs two multiplications.
+  *
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  * @param  Iqd measured currents, expressed in s16A.
+  * @retval Returns MC_OVER_CURR after OCDebounce consecutive samples above OCThreshold, MC_NO_ERROR otherwise.
+  */
+uint16_t CPR_CheckCurrent(CPR_Handle_t *pHandle, qd_t Iqd)
+{
+  uint16_t fault = MC_NO_ERROR;
+#ifdef NULL_PTR_CHECK_CPR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    /* Cannot overflow: twice 32768 squared is 2^31 */
+    uint32_t square = (uint32_t)((int32_t)Iqd.q * Iqd.q) + (uint32_t)((int32_t)Iqd.d * Iqd.d);
+
+    pHandle->SquareSum += square >> CPR_SQUARE_SHIFT;
+    /* Published last, CPR_CalcThermal() relies on it */
+    pHandle->SquareCount++;
+
+    if (square > pHandle->OCThresholdSquare)
+    {
+      if (pHandle->OCCount < pHandle->OCDebounce)
+      {
+        pHandle->OCCount++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if (pHandle->OCCount >= pHandle->OCDebounce)
+      {
+        fault = MC_OVER_CURR;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      pHandle->OCCount = 0U;
+    }
+#ifdef NULL_PTR_CHECK_CPR
+  }
+#endif
+  return (fault);
+}
+
+/**
+  * @brief  Updates the thermal model with the samples accumulated since the previous call and derates the
+  *         torque limits accordingly.
+  *
+  * To be called by the Medium Frequency Task at ThermalFrequencyHz, before the torque reference is computed,
+  * also when the motor is stopped so that the model cools down. The torque limits are applied to the speed and
+  * torque controller, to the outputs of the speed and position regulators, and to the torque reference in
+  * torque mode, which is clamped at each call.
+  *
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  */
+void CPR_CalcThermal(CPR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_CPR
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t squareSum;
+    uint32_t squareCount;
+    float power = 0.0f;
+    float load;
+    uint16_t limit;
+
+    /* The High Frequency Task may preempt the reading: read again until both are consistent */
+    do
+    {
+      squareCount = pHandle->SquareCount;
+      squareSum = pHandle->SquareSum;
+    } while (squareCount != pHandle->SquareCount);
+
+    if ((squareCount != pHandle->LastSquareCount) && (pHandle->NominalSquare > 0.0f))
+    {
+      power = (float)(squareSum - pHandle->LastSquareSum) / (float)(squareCount - pHandle->LastSquareCount);
+      power /= pHandle->NominalSquare;
+    }
+    else
+    {
+      /* No current measured, the motor is not driven */
+    }
+    pHandle->LastSquareSum = squareSum;
+    pHandle->LastSquareCount = squareCount;
+
+    pHandle->WindingRise += pHandle->WindingAlpha * (((1.0f - pHandle->HousingShare) * power) - pHandle->WindingRise);
+    pHandle->HousingRise += pHandle->HousingAlpha * ((pHandle->HousingShare * power) - pHandle->HousingRise);
+    load = pHandle->WindingRise + pHandle->HousingRise;
+
+    if (load <= pHandle->DeratingStart)
+    {
+      limit = pHandle->PeakCurrent;
+    }
+    else if (load >= 1.0f)
+    {
+      limit = pHandle->NominalCurrent;
+    }
+    else
+    {
+      float ratio = (load - pHandle->DeratingStart) / (1.0f - pHandle->DeratingStart);
+      limit = (uint16_t)((float)pHandle->PeakCurrent
+                         - (ratio * (float)((int32_t)pHandle->PeakCurrent - (int32_t)pHandle->NominalCurrent)));
+    }
+
+    pHandle->ThermalLoad = (load < 65.535f) ? (uint16_t)(load * 1000.0f) : 65535U;
+    if (limit != pHandle->CurrentLimit)
+    {
+      CPR_ApplyLimit(pHandle, limit);
+    }
+    else
+    {
+      CPR_ClampTorqueRef(pHandle);
+    }
+#ifdef NULL_PTR_CHECK_CPR
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the heating of the winding relative to the thermal limit.
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  * @retval Thermal load, expressed in per mille. 1000 is reached in steady state at the nominal current.
+  */
+uint16_t CPR_GetThermalLoad(const CPR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_CPR
+  return ((MC_NULL == pHandle) ? 0U : pHandle->ThermalLoad);
+#else
+  return (pHandle->ThermalLoad);
+#endif
+}
+
+/**
+  * @brief  Returns the torque limit applied to the speed and torque controller.
+  * @param  pHandle handler of the current instance of the Current Protection component.
+  * @retval Torque limit, expressed in s16A.
+  */
+uint16_t CPR_GetCurrentLimit(const CPR_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_CPR
+  return ((MC_NULL == pHandle) ? 0U : pHandle->CurrentLimit);
+#else
+  return (pHandle->CurrentLimit);
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
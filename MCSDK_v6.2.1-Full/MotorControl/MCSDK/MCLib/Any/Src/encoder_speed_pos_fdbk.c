@@ -95,6 +95,32 @@ __weak void ENC_Init(ENCODER_Handle_t *pHandle)
     /* Enable the counting timer */
     LL_TIM_EnableCounter(TIMx);
 
+    if (MC_NULL == pHandle->TimeTIMx)
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      TIM_TypeDef *TimeTIMx = pHandle->TimeTIMx;
+
+      /* TIMx captures its counter on the rising edges of channel A, and pulses its trigger output */
+      LL_TIM_CC_EnableChannel(TIMx, LL_TIM_CHANNEL_CH1);
+      LL_TIM_SetTriggerOutput(TIMx, LL_TIM_TRGO_CC1IF);
+
+      /* TimeTIMx counts freely at its clock frequency and captures its counter on this pulse */
+      LL_TIM_SetPrescaler(TimeTIMx, 0U);
+      LL_TIM_SetAutoReload(TimeTIMx, UINT32_MAX);
+      LL_TIM_SetTriggerInput(TimeTIMx, pHandle->TimeITR);
+      LL_TIM_IC_SetActiveInput(TimeTIMx, LL_TIM_CHANNEL_CH1, LL_TIM_ACTIVEINPUT_TRC);
+      LL_TIM_CC_EnableChannel(TimeTIMx, LL_TIM_CHANNEL_CH1);
+      LL_TIM_GenerateEvent_UPDATE(TimeTIMx);
+      LL_TIM_EnableCounter(TimeTIMx);
+
+      pHandle->EdgeTimeout = (pHandle->TimeFrequencyHz / 1000U) * (uint32_t)pHandle->EdgeTimeoutMs;
+      pHandle->MTConvFactor = ((float)pHandle->TimeFrequencyHz * (float)SPEED_UNIT) / (float)pHandle->PulseNumber;
+      pHandle->LastEdgeValid = false;
+    }
+
     /* Erase speed buffer */
     bufferSize = pHandle->SpeedBufferSize;
 
@@ -129,6 +155,7 @@ __weak void ENC_Clear(ENCODER_Handle_t *pHandle)
     {
       pHandle->DeltaCapturesBuffer[index] = 0;
     }
+    pHandle->LastEdgeValid = false;
     pHandle->SensorIsReliable = true;
 #ifdef NULL_PTR_CHECK_ENC_SPD_POS_FDB
   }
@@ -184,6 +211,133 @@ __weak int16_t ENC_CalcAngle(ENCODER_Handle_t *pHandle)
   return (elAngle);
 }
 
+/**
+  * @brief  Computes the average mechanical speed with the M/T method, from the timestamps of the edges.
+  *
+  * The speed is the number of counts between the last edge processed and the last edge captured, over the
+  * exact time between both edges. It is therefore averaged over the last edge period at low speed, and over
+  * the sampling period at high speed. Without new edge, the speed cannot be greater than one edge over the
+  * time elapsed since the last one, and it is zero after EdgeTimeout.
+  * @param  pHandle: handler of the current instance of the encoder component
+  * @retval Average mechanical speed expressed in the unit defined by #SPEED_UNIT
+  */
+static int16_t ENC_CalcMTSpeedUnit(ENCODER_Handle_t *pHandle)
+{
+  TIM_TypeDef *TIMx = pHandle->TIMx;
+  float speed = (float)pHandle->_Super.hAvrMecSpeedUnit;
+  uint32_t elapsed;
+  uint32_t edgeTime;
+  uint16_t edgeCount;
+
+  /* An edge may be captured between both reads: read again until both captures belong to the same edge */
+  do
+  {
+    edgeCount = (uint16_t)LL_TIM_IC_GetCaptureCH1(TIMx);
+    edgeTime = LL_TIM_IC_GetCaptureCH1(pHandle->TimeTIMx);
+  } while (edgeCount != (uint16_t)LL_TIM_IC_GetCaptureCH1(TIMx));
+
+  if (false == pHandle->LastEdgeValid)
+  {
+    /* The captured edge is only used as the reference of the next one */
+    speed = 0.0f;
+    pHandle->LastEdgeValid = true;
+  }
+  else if (edgeTime != pHandle->LastEdgeTime)
+  {
+    int32_t counts = (int32_t)edgeCount - (int32_t)pHandle->LastEdgeCount;
+    int32_t halfTurn = (int32_t)pHandle->PulseNumber / 2;
+
+    /* TIMx counts modulo PulseNumber */
+    if (counts > halfTurn)
+    {
+      counts -= (int32_t)pHandle->PulseNumber;
+    }
+    else if (counts < -halfTurn)
+    {
+      counts += (int32_t)pHandle->PulseNumber;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    elapsed = edgeTime - pHandle->LastEdgeTime;
+    speed = (elapsed > pHandle->EdgeTimeout) ? 0.0f : (((float)counts * pHandle->MTConvFactor) / (float)elapsed);
+  }
+  else
+  {
+    elapsed = LL_TIM_GetCounter(pHandle->TimeTIMx) - pHandle->LastEdgeTime;
+    if (elapsed > pHandle->EdgeTimeout)
+    {
+      speed = 0.0f;
+    }
+    else if (elapsed > 0U)
+    {
+      float bound = ((float)ENC_EDGE_COUNTS * pHandle->MTConvFactor) / (float)elapsed;
+      if (speed > bound)
+      {
+        speed = bound;
+      }
+      else if (speed < -bound)
+      {
+        speed = -bound;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  pHandle->LastEdgeTime = edgeTime;
+  pHandle->LastEdgeCount = edgeCount;
+
+  if (speed > (float)INT16_MAX)
+  {
+    speed = (float)INT16_MAX;
+  }
+  else if (speed < (float)-INT16_MAX)
+  {
+    speed = (float)-INT16_MAX;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return ((int16_t)speed);
+}
+
+/**
+  * @brief  Computes and stores the average mechanical speed with the M/T method, see ENC_CalcMTSpeedUnit(),
+  *         then the acceleration and the electrical speed, as ENC_CalcAvrgMecSpeedUnit() does from the
+  *         speed buffer.
+  * @param  pHandle: handler of the current instance of the encoder component
+  * @param  pMecSpeedUnit pointer used to return the rotor average mechanical speed
+  *         expressed in the unit defined by #SPEED_UNIT
+  * @retval true = sensor information is reliable. false = sensor information is not reliable
+  */
+static bool ENC_CalcAvrgMecSpeedUnitMT(ENCODER_Handle_t *pHandle, int16_t *pMecSpeedUnit)
+{
+  int16_t hSpeed = ENC_CalcMTSpeedUnit(pHandle);
+
+  *pMecSpeedUnit = hSpeed;
+
+  /* Computes & stores average mechanical acceleration */
+  pHandle->_Super.hMecAccelUnitP = (int16_t)(hSpeed - pHandle->_Super.hAvrMecSpeedUnit);
+
+  /* Stores average mechanical speed */
+  pHandle->_Super.hAvrMecSpeedUnit = hSpeed;
+
+  /* Computes & stores the instantaneous electrical speed [dpp] */
+  pHandle->_Super.hElSpeedDpp = (int16_t)(((float)hSpeed * (float)pHandle->_Super.bElToMecRatio
+                                           * (float)pHandle->_Super.DPPConvFactor)
+                                          / ((float)SPEED_UNIT * (float)pHandle->_Super.hMeasurementFrequency));
+
+  return (SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit));
+}
+
 /**
   * @brief  This method must be called with the periodicity defined by parameter
   *         SpeedSamplingFreqUnit. The method generates a capture event on
@@ -194,6 +348,8 @@ __weak int16_t ENC_CalcAngle(ENCODER_Handle_t *pHandle)
   *         unit [dpp](measurement_units.md), updates the index of the
   *         speed buffer, then checks, stores and returns the reliability state
   *         of the sensor.
+  *         If TimeTIMx is set, the average mechanical speed is computed from the
+  *         timestamps of the encoder edges instead, see ENC_CalcAvrgMecSpeedUnitMT().
   * @param  pHandle: handler of the current instance of the encoder component
   * @param  pMecSpeedUnit pointer used to return the rotor average mechanical speed
   *         expressed in the unit defined by #SPEED_UNIT
@@ -208,8 +364,13 @@ __weak bool ENC_CalcAvrgMecSpeedUnit(ENCODER_Handle_t *pHandle, int16_t *pMecSpe
     bReliability = false;
   }
   else
-  {
 #endif
+  if (MC_NULL != pHandle->TimeTIMx)
+  {
+    bReliability = ENC_CalcAvrgMecSpeedUnitMT(pHandle, pMecSpeedUnit);
+  }
+  else
+  {
     int32_t wtemp1;
     int32_t wtemp2;
     uint32_t OverflowCntSample;
@@ -343,9 +504,7 @@ __weak bool ENC_CalcAvrgMecSpeedUnit(ENCODER_Handle_t *pHandle, int16_t *pMecSpe
     {
       bReliability = SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit);
     }
-#ifdef NULL_PTR_CHECK_ENC_SPD_POS_FDB
   }
-#endif
   return (bReliability);
 }
 
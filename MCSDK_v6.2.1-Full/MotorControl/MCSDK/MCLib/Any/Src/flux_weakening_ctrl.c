@@ -122,6 +122,7 @@ __weak qd_t FW_CalcCurrRef(FW_Handle_t *pHandle, qd_t Iqdref)
   {
 #endif
     int32_t wIdRef;
+    int32_t wIdLimit;
     int32_t wIqSatSq;
     int32_t wIqSat;
     int32_t wAux1;
@@ -150,9 +151,53 @@ __weak qd_t FW_CalcCurrRef(FW_Handle_t *pHandle, qd_t Iqdref)
     }
 
     /* Saturate new Idref to prevent the rotor from being demagnetized */
-    if (wIdRef < pHandle->hDemagCurrent)
+    wIdLimit = pHandle->hDemagCurrent;
+    if (pHandle->pSPD != MC_NULL)
     {
-      wIdRef =  pHandle->hDemagCurrent;
+      /* Past the Id giving the smallest stator voltage, a more negative Id raises the voltage again and only
+         steals current from Iq. This Id is -w^2.Ls.Flux / (Rs^2 + w^2.Ls^2): it stays close to 0 as long as
+         the resistive drop dominates, and tends to -Flux / Ls at high speed */
+      float omega = pHandle->ElSpeedConv * (float)SPD_GetAvrgMecSpeedUnit(pHandle->pSPD);
+      float omegaSq = omega * omega;
+      float idOptimum = -(omegaSq * pHandle->Ls * pHandle->Flux * pHandle->CurrentConv)
+                        / ((pHandle->Rs * pHandle->Rs) + (omegaSq * pHandle->Ls * pHandle->Ls));
+      if (idOptimum > (float)pHandle->hIdRefOffset)
+      {
+        /* Only the flux weakening contribution is bounded, not the Id reference requested by the application */
+        idOptimum = (float)pHandle->hIdRefOffset;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if (idOptimum > (float)wIdLimit)
+      {
+        wIdLimit = (int32_t)idOptimum;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (wIdRef < wIdLimit)
+    {
+      wIdRef = wIdLimit;
+      if (hId_fw < (int16_t)0)
+      {
+        /* Holds the integral term at the limit, so that Id leaves it as soon as the voltage drops */
+        wAux1 = (wIdLimit - (int32_t)pHandle->hIdRefOffset) * (int32_t)PID_GetKIDivisor(pHandle->pFluxWeakeningPID);
+        PID_SetIntegralTerm(pHandle->pFluxWeakeningPID, (wAux1 < 0) ? wAux1 : 0);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
     }
     else
     {
@@ -245,6 +290,28 @@ __weak void FW_DataProcess(FW_Handle_t *pHandle, qd_t Vqd)
 }
 
 
+/**
+  * @brief  Sets the radius of the current circle: Iqref is saturated to the square root of its square minus the
+  *         square of Idref.
+  * @param  pHandle pointer to flux weakening component handler.
+  * @param  hNominalCurrent Largest current magnitude, expressed in s16A.
+  */
+__weak void FW_SetNominalCurrent(FW_Handle_t *pHandle, uint16_t hNominalCurrent)
+{
+#ifdef NULL_PTR_CHECK_FLUX_WEAK
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->wNominalSqCurr = (int32_t)hNominalCurrent * (int32_t)hNominalCurrent;
+#ifdef NULL_PTR_CHECK_FLUX_WEAK
+  }
+#endif
+}
+
 /**
   * @brief  Sets a new value for the voltage reference used by
   *         flux weakening algorithm.
@@ -0,0 +1,355 @@
+/**
+  ******************************************************************************
+  * @file    fused_speed_pos_fdbk.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the Fused Hall & Encoder component of the Motor Control SDK:
+  *           - fuses the absolute hall angle with the incremental encoder angle
+  *           - computes and stores average mechanical speed
+  *           - detects the inconsistencies between both sensors
+  *           - falls back on the remaining sensor on a single sensor fault
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup FusedSpeednPosFdbk
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fused_speed_pos_fdbk.h"
+#include "mc_type.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup SpeednPosFdbk
+  * @{
+  */
+
+/** @defgroup FusedSpeednPosFdbk Fused Hall & Encoder Speed & Position Feedback
+  * @brief Complementary filter of the analog hall sensors and the quadrature encoder
+  *
+  * The encoder gives the motion at each FOC cycle, with a high resolution but no absolute reference. The
+  * analog hall sensors give the absolute electrical angle, at a lower rate and with more noise. The fused
+  * angle follows the encoder increments and, at each new hall sample, a HallGain part of the hall angle error
+  * is corrected: the hall sensors remove the drift, the encoder filters the hall noise.
+  *
+  * The hall sensors are checked on their own, by the amplitude of their vector. A hall error larger than
+  * MaxAngleError for MaxErrorSamples consecutive samples is therefore an encoder fault, as is an unreliable
+  * encoder speed. Then the encoder is ignored until FUS_Clear(): the angle is extrapolated at the measured
+  * speed and fully corrected at each hall sample. If the hall sensors are not usable, the angle follows the
+  * encoder alone. The speed is reported unreliable only when both sensors are lost.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Returns the absolute hall angle if it can be used.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  * @param  pElAngle: receives the electrical angle in [s16degree](measurement_units.md) format.
+  * @retval bool true if the hall angle is plausible and its phase shift calibrated.
+  */
+static bool FUS_GetHallElAngle(const FUS_Handle_t *pHandle, int16_t *pElAngle)
+{
+  return ((pHandle->pHAC->HallCalibrated) && (HALL_GetAbsoluteElAngle(pHandle->pHALL, pElAngle)));
+}
+
+/**
+  * @brief  Moves the fused electrical angle and the mechanical angles accordingly.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  * @param  hDeltaElAngle: electrical angle variation in [s16degree](measurement_units.md) format.
+  */
+static void FUS_MoveElAngle(FUS_Handle_t *pHandle, int16_t hDeltaElAngle)
+{
+  int32_t wDelta = (int32_t)pHandle->ElResidual + (int32_t)hDeltaElAngle;
+  int32_t wMecDelta = wDelta / (int32_t)pHandle->_Super.bElToMecRatio;
+
+  /* The remainder is kept so that the mechanical angle does not drift from the electrical one */
+  pHandle->ElResidual = (int16_t)(wDelta - (wMecDelta * (int32_t)pHandle->_Super.bElToMecRatio));
+  pHandle->_Super.hElAngle = (int16_t)(pHandle->_Super.hElAngle + hDeltaElAngle);
+  pHandle->_Super.hMecAngle = (int16_t)(pHandle->_Super.hMecAngle + wMecDelta);
+  pHandle->_Super.wMecAngle += wMecDelta;
+}
+
+/**
+  * @brief  Initializes the fused sensor. HALL_Init() and ENC_Init() must have been called.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  */
+__weak void FUS_Init(FUS_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->_Super.hElAngle = 0;
+    pHandle->_Super.hMecAngle = 0;
+    pHandle->_Super.wMecAngle = 0;
+    pHandle->ElResidual = 0;
+    FUS_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Restarts the fusion, from the hall angle if it is usable, from the encoder angle otherwise.
+  *
+  * It must be called before starting the motor, once the encoder has been aligned. An encoder fault is
+  * cleared. The mechanical angle keeps counting from its previous value.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  */
+__weak void FUS_Clear(FUS_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int16_t hElAngle;
+
+    /* The encoder gets a new chance */
+    ENC_Clear(pHandle->pENC);
+    pHandle->pENC->TimerOverflowError = false;
+    pHandle->pENC->_Super.bSpeedErrorNumber = 0U;
+    (void)ENC_CalcAngle(pHandle->pENC);
+    pHandle->PrevEncMecAngle = pHandle->pENC->_Super.wMecAngle;
+
+    if (FUS_GetHallElAngle(pHandle, &hElAngle))
+    {
+      pHandle->Status = 0U;
+    }
+    else
+    {
+      hElAngle = pHandle->pENC->_Super.hElAngle;
+      pHandle->Status = FUS_STATUS_HALL_UNUSABLE;
+    }
+    FUS_MoveElAngle(pHandle, (int16_t)(hElAngle - pHandle->_Super.hElAngle));
+
+    pHandle->HallSampleCount = pHandle->pHALL->SampleCount;
+    pHandle->ErrorSamples = 0U;
+    pHandle->HallAngleError = 0;
+    pHandle->PrevElAngle = pHandle->_Super.hElAngle;
+    pHandle->_Super.hAvrMecSpeedUnit = 0;
+    pHandle->_Super.hMecAccelUnitP = 0;
+    pHandle->_Super.hElSpeedDpp = 0;
+    pHandle->_Super.bSpeedErrorNumber = 0U;
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Updates both sensors and fuses their angles.
+  *
+  * It must be called by the High Frequency Task at each FOC cycle. HALL_CalcAngle() and ENC_CalcAngle() are
+  * called from here.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  * @retval Fused electrical angle in [s16degree](measurement_units.md) format.
+  */
+__weak int16_t FUS_CalcAngle(FUS_Handle_t *pHandle)
+{
+  int16_t elAngle;
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  if (NULL == pHandle)
+  {
+    elAngle = 0;
+  }
+  else
+  {
+#endif
+    int16_t hHallElAngle;
+    int16_t hDeltaElAngle;
+    int32_t wEncDelta;
+
+    (void)HALL_CalcAngle(pHandle->pHALL);
+    (void)ENC_CalcAngle(pHandle->pENC);
+    wEncDelta = pHandle->pENC->_Super.wMecAngle - pHandle->PrevEncMecAngle;
+    pHandle->PrevEncMecAngle = pHandle->pENC->_Super.wMecAngle;
+
+    if (0U == (pHandle->Status & FUS_STATUS_ENCODER_FAULT))
+    {
+      hDeltaElAngle = (int16_t)(wEncDelta * (int32_t)pHandle->_Super.bElToMecRatio);
+    }
+    else
+    {
+      /* Extrapolated at the measured speed until the next hall sample */
+      hDeltaElAngle = pHandle->_Super.hElSpeedDpp;
+    }
+
+    if (pHandle->HallSampleCount == pHandle->pHALL->SampleCount)
+    {
+      /* No new hall sample */
+    }
+    else if (FUS_GetHallElAngle(pHandle, &hHallElAngle))
+    {
+      int16_t hError = (int16_t)(hHallElAngle - (int16_t)(pHandle->_Super.hElAngle + hDeltaElAngle));
+
+      pHandle->HallSampleCount = pHandle->pHALL->SampleCount;
+      pHandle->HallAngleError = hError;
+      pHandle->Status &= (uint8_t)~FUS_STATUS_HALL_UNUSABLE;
+
+      if ((hError > pHandle->MaxAngleError) || (hError < -pHandle->MaxAngleError))
+      {
+        if (pHandle->ErrorSamples < pHandle->MaxErrorSamples)
+        {
+          pHandle->ErrorSamples++;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        pHandle->ErrorSamples = 0U;
+      }
+
+      if (pHandle->ErrorSamples >= pHandle->MaxErrorSamples)
+      {
+        /* The hall sensors passed their own checks, the encoder is at fault */
+        pHandle->Status |= FUS_STATUS_ENCODER_FAULT;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if (0U == (pHandle->Status & FUS_STATUS_ENCODER_FAULT))
+      {
+        hDeltaElAngle = (int16_t)(hDeltaElAngle + (int16_t)((float)hError * pHandle->HallGain));
+      }
+      else
+      {
+        hDeltaElAngle = (int16_t)(hDeltaElAngle + hError);
+      }
+    }
+    else
+    {
+      pHandle->HallSampleCount = pHandle->pHALL->SampleCount;
+      pHandle->ErrorSamples = 0U;
+      pHandle->Status |= FUS_STATUS_HALL_UNUSABLE;
+    }
+
+    FUS_MoveElAngle(pHandle, hDeltaElAngle);
+    elAngle = pHandle->_Super.hElAngle;
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  }
+#endif
+  return (elAngle);
+}
+
+/**
+  * @brief  Computes and stores the average mechanical speed, then checks, stores and returns the reliability
+  *         of the fused sensor.
+  *
+  * It must be called by the Medium Frequency Task at SpeedSamplingFreqHz. ENC_CalcAvrgMecSpeedUnit() is called
+  * from here. The speed is the encoder one, or the variation of the fused angle once the encoder is faulty.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  * @param  pMecSpeedUnit pointer used to return the rotor average mechanical speed
+  *         expressed in the unit defined by #SPEED_UNIT
+  * @retval true = sensor information is reliable. false = sensor information is not reliable
+  */
+__weak bool FUS_CalcAvrgMecSpeedUnit(FUS_Handle_t *pHandle, int16_t *pMecSpeedUnit)
+{
+  bool bReliability;
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  if ((NULL == pHandle) || (NULL == pMecSpeedUnit))
+  {
+    bReliability = false;
+  }
+  else
+  {
+#endif
+    int16_t hEncSpeed;
+    int16_t hSpeed;
+    int16_t hElAngle = pHandle->_Super.hElAngle;
+
+    if (ENC_CalcAvrgMecSpeedUnit(pHandle->pENC, &hEncSpeed))
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      pHandle->Status |= FUS_STATUS_ENCODER_FAULT;
+    }
+
+    if (0U == (pHandle->Status & FUS_STATUS_ENCODER_FAULT))
+    {
+      hSpeed = hEncSpeed;
+    }
+    else
+    {
+      /* The electrical angle does not see the resets of the mechanical angle by the position control */
+      int32_t wtemp = (int32_t)((int16_t)(hElAngle - pHandle->PrevElAngle));
+      wtemp *= (int32_t)pHandle->SpeedSamplingFreqHz * (int32_t)SPEED_UNIT;
+      wtemp /= (int32_t)65536 * (int32_t)pHandle->_Super.bElToMecRatio;
+      hSpeed = (int16_t)wtemp;
+    }
+    pHandle->PrevElAngle = hElAngle;
+
+    *pMecSpeedUnit = hSpeed;
+
+    /* Computes & stores average mechanical acceleration */
+    pHandle->_Super.hMecAccelUnitP = (int16_t)(hSpeed - pHandle->_Super.hAvrMecSpeedUnit);
+
+    /* Stores average mechanical speed */
+    pHandle->_Super.hAvrMecSpeedUnit = hSpeed;
+
+    /* Computes & stores the instantaneous electrical speed [dpp] */
+    pHandle->_Super.hElSpeedDpp = (int16_t)(((float)hSpeed * (float)pHandle->_Super.bElToMecRatio
+                                             * (float)pHandle->_Super.DPPConvFactor)
+                                            / ((float)SPEED_UNIT * (float)pHandle->_Super.hMeasurementFrequency));
+
+    if ((FUS_STATUS_ENCODER_FAULT | FUS_STATUS_HALL_UNUSABLE) == pHandle->Status)
+    {
+      /* Both sensors are lost */
+      bReliability = false;
+      pHandle->_Super.bSpeedErrorNumber = pHandle->_Super.bMaximumSpeedErrorsNumber;
+    }
+    else
+    {
+      bReliability = SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit);
+    }
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  }
+#endif
+  return (bReliability);
+}
+
+/**
+  * @brief  Returns the degradation status of the fused sensor.
+  * @param  pHandle: handler of the current instance of the fused sensor component
+  * @retval Combination of FUS_STATUS_ENCODER_FAULT and FUS_STATUS_HALL_UNUSABLE, 0 if both sensors are used.
+  */
+__weak uint8_t FUS_GetStatus(const FUS_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FUS_SPD_POS_FDB
+  return ((NULL == pHandle) ? (FUS_STATUS_ENCODER_FAULT | FUS_STATUS_HALL_UNUSABLE) : pHandle->Status);
+#else
+  return (pHandle->Status);
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @} */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
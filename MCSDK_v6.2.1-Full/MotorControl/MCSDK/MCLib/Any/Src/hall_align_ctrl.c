@@ -58,6 +58,7 @@ __weak void HAC_Init(HallAlign_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC,
     pHandle->pHALL = pHALL;
     pHandle->HallAligned = false;
     pHandle->HallRestart = false;
+    pHandle->HallCalibrated = false;
 #ifdef NULL_PTR_CHECK_ENC_ALI_CTRL
   }
 #endif
@@ -111,6 +112,81 @@ __weak void HAC_StartAlignment(HallAlign_Handle_t* pHandle)
 #endif
 }
 
+/**
+  * @brief  It aligns the encoder, if any, on the absolute electrical angle given
+  *         by the hall sensors, so that the timed alignment can be skipped.
+  *         It succeeds only if instant start is enabled, the hall phase shift is
+  *         known and the hall signals have been plausible for the last
+  *         HALL_MIN_VALID_SAMPLES samples. Otherwise nothing is changed and the
+  *         caller falls back to HAC_StartAlignment().
+  * @param  pHandle: handler of the current instance of the HallAlignCtrl component.
+  * @retval bool It returns true when the encoder has been aligned.
+  */
+__weak bool HAC_InstantAlignment(HallAlign_Handle_t *pHandle)
+{
+  bool retVal = false;
+#ifdef NULL_PTR_CHECK_ENC_ALI_CTRL
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    int16_t hElAngle;
+
+    if ((false == pHandle->InstantStart) || (false == pHandle->HallCalibrated))
+    {
+      /* Nothing to do, timed alignment is requested or needed to measure the hall phase shift */
+    }
+    else if (false == HALL_GetAbsoluteElAngle(pHandle->pHALL, &hElAngle))
+    {
+      pHandle->InstantFallbacks++;
+    }
+    else
+    {
+      /* Without encoder the hall angle is used directly, there is nothing to seed */
+      if (pHandle->pENC != MC_NULL)
+      {
+        ENC_SetMecAngle(pHandle->pENC, hElAngle / ((int16_t)pHandle->bElToMecRatio));
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->hRemainingTicks = 0U;
+      pHandle->HallAligned = true;
+      retVal = true;
+    }
+#ifdef NULL_PTR_CHECK_ENC_ALI_CTRL
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  It restores the hall phase shift measured by a previous timed alignment,
+  *         which allows the instant alignment.
+  * @param  pHandle: handler of the current instance of the HallAlignCtrl component.
+  * @param  hPhaseShift: hall phase shift in [s16degree](measurement_units.md) format.
+  */
+__weak void HAC_SetHallPhaseShift(HallAlign_Handle_t *pHandle, int16_t hPhaseShift)
+{
+#ifdef NULL_PTR_CHECK_ENC_ALI_CTRL
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->pHALL->PhaseShift = hPhaseShift;
+    pHandle->HallCalibrated = true;
+#ifdef NULL_PTR_CHECK_ENC_ALI_CTRL
+  }
+#endif
+}
+
 /**
   * @brief  It executes the encoder alignment controller and must be called with a
   *         frequency equal to the one settled in the parameters
@@ -140,9 +216,28 @@ __weak bool HAC_Exec(HallAlign_Handle_t* pHandle)
 
       if (0U == pHandle->hRemainingTicks)
       {
+        int16_t hHallElAngle;
+
         /* At the end of Alignment procedure, we set the encoder mechanical angle to the alignement angle */
-        //ENC_SetMecAngle(pHandle->pENC, pHandle->hElAngle / ((int16_t)pHandle->bElToMecRatio));
-        HALL_SetMecAngle(pHandle->pHALL, pHandle->hElAngle / ((int16_t)pHandle->bElToMecRatio));
+        if (pHandle->pENC != MC_NULL)
+        {
+          ENC_SetMecAngle(pHandle->pENC, pHandle->hElAngle / ((int16_t)pHandle->bElToMecRatio));
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+
+        /* The rotor is locked on the alignment angle: the hall angle error gives its phase shift */
+        if (HALL_GetAbsoluteElAngle(pHandle->pHALL, &hHallElAngle))
+        {
+          pHandle->pHALL->PhaseShift = (int16_t)(pHandle->pHALL->PhaseShift + (int16_t)(pHandle->hElAngle - hHallElAngle));
+          pHandle->HallCalibrated = true;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
         pHandle->HallAligned = true;
         retVal = true;
       }
@@ -47,12 +47,41 @@ __weak void HALL_Init(HALL_Handle_t *pHandle)
     {
       pHandle->rawAdc[i] = 0;
     }
+    HALL_Clear(pHandle);
 
   #ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
   }
   #endif
 }
 
+/**
+  * @brief  Clears the plausibility history of the hall signals, so that the
+  *         absolute angle is only trusted again after HALL_MIN_VALID_SAMPLES
+  *         fresh samples.
+  * @param  pHandle: handler of the current instance of the hall component
+  */
+__weak void HALL_Clear(HALL_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  if (NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->ValidSamples = 0U;
+    pHandle->Amplitude = 0U;
+    pHandle->SensorIsReliable = false;
+    pHandle->ElAngleRemainder = 0;
+    pHandle->_Super.hAvrMecSpeedUnit = 0;
+    pHandle->_Super.hElSpeedDpp = 0;
+    pHandle->_Super.bSpeedErrorNumber = 0U;
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  }
+#endif
+}
+
 /**
   * @brief  It set instantaneous rotor mechanical angle.
   *         As a consequence, timer counter is computed and updated.
@@ -103,6 +132,7 @@ __weak int16_t HALL_CalcAngle(HALL_Handle_t *pHandle)
   {
     //adc data available
     LL_ADC_ClearFlag_EOS(ADC2);  
+    pHandle->SampleCount++;
      pHandle->rawAdcValues[0] = LL_ADC_REG_ReadConversionData12(ADC2);  //PC0
      pHandle->rawAdcValues[1] = LL_ADC_REG_ReadConversionData12(ADC2);  //PC1
      pHandle->rawAdcValues[2] = LL_ADC_REG_ReadConversionData12(ADC2);  //PC2
@@ -114,6 +144,50 @@ __weak int16_t HALL_CalcAngle(HALL_Handle_t *pHandle)
     // Calculate the electrical angle theta
     float theta = atan2(beta, alpha);
 
+    // Check the amplitude of the hall vector: a disconnected or saturated
+    // sensor gives a vector far outside the expected circle
+    pHandle->Amplitude = (uint16_t)sqrtf((alpha * alpha) + (beta * beta));
+    if ((pHandle->Amplitude >= pHandle->MinAmplitude) && (pHandle->Amplitude <= pHandle->MaxAmplitude))
+    {
+      pHandle->SensorIsReliable = true;
+      if (pHandle->ValidSamples < UINT8_MAX)
+      {
+        pHandle->ValidSamples++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      pHandle->SensorIsReliable = false;
+      pHandle->ValidSamples = 0U;
+    }
+
+    // Absolute electrical angle in s16degree, corrected by the sensor phase shift
+    pHandle->_Super.hElAngle = (int16_t)((int32_t)(theta * (32768.0f / (float)M_PI)) + pHandle->PhaseShift);
+    pHandle->_Super.hMecAngle = pHandle->_Super.hElAngle / (int16_t)pHandle->_Super.bElToMecRatio;
+
+    // Multi-turn mechanical angle for the position control, from the variation of the plausible samples
+    if (1U == pHandle->ValidSamples)
+    {
+      pHandle->PrevElAngle = pHandle->_Super.hElAngle;
+      pHandle->SpeedPrevElAngle = pHandle->_Super.hElAngle;
+    }
+    else if (pHandle->SensorIsReliable)
+    {
+      int32_t wDelta = (int32_t)((int16_t)(pHandle->_Super.hElAngle - pHandle->PrevElAngle))
+                     + (int32_t)pHandle->ElAngleRemainder;
+      pHandle->_Super.wMecAngle += wDelta / (int32_t)pHandle->_Super.bElToMecRatio;
+      pHandle->ElAngleRemainder = (int16_t)(wDelta % (int32_t)pHandle->_Super.bElToMecRatio);
+      pHandle->PrevElAngle = pHandle->_Super.hElAngle;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
     float angle_degree = (int16_t)(theta * (180.0 / M_PI));  
 
     // Convert theta from radians to degrees, if necessary
@@ -133,4 +207,97 @@ __weak int16_t HALL_CalcAngle(HALL_Handle_t *pHandle)
 
   return retVal;
   
-}
\ No newline at end of file
+}
+
+/**
+  * @brief  Computes and stores the average mechanical speed from the variation of the hall angle, then checks,
+  *         stores and returns the reliability of the sensor.
+  *
+  * It must be called by the Medium Frequency Task at SpeedSamplingFreqHz, which must not be higher than the
+  * hall sampling rate.
+  * @param  pHandle: handler of the current instance of the hall component
+  * @param  pMecSpeedUnit pointer used to return the rotor average mechanical speed
+  *         expressed in the unit defined by #SPEED_UNIT
+  * @retval true = sensor information is reliable. false = sensor information is not reliable
+  */
+__weak bool HALL_CalcAvrgMecSpeedUnit(HALL_Handle_t *pHandle, int16_t *pMecSpeedUnit)
+{
+  bool bReliability;
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  if ((NULL == pHandle) || (NULL == pMecSpeedUnit))
+  {
+    bReliability = false;
+  }
+  else
+  {
+#endif
+    int16_t hElAngle = pHandle->PrevElAngle;
+    int16_t hSpeed;
+    int32_t wtemp = (int32_t)((int16_t)(hElAngle - pHandle->SpeedPrevElAngle));
+
+    /* The electrical angle does not see the resets of the mechanical angle by the position control */
+    wtemp *= (int32_t)pHandle->SpeedSamplingFreqHz * (int32_t)SPEED_UNIT;
+    wtemp /= (int32_t)65536 * (int32_t)pHandle->_Super.bElToMecRatio;
+    hSpeed = (int16_t)wtemp;
+    pHandle->SpeedPrevElAngle = hElAngle;
+
+    *pMecSpeedUnit = hSpeed;
+
+    /* Computes & stores average mechanical acceleration */
+    pHandle->_Super.hMecAccelUnitP = (int16_t)(hSpeed - pHandle->_Super.hAvrMecSpeedUnit);
+
+    /* Stores average mechanical speed */
+    pHandle->_Super.hAvrMecSpeedUnit = hSpeed;
+
+    /* Computes & stores the instantaneous electrical speed [dpp] */
+    pHandle->_Super.hElSpeedDpp = (int16_t)(((float)hSpeed * (float)pHandle->_Super.bElToMecRatio
+                                             * (float)pHandle->_Super.DPPConvFactor)
+                                            / ((float)SPEED_UNIT * (float)pHandle->_Super.hMeasurementFrequency));
+
+    if (false == pHandle->SensorIsReliable)
+    {
+      bReliability = false;
+      pHandle->_Super.bSpeedErrorNumber = pHandle->_Super.bMaximumSpeedErrorsNumber;
+    }
+    else
+    {
+      bReliability = SPD_IsMecSpeedReliable(&pHandle->_Super, pMecSpeedUnit);
+    }
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  }
+#endif
+  return (bReliability);
+}
+
+/**
+  * @brief  Returns the absolute electrical angle measured by the hall sensors,
+  *         if the last HALL_MIN_VALID_SAMPLES samples were plausible.
+  * @param  pHandle: handler of the current instance of the hall component
+  * @param  pElAngle: receives the electrical angle in [s16degree](measurement_units.md) format.
+  * @retval bool true if the angle can be trusted, false otherwise.
+  */
+__weak bool HALL_GetAbsoluteElAngle(const HALL_Handle_t *pHandle, int16_t *pElAngle)
+{
+  bool retVal = false;
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  if ((NULL == pHandle) || (NULL == pElAngle))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (pHandle->ValidSamples >= HALL_MIN_VALID_SAMPLES)
+    {
+      *pElAngle = pHandle->_Super.hElAngle;
+      retVal = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HALL_SPD_POS_FDB
+  }
+#endif
+  return (retVal);
+}
@@ -36,6 +36,217 @@ static void MCPA_stopDataLog(MCPA_Handle_t *pHandle);
   * @{
   */
 
+/**
+  * @brief  Returns the zig-zag code of a 16 bits difference: the sign moves to bit 0, small differences
+  *         either positive or negative have small codes (0, -1, 1, -2... give 0, 1, 2, 3...)
+  */
+static inline uint16_t MCPA_zigZag(uint16_t delta)
+{
+  return ((uint16_t)((uint16_t)(delta << 1) ^ (uint16_t)(0U - (delta >> 15))));
+}
+
+/**
+  * @brief  Writes a zig-zag varint encoded delta in the asynchronous buffer
+  *
+  * The delta is computed modulo 2^16, so that any 16 bits value (signed or not) is rebuilt by the
+  * controller by adding the decoded delta to the previous sample. Small deltas, either positive or
+  * negative, fit in one byte (-64..63) or two bytes (-8192..8191).
+  *
+  * Controller side decoding of one value:
+  *   zz = 0; shift = 0; do { b = *p++; zz |= (b & 0x7F) << shift; shift += 7; } while (b & 0x80);
+  *   delta = (zz >> 1) ^ -(zz & 1);  last = (uint16_t)(last + delta);
+  * where last is reset to 0 for every channel at the start of each packet.
+  *
+  * @param  pDest Where to write the encoded value
+  * @param  delta Difference between the new sample and the previous one
+  * @retval Number of bytes written (1 to #MCPA_VARINT_MAX_SIZE)
+  */
+static inline uint8_t MCPA_putVarint(uint8_t *pDest, int16_t delta)
+{
+  uint16_t zz = MCPA_zigZag((uint16_t)delta);
+  uint8_t n = 0U;
+
+  while (zz >= 0x80U)
+  {
+    pDest[n] = (uint8_t)(zz | 0x80U);
+    zz >>= 7;
+    n++;
+  }
+  pDest[n] = (uint8_t)zz;
+  n++;
+  return (n);
+}
+
+/**
+  * @brief  Appends bits to the asynchronous buffer, least significant bit first
+  *
+  * @param  pHandle Pointer to the MCPA Handle
+  * @param  code Bits to append
+  * @param  width Number of bits to append, 16 at most
+  */
+static inline void MCPA_putBits(MCPA_Handle_t *pHandle, uint16_t code, uint8_t width)
+{
+  pHandle->packedBits |= (uint32_t)code << pHandle->packedBitCount;
+  pHandle->packedBitCount += width;
+  while (pHandle->packedBitCount >= 8U)
+  {
+    pHandle->currentBuffer[pHandle->bufferIndex] = (uint8_t)pHandle->packedBits;
+    pHandle->bufferIndex++;
+    pHandle->packedBits >>= 8;
+    pHandle->packedBitCount -= 8U;
+  }
+}
+
+/**
+  * @brief  Completes the last byte of the bit packed values, the next value starts on a byte
+  *
+  * @param  pHandle Pointer to the MCPA Handle
+  */
+static inline void MCPA_alignBits(MCPA_Handle_t *pHandle)
+{
+  if (pHandle->packedBitCount > 0U)
+  {
+    pHandle->currentBuffer[pHandle->bufferIndex] = (uint8_t)pHandle->packedBits;
+    pHandle->bufferIndex++;
+    pHandle->packedBits = 0U;
+    pHandle->packedBitCount = 0U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Returns the width of the residuals up to residualMax, with room for the escape code
+  *
+  * The escape code is the largest code of the width, so residualMax must be below it. A width of 16 bits
+  * holds any value and has no escape code.
+  */
+static uint8_t MCPA_packedWidth(uint16_t residualMax)
+{
+  uint32_t codes = (uint32_t)residualMax + 1U;
+  uint8_t width = 0U;
+
+  while (codes != 0U)
+  {
+    width++;
+    codes >>= 1;
+  }
+  return ((width > 16U) ? 16U : width);
+}
+
+/**
+  * @brief  Starts a bit packed buffer, after its timestamp
+  *
+  * The prediction order and the width of each HF value are chosen from the residuals of the previous
+  * buffer, and written in the header of the buffer.
+  *
+  * Bit packed buffer: timestamp (u32), number of frames (u16), one byte per HF value (bit 7: 2nd order
+  * prediction, bits 0 to 4: width), then the bits of the HF values, least significant bit first:
+  * - First frames, as many as the prediction order: the 16 bits of the value.
+  * - Next frames: the zig-zag residual of the value on its width. The 1st order prediction is the previous
+  *   sample, the 2nd order one adds the previous difference between samples. A residual that does not fit
+  *   is sent as the escape code (all ones, below 16 bits only) followed by the 16 bits of the value.
+  * The MF values, the Mark and the async ID start on the next byte, as in the raw buffers.
+  *
+  * @param  pHandle Pointer to the MCPA Handle
+  */
+static void MCPA_startPacking(MCPA_Handle_t *pHandle)
+{
+  MCPA_Packing_t *pPacking;
+  uint8_t width2;
+  uint8_t i;
+
+  for (i = 0U; i < pHandle->HFNumBuff; i++)
+  {
+    pPacking = &pHandle->packingTable[i];
+    pPacking->width = MCPA_packedWidth(pPacking->residualMax[0]);
+    width2 = MCPA_packedWidth(pPacking->residualMax[1]);
+    if (width2 < pPacking->width)
+    {
+      pPacking->width = width2;
+      pPacking->order = 2U;
+    }
+    else
+    {
+      pPacking->order = 1U;
+    }
+    pHandle->currentBuffer[6U + i] = (uint8_t)(((2U == pPacking->order) ? 0x80U : 0U) | pPacking->width);
+    pPacking->residualMax[0] = 0U;
+    pPacking->residualMax[1] = 0U;
+  }
+  pHandle->packedFrames = 0U;
+  pHandle->packedBits = 0U;
+  pHandle->packedBitCount = 0U;
+  pHandle->bufferIndex = 6U + (uint16_t)pHandle->HFNumBuff;
+}
+
+/**
+  * @brief  Writes the HF values of a frame in a bit packed buffer
+  *
+  * @param  pHandle Pointer to the MCPA Handle
+  */
+static void MCPA_packFrame(MCPA_Handle_t *pHandle)
+{
+  MCPA_Packing_t *pPacking;
+  uint16_t value;
+  uint16_t delta;
+  uint16_t residual[2];
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0U; i < pHandle->HFNumBuff; i++)
+  {
+    pPacking = &pHandle->packingTable[i];
+    value = *((uint16_t *) pHandle->dataPtrTableBuff[i]); //cstat !MISRAC2012-Rule-11.5
+    delta = (0U == pHandle->packedFrames) ? 0U : (uint16_t)(value - pPacking->last);
+    residual[0] = MCPA_zigZag(delta);
+    residual[1] = MCPA_zigZag(delta - pPacking->delta);
+    /* Residuals of the predictions that have their previous samples */
+    for (j = 0U; j < 2U; j++)
+    {
+      if ((pHandle->packedFrames > j) && (residual[j] > pPacking->residualMax[j]))
+      {
+        pPacking->residualMax[j] = residual[j];
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+
+    if (pHandle->packedFrames < pPacking->order)
+    {
+      MCPA_putBits(pHandle, value, 16U);
+    }
+    else if ((pPacking->width < 16U) && (residual[pPacking->order - 1U] >= ((1U << pPacking->width) - 1U)))
+    {
+      MCPA_putBits(pHandle, (uint16_t)((1U << pPacking->width) - 1U), pPacking->width);
+      MCPA_putBits(pHandle, value, 16U);
+    }
+    else
+    {
+      MCPA_putBits(pHandle, residual[pPacking->order - 1U], pPacking->width);
+    }
+    pPacking->last = value;
+    pPacking->delta = delta;
+  }
+  pHandle->packedFrames++;
+}
+
+/**
+  * @brief  Completes a bit packed buffer before its MF values sent once per buffer and its Mark
+  *
+  * @param  pHandle Pointer to the MCPA Handle
+  */
+static void MCPA_endPacking(MCPA_Handle_t *pHandle)
+{
+  MCPA_alignBits(pHandle);
+  pHandle->currentBuffer[4] = (uint8_t)pHandle->packedFrames;
+  pHandle->currentBuffer[5] = (uint8_t)(pHandle->packedFrames >> 8);
+}
+
 /**
   * @brief  Allocates and fills buffer with asynchronous data to be sent to controller
   *
@@ -89,13 +300,36 @@ void MCPA_dataLog(MCPA_Handle_t *pHandle)
             pHandle->HFRateBuff          = pHandle->HFRate;
             pHandle->MFRateBuff          = pHandle->MFRate;
             pHandle->bufferTxTriggerBuff = pHandle->bufferTxTrigger;
+            pHandle->EncodingBuff        = pHandle->Encoding;
 
-            /* We store pointer here, so 4 bytes */
+            /* We store pointer here */
             (void)memcpy(pHandle->dataPtrTableBuff, pHandle->dataPtrTable,
-                         ((uint32_t)pHandle->HFNum + (uint32_t)pHandle->MFNum) * 4U); /* We store pointer here,
-                                                                                         so 4 bytes */
+                         ((uint32_t)pHandle->HFNum + (uint32_t)pHandle->MFNum) * sizeof(void *));
             (void)memcpy(pHandle->dataSizeTableBuff, pHandle->dataSizeTable,
                          (uint32_t)pHandle->HFNum + (uint32_t)pHandle->MFNum); /* 1 size byte per ID */
+            if (MCPA_ENCODING_BIT_PACKED == pHandle->EncodingBuff)
+            {
+              /* No residual known yet, the first buffer sends the values on 16 bits */
+              (void)memset(pHandle->packingTable, 0xFF, (uint32_t)pHandle->HFNumBuff * sizeof(MCPA_Packing_t));
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+          }
+          if (MCPA_ENCODING_DELTA_VARINT == pHandle->EncodingBuff)
+          {
+            /* Each packet can be decoded on its own, its first samples are deltas to zero */
+            (void)memset(pHandle->lastValueTable, 0, (uint32_t)pHandle->HFNumBuff * 2U);
+          }
+          else if (MCPA_ENCODING_BIT_PACKED == pHandle->EncodingBuff)
+          {
+            /* Each packet can be decoded on its own, its first samples are sent on 16 bits */
+            MCPA_startPacking(pHandle);
+          }
+          else
+          {
+            /* Nothing to do */
           }
         }
       }
@@ -107,12 +341,30 @@ void MCPA_dataLog(MCPA_Handle_t *pHandle)
       /* */
       if ((pHandle->bufferIndex > 0U)  && (pHandle->bufferIndex <= pHandle->bufferTxTriggerBuff))
       {
-        logValue16 = (uint16_t *)&pHandle->currentBuffer[pHandle->bufferIndex]; //cstat !MISRAC2012-Rule-11.3
-        for (i = 0U; i < pHandle->HFNumBuff; i++)
+        if (MCPA_ENCODING_DELTA_VARINT == pHandle->EncodingBuff)
         {
-          *logValue16 = *((uint16_t *) pHandle->dataPtrTableBuff[i]) ; //cstat !MISRAC2012-Rule-11.5
-          logValue16++;
-          pHandle->bufferIndex = pHandle->bufferIndex + 2U;
+          uint16_t value;
+          for (i = 0U; i < pHandle->HFNumBuff; i++)
+          {
+            value = *((uint16_t *) pHandle->dataPtrTableBuff[i]); //cstat !MISRAC2012-Rule-11.5
+            pHandle->bufferIndex += MCPA_putVarint(&pHandle->currentBuffer[pHandle->bufferIndex],
+                                                   (int16_t)(value - pHandle->lastValueTable[i]));
+            pHandle->lastValueTable[i] = value;
+          }
+        }
+        else if (MCPA_ENCODING_BIT_PACKED == pHandle->EncodingBuff)
+        {
+          MCPA_packFrame(pHandle);
+        }
+        else
+        {
+          logValue16 = (uint16_t *)&pHandle->currentBuffer[pHandle->bufferIndex]; //cstat !MISRAC2012-Rule-11.3
+          for (i = 0U; i < pHandle->HFNumBuff; i++)
+          {
+            *logValue16 = *((uint16_t *) pHandle->dataPtrTableBuff[i]) ; //cstat !MISRAC2012-Rule-11.5
+            logValue16++;
+            pHandle->bufferIndex = pHandle->bufferIndex + 2U;
+          }
         }
         /* MFRateBuff=254 means we dump MF data once per buffer */
         /* MFRateBuff=255 means we do not dump MF data */
@@ -121,6 +373,7 @@ void MCPA_dataLog(MCPA_Handle_t *pHandle)
           if (pHandle->MFIndex == pHandle->MFRateBuff)
           {
             pHandle->MFIndex = 0U;
+            MCPA_alignBits(pHandle); /* MF values start on a byte, after the bit packed HF values */
             for (i = pHandle->HFNumBuff; i < (pHandle->MFNumBuff + pHandle->HFNumBuff); i++)
             {
               /* Dump MF data */
@@ -171,6 +424,14 @@ void MCPA_dataLog(MCPA_Handle_t *pHandle)
       }
       if (pHandle->bufferIndex > pHandle->bufferTxTriggerBuff)
       {
+        if (MCPA_ENCODING_BIT_PACKED == pHandle->EncodingBuff)
+        {
+          MCPA_endPacking(pHandle);
+        }
+        else
+        {
+          /* Nothing to do */
+        }
         if (pHandle->MFRateBuff == 254U) /* MFRateBuff = 254 means we dump MF data once per buffer */
         {
           for (i = pHandle->HFNumBuff; i < (pHandle->MFNumBuff + pHandle->HFNumBuff); i++)
@@ -228,6 +489,14 @@ void MCPA_flushDataLog (MCPA_Handle_t *pHandle)
 
     if (pHandle->bufferIndex > 0U)
     {  /* If buffer is allocated, we must send it */
+      if (MCPA_ENCODING_BIT_PACKED == pHandle->EncodingBuff)
+      {
+        MCPA_endPacking(pHandle);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
       if (pHandle->MFRateBuff == 254U) /* In case of flush, we must respect the packet format to allow
                                           proper decoding */
       {
@@ -264,22 +533,11 @@ void MCPA_flushDataLog (MCPA_Handle_t *pHandle)
   * @param  *pHandle Pointer to the MCPA Handle
   */
 void MCPA_stopDataLog(MCPA_Handle_t *pHandle)
-{ 
-  uint16_t *logValue16;
-
+{
   pHandle->Mark = 0U;
-  if (pHandle->bufferIndex > 0U)
-  { /* If buffer is allocated, we must send it */
-    logValue16 = (uint16_t *)&pHandle->currentBuffer[pHandle->bufferIndex]; //cstat !MISRAC2012-Rule-11.3
-    *logValue16 = pHandle->MarkBuff; /* MarkBuff is actually 8 bits, but we add also 8 bits of the ASYNCID=0 after
-                                        the MARK */
-    pHandle->pTransportLayer->fSendPacket (pHandle->pTransportLayer, pHandle->currentBuffer,
-                                           pHandle->bufferIndex + 2U, MCTL_ASYNC);
-  }
-  else
-  {
-    /* Nothing to do */
-  }
+  /* If buffer is allocated, we must send it. It is sent as any other packet, with the MF values sent once per
+     buffer, otherwise the controller would decode the end of the last frame as the MF values */
+  MCPA_flushDataLog(pHandle);
   pHandle->bufferIndex = 0U;
   pHandle->MarkBuff    = 0U;
   pHandle->HFIndex     = 0U;
@@ -289,10 +547,15 @@ void MCPA_stopDataLog(MCPA_Handle_t *pHandle)
 /**
   * @brief  Stores the asynchronous configuration stating all the register to be continuously sent to controller
   *
+  * The configuration ends with the Mark byte, optionally followed by the encoding of the HF values
+  * (see MCPA_ENCODING_xxx). Without it, HF values are sent raw. The bit packed encoding is described with
+  * MCPA_startPacking().
+  *
   * @param  *pHandle Pointer to the MCPA Handle
   * @param  *cfgdata Configuration of the Async communication
+  * @param  cfgSize Size of the configuration, in bytes
   */
-uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
+uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata, uint16_t cfgSize)
 {
   uint8_t result = MCP_CMD_OK;
 
@@ -306,8 +569,10 @@ uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
 #endif
     uint8_t i;
     uint16_t logSize = 0U; /* Max size of a log per iteration (HF+MF) */
+    uint16_t headerSize; /* TimeStamp and bit packing header */
     uint16_t newID, buffSize;
     uint8_t *pCfgData = cfgdata;
+    uint8_t encoding = MCPA_ENCODING_RAW;
 
     buffSize = *((uint16_t *)pCfgData); //cstat !MISRAC2012-Rule-11.3
 
@@ -328,7 +593,23 @@ uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
       pHandle->MFNum  = *((uint8_t *)&pCfgData[5]);
       pCfgData = &pCfgData[6]; /* Start of the HF IDs */
 
-      if ((pHandle->HFNum + pHandle->MFNum) <= pHandle->nbrOfDataLog)
+      /* Header, IDs and Mark, then the optional encoding byte */
+      if (cfgSize > (6U + (2U * ((uint16_t)pHandle->HFNum + (uint16_t)pHandle->MFNum)) + 1U))
+      {
+        encoding = pCfgData[2U * ((uint16_t)pHandle->HFNum + (uint16_t)pHandle->MFNum) + 1U];
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if (((pHandle->HFNum + pHandle->MFNum) > pHandle->nbrOfDataLog) || (encoding > MCPA_ENCODING_BIT_PACKED)
+          || ((MCPA_ENCODING_DELTA_VARINT == encoding) && (MC_NULL == pHandle->lastValueTable))
+          || ((MCPA_ENCODING_BIT_PACKED == encoding) && (MC_NULL == pHandle->packingTable)))
+      {
+        result = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else
       {
         for (i = 0; i < (pHandle->HFNum + pHandle->MFNum); i++)
         {
@@ -338,11 +619,25 @@ uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
           pHandle->dataSizeTable[i] = (i < pHandle->HFNum ) ? 2U : RI_GetIDSize(newID);
           pCfgData++; /* Point to the next UID */
           pCfgData++;
-          logSize = logSize+pHandle->dataSizeTable[i];
+          /* Room is reserved for the largest encoded value, the actual size is usually smaller */
+          if ((i < pHandle->HFNum) && (MCPA_ENCODING_DELTA_VARINT == encoding))
+          {
+            logSize = logSize + MCPA_VARINT_MAX_SIZE;
+          }
+          else if ((i < pHandle->HFNum) && (MCPA_ENCODING_BIT_PACKED == encoding))
+          {
+            logSize = logSize + MCPA_PACKED_MAX_SIZE;
+          }
+          else
+          {
+            logSize = logSize + pHandle->dataSizeTable[i];
+          }
         }
+        /* Bit packed buffers start with the number of frames and the width of each HF value */
+        headerSize = (MCPA_ENCODING_BIT_PACKED == encoding) ? (4U + 2U + (uint16_t)pHandle->HFNum) : 4U;
 
-        /* Smallest packet must be able to contain logSize Markbyte AsyncID and TimeStamp */
-        if (buffSize < (logSize + 2U + 4U))
+        /* Smallest packet must be able to contain logSize Markbyte AsyncID, TimeStamp and header */
+        if (buffSize < (logSize + 2U + headerSize))
         {
           result = MCP_ERROR_NO_TXASYNC_SPACE;
         }
@@ -350,6 +645,7 @@ uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
         {
           pHandle->bufferTxTrigger = buffSize-logSize - 2U; /* 2 is required to add the last Mark byte and NUL
                                                                ASYNCID */
+          pHandle->Encoding = encoding;
           pHandle->Mark = *((uint8_t *)pCfgData);
           if (0U == pHandle->Mark)
           {  /* Switch Off condition */
@@ -361,10 +657,6 @@ uint8_t MCPA_cfgLog(MCPA_Handle_t *pHandle, uint8_t *cfgdata)
           }
         }
       }
-      else
-      {
-        result = MCP_ERROR_BAD_RAW_FORMAT;
-      }
     }
 #ifdef NULL_PTR_CHECK_MCPA
   }
@@ -0,0 +1,640 @@
+/**
+  ******************************************************************************
+  * @file    motor_ident.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the Motor
+  *          Identification component of the Motor Control SDK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup MotorIdent
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include "motor_ident.h"
+#include "mc_math.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup MotorIdent Motor Identification
+  *
+  * @brief On-board identification of the motor parameters and tuning of the current and speed loops
+  *
+  * The identification is armed with MID_Start() and runs once the motor reaches the RUN state, the position loop
+  * being suspended. The electrical steps keep the rotor locked with a current on the alpha axis, the current
+  * regulators being replaced by MID_CalcVoltage():
+  *
+  * - The resistance is the slope of the DC voltage between half the test current and the test current, so that the
+  *   constant voltage drop of the dead times cancels out.
+  * - The inductance is derived from the amplitude of the current answering an AC voltage injected over the DC
+  *   current, which keeps the phase currents away from zero. The amplitude is solved against the sampled model of
+  *   the RL circuit supplied by the PWM, so it holds even when L/R is shorter than the PWM period, and it does not
+  *   depend on the control delay.
+  *
+  * The current loops are then tuned by pole-zero cancellation for CurrentBandwidth, and the mechanical step runs in
+  * closed loop: a +I, -I, -I, +I sequence of torque pulses brings the rotor back near its start position. The flux
+  * is the least square fit of the back-EMF on the electrical speed over the sequence. The inertia comes from the
+  * speed changes of the pulses, in which the Coulomb friction cancels out, and the speed loop is tuned for
+  * SpeedBandwidth. The tuned gains are not saved and are lost at the next reset.
+  *
+  * @{
+  */
+
+#define MID_TWO_PI             6.2831853f
+#define MID_KE_SCALE           128.25f  /* Vrms phase to phase per krpm for one weber and one pole pair */
+#define MID_REGULATION_GAIN    0.1f     /* Part of the DC current error corrected per call */
+#define MID_MAX_DC_VOLTAGE     24576.0f /* Largest DC voltage of the resistance step, expressed in s16V */
+#define MID_CURRENT_TOLERANCE  0.25f    /* Largest relative error on the DC current at the end of the settling */
+#define MID_SPEED_ZERO_RATIO   4.0f     /* Ratio between the speed loop bandwidth and its PI zero */
+
+/**
+  * @brief  Reads the sums accumulated by the High Frequency Task.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  pSums receives SumI, SumIcos, SumIsin and SampleCount, in this order.
+  */
+static void MID_ReadSums(const MID_Handle_t *pHandle, uint32_t pSums[4])
+{
+  /* The High Frequency Task may preempt the reading: read again until all are consistent */
+  do
+  {
+    pSums[3] = pHandle->SampleCount;
+    pSums[0] = pHandle->SumI;
+    pSums[1] = pHandle->SumIcos;
+    pSums[2] = pHandle->SumIsin;
+  } while (pSums[3] != pHandle->SampleCount);
+}
+
+/**
+  * @brief  Measures the bus voltage and returns the voltage conversion factor.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @retval Voltage conversion factor, expressed in s16V per volt.
+  */
+static float MID_VoltageConv(MID_Handle_t *pHandle)
+{
+  pHandle->BusVoltage = ((float)VBS_GetAvBusVoltage_d(pHandle->pVBS) * (float)pHandle->pVBS->ConversionFactor)
+                      / 65536.0f;
+  return ((pHandle->BusRatio * 32768.0f) / ((pHandle->BusVoltage > 1.0f) ? pHandle->BusVoltage : 1.0f));
+}
+
+/**
+  * @brief  Applies the gains of a PI regulator and clears its integral term.
+  * @param  pPID PI regulator to tune.
+  * @param  kp proportional gain, expressed in output units per error unit.
+  * @param  ki integral gain, expressed in output units per error unit and per call.
+  */
+static void MID_SetGains(PID_Handle_t *pPID, float kp, float ki)
+{
+  float gain[2];
+  int16_t digit[2];
+  uint8_t i;
+
+  gain[0] = kp * (float)PID_GetKPDivisor(pPID);
+  gain[1] = ki * (float)PID_GetKIDivisor(pPID);
+  for (i = 0U; i < 2U; i++)
+  {
+    if (gain[i] >= (float)INT16_MAX)
+    {
+      digit[i] = INT16_MAX;
+    }
+    else if (gain[i] <= 0.0f)
+    {
+      digit[i] = 0;
+    }
+    else
+    {
+      digit[i] = (int16_t)(gain[i] + 0.5f);
+    }
+  }
+  PID_SetKP(pPID, digit[0]);
+  PID_SetKI(pPID, digit[1]);
+  PID_SetIntegralTerm(pPID, 0);
+}
+
+/**
+  * @brief  Stops the injection of the test voltages.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+static void MID_StopInjection(MID_Handle_t *pHandle)
+{
+  pHandle->Injecting = false;
+  pHandle->Vdc = 0;
+  pHandle->Vac = 0;
+}
+
+/**
+  * @brief  Runs one call of the resistance steps.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  vConv voltage conversion factor, expressed in s16V per volt.
+  */
+static void MID_ExecResistance(MID_Handle_t *pHandle, float vConv)
+{
+  uint32_t sums[4];
+  float target = (MID_RESISTANCE_LOW == pHandle->State) ? (0.5f * pHandle->TestCurrent) : pHandle->TestCurrent;
+  float current;
+  float voltage;
+
+  MID_ReadSums(pHandle, sums);
+  if (pHandle->Counter < pHandle->SettleTicks)
+  {
+    if (sums[3] != pHandle->LastCount)
+    {
+      current = (float)(int32_t)(sums[0] - pHandle->LastSumI) / (float)(sums[3] - pHandle->LastCount);
+      pHandle->VdcRef += MID_REGULATION_GAIN * pHandle->NominalRs * (vConv / pHandle->CurrentConv)
+                       * ((target * pHandle->CurrentConv) - current);
+      if (pHandle->VdcRef > MID_MAX_DC_VOLTAGE)
+      {
+        pHandle->VdcRef = MID_MAX_DC_VOLTAGE;
+      }
+      else if (pHandle->VdcRef < 0.0f)
+      {
+        pHandle->VdcRef = 0.0f;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->Vdc = (int16_t)pHandle->VdcRef;
+    }
+    else
+    {
+      /* No current sampled since the previous call */
+    }
+    pHandle->Counter++;
+    if (pHandle->Counter == pHandle->SettleTicks)
+    {
+      /* The DC voltage is frozen during the measurement window */
+      pHandle->StartSumI = sums[0];
+      pHandle->StartCount = sums[3];
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else if (pHandle->Counter < (pHandle->SettleTicks + pHandle->MeasureTicks))
+  {
+    pHandle->Counter++;
+  }
+  else
+  {
+    current = (float)(int32_t)(sums[0] - pHandle->StartSumI) / (float)(sums[3] - pHandle->StartCount);
+    current /= pHandle->CurrentConv;
+    voltage = (float)pHandle->Vdc / vConv;
+    if (fabsf(current - target) > (MID_CURRENT_TOLERANCE * target))
+    {
+      MID_StopInjection(pHandle);
+      pHandle->State = MID_ERROR_RESISTANCE;
+    }
+    else if (MID_RESISTANCE_LOW == pHandle->State)
+    {
+      pHandle->LowVoltage = voltage;
+      pHandle->LowCurrent = current;
+      pHandle->Counter = 0U;
+      pHandle->State = MID_RESISTANCE_HIGH;
+    }
+    else
+    {
+      pHandle->Rs = (voltage - pHandle->LowVoltage) / (current - pHandle->LowCurrent);
+      if (pHandle->Rs <= 0.0f)
+      {
+        MID_StopInjection(pHandle);
+        pHandle->State = MID_ERROR_RESISTANCE;
+      }
+      else
+      {
+        /* The AC current cannot exceed half the DC current, even without inductance */
+        float vac = 0.5f * pHandle->TestCurrent * pHandle->Rs * vConv;
+        float vacMax = (float)INT16_MAX - (float)pHandle->Vdc;
+        pHandle->Vac = (int16_t)((vac < vacMax) ? vac : vacMax);
+        pHandle->Angle = 0;
+        pHandle->Counter = 0U;
+        pHandle->State = MID_INDUCTANCE;
+      }
+    }
+  }
+  pHandle->LastSumI = sums[0];
+  pHandle->LastCount = sums[3];
+}
+
+/**
+  * @brief  Runs one call of the inductance step, then tunes the current loops.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  vConv voltage conversion factor, expressed in s16V per volt.
+  */
+static void MID_ExecInductance(MID_Handle_t *pHandle, float vConv)
+{
+  uint32_t sums[4];
+
+  MID_ReadSums(pHandle, sums);
+  if (pHandle->Counter < pHandle->SettleTicks)
+  {
+    pHandle->Counter++;
+    if (pHandle->Counter == pHandle->SettleTicks)
+    {
+      pHandle->StartSumIcos = sums[1];
+      pHandle->StartSumIsin = sums[2];
+      pHandle->StartCount = sums[3];
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else if (pHandle->Counter < (pHandle->SettleTicks + pHandle->MeasureTicks))
+  {
+    pHandle->Counter++;
+  }
+  else
+  {
+    float cosSum = (float)(int32_t)(sums[1] - pHandle->StartSumIcos);
+    float sinSum = (float)(int32_t)(sums[2] - pHandle->StartSumIsin);
+    float currentAc = (2.0f * sqrtf((cosSum * cosSum) + (sinSum * sinSum)))
+                    / ((float)(sums[3] - pHandle->StartCount) * pHandle->CurrentConv);
+    float voltageAc = (float)pHandle->Vac / vConv;
+    float omega = (MID_TWO_PI * (float)pHandle->InjectionFrequencyHz) / (float)pHandle->HFFrequencyHz;
+    float g = 0.0f;
+
+    MID_StopInjection(pHandle);
+    if (currentAc > 0.0f)
+    {
+      /* With a = exp(-Rs Ts / Ls), the sampled RL circuit answers Vac with Vac (1 - a) / (Rs |exp(j omega) - a|).
+         g is |exp(j omega) - a|^2 / (1 - a)^2, and a the root below 1 of a^2 - 2 c a + 1 = 0 */
+      g = voltageAc / (pHandle->Rs * currentAc);
+      g *= g;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (g > 1.001f)
+    {
+      float c = (g - cosf(omega)) / (g - 1.0f);
+      float a = c - sqrtf((c * c) - 1.0f);
+      float scale = vConv / pHandle->CurrentConv;
+      float omegaC = MID_TWO_PI * pHandle->CurrentBandwidth;
+
+      pHandle->Ls = -pHandle->Rs / ((float)pHandle->HFFrequencyHz * logf(a));
+      /* The PI zero cancels the pole of the RL circuit */
+      MID_SetGains(pHandle->pPIDIq, pHandle->Ls * omegaC * scale,
+                   (pHandle->Rs * omegaC * scale) / (float)pHandle->HFFrequencyHz);
+      MID_SetGains(pHandle->pPIDId, pHandle->Ls * omegaC * scale,
+                   (pHandle->Rs * omegaC * scale) / (float)pHandle->HFFrequencyHz);
+      pHandle->FluxNum = 0.0f;
+      pHandle->FluxDen = 0.0f;
+      pHandle->Counter = 0U;
+      pHandle->State = MID_MECHANICAL;
+    }
+    else
+    {
+      pHandle->State = MID_ERROR_INDUCTANCE;
+    }
+  }
+}
+
+/**
+  * @brief  Runs one call of the mechanical step, then tunes the speed loop.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  Vqd voltages applied by the current regulators, expressed in s16V.
+  * @param  Iqd measured currents, expressed in s16A.
+  * @param  hMecSpeedUnit measured mechanical speed, expressed in #SPEED_UNIT.
+  * @param  vConv voltage conversion factor, expressed in s16V per volt.
+  * @retval Iq current reference, expressed in s16A.
+  */
+static int16_t MID_ExecMechanical(MID_Handle_t *pHandle, qd_t Vqd, qd_t Iqd, int16_t hMecSpeedUnit, float vConv)
+{
+  float speed = ((float)hMecSpeedUnit * MID_TWO_PI) / (float)pHandle->SpeedUnit;
+  uint16_t start = pHandle->SettleTicks;
+  uint16_t pulse = pHandle->PulseTicks;
+  uint16_t time = pHandle->Counter;
+  int16_t torque = (int16_t)(pHandle->TorqueCurrent * pHandle->CurrentConv);
+  int16_t iqRef = 0;
+
+  if (time == start)
+  {
+    pHandle->Speed[0] = speed;
+  }
+  else if (time == (start + pulse))
+  {
+    pHandle->Speed[1] = speed;
+  }
+  else if (time == (start + (3U * pulse)))
+  {
+    pHandle->Speed[2] = speed;
+  }
+  else if (time == (start + (4U * pulse)))
+  {
+    pHandle->Speed[3] = speed;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (time < start)
+  {
+    /* The current loops settle with their new gains */
+  }
+  else if (time < (start + (4U * pulse)))
+  {
+    float elSpeed = speed * (float)pHandle->PolePairs;
+    float bemf = ((float)Vqd.q / vConv)
+               - ((pHandle->Rs * (float)Iqd.q) / pHandle->CurrentConv)
+               - ((elSpeed * pHandle->Ls * (float)Iqd.d) / pHandle->CurrentConv);
+
+    pHandle->FluxNum += bemf * elSpeed;
+    pHandle->FluxDen += elSpeed * elSpeed;
+    iqRef = ((time < (start + pulse)) || (time >= (start + (3U * pulse)))) ? torque : -torque;
+  }
+  else
+  {
+    float duration = (float)pulse / (float)pHandle->MFFrequencyHz;
+    float *w = pHandle->Speed;
+    float deltaSpeed = (2.0f * w[1]) - (2.0f * w[2]) + w[3] - w[0];
+
+    pHandle->Flux = (pHandle->FluxDen > 0.0f) ? (pHandle->FluxNum / pHandle->FluxDen) : 0.0f;
+    if ((pHandle->Flux > 0.0f) && (deltaSpeed > 0.0f))
+    {
+      float kt = 1.5f * (float)pHandle->PolePairs * pHandle->Flux;
+      float omegaS = MID_TWO_PI * pHandle->SpeedBandwidth;
+      float kp;
+      float scale = (pHandle->CurrentConv * MID_TWO_PI) / (float)pHandle->SpeedUnit;
+
+      /* Friction opposes the speed: it slows the first pulse, helps the last one and cancels in the middle */
+      pHandle->Inertia = (4.0f * kt * pHandle->TorqueCurrent * duration) / deltaSpeed;
+      pHandle->Friction = (pHandle->Inertia * ((w[3] - w[2]) - (w[1] - w[0]))) / (2.0f * duration);
+      kp = (pHandle->Inertia * omegaS) / kt;
+      MID_SetGains(pHandle->pPIDSpeed, kp * scale,
+                   ((kp * omegaS * scale) / MID_SPEED_ZERO_RATIO) / (float)pHandle->MFFrequencyHz);
+      pHandle->State = MID_DONE;
+    }
+    else
+    {
+      pHandle->State = MID_ERROR_MECHANICAL;
+    }
+  }
+  pHandle->Counter++;
+  return (iqRef);
+}
+
+/**
+  * @brief  Initializes the Motor Identification component.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+void MID_Init(MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    MID_StopInjection(pHandle);
+    pHandle->AngleStep = (int16_t)(((int32_t)pHandle->InjectionFrequencyHz * 65536) / pHandle->HFFrequencyHz);
+    pHandle->State = MID_IDLE;
+    pHandle->BusVoltage = 0.0f;
+    pHandle->Rs = 0.0f;
+    pHandle->Ls = 0.0f;
+    pHandle->Flux = 0.0f;
+    pHandle->Inertia = 0.0f;
+    pHandle->Friction = 0.0f;
+#ifdef NULL_PTR_CHECK_MID
+  }
+#endif
+}
+
+/**
+  * @brief  Arms the identification, it starts when the motor reaches the RUN state.
+  *
+  * The results of the previous identification are cleared. The TestCurrent, TorqueCurrent and bandwidths can be
+  * changed until the motor is started.
+  *
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+void MID_Start(MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    MID_Init(pHandle);
+    pHandle->State = MID_ARMED;
+#ifdef NULL_PTR_CHECK_MID
+  }
+#endif
+}
+
+/**
+  * @brief  Aborts the identification, the gains already tuned are kept.
+  *
+  * To be called when the PWM is switched off. It has no effect once the identification is completed.
+  *
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+void MID_Stop(MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (MID_IsRunning(pHandle))
+    {
+      MID_StopInjection(pHandle);
+      pHandle->State = MID_ABORTED;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_MID
+  }
+#endif
+}
+
+/**
+  * @brief  Returns true from MID_Start() until the identification is completed or fails.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+bool MID_IsRunning(const MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  return ((MC_NULL == pHandle) ? false : ((pHandle->State >= MID_ARMED) && (pHandle->State <= MID_MECHANICAL)));
+#else
+  return ((pHandle->State >= MID_ARMED) && (pHandle->State <= MID_MECHANICAL));
+#endif
+}
+
+/**
+  * @brief  Returns true while MID_CalcVoltage() replaces the current regulators.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+bool MID_IsInjecting(const MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  return ((MC_NULL == pHandle) ? false : pHandle->Injecting);
+#else
+  return (pHandle->Injecting);
+#endif
+}
+
+/**
+  * @brief  Returns the test voltages and accumulates the measured current.
+  *
+  * To be called by the High Frequency Task instead of the current regulators while MID_IsInjecting() returns true.
+  * It costs three multiplications and a sine table lookup.
+  *
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  Ialphabeta measured currents, expressed in s16A.
+  * @retval Voltages to apply, expressed in s16V. Only the alpha axis is driven.
+  */
+alphabeta_t MID_CalcVoltage(MID_Handle_t *pHandle, alphabeta_t Ialphabeta)
+{
+  alphabeta_t Valphabeta = {0, 0};
+#ifdef NULL_PTR_CHECK_MID
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    Trig_Components trig = MCM_Trig_Functions(pHandle->Angle);
+    int32_t current = (int32_t)Ialphabeta.alpha;
+
+    pHandle->SumI += (uint32_t)current;
+    pHandle->SumIcos += (uint32_t)((current * trig.hCos) >> 15);
+    pHandle->SumIsin += (uint32_t)((current * trig.hSin) >> 15);
+    /* Published last, MID_ReadSums() relies on it */
+    pHandle->SampleCount++;
+
+    Valphabeta.alpha = (int16_t)((int32_t)pHandle->Vdc + (((int32_t)pHandle->Vac * trig.hCos) >> 15));
+    pHandle->Angle += pHandle->AngleStep;
+#ifdef NULL_PTR_CHECK_MID
+  }
+#endif
+  return (Valphabeta);
+}
+
+/**
+  * @brief  Runs one step of the identification.
+  *
+  * To be called by the Medium Frequency Task at MFFrequencyHz in the RUN state while MID_IsRunning() returns true,
+  * instead of the position and speed loops. The motor has to be stopped once MID_IsRunning() returns false.
+  *
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @param  Vqd voltages applied by the current regulators, expressed in s16V.
+  * @param  Iqd measured currents, expressed in s16A.
+  * @param  hMecSpeedUnit measured mechanical speed, expressed in #SPEED_UNIT.
+  * @retval Current references to apply, expressed in s16A.
+  */
+qd_t MID_Exec(MID_Handle_t *pHandle, qd_t Vqd, qd_t Iqd, int16_t hMecSpeedUnit)
+{
+  qd_t IqdRef = {0, 0};
+#ifdef NULL_PTR_CHECK_MID
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    float vConv = MID_VoltageConv(pHandle);
+
+    switch (pHandle->State)
+    {
+      case MID_ARMED:
+      {
+        uint32_t sums[4];
+
+        MID_ReadSums(pHandle, sums);
+        pHandle->LastSumI = sums[0];
+        pHandle->LastCount = sums[3];
+        pHandle->VdcRef = 0.0f;
+        pHandle->Counter = 0U;
+        pHandle->State = MID_RESISTANCE_LOW;
+        pHandle->Injecting = true;
+        break;
+      }
+
+      case MID_RESISTANCE_LOW:
+      case MID_RESISTANCE_HIGH:
+      {
+        MID_ExecResistance(pHandle, vConv);
+        break;
+      }
+
+      case MID_INDUCTANCE:
+      {
+        MID_ExecInductance(pHandle, vConv);
+        break;
+      }
+
+      case MID_MECHANICAL:
+      {
+        IqdRef.q = MID_ExecMechanical(pHandle, Vqd, Iqd, hMecSpeedUnit, vConv);
+        break;
+      }
+
+      default:
+        break;
+    }
+#ifdef NULL_PTR_CHECK_MID
+  }
+#endif
+  return (IqdRef);
+}
+
+/**
+  * @brief  Returns the state of the identification.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  */
+MID_State_t MID_GetState(const MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  return ((MC_NULL == pHandle) ? MID_IDLE : pHandle->State);
+#else
+  return (pHandle->State);
+#endif
+}
+
+/**
+  * @brief  Returns the identified voltage constant, in the unit of MOTOR_VOLTAGE_CONSTANT.
+  * @param  pHandle handler of the current instance of the Motor Identification component.
+  * @retval Voltage constant, expressed in Vrms phase to phase per thousand mechanical rpm.
+  */
+float MID_GetKe(const MID_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MID
+  return ((MC_NULL == pHandle) ? 0.0f : (pHandle->Flux * (float)pHandle->PolePairs * MID_KE_SCALE));
+#else
+  return (pHandle->Flux * (float)pHandle->PolePairs * MID_KE_SCALE);
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -48,6 +48,15 @@
   * In case of Pull up configuration @f$\frac{dV}{dT}@f$ is positive and @f$V_0@f$ is low.
   * In case of Pull down configuration @f$\frac{dV}{dT}@f$ is negative and @f$V_0@f$ is high.
   *
+  * Sensors that do not follow this formula, or follow it only over a limited range, are described by a
+  * table of #NTC_TABLE_SIZE temperatures instead, see NTC_Handle_t::pTempTable. The table is linearly
+  * interpolated.
+  *
+  * The measurement is filtered by a first order filter with a time constant of hLowPassFilterBW
+  * calls of NTC_CalcAvTemp(). A step of the temperature from @f$T_a@f$ to @f$T_b@f$ raises the
+  * over temperature fault after @f$-hLowPassFilterBW \cdot \ln(1 - \frac{T_{th} - T_a}{T_b - T_a})@f$ calls,
+  * where @f$T_{th}@f$ is the over temperature threshold.
+  *
   * In case a real temperature sensor is not available (Sensor Type = #VIRTUAL_SENSOR),
   * This component will always returns a constant, programmable, temperature.
   *
@@ -113,6 +122,12 @@ __weak void NTC_Init(NTC_Handle_t *pHandle)
   else
   {
 #endif
+    pHandle->bLowPassFilterShift = 0U;
+    while (((uint32_t)2U << pHandle->bLowPassFilterShift) <= (uint32_t)pHandle->hLowPassFilterBW)
+    {
+      pHandle->bLowPassFilterShift++;
+    }
+
     if (REAL_SENSOR == pHandle->bSensorType)
     {
       NTC_Clear(pHandle);
@@ -143,6 +158,7 @@ __weak void NTC_Clear(NTC_Handle_t *pHandle)
   {
 #endif
     pHandle->hAvTemp_d = 0U;
+    pHandle->wAvTempSum = 0U;
 #ifdef NULL_PTR_CHECK_NTC_TEMP_SENS
   }
 #endif
@@ -151,6 +167,8 @@ __weak void NTC_Clear(NTC_Handle_t *pHandle)
 /**
   * @brief Performs the temperature sensing average computation after an ADC conversion
   *
+  * The first order filter only needs shifts: its state is the average scaled by hLowPassFilterBW.
+  *
   * @param pHandle : Pointer on Handle structure of TemperatureSensor component
   *
   * @retval Fault status : Error reported in case of an over temperature detection
@@ -177,13 +195,10 @@ __weak uint16_t NTC_CalcAvTemp(NTC_Handle_t *pHandle, uint16_t rawValue)
       }
       else
       {
-        uint32_t wtemp;
-        wtemp = (uint32_t)(pHandle->hLowPassFilterBW) - 1U;
-        wtemp *= ((uint32_t)pHandle->hAvTemp_d);
-        wtemp += hAux;
-        wtemp /= ((uint32_t)pHandle->hLowPassFilterBW);
+        pHandle->wAvTempSum -= pHandle->wAvTempSum >> pHandle->bLowPassFilterShift;
+        pHandle->wAvTempSum += hAux;
 
-        pHandle->hAvTemp_d = (uint16_t)wtemp;
+        pHandle->hAvTemp_d = (uint16_t)(pHandle->wAvTempSum >> pHandle->bLowPassFilterShift);
       }
 
       pHandle->hFaultState = NTC_SetFaultState(pHandle);
@@ -218,6 +233,8 @@ __weak uint16_t NTC_GetAvTemp_d(const NTC_Handle_t *pHandle) //cstat !MISRAC2012
 /**
   * @brief  Returns latest averaged temperature expressed in Celsius degrees
   *
+  * The temperature is interpolated in the table of the sensor if any, computed with the linear model otherwise.
+  *
   * @param pHandle : Pointer on Handle structure of TemperatureSensor component
   *
   * @retval AverageTemperature : Latest averaged temperature measured (in Celsius degrees)
@@ -235,7 +252,21 @@ __weak int16_t NTC_GetAvTemp_C(NTC_Handle_t *pHandle) //cstat !MISRAC2012-Rule-8
 #endif
     int32_t wTemp;
 
-    if (REAL_SENSOR == pHandle->bSensorType)
+    if ((REAL_SENSOR == pHandle->bSensorType) && (pHandle->pTempTable != MC_NULL))
+    {
+      uint32_t index = (uint32_t)pHandle->hAvTemp_d >> NTC_TABLE_SHIFT;
+      int32_t fraction = (int32_t)pHandle->hAvTemp_d & (int32_t)((1UL << NTC_TABLE_SHIFT) - 1U);
+
+      wTemp = (int32_t)pHandle->pTempTable[index + 1U] - (int32_t)pHandle->pTempTable[index];
+      wTemp *= fraction;
+#ifndef FULL_MISRA_C_COMPLIANCY_NTC_TEMP
+      //cstat !MISRAC2012-Rule-1.3_n !ATH-shift-neg !MISRAC2012-Rule-10.1_R6
+      wTemp = (wTemp >> NTC_TABLE_SHIFT) + (int32_t)pHandle->pTempTable[index];
+#else
+      wTemp = (wTemp / (int32_t)(1UL << NTC_TABLE_SHIFT)) + (int32_t)pHandle->pTempTable[index];
+#endif
+    }
+    else if (REAL_SENSOR == pHandle->bSensorType)
     {
       wTemp = (int32_t)pHandle->hAvTemp_d;
       wTemp -= ((int32_t)pHandle->wV0);
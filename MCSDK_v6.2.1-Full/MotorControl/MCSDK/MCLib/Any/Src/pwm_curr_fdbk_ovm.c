@@ -284,8 +284,10 @@ uint16_t PWMC_SetPhaseVoltage_OVM(PWMC_Handle_t *pHandle, alphabeta_t Valfa_beta
 
     if (vref < OVM_VREF_MODE1_START)      /* Linear range */
     {
-      wUAlpha = Valfa_beta.alpha;
-      wUBeta = Valfa_beta.beta;
+      /* Same gain as at the start of the OVM mode 1 range: vref is relative to the six-step fundamental, the
+         hexagon vertex is pi/3 of it. The fundamental follows vref without a step at the range boundary */
+      wUAlpha = (Valfa_beta.alpha * OVM_3_DIV_PI) / OVM_ONE_POINT_ZERO;
+      wUBeta = (Valfa_beta.beta * OVM_3_DIV_PI) / OVM_ONE_POINT_ZERO;
       ovm_mode_flag = OVM_LINEAR;
     }
     else if (vref < OVM_VREF_MODE2_START) /* OVM mode 1 range */
@@ -502,6 +504,7 @@ uint16_t PWMC_SetPhaseVoltage_OVM(PWMC_Handle_t *pHandle, alphabeta_t Valfa_beta
     pHandle->CntPhA = (uint16_t)duty_a ;
     pHandle->CntPhB = (uint16_t)duty_b ;
     pHandle->CntPhC = (uint16_t)duty_c;
+    PWMC_DPWM_ClampLow(pHandle);
     retvalue = pHandle->pFctSetADCSampPointSectX(pHandle);
 #ifdef NULL_PTR_CHECK_PWM_CUR_FDB_OVM
   }
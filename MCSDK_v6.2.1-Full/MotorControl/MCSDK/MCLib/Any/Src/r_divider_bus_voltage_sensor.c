@@ -87,6 +87,7 @@ __weak void RVBS_Clear(RDivider_Handle_t *pHandle)
     {
       pHandle->aBuffer[index] = aux;
     }
+    pHandle->SumBuffer = (uint32_t)aux * pHandle->LowPassFilterBW;
     pHandle->_Super.LatestConv = aux;
     pHandle->_Super.AvBusVoltage_d = aux;
     pHandle->index = 0U;
@@ -98,6 +99,9 @@ __weak void RVBS_Clear(RDivider_Handle_t *pHandle)
 /**
   * @brief  It actually performes the Vbus ADC conversion and updates averaged
   *         value for all STM32 families except STM32F3 in u16Volt format.
+  *
+  *         The average is a moving average over the last LowPassFilterBW samples, kept
+  *         as a running sum: the cost does not depend on the filter length.
   * @param  pHandle related RDivider_Handle_t
   * @retval uint16_t Fault code error
   */
@@ -114,7 +118,6 @@ __weak uint16_t RVBS_CalcAvVbus(RDivider_Handle_t *pHandle, uint16_t rawValue)
 #endif
     uint32_t wtemp;
     uint16_t hAux;
-    uint8_t i;
 
     hAux = rawValue;
 
@@ -124,14 +127,11 @@ __weak uint16_t RVBS_CalcAvVbus(RDivider_Handle_t *pHandle, uint16_t rawValue)
     }
     else
     {
-      /* Store latest value on buffer */
+      /* Replace the oldest value of the buffer by the latest one */
+      pHandle->SumBuffer -= pHandle->aBuffer[pHandle->index];
+      pHandle->SumBuffer += hAux;
       pHandle->aBuffer[pHandle->index] = hAux;
-      wtemp = 0u;
-      for (i = 0U; i < (uint8_t)pHandle->LowPassFilterBW; i++)
-      {
-        wtemp += pHandle->aBuffer[i];
-      }
-      wtemp /= pHandle->LowPassFilterBW;
+      wtemp = pHandle->SumBuffer / pHandle->LowPassFilterBW;
       /* Averaging done over the buffer stored values */
       pHandle->_Super.AvBusVoltage_d = (uint16_t)wtemp;
       pHandle->_Super.LatestConv = hAux;
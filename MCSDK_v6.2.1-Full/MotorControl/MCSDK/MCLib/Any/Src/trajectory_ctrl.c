@@ -125,6 +125,10 @@ void TC_Init(PosCtrl_Handle_t *pHandle, PID_Handle_t *pPIDPosReg, SpeednTorqCtrl
   pHandle->ReceivedTh = 0.0f;
   pHandle->TcTick = 0;
   pHandle->ElapseTime = 0.0f;
+  pHandle->TorqueFeedForward = 0;
+  pHandle->TorqueRefFF = 0;
+  pHandle->TorqueRefFB = 0;
+  pHandle->RefPerturbation = 0;
 
   pHandle->PositionControlRegulation = DISABLE;
   pHandle->PositionCtrlStatus = TC_READY_FOR_COMMAND;
@@ -154,7 +158,8 @@ bool TC_MoveCommand(PosCtrl_Handle_t *pHandle, float startingAngle, float angleS
   bool RetConfigStatus = false;
   float fMinimumStepDuration;
 
-  if ((pHandle->PositionCtrlStatus == TC_FOLLOWING_ON_GOING) && (movementDuration > 0))
+  if (((pHandle->PositionCtrlStatus == TC_FOLLOWING_ON_GOING) || (pHandle->PositionCtrlStatus == TC_STREAMING_ON_GOING))
+      && (movementDuration > 0))
   {
     /* Back to Move command as the movement duration is different from 0 */
     pHandle->PositionCtrlStatus = TC_READY_FOR_COMMAND;
@@ -203,6 +208,7 @@ bool TC_MoveCommand(PosCtrl_Handle_t *pHandle, float startingAngle, float angleS
     pHandle->Omega = 0.0f;
     pHandle->Acceleration = 0.0f;
     pHandle->Theta = startingAngle;
+    pHandle->TorqueFeedForward = 0;
 
     pHandle->PositionCtrlStatus = TC_MOVEMENT_ON_GOING;   /* new trajectory has been programmed */
 
@@ -284,11 +290,41 @@ void TC_FollowCommand(PosCtrl_Handle_t *pHandle, float Angle)
   pHandle->Acceleration = acceleration;
   pHandle->Omega = omega;
   pHandle->Theta = Angle;
+  pHandle->TorqueFeedForward = 0;
 
   pHandle->PositionCtrlStatus = TC_FOLLOWING_ON_GOING;   /* follow mode has been programmed */
   pHandle->MovementDuration = 0;
 }
 
+/**
+  * @brief  Applies a setpoint computed by an external trajectory generator.
+  * @param  pHandle handler of the current instance of the Position Control component.
+  * @param  Angle Target mechanical position, expressed in radians.
+  * @param  Speed Target mechanical speed, expressed in rad/s.
+  * @param  Acceleration Target mechanical acceleration, expressed in rad/s^2.
+  * @param  TorqueFF Torque feed-forward added to the position PID output, expressed in digit.
+  *
+  * Unlike TC_FollowCommand(), speed and acceleration are not estimated by differencing, so this
+  * function is meant to be called at every position loop period (see the Setpoint Stream component).
+  * The follow mode state is kept consistent, so that a following TC_FollowCommand() continues
+  * smoothly from this setpoint.
+  */
+void TC_StreamCommand(PosCtrl_Handle_t *pHandle, float Angle, float Speed, float Acceleration, int16_t TorqueFF)
+{
+  pHandle->ThetaPrev = Angle;
+  pHandle->OmegaPrev = Speed;
+  pHandle->ReceivedTh = 2;
+  pHandle->TcTick = 0;
+
+  pHandle->Acceleration = Acceleration;
+  pHandle->Omega = Speed;
+  pHandle->Theta = Angle;
+  pHandle->TorqueFeedForward = TorqueFF;
+
+  pHandle->PositionCtrlStatus = TC_STREAMING_ON_GOING;   /* streamed setpoint has been programmed */
+  pHandle->MovementDuration = 0;
+}
+
 /**
   * @brief  Proceeds on the position control loop.
   * @param  pHandle: handler of the current instance of the Position Control component.
@@ -300,6 +336,7 @@ void TC_PositionRegulation(PosCtrl_Handle_t *pHandle)
   int32_t wMecAngle;
   int32_t wError;
   int32_t hTorqueRef_Pos;
+  float fTorqueFF;
 
   if (pHandle->PositionCtrlStatus == TC_MOVEMENT_ON_GOING)
   {
@@ -321,14 +358,65 @@ void TC_PositionRegulation(PosCtrl_Handle_t *pHandle)
 
   if (pHandle->PositionControlRegulation == ENABLE)
   {
-    wMecAngleRef = (int32_t)(pHandle->Theta * RADTOS16);
+    wMecAngleRef = (int32_t)(pHandle->Theta * RADTOS16) + pHandle->RefPerturbation;
+    if (pHandle->pBacklash != MC_NULL)
+    {
+      wMecAngleRef += BLC_CalcOffset(pHandle->pBacklash, wMecAngleRef);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
 
     wMecAngle = SPD_GetMecAngle(STC_GetSpeedSensor(pHandle->pSTC));
     wError = wMecAngleRef - wMecAngle;
-    hTorqueRef_Pos = PID_Controller(pHandle->PIDPosRegulator, wError);
+    pHandle->TorqueRefFB = PID_Controller(pHandle->PIDPosRegulator, wError);
+
+    /* Feed-forward from the reference trajectory: inertia, viscous and Coulomb friction */
+    fTorqueFF = (pHandle->InertiaFF * pHandle->Acceleration) + (pHandle->ViscousFF * pHandle->Omega);
+    if (pHandle->Omega > pHandle->CoulombDeadband)
+    {
+      fTorqueFF += pHandle->CoulombFF;
+    }
+    else if (pHandle->Omega < -pHandle->CoulombDeadband)
+    {
+      fTorqueFF -= pHandle->CoulombFF;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    fTorqueFF += (float)pHandle->TorqueFeedForward;
+    if (fTorqueFF > (float)INT16_MAX)
+    {
+      fTorqueFF = (float)INT16_MAX;
+    }
+    else if (fTorqueFF < (float)-INT16_MAX)
+    {
+      fTorqueFF = (float)-INT16_MAX;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pHandle->TorqueRefFF = (int16_t)fTorqueFF;
+
+    hTorqueRef_Pos = (int32_t)pHandle->TorqueRefFB + (int32_t)pHandle->TorqueRefFF;
+    if (hTorqueRef_Pos > pHandle->pSTC->MaxPositiveTorque)
+    {
+      hTorqueRef_Pos = pHandle->pSTC->MaxPositiveTorque;
+    }
+    else if (hTorqueRef_Pos < pHandle->pSTC->MinNegativeTorque)
+    {
+      hTorqueRef_Pos = pHandle->pSTC->MinNegativeTorque;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
 
     STC_SetControlMode(pHandle->pSTC, MCM_TORQUE_MODE);
-    STC_ExecRamp(pHandle->pSTC, hTorqueRef_Pos, 0);
+    STC_ExecRamp(pHandle->pSTC, (int16_t)hTorqueRef_Pos, 0);
   }
   else
   {
@@ -378,6 +466,8 @@ void TC_MoveExecution(PosCtrl_Handle_t *pHandle)
   else
   {
     pHandle->Theta = pHandle->FinalAngle;
+    pHandle->Omega = 0.0f;
+    pHandle->Acceleration = 0.0f;
     pHandle->PositionCtrlStatus = TC_TARGET_POSITION_REACHED;
   }
 
@@ -450,7 +540,7 @@ void TC_EncAlignmentCommand(PosCtrl_Handle_t *pHandle)
     else
     {
       /* If index is not supprted set the alignment angle as zero reference */
-      pHandle->pENC->_Super.wMecAngle = 0;
+      STC_GetSpeedSensor(pHandle->pSTC)->wMecAngle = 0;
       pHandle->AlignmentStatus = TC_ALIGNMENT_COMPLETED;
       pHandle->PositionCtrlStatus = TC_READY_FOR_COMMAND;
       pHandle->PositionControlRegulation = ENABLE;
@@ -552,6 +642,51 @@ AlignStatus_t TC_GetAlignmentStatus(PosCtrl_Handle_t *pHandle)
   return (pHandle->AlignmentStatus);
 }
 
+/**
+  * @brief  Sets the feed-forward gains of the position controller.
+  * @param  pHandle handler of the current instance of the Position Control component.
+  * @param  Inertia Acceleration gain, expressed in digit/(rad/s^2).
+  * @param  Viscous Speed gain, expressed in digit/(rad/s).
+  * @param  Coulomb Constant torque applied in the direction of the reference speed, expressed in digit.
+  *
+  * The feed-forward torque is computed from the reference trajectory (Omega and Acceleration) and added
+  * to the output of the position PID, so that the PID only has to correct the residual following error.
+  */
+void TC_SetFeedForwardGains(PosCtrl_Handle_t *pHandle, float Inertia, float Viscous, float Coulomb)
+{
+  pHandle->InertiaFF = Inertia;
+  pHandle->ViscousFF = Viscous;
+  pHandle->CoulombFF = Coulomb;
+}
+
+/**
+  * @brief  Returns the feed-forward contribution of the last torque reference, expressed in digit.
+  * @param  pHandle handler of the current instance of the Position Control component.
+  */
+int16_t TC_GetTorqueRefFF(PosCtrl_Handle_t *pHandle)
+{
+  return (pHandle->TorqueRefFF);
+}
+
+/**
+  * @brief  Returns the feedback (PID) contribution of the last torque reference, expressed in digit.
+  * @param  pHandle handler of the current instance of the Position Control component.
+  */
+int16_t TC_GetTorqueRefFB(PosCtrl_Handle_t *pHandle)
+{
+  return (pHandle->TorqueRefFB);
+}
+
+/**
+  * @brief  Sets the perturbation added to the position reference, before the backlash compensation.
+  * @param  pHandle handler of the current instance of the Position Control component.
+  * @param  Perturbation offset of the reference, expressed in s16degree. 0 when no measurement is running.
+  */
+void TC_SetRefPerturbation(PosCtrl_Handle_t *pHandle, int32_t Perturbation)
+{
+  pHandle->RefPerturbation = Perturbation;
+}
+
 /**
   * @brief  Increments Tick counter used in follow mode.
   * @param  pHandle handler of the current instance of the Position Control component.
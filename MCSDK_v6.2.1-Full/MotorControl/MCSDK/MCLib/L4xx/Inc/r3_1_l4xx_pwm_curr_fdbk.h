@@ -80,6 +80,11 @@ typedef const struct
                                              registers are updated again. In
                                              particular:
                                              RepetitionCounter= (2* #PWM periods)-1*/
+  uint8_t  TimShift;                      /* SHIFTED_TIMs starts the timer half a PWM period
+                                             ahead of an unshifted one, so that the current
+                                             reading interrupts of two drives started by the
+                                             same TIM2 trigger interleave. NO_SHIFTED_TIMs
+                                             otherwise. */
 } R3_1_Params_t;
 
 
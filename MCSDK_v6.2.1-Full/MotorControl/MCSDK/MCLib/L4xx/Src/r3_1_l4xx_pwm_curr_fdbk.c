@@ -107,6 +107,16 @@ __weak void R3_1_Init( PWMC_R3_1_Handle_t * pHandle )
      * a synchronous start by TIM2 trigger */
     LL_TIM_DisableCounter( TIMx );
 
+    if ( SHIFTED_TIMs == pHandle->pParams_str->TimShift )
+    {
+      /* Half a PWM period ahead: the ADC triggers of the two drives alternate */
+      LL_TIM_SetCounter( TIMx, ( uint32_t )( pHandle->Half_PWMPeriod ) - 1u );
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
     if ( TIMx == TIM1 )
     {
       /* TIM1 Counter Clock stopped when the core is halted */
@@ -127,6 +137,24 @@ __weak void R3_1_Init( PWMC_R3_1_Handle_t * pHandle )
     /* Enable PWM channel */
     LL_TIM_CC_EnableChannel( TIMx, TIMxCCER_MASK_CH123 );
 
+    if ( 0U == LL_ADC_IsInternalRegulatorEnabled( ADCx ) )
+    {
+      /* ADC not initialized by CubeMX yet, as the second ADC of a dual drive */
+      LL_ADC_DisableDeepPowerDown( ADCx );
+      LL_ADC_EnableInternalRegulator( ADCx );
+
+      /* Wait for Regulator Startup time */
+      volatile uint32_t wait_loop_index = ((LL_ADC_DELAY_INTERNAL_REGUL_STAB_US / 10UL) * (SystemCoreClock / (100000UL * 2UL)));
+      while(wait_loop_index != 0UL)
+      {
+        wait_loop_index--;
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
     LL_ADC_StartCalibration( ADCx, LL_ADC_SINGLE_ENDED );
     while ( LL_ADC_IsCalibrationOnGoing( ADCx ) )
     {
@@ -20,6 +20,7 @@
   ******************************************************************************
   */
 #include <stdint.h>
+#include <string.h>
 #include "aspep.h"
 
 /* Local definition */
@@ -27,6 +28,8 @@
 
 /* Local functions */
 static bool ASPEP_CheckBeacon (ASPEP_Handle_t *pHandle);
+static bool ASPEP_DecodeHeader(ASPEP_Handle_t *pHandle);
+static void ASPEP_RingParse(ASPEP_Handle_t *pHandle, bool lineIdle);
 static uint8_t ASPEP_TXframeProcess(ASPEP_Handle_t *pHandle, uint8_t packetType, void *txBuffer, uint16_t bufferLength);
 void ASPEP_sendBeacon(ASPEP_Handle_t *pHandle, ASPEP_Capabilities_def *capabilities);
 void ASPEP_sendPing(ASPEP_Handle_t *pHandle, uint8_t state, uint16_t PacketNumber);
@@ -171,6 +174,251 @@ static bool ASPEP_CheckHeaderCRC(uint32_t header)
   return (crc == 0U);
 }
 
+/**
+  * @brief CRC-16 lookup table with 256 entries
+  *
+  *  Used to compute and check the CRC on the data payload when the hardware CRC unit is not available.
+  * The generator polynomial is x^16+x^12+x^5+1 (0x1021, CRC-16/CCITT-FALSE).
+  */
+static uint16_t const CRC16_Lookup8[] =
+{
+  0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+  0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+  0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+  0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+  0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+  0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+  0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+  0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+  0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+  0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+  0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+  0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+  0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+  0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+  0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+  0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+  0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+  0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+  0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+  0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+  0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+  0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+  0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+  0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+  0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+  0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+  0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+  0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+  0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+  0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+  0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+  0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/**
+  * @brief Computes the 16-bit CRC of @p length bytes of @p data
+  *
+  *  The CRC is computed with the hardware unit provided by the transport driver when there is one, and
+  * with the CRC16_Lookup8 table otherwise. It is never computed under the High Frequency Task, see
+  * ASPEP_AsyncSend(). The polynomial is x^16+x^12+x^5+1,
+  * the initial value is 0xFFFF, and neither the input nor the output are reflected.
+  *
+  *  The CPU cycles spent are recorded in dataCRCCycles and dataCRCMaxCycles, on cores with a DWT unit.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  * @param  *data Payload on which the CRC is computed
+  * @param  length Size of the payload in bytes
+  *
+  * @return Returns the CRC of the payload
+  */
+static uint16_t ASPEP_ComputeDataCRC(ASPEP_Handle_t *pHandle, const uint8_t *data, uint16_t length)
+{
+  uint16_t crc = 0xFFFFU;
+  uint16_t i;
+#ifdef DWT
+  uint32_t start = DWT->CYCCNT;
+  uint32_t cycles;
+#endif
+
+  if ((MC_NULL == pHandle->fASPEP_dataCRC) || (false == pHandle->fASPEP_dataCRC(pHandle->HWIp, data, length, &crc)))
+  {
+    /* Software fallback, also used while the hardware unit is busy with a preempted computation */
+    crc = 0xFFFFU;
+    for (i = 0U; i < length; i++)
+    {
+      crc = (uint16_t)(crc << 8U) ^ CRC16_Lookup8[(uint8_t)(crc >> 8U) ^ data[i]];
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+#ifdef DWT
+  cycles = DWT->CYCCNT - start;
+  pHandle->dataCRCCycles = cycles;
+  if (cycles > pHandle->dataCRCMaxCycles)
+  {
+    pHandle->dataCRCMaxCycles = cycles;
+    pHandle->dataCRCMaxLength = length;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
+  return (crc);
+}
+
+/**
+  * @brief  Counts the bits set in a 32 bits word.
+  */
+static inline uint8_t ASPEP_CountBits(uint32_t value)
+{
+  uint32_t count = value - ((value >> 1U) & 0x55555555U);
+  count = (count & 0x33333333U) + ((count >> 2U) & 0x33333333U);
+  count = (count + (count >> 4U)) & 0x0F0F0F0FU;
+  return ((uint8_t)((count * 0x01010101U) >> 24U));
+}
+
+/**
+  * @brief  Takes the lowest available buffer out of the free list of the async pool.
+  *
+  * The free list is a bit mask updated with exclusive accesses, as buffers are taken under the High Frequency Task
+  * and given back under the transmission complete interrupt.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  *
+  * @return Returns the buffer taken, or NULL if the pool is empty.
+  */
+static MCTL_Buff_t *ASPEP_AsyncPoolTake(ASPEP_Handle_t *pHandle)
+{
+  MCTL_Buff_t *result = NULL;
+  uint32_t freeMask;
+  uint32_t lowest = 0U;
+  bool empty;
+
+  do
+  {
+    freeMask = __LDREXW(&pHandle->asyncFreeMask);
+    empty = (0U == freeMask);
+    if (empty)
+    {
+      __CLREX();
+      break;
+    }
+    else
+    {
+      lowest = freeMask & (0U - freeMask);
+    }
+  } while (__STREXW(freeMask & ~lowest, &pHandle->asyncFreeMask) != 0U);
+
+  if (empty)
+  {
+    pHandle->asyncDropped++;
+  }
+  else
+  {
+    uint16_t inUse = (uint16_t)pHandle->asyncPoolSize - ASPEP_CountBits(freeMask & ~lowest);
+    if (inUse > pHandle->asyncHighWater)
+    {
+      pHandle->asyncHighWater = inUse;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    result = &pHandle->asyncPool[31U - __CLZ(lowest)];
+  }
+  return (result);
+}
+
+/**
+  * @brief  Gives a buffer back to the free list of the async pool.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  * @param  *pBuffer Buffer of the async pool
+  */
+static void ASPEP_AsyncPoolGive(ASPEP_Handle_t *pHandle, const MCTL_Buff_t *pBuffer)
+{
+  uint32_t bit = 1UL << (uint32_t)(pBuffer - pHandle->asyncPool);
+  uint32_t freeMask;
+
+  do
+  {
+    freeMask = __LDREXW(&pHandle->asyncFreeMask);
+  } while (__STREXW(freeMask | bit, &pHandle->asyncFreeMask) != 0U);
+}
+
+/**
+  * @brief  Returns the entry of the async transmit queue that follows @p index. The queue has one entry per buffer
+  *         of the pool and wraps explicitly, whatever the pool size.
+  */
+static uint8_t ASPEP_AsyncQueueNext(const ASPEP_Handle_t *pHandle, uint8_t index)
+{
+  return ((index < (pHandle->asyncPoolSize - 1U)) ? (index + 1U) : 0U);
+}
+
+/**
+  * @brief  Takes the oldest async buffer out of the transmit queue and locks it for the transmission.
+  *
+  * Must be called with interrupts disabled, and only when no transfer is in progress.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  *
+  * @return Returns the buffer to send, or NULL if the queue is empty. It is also the new lockBuffer.
+  */
+static MCTL_Buff_t *ASPEP_AsyncDequeue(ASPEP_Handle_t *pHandle)
+{
+  MCTL_Buff_t *nextBuff = NULL;
+
+  if (pHandle->asyncQueueCount > 0U)
+  {
+    nextBuff = &pHandle->asyncPool[pHandle->asyncQueue[pHandle->asyncQueueTail]];
+    pHandle->asyncQueueTail = ASPEP_AsyncQueueNext(pHandle, pHandle->asyncQueueTail);
+    pHandle->asyncQueueCount--;
+    nextBuff->state = readLock;
+#ifdef MCP_DEBUG_METRICS
+    nextBuff->SentNumber++;
+#endif
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  pHandle->lockBuffer = (void *)nextBuff;
+  return (nextBuff);
+}
+
+/**
+  * @brief  Completes an async buffer with its data CRC and sends it.
+  *
+  *  The data CRC of the async buffers is not computed by ASPEP_sendPacket() under the High Frequency Task, but
+  * here, just before the transfer: from the transmission complete interrupt or from the Medium Frequency Task.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  * @param  *pBuffer Async buffer locked by ASPEP_AsyncDequeue()
+  */
+static void ASPEP_AsyncSend(ASPEP_Handle_t *pHandle, MCTL_Buff_t *pBuffer)
+{
+  uint16_t length;
+  uint16_t dataCRC;
+
+  if (1U == pHandle->Capabilities.DATA_CRC)
+  {
+    length = pBuffer->length - (uint16_t)ASPEP_HEADER_SIZE - (uint16_t)ASPEP_DATACRC_SIZE;
+    dataCRC = ASPEP_ComputeDataCRC(pHandle, &pBuffer->buffer[ASPEP_HEADER_SIZE], length);
+    pBuffer->buffer[ASPEP_HEADER_SIZE + length] = (uint8_t)(dataCRC & 0xFFU);
+    pBuffer->buffer[ASPEP_HEADER_SIZE + length + 1U] = (uint8_t)(dataCRC >> 8U);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  pHandle->fASPEP_send(pHandle->HWIp, pBuffer->buffer, pBuffer->length);
+}
+
 /**
   * @brief  Starts ASPEP communication by configuring UART.
   *
@@ -191,8 +439,34 @@ void ASPEP_start(ASPEP_Handle_t *pHandle)
     pHandle->ASPEP_TL_State = WAITING_PACKET;
     pHandle->syncPacketCount = 0; /* Sync packet counter is reset only at startup*/
 
-    /* Configure UART to receive first packet*/
-    pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+    /* All the async buffers are free, the transmit queue is empty */
+    for (uint8_t i = 0U; i < pHandle->asyncPoolSize; i++)
+    {
+      pHandle->asyncPool[i].buffer = &pHandle->asyncPoolStorage[(uint32_t)i * pHandle->asyncBufferStride];
+      pHandle->asyncPool[i].state = available;
+    }
+    pHandle->asyncFreeMask = (ASPEP_ASYNC_POOL_MAX == pHandle->asyncPoolSize) ? 0xFFFFFFFFU
+                           : ((1UL << pHandle->asyncPoolSize) - 1U);
+    pHandle->asyncQueueHead = 0U;
+    pHandle->asyncQueueTail = 0U;
+    pHandle->asyncQueueCount = 0U;
+    pHandle->lastRequestedAsyncBuff = NULL;
+
+    if (0U == pHandle->rxRingSize)
+    {
+      /* Configure UART to receive first packet*/
+      pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+    }
+    else
+    {
+      /* Reception runs continuously in the ring, packets are parsed in place */
+      pHandle->rxRingRead = 0U;
+      pHandle->rxRingWrite = 0U;
+      pHandle->rxRingFill = 0U;
+      pHandle->rxRingKept = 0U;
+      pHandle->rxDiscard = false;
+      pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxRing, pHandle->rxRingSize);
+    }
 #ifdef NULL_PTR_CHECK_ASP
   }
 #endif
@@ -307,36 +581,41 @@ bool ASPEP_getBuffer(MCTL_Handle_t *pSupHandle, void **buffer,  uint8_t syncAsyn
         result = false;
       }
     }
-    else /* Asynchronous buffer request */
+    else if (MCTL_EVENT == syncAsync)
     {
-      if ((pHandle->asyncBufferA.state > writeLock) && (pHandle->asyncBufferB.state > writeLock))
+      if (pHandle->eventBuffer.state <= writeLock) /* Possible values are free or writeLock*/
+      {
+        *buffer = &pHandle->eventBuffer.buffer[ASPEP_HEADER_SIZE];
+        pHandle->eventBuffer.state = writeLock;
+      }
+      else
       {
         result = false;
       }
+    }
+    else /* Asynchronous buffer request */
+    {
+      if ((pHandle->lastRequestedAsyncBuff != NULL) && (writeLock == pHandle->lastRequestedAsyncBuff->state))
+      {
+        /* The last buffer requested was not sent, it is still owned by the requester */
+        *buffer = &pHandle->lastRequestedAsyncBuff->buffer[ASPEP_HEADER_SIZE];
+      }
       else
       {
-        if (pHandle->asyncBufferA.state <= writeLock)
+        MCTL_Buff_t *asyncBuff = ASPEP_AsyncPoolTake(pHandle);
+        if (NULL == asyncBuff)
         {
-          pHandle->asyncBufferA.state = writeLock;
-          pHandle->lastRequestedAsyncBuff = &pHandle->asyncBufferA;
-          *buffer = &pHandle->asyncBufferA.buffer[ASPEP_HEADER_SIZE];
-#ifdef MCP_DEBUG_METRICS
-          pHandle->asyncBufferA.RequestedNumber++;
-#endif
+          result = false;
         }
-        else if (pHandle->asyncBufferB.state <= writeLock)
+        else
         {
-          pHandle->asyncBufferB.state = writeLock;
-          pHandle->lastRequestedAsyncBuff = &pHandle->asyncBufferB;
-          *buffer = &pHandle->asyncBufferB.buffer[ASPEP_HEADER_SIZE];
+          asyncBuff->state = writeLock;
+          pHandle->lastRequestedAsyncBuff = asyncBuff;
+          *buffer = &asyncBuff->buffer[ASPEP_HEADER_SIZE];
 #ifdef MCP_DEBUG_METRICS
-          pHandle->asyncBufferB.RequestedNumber++;
+          asyncBuff->RequestedNumber++;
 #endif
         }
-        else
-        {
-          /* Nothing to do */
-        }
       }
     }
 #ifdef NULL_PTR_CHECK_ASP
@@ -427,13 +706,22 @@ uint8_t ASPEP_sendPacket(MCTL_Handle_t *pSupHandle, void *txBuffer, uint16_t txD
       packet = (uint8_t *)txBuffer; //cstat !MISRAC2012-Rule-11.5
       header = (uint32_t *)txBuffer; //cstat !MISRAC2012-Rule-11.5
       header--; /* Header ues 4*8 bits on top of txBuffer*/
-      tmpHeader = ((uint32_t)((uint32_t)txDataLengthTemp << (uint32_t)4) | (uint32_t)syncAsync);
+      /* Event packets are asynchronous packets for the controller */
+      tmpHeader = ((uint32_t)((uint32_t)txDataLengthTemp << (uint32_t)4)
+                | (uint32_t)((MCTL_EVENT == syncAsync) ? MCTL_ASYNC : syncAsync));
       *header = tmpHeader;
       if (1U == pHandle->Capabilities.DATA_CRC)
       {
-        /* TODO : Compute real CRC*/
-        packet[txDataLengthTemp] = (uint8_t)0xCA; /* Dummy CRC */
-        packet[txDataLengthTemp + 1U] = (uint8_t)0xFE; /* Dummy CRC */
+        if (MCTL_ASYNC == syncAsync)
+        {
+          /* Room only, the CRC is computed out of the High Frequency Task by ASPEP_AsyncSend() */
+        }
+        else
+        {
+          uint16_t dataCRC = ASPEP_ComputeDataCRC(pHandle, packet, txDataLengthTemp);
+          packet[txDataLengthTemp] = (uint8_t)(dataCRC & 0xFFU);
+          packet[txDataLengthTemp + 1U] = (uint8_t)(dataCRC >> 8U);
+        }
         txDataLengthTemp += (uint16_t)ASPEP_DATACRC_SIZE;
       }
       if (MCTL_SYNC == syncAsync)
@@ -470,7 +758,7 @@ uint8_t ASPEP_sendPacket(MCTL_Handle_t *pSupHandle, void *txBuffer, uint16_t txD
   * and under Medium frequency task (MC_Scheduler -> ASPEP_RxFrameProcess ).
   *
   * @param  *pHandle Handler of the current instance of the ASPEP component
-  * @param  dataType Nature of the communication : synchronous, asynchronous or a CTL packet
+  * @param  dataType Nature of the communication : synchronous, asynchronous, event or a CTL packet
   * @param  *txBuffer CRC Header to be computed in sent packet
   * @param  bufferLength Size of the packet to be sent : Header + Data
   *
@@ -490,11 +778,14 @@ uint8_t ASPEP_TXframeProcess(ASPEP_Handle_t *pHandle, uint8_t dataType, void *tx
     /* Insert CRC header in the packet to send */
     ASPEP_ComputeHeaderCRC((uint32_t *)txBuffer); //cstat !MISRAC2012-Rule-11.5
     __disable_irq(); /*TODO: Disable High frequency task is enough */
-    if (NULL == pHandle->lockBuffer) /* Communication Ip free to send data*/
+    /* Async buffers with a data CRC are always queued: they are sent, with their CRC, by the transmission complete
+       interrupt or by the next ASPEP_RXframeProcess() */
+    if ((NULL == pHandle->lockBuffer) /* Communication Ip free to send data*/
+        && ((dataType != MCTL_ASYNC) || (0U == pHandle->Capabilities.DATA_CRC)))
     {
       if (MCTL_ASYNC == dataType)
       {
-        /* In ASYNC, two flipflop buffers are used, the txBuffer points always to lastRequestedAsyncBuff->buffer */
+        /* In ASYNC, the txBuffer points always to lastRequestedAsyncBuff->buffer */
         pHandle->lastRequestedAsyncBuff->state = readLock;
         pHandle->lockBuffer = (void *)pHandle->lastRequestedAsyncBuff;
 #ifdef MCP_DEBUG_METRICS
@@ -506,6 +797,11 @@ uint8_t ASPEP_TXframeProcess(ASPEP_Handle_t *pHandle, uint8_t dataType, void *tx
         pHandle->syncBuffer.state = readLock;
         pHandle->lockBuffer = (void *)&pHandle->syncBuffer;
       }
+      else if (MCTL_EVENT == dataType)
+      {
+        pHandle->eventBuffer.state = readLock;
+        pHandle->lockBuffer = (void *)&pHandle->eventBuffer;
+      }
       else
       {
         pHandle->ctrlBuffer.state = readLock;
@@ -515,37 +811,32 @@ uint8_t ASPEP_TXframeProcess(ASPEP_Handle_t *pHandle, uint8_t dataType, void *tx
       __enable_irq(); /*TODO: Enable High frequency task is enough */
       pHandle->fASPEP_send(pHandle->HWIp, txBuffer, bufferLength);
     }
-    else /* HW resource busy, saving packet to sent it once resource will be freed*/
+    else if (MCTL_EVENT == dataType)
     {
+      /* Marked pending before the interrupts are enabled, so that the end of the current transfer sends it */
+      pHandle->eventBuffer.length = bufferLength;
+      pHandle->eventBuffer.state = pending;
       __enable_irq(); /*TODO: Enable High frequency task is enough */
-      /* Lock buffer can be freed here */
-      if (MCTL_ASYNC == dataType)
-      {
-        /* Check that the buffer received is the one expected - probably useless */
-        if (txBuffer != (uint8_t *)pHandle->lastRequestedAsyncBuff->buffer)
-        {
-          result = ASPEP_BUFFER_ERROR;
-        }
-        else
-        {
-          /* Nothing to do */
-        }
-        if (NULL == pHandle->asyncNextBuffer)
-        {
-          /* Required to keep the right sending order */
-          pHandle->asyncNextBuffer = pHandle->lastRequestedAsyncBuff;
-        }
-        else
-        {
-          /* Nothing to do */
-        }
-        pHandle->lastRequestedAsyncBuff->state = pending;
-        pHandle->lastRequestedAsyncBuff->length = bufferLength;
+    }
+    else if (MCTL_ASYNC == dataType)
+    {
+      /* Queued before the interrupts are enabled, so that the end of the current transfer sends it. The queue
+         cannot overflow, it has one entry per buffer of the pool. */
+      pHandle->lastRequestedAsyncBuff->state = pending;
+      pHandle->lastRequestedAsyncBuff->length = bufferLength;
+      pHandle->asyncQueue[pHandle->asyncQueueHead] = (uint8_t)(pHandle->lastRequestedAsyncBuff - pHandle->asyncPool);
+      pHandle->asyncQueueHead = ASPEP_AsyncQueueNext(pHandle, pHandle->asyncQueueHead);
+      pHandle->asyncQueueCount++;
 #ifdef MCP_DEBUG_METRICS
-        pHandle->lastRequestedAsyncBuff->PendingNumber++;
+      pHandle->lastRequestedAsyncBuff->PendingNumber++;
 #endif
-      }
-      else if (MCTL_SYNC == dataType)
+      __enable_irq(); /*TODO: Enable High frequency task is enough */
+    }
+    else /* HW resource busy, saving packet to sent it once resource will be freed*/
+    {
+      __enable_irq(); /*TODO: Enable High frequency task is enough */
+      /* Lock buffer can be freed here */
+      if (MCTL_SYNC == dataType)
       {
         if (pHandle -> syncBuffer.state != writeLock)
         {
@@ -606,6 +897,14 @@ void ASPEP_HWDataTransmittedIT(ASPEP_Handle_t *pHandle)
     {
       MCTL_Buff_t *tempBuff = (MCTL_Buff_t *)pHandle->lockBuffer; //cstat !MISRAC2012-Rule-11.5
       tempBuff->state = available;
+      if ((tempBuff >= pHandle->asyncPool) && (tempBuff < &pHandle->asyncPool[pHandle->asyncPoolSize]))
+      {
+        ASPEP_AsyncPoolGive(pHandle, tempBuff);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
     }
     if (pHandle->syncBuffer.state == pending)
     {
@@ -620,35 +919,28 @@ void ASPEP_HWDataTransmittedIT(ASPEP_Handle_t *pHandle)
       pHandle->fASPEP_send(pHandle ->HWIp, pHandle->ctrlBuffer.buffer, ASPEP_CTRL_SIZE);
       pHandle->ctrlBuffer.state = readLock;
     }
+    /* Events are sent before the telemetry */
+    else if (pHandle->eventBuffer.state == pending)
+    {
+      pHandle->lockBuffer = (void *)&pHandle->eventBuffer;
+      pHandle->fASPEP_send(pHandle->HWIp, pHandle->eventBuffer.buffer, pHandle->eventBuffer.length);
+      pHandle->eventBuffer.state = readLock;
+    }
     else
     {
+      /* Oldest queued async buffer first. If none, no TX packet are pending, HW resource is free */
+      MCTL_Buff_t *nextBuff;
       __disable_irq();
-      if (pHandle->asyncNextBuffer != NULL)
+      nextBuff = ASPEP_AsyncDequeue(pHandle);
+      __enable_irq();
+      if (nextBuff != NULL)
       {
-        pHandle->lockBuffer = (void *)pHandle->asyncNextBuffer;
-        pHandle->asyncNextBuffer->state = readLock;
-#ifdef MCP_DEBUG_METRICS
-        pHandle->asyncNextBuffer->SentNumber++;
-#endif
-        pHandle->fASPEP_send(pHandle ->HWIp, pHandle->asyncNextBuffer->buffer, pHandle->asyncNextBuffer->length);
-        /* If one Async buffer is still pending, assign it to the asyncNextBuffer pointer*/
-        if ((pHandle->asyncBufferA.state == pending) || (pHandle->asyncBufferB.state == pending))
-        {
-          //cstat !MISRAC2012-Rule-11.4
-          uint32_t temp = (uint32_t)&pHandle->asyncBufferA + (uint32_t)&pHandle->asyncBufferB
-                          - (uint32_t) pHandle->asyncNextBuffer; //cstat !MISRAC2012-Rule-11.4
-          pHandle->asyncNextBuffer = (MCTL_Buff_t *) temp; //cstat !MISRAC2012-Rule-11.4
-        }
-        else
-        {
-          pHandle->asyncNextBuffer = NULL;
-        }
+        ASPEP_AsyncSend(pHandle, nextBuff);
       }
-      else /* No TX packet are pending, HW resource is free*/
+      else
       {
-        pHandle->lockBuffer = NULL;
+        /* Nothing to do */
       }
-      __enable_irq();
     }
 #ifdef NULL_PTR_CHECK_ASP
   }
@@ -659,6 +951,7 @@ void ASPEP_HWDataTransmittedIT(ASPEP_Handle_t *pHandle)
   * @brief  Updates ASPEP state depending on received packet from Controller and sends a response according to ASPEP protocol
   *
   * ASPEP protocol defined in section 4.4.1 Connection Procedure of Motor Control Protocol Suite of User Manual
+  * Called once per Medium Frequency Task, it also starts the async buffers queued while the line was idle.
   *
   * @param  *pSupHandle Handler of the current instance of the MCTL component
   * @param  *packetLength Length of the packet to be processed
@@ -679,13 +972,42 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
     ASPEP_Handle_t *pHandle = (ASPEP_Handle_t *)pSupHandle; //cstat !MISRAC2012-Rule-11.3
     uint32_t packetHeader = *((uint32_t *)pHandle->rxHeader); //cstat !MISRAC2012-Rule-11.3
     uint16_t packetNumber;
-#if VALID_CRC_DATA
+    uint16_t dataCRC;
     bool validCRCData = true;
-#endif
+    MCTL_Buff_t *asyncBuff = NULL;
     *packetLength = 0;
+
+    /* Async buffers queued by the High Frequency Task while the line was idle are started here */
+    __disable_irq();
+    if (NULL == pHandle->lockBuffer)
+    {
+      asyncBuff = ASPEP_AsyncDequeue(pHandle);
+    }
+    else
+    {
+      /* Nothing to do, the transmission complete interrupt sends them */
+    }
+    __enable_irq();
+    if (asyncBuff != NULL)
+    {
+      ASPEP_AsyncSend(pHandle, asyncBuff);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
     if (pHandle->NewPacketAvailable)
     {
-      pHandle->NewPacketAvailable = false; /* Consumes new packet*/
+      if (0U == pHandle->rxRingSize)
+      {
+        pHandle->NewPacketAvailable = false; /* Consumes new packet*/
+      }
+      else
+      {
+        /* The packet stays pending until it is consumed: the reception interrupts do not parse the next one over
+           its header and payload */
+      }
       switch (pHandle->ASPEP_State)
       {
         case ASPEP_IDLE:
@@ -770,21 +1092,36 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
           }
           else if (DATA_PACKET == pHandle->rxPacketType)
           {
-#if VALID_CRC_DATA
+            if (1U == pHandle->Capabilities.DATA_CRC)
+            {
+              /* The CRC is transmitted LSB first right after the payload */
+              dataCRC = (uint16_t)pHandle->rxBuffer[pHandle->rxLength]
+                      | (uint16_t)((uint16_t)pHandle->rxBuffer[pHandle->rxLength + 1U] << 8U);
+              if (ASPEP_ComputeDataCRC(pHandle, pHandle->rxBuffer, pHandle->rxLength) != dataCRC)
+              {
+                validCRCData = false;
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+
             if (validCRCData)
             {
-#endif
               pHandle->syncPacketCount++; /* this counter is incremented at each valid data packet received from controller */
               pSupHandle->MCP_PacketAvailable = true; /* Will be consumed in ASPEP_sendPacket */
               *packetLength = pHandle->rxLength;
               result = pHandle->rxBuffer;
-#if VALID_CRC_DATA
             }
             else
             {
-              ASPEP_sendNack (pHandle, ASPEP_BAD_CRC_DATA);
+              ASPEP_sendNack(pHandle, ASPEP_BAD_CRC_DATA);
             }
-#endif
           }
           else
           {
@@ -798,7 +1135,20 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
           break;
       }
       /* The valid received packet is now safely consumes, we are ready to receive a new packet */
-      pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+      if (0U == pHandle->rxRingSize)
+      {
+        pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+      }
+      else
+      {
+        /* Packets received back to back are already in the ring, the next one is parsed right now. The payload
+           returned is processed by the caller before the DMA can wrap over it */
+        __disable_irq();
+        pHandle->NewPacketAvailable = false;
+        pHandle->rxRingKept = 0U;
+        ASPEP_RingParse(pHandle, false);
+        __enable_irq();
+      }
     }
     else if (pHandle->badPacketFlag > ASPEP_OK)
     {
@@ -810,8 +1160,19 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
         * It is important to note that we will detect only the NEXT free line transition, it means the next packet will
         * be lost but the end of this lost packet will generate the IDLE interrupt
         * the IDLE interrupt will call ASPEP_HWDMAReset (in charge of the IP_aspep driver to call it at the appropriate
-        * time)*/
-      pHandle->fASPEP_HWSync(pHandle->HWIp);
+        * time)
+        * With circular reception, ASPEP_RingParse already skips the received bytes until the line goes idle */
+      if (0U == pHandle->rxRingSize)
+      {
+        pHandle->fASPEP_HWSync(pHandle->HWIp);
+      }
+      else
+      {
+        /* Parses what was received after the skipped bytes */
+        __disable_irq();
+        ASPEP_RingParse(pHandle, false);
+        __enable_irq();
+      }
     }
     else
     {
@@ -823,6 +1184,194 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
   return (result);
 }
 
+/**
+  * @brief  Decodes the header stored in rxHeader.
+  *
+  * Sets NewPacketAvailable when the packet has no payload, badPacketFlag when the header is not valid.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  * @retval true if a payload must be received
+  */
+static bool ASPEP_DecodeHeader(ASPEP_Handle_t *pHandle)
+{
+  bool payload = false;
+
+  if (ASPEP_CheckHeaderCRC(*(uint32_t *)pHandle->rxHeader) == true) //cstat !MISRAC2012-Rule-11.3
+  {
+    pHandle->rxPacketType = (ASPEP_packetType)(((uint32_t)pHandle->rxHeader[0]) & ID_MASK);
+    switch (pHandle->rxPacketType)
+    {
+      case DATA_PACKET:
+      {
+        //cstat !MISRAC2012-Rule-11.3
+        pHandle->rxLength = (uint16_t)((*((uint16_t *)pHandle->rxHeader) & 0x1FFF0U) >> (uint16_t)4);
+        if (0U == pHandle->rxLength) /* data packet with length 0 is a valid packet */
+        {
+          pHandle->NewPacketAvailable = true;
+          /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
+            *  processed in ASPEP_RXframeProcess */
+        }
+        else if (pHandle->rxLength <= pHandle->maxRXPayload)
+        {
+          payload = true;
+        }
+        else
+        {
+          pHandle->badPacketFlag = ASPEP_BAD_PACKET_SIZE;
+        }
+        break;
+      }
+
+      case BEACON:
+      case PING:
+      {
+        pHandle->NewPacketAvailable = true;
+        /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
+          * processed in ASPEP_RXframeProcess */
+        break;
+      }
+
+      default:
+      {
+        pHandle->badPacketFlag = ASPEP_BAD_PACKET_TYPE;
+        break;
+      }
+    }
+  }
+  else
+  {
+    pHandle->badPacketFlag = ASPEP_BAD_CRC_HEADER;
+  }
+  return (payload);
+}
+
+/**
+  * @brief  Parses the packets received in the circular reception buffer.
+  *
+  * Payloads are not copied: rxBuffer points directly in the ring. A payload wrapping around the end of
+  * the ring is made contiguous by copying its beginning after the end of the ring. Parsing stops at the
+  * first complete packet, until it is consumed by ASPEP_RXframeProcess.
+  *
+  * The bytes received since the previous call are counted, so the ring must be parsed at least every half
+  * ring: the DMA half and full ring interrupts do it. When the bytes not parsed yet and the pending payload
+  * no longer fit in the ring, the DMA has wrapped over them: the pending packet is dropped. After such an
+  * overrun or a bad header, the received bytes are skipped until the line goes idle, as the controller sends
+  * its next request after an idle line.
+  * Must be called with interrupts disabled or from the reception interrupts.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  * @param  lineIdle true when called at the end of a burst, all the bytes of the burst are received
+  */
+static void ASPEP_RingParse(ASPEP_Handle_t *pHandle, bool lineIdle)
+{
+  uint16_t size = pHandle->rxRingSize;
+  uint16_t write = size - pHandle->fASPEP_rxRemaining(pHandle->HWIp);
+  uint16_t read = pHandle->rxRingRead;
+  uint16_t need;
+  uint8_t i;
+  bool parsing = true;
+
+  if (write >= size)
+  {
+    write = 0U; /* Counter is being reloaded */
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Counts the bytes received since the previous call */
+  pHandle->rxRingFill += (write >= pHandle->rxRingWrite) ? (write - pHandle->rxRingWrite)
+                                                         : ((size - pHandle->rxRingWrite) + write);
+  pHandle->rxRingWrite = write;
+  if (((uint32_t)pHandle->rxRingFill + pHandle->rxRingKept) > size)
+  {
+    /* Overrun, the pending packet or the beginning of the next one is lost */
+    pHandle->rxRingOverruns++;
+    pHandle->NewPacketAvailable = false;
+    pHandle->rxRingKept = 0U;
+    pHandle->ASPEP_TL_State = WAITING_PACKET;
+    pHandle->rxDiscard = true;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (pHandle->rxDiscard)
+  {
+    read = write;
+    pHandle->rxRingFill = 0U;
+    pHandle->rxDiscard = !lineIdle;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  while (parsing && (false == pHandle->NewPacketAvailable) && (ASPEP_OK == pHandle->badPacketFlag))
+  {
+    if (WAITING_PACKET == pHandle->ASPEP_TL_State)
+    {
+      if (pHandle->rxRingFill < (uint16_t)ASPEP_HEADER_SIZE)
+      {
+        parsing = false;
+      }
+      else
+      {
+        for (i = 0U; i < (uint8_t)ASPEP_HEADER_SIZE; i++)
+        {
+          pHandle->rxHeader[i] = pHandle->rxRing[read];
+          read = ((read + 1U) < size) ? (read + 1U) : 0U;
+        }
+        pHandle->rxRingFill -= (uint16_t)ASPEP_HEADER_SIZE;
+        if (ASPEP_DecodeHeader(pHandle))
+        {
+          pHandle->ASPEP_TL_State = WAITING_PAYLOAD;
+        }
+        else if (pHandle->badPacketFlag != ASPEP_OK)
+        {
+          /* The rest of the burst is skipped, at once if it is complete */
+          read = write;
+          pHandle->rxRingFill = 0U;
+          pHandle->rxDiscard = !lineIdle;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+    else
+    {
+      /* need to read + 2 bytes CRC*/
+      need = pHandle->rxLength + ((uint16_t)ASPEP_DATACRC_SIZE * (uint16_t)pHandle->Capabilities.DATA_CRC);
+      if (pHandle->rxRingFill < need)
+      {
+        parsing = false;
+      }
+      else
+      {
+        if (need > (size - read))
+        {
+          (void)memcpy(&pHandle->rxRing[size], pHandle->rxRing, (uint32_t)need - (size - read));
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        pHandle->rxBuffer = &pHandle->rxRing[read];
+        read = ((read + need) < size) ? (read + need) : ((read + need) - size);
+        pHandle->rxRingFill -= need;
+        pHandle->rxRingKept = need;
+        pHandle->ASPEP_TL_State = WAITING_PACKET;
+        pHandle->NewPacketAvailable = true;
+      }
+    }
+  }
+  pHandle->rxRingRead = read;
+}
+
 /**
   * @brief  Processes the received data packet.
   *
@@ -830,6 +1379,7 @@ uint8_t *ASPEP_RXframeProcess(MCTL_Handle_t *pSupHandle, uint16_t *packetLength)
   * Upon reception of a new packet the DMA will be re-configured only once the answer has been sent.
   * This is mandatory to avoid a race condition in case of a new packet is received while executing ASPEP_RXframeProcess.
   * If the packet received contains an error in the header, the HW IP will be re-synchronised first, and DMA will be configured after.
+  * With circular reception, it is called at the end of each burst (idle line) and parses all complete packets.
   *
   * @param  *pHandle Handler of the current instance of the ASPEP component
   */
@@ -843,73 +1393,77 @@ void ASPEP_HWDataReceivedIT(ASPEP_Handle_t *pHandle)
   else
   {
 #endif
-    switch (pHandle->ASPEP_TL_State)
+    if (pHandle->rxRingSize != 0U)
+    {
+      __disable_irq();
+      ASPEP_RingParse(pHandle, false);
+      __enable_irq();
+    }
+    else
     {
-      case WAITING_PACKET:
+      switch (pHandle->ASPEP_TL_State)
       {
-        if (ASPEP_CheckHeaderCRC(*(uint32_t *)pHandle->rxHeader) == true) //cstat !MISRAC2012-Rule-11.3
+        case WAITING_PACKET:
         {
-          pHandle->rxPacketType = (ASPEP_packetType)(((uint32_t)pHandle->rxHeader[0]) & ID_MASK);
-          switch (pHandle->rxPacketType)
+          if (ASPEP_DecodeHeader(pHandle))
           {
-            case DATA_PACKET:
-            {
-              //cstat !MISRAC2012-Rule-11.3
-              pHandle->rxLength = (uint16_t)((*((uint16_t *)pHandle->rxHeader) & 0x1FFF0U) >> (uint16_t)4);
-              if (0U == pHandle->rxLength) /* data packet with length 0 is a valid packet */
-              {
-                pHandle->NewPacketAvailable = true;
-                /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
-                  *  processed in ASPEP_RXframeProcess */
-              }
-              else if (pHandle->rxLength <= pHandle->maxRXPayload)
-              {
-                pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxBuffer,  /* need to read + 2 bytes CRC*/
-                                        (pHandle->rxLength + ((uint16_t)ASPEP_DATACRC_SIZE * (uint16_t)pHandle->Capabilities.DATA_CRC)));
-                pHandle->ASPEP_TL_State = WAITING_PAYLOAD;
-              }
-              else
-              {
-                pHandle->badPacketFlag = ASPEP_BAD_PACKET_SIZE;
-              }
-              break;
-            }
-
-            case BEACON:
-            case PING:
-            {
-              pHandle->NewPacketAvailable = true;
-              /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
-                * processed in ASPEP_RXframeProcess */
-              break;
-            }
-
-            default:
-            {
-              pHandle->badPacketFlag = ASPEP_BAD_PACKET_TYPE;
-              break;
-            }
+            pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxBuffer,  /* need to read + 2 bytes CRC*/
+                                    (pHandle->rxLength + ((uint16_t)ASPEP_DATACRC_SIZE * (uint16_t)pHandle->Capabilities.DATA_CRC)));
+            pHandle->ASPEP_TL_State = WAITING_PAYLOAD;
           }
+          else
+          {
+            /* Nothing to do */
+          }
+          break;
         }
-        else
+
+        case WAITING_PAYLOAD:
         {
-          pHandle->badPacketFlag = ASPEP_BAD_CRC_HEADER;
+          pHandle->ASPEP_TL_State = WAITING_PACKET;
+          /* Payload received, */
+          pHandle->NewPacketAvailable = true;
+          /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
+            * processed in ASPEP_RXframeProcess */
+          break;
         }
-        break;
-      }
 
-      case WAITING_PAYLOAD:
-      {
-        pHandle->ASPEP_TL_State = WAITING_PACKET;
-        /* Payload received, */
-        pHandle->NewPacketAvailable = true;
-        /* The receiver is not reconfigure right now on purpose to avoid race condition when the packet will be
-          * processed in ASPEP_RXframeProcess */
-        break;
+        default:
+          break;
       }
+    }
+#ifdef NULL_PTR_CHECK_ASP
+  }
+#endif
+}
 
-      default:
-        break;
+/**
+  * @brief  Processes the end of a reception burst, signaled by the idle line.
+  *
+  * With circular reception, parses the packets of the burst and ends the skipping of the bytes following a
+  * bad header or an overrun. Otherwise, same as ASPEP_HWDataReceivedIT.
+  *
+  * @param  *pHandle Handler of the current instance of the ASPEP component
+  */
+void ASPEP_HWRxIdleIT(ASPEP_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_ASP
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (pHandle->rxRingSize != 0U)
+    {
+      __disable_irq();
+      ASPEP_RingParse(pHandle, true);
+      __enable_irq();
+    }
+    else
+    {
+      ASPEP_HWDataReceivedIT(pHandle);
     }
 #ifdef NULL_PTR_CHECK_ASP
   }
@@ -935,7 +1489,28 @@ void ASPEP_HWDMAReset(ASPEP_Handle_t *pHandle)
     /* Otherwise the arrival of a new packet will trigger a NewPacketAvailable despite */
     /* the fact that bytes have been lost because of overrun (debugger paused for instance) */
     pHandle->ASPEP_TL_State = WAITING_PACKET;
-    pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+    if (0U == pHandle->rxRingSize)
+    {
+      pHandle->fASPEP_receive(pHandle->HWIp, pHandle->rxHeader, ASPEP_HEADER_SIZE);
+    }
+    else
+    {
+      /* The circular DMA keeps running, the corrupted bytes are skipped. A pending packet is still kept */
+      __disable_irq();
+      pHandle->rxRingRead = pHandle->rxRingSize - pHandle->fASPEP_rxRemaining(pHandle->HWIp);
+      if (pHandle->rxRingRead >= pHandle->rxRingSize)
+      {
+        pHandle->rxRingRead = 0U;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->rxRingWrite = pHandle->rxRingRead;
+      pHandle->rxRingFill = 0U;
+      pHandle->rxDiscard = false;
+      __enable_irq();
+    }
 #ifdef NULL_PTR_CHECK_ASP
   }
 #endif
@@ -0,0 +1,554 @@
+
+/**
+  ******************************************************************************
+  * @file    calib_store.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the Calibration Store component of the Motor Control SDK:
+  *           + load of the last valid calibration record at boot
+  *           + wear levelled, non blocking write of new records
+  *           + background re-verification of the stored record
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup CalibStore
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "string.h"
+#include "stddef.h"
+#include "main.h"
+#include "calib_store.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup CalibStore Calibration Store
+  *
+  * @brief Non volatile storage of the calibration results
+  *
+  * The phase current offsets and the alignment results (alignment angle and hall phase shift) are
+  * stored in a flash area reserved by the linker scripts (CALIB memory region, two pages at the end
+  * of bank 2). Records are appended one after the other in the active page; when it is full the
+  * other page is erased and becomes the active one, so each page is erased once every
+  * FLASH_PAGE_SIZE / sizeof(CAL_Record_t) writes and the previous record survives a power loss
+  * during the erase.
+  *
+  * At boot, CAL_Init() selects the valid record (magic, version and CRC) with the highest sequence
+  * number. Flash operations are then run by CAL_Exec() from the Medium Frequency Task, one step per
+  * call: the erase runs in the background and a single double word is programmed per call. The
+  * reserved area is in bank 2, so the code executed from bank 1 is not stalled.
+  *
+  * While idle, CAL_Exec() periodically compares the stored record with its RAM copy and rewrites it
+  * if they differ.
+  *
+  * @{
+  */
+
+#define CAL_DWORDS_PER_RECORD (sizeof(CAL_Record_t) / sizeof(uint64_t))
+
+/**
+  * @brief  Computes the CRC-32 (IEEE 802.3) of a buffer.
+  */
+static uint32_t CAL_Crc32(const uint8_t *pData, uint32_t size)
+{
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i;
+  uint8_t bit;
+
+  for (i = 0U; i < size; i++)
+  {
+    crc ^= pData[i];
+    for (bit = 0U; bit < 8U; bit++)
+    {
+      crc = ((crc & 1U) != 0U) ? ((crc >> 1) ^ 0xEDB88320U) : (crc >> 1);
+    }
+  }
+  return (~crc);
+}
+
+/**
+  * @brief  Returns true if the record is complete and consistent.
+  */
+static bool CAL_IsRecordValid(const CAL_Record_t *pRecord)
+{
+  bool retVal = false;
+
+  if ((CAL_RECORD_MAGIC == pRecord->Magic) && (CAL_RECORD_VERSION == pRecord->Version))
+  {
+    retVal = (CAL_Crc32((const uint8_t *)pRecord, offsetof(CAL_Record_t, Crc)) == pRecord->Crc);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (retVal);
+}
+
+/**
+  * @brief  Returns true if the slot at the given address is erased.
+  */
+static bool CAL_IsSlotErased(uint32_t address)
+{
+  const uint32_t *pWord = (const uint32_t *)address; //cstat !MISRAC2012-Rule-11.4
+  bool retVal = true;
+  uint32_t i;
+
+  for (i = 0U; i < (sizeof(CAL_Record_t) / sizeof(uint32_t)); i++)
+  {
+    if (pWord[i] != 0xFFFFFFFFU)
+    {
+      retVal = false;
+      break;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  return (retVal);
+}
+
+/**
+  * @brief  Starts the erase of the flash page containing the given address and
+  *         returns immediately.
+  */
+static void CAL_StartPageErase(uint32_t address)
+{
+  uint32_t offset = address - FLASH_BASE;
+  uint32_t bank = FLASH_BANK_1;
+
+#if defined (FLASH_OPTR_DUALBANK)
+  if ((READ_BIT(FLASH->OPTR, FLASH_OPTR_DUALBANK) != 0U) && (offset >= FLASH_BANK_SIZE))
+  {
+    bank = FLASH_BANK_2;
+    offset -= FLASH_BANK_SIZE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
+  (void)HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+  FLASH_PageErase(offset / FLASH_PAGE_SIZE, bank);
+}
+
+/**
+  * @brief  Ends a page erase: releases the flash control register and drops the
+  *         data cache lines that may hold the erased content.
+  */
+static void CAL_EndPageErase(void)
+{
+  CLEAR_BIT(FLASH->CR, (FLASH_CR_PER | FLASH_CR_PNB));
+  if (READ_BIT(FLASH->ACR, FLASH_ACR_DCEN) != 0U)
+  {
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Returns the first address of the page following the one of the given address,
+  *         wrapping to the start of the reserved area.
+  */
+static uint32_t CAL_NextPage(const CAL_Handle_t *pHandle, uint32_t address)
+{
+  uint32_t next = (address - (address % FLASH_PAGE_SIZE)) + FLASH_PAGE_SIZE;
+  return ((next >= pHandle->EndAddress) ? pHandle->StartAddress : next);
+}
+
+/**
+  * @brief  Seals the RAM copy of the record and schedules its write.
+  */
+static void CAL_RequestSave(CAL_Handle_t *pHandle)
+{
+  pHandle->Record.Magic = CAL_RECORD_MAGIC;
+  pHandle->Record.Version = CAL_RECORD_VERSION;
+  pHandle->Record.Reserved = 0U;
+  pHandle->SaveRequest = true;
+}
+
+/**
+  * @brief  Initializes the Calibration Store component and loads the most recent
+  *         valid record found in the reserved flash area.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  * @retval bool true if a valid record has been loaded, false otherwise.
+  */
+bool CAL_Init(CAL_Handle_t *pHandle)
+{
+  bool retVal = false;
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t address;
+
+    pHandle->StartAddress = (uint32_t)_scalib; //cstat !MISRAC2012-Rule-11.4
+    pHandle->EndAddress = (uint32_t)_ecalib; //cstat !MISRAC2012-Rule-11.4
+    pHandle->RecordAddress = 0U;
+    pHandle->SaveRequest = false;
+    pHandle->State = CAL_IDLE;
+    pHandle->VerifyCounter = pHandle->VerifyPeriod;
+    pHandle->VerifyErrors = 0U;
+    (void)memset(&pHandle->Record, 0, sizeof(CAL_Record_t));
+
+    for (address = pHandle->StartAddress; address < pHandle->EndAddress; address += sizeof(CAL_Record_t))
+    {
+      const CAL_Record_t *pRecord = (const CAL_Record_t *)address; //cstat !MISRAC2012-Rule-11.4
+      if (CAL_IsRecordValid(pRecord))
+      {
+        if ((false == retVal) || ((int32_t)(pRecord->Sequence - pHandle->Record.Sequence) > 0))
+        {
+          pHandle->Record = *pRecord;
+          pHandle->RecordAddress = address;
+          retVal = true;
+        }
+        else
+        {
+          /* Nothing to do, an older record */
+        }
+      }
+      else
+      {
+        /* Nothing to do, erased or corrupted slot */
+      }
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Runs the background flash operations of the Calibration Store. It must be
+  *         called periodically, at the Medium Frequency Task rate.
+  *
+  *  Each call does at most one flash step: start or poll a page erase, or program
+  *  one double word of the pending record.
+  *
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  */
+void CAL_Exec(CAL_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    switch (pHandle->State)
+    {
+      case CAL_IDLE:
+      {
+        if (pHandle->SaveRequest)
+        {
+          uint32_t address;
+
+          pHandle->SaveRequest = false;
+          pHandle->Record.Sequence++;
+          pHandle->Record.Crc = CAL_Crc32((const uint8_t *)&pHandle->Record, offsetof(CAL_Record_t, Crc));
+          pHandle->WriteIndex = 0U;
+
+          address = (0U == pHandle->RecordAddress) ? pHandle->StartAddress
+                                                   : (pHandle->RecordAddress + sizeof(CAL_Record_t));
+          if (((address % FLASH_PAGE_SIZE) != 0U) && CAL_IsSlotErased(address))
+          {
+            /* Room left in the active page */
+            pHandle->WriteAddress = address;
+            (void)HAL_FLASH_Unlock();
+            __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+            pHandle->State = CAL_PROGRAM;
+          }
+          else
+          {
+            /* Active page full, or first record: move to the next page */
+            pHandle->WriteAddress = (0U == pHandle->RecordAddress) ? pHandle->StartAddress
+                                                                   : CAL_NextPage(pHandle, pHandle->RecordAddress);
+            CAL_StartPageErase(pHandle->WriteAddress);
+            pHandle->State = CAL_ERASE;
+          }
+        }
+        else if (pHandle->RecordAddress != 0U)
+        {
+          if (pHandle->VerifyCounter > 0U)
+          {
+            pHandle->VerifyCounter--;
+          }
+          else
+          {
+            pHandle->VerifyCounter = pHandle->VerifyPeriod;
+            if (memcmp((const void *)pHandle->RecordAddress, &pHandle->Record, sizeof(CAL_Record_t)) != 0) //cstat !MISRAC2012-Rule-11.6
+            {
+              /* The stored record does not match the one in use anymore: write it again */
+              pHandle->VerifyErrors++;
+              pHandle->SaveRequest = true;
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+          }
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case CAL_ERASE:
+      {
+        if (__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY))
+        {
+          /* Nothing to do, erase on going */
+        }
+        else
+        {
+          CAL_EndPageErase();
+          pHandle->State = (__HAL_FLASH_GET_FLAG(FLASH_FLAG_ALL_ERRORS)) ? CAL_ERROR : CAL_PROGRAM;
+          if (CAL_ERROR == pHandle->State)
+          {
+            (void)HAL_FLASH_Lock();
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        break;
+      }
+
+      case CAL_PROGRAM:
+      {
+        uint64_t dword;
+
+        (void)memcpy(&dword, ((const uint8_t *)&pHandle->Record) + (pHandle->WriteIndex * sizeof(uint64_t)),
+                     sizeof(uint64_t));
+        if (HAL_OK == HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                                        pHandle->WriteAddress + (pHandle->WriteIndex * sizeof(uint64_t)), dword))
+        {
+          pHandle->WriteIndex++;
+          if (pHandle->WriteIndex >= CAL_DWORDS_PER_RECORD)
+          {
+            (void)HAL_FLASH_Lock();
+            if (memcmp((const void *)pHandle->WriteAddress, &pHandle->Record, sizeof(CAL_Record_t)) == 0) //cstat !MISRAC2012-Rule-11.6
+            {
+              pHandle->RecordAddress = pHandle->WriteAddress;
+            }
+            else
+            {
+              /* Read back failed, write the record again in the next slot */
+              pHandle->RecordAddress = pHandle->WriteAddress;
+              pHandle->SaveRequest = true;
+            }
+            pHandle->VerifyCounter = pHandle->VerifyPeriod;
+            pHandle->State = CAL_IDLE;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        else
+        {
+          (void)HAL_FLASH_Lock();
+          pHandle->State = CAL_ERROR;
+        }
+        break;
+      }
+
+      case CAL_ERROR:
+      default:
+      {
+        /* Nothing to do, the store stays read only until next reset */
+        break;
+      }
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Stores new phase current offsets. The write is done in the background.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  * @param  pOffsets phase current offsets measured by the current sensing component.
+  */
+void CAL_SetOffsets(CAL_Handle_t *pHandle, const PolarizationOffsets_t *pOffsets)
+{
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == pOffsets))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (((pHandle->Record.Flags & CAL_FLAG_OFFSETS) != 0U)
+        && (0 == memcmp(&pHandle->Record.Offsets, pOffsets, sizeof(PolarizationOffsets_t))))
+    {
+      /* Nothing to do, same values already stored */
+    }
+    else
+    {
+      pHandle->Record.Offsets = *pOffsets;
+      pHandle->Record.Flags |= CAL_FLAG_OFFSETS;
+      CAL_RequestSave(pHandle);
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the stored phase current offsets if they are present and plausible.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  * @param  pOffsets receives the phase current offsets.
+  * @retval bool true if the offsets are valid, false otherwise.
+  */
+bool CAL_GetOffsets(const CAL_Handle_t *pHandle, PolarizationOffsets_t *pOffsets)
+{
+  bool retVal = false;
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == pOffsets))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    const PolarizationOffsets_t *pStored = &pHandle->Record.Offsets;
+
+    if (((pHandle->Record.Flags & CAL_FLAG_OFFSETS) != 0U)
+        && (pStored->phaseAOffset >= CAL_OFFSET_MIN) && (pStored->phaseAOffset <= CAL_OFFSET_MAX)
+        && (pStored->phaseBOffset >= CAL_OFFSET_MIN) && (pStored->phaseBOffset <= CAL_OFFSET_MAX)
+        && (pStored->phaseCOffset >= CAL_OFFSET_MIN) && (pStored->phaseCOffset <= CAL_OFFSET_MAX))
+    {
+      *pOffsets = *pStored;
+      retVal = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Stores a new alignment result. The write is done in the background.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  * @param  hAlignElAngle electrical angle of the alignment, in s16degree.
+  * @param  hPhaseShift hall phase shift measured at the end of the alignment, in s16degree.
+  */
+void CAL_SetHallCorrection(CAL_Handle_t *pHandle, int16_t hAlignElAngle, int16_t hPhaseShift)
+{
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (((pHandle->Record.Flags & CAL_FLAG_HALL) != 0U)
+        && (hAlignElAngle == pHandle->Record.AlignElAngle) && (hPhaseShift == pHandle->Record.HallPhaseShift))
+    {
+      /* Nothing to do, same values already stored */
+    }
+    else
+    {
+      pHandle->Record.AlignElAngle = hAlignElAngle;
+      pHandle->Record.HallPhaseShift = hPhaseShift;
+      pHandle->Record.Flags |= CAL_FLAG_HALL;
+      CAL_RequestSave(pHandle);
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the stored hall phase shift if present.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  * @param  pPhaseShift receives the hall phase shift, in s16degree.
+  * @retval bool true if the phase shift is valid, false otherwise.
+  */
+bool CAL_GetHallCorrection(const CAL_Handle_t *pHandle, int16_t *pPhaseShift)
+{
+  bool retVal = false;
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if ((MC_NULL == pHandle) || (MC_NULL == pPhaseShift))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((pHandle->Record.Flags & CAL_FLAG_HALL) != 0U)
+    {
+      *pPhaseShift = pHandle->Record.HallPhaseShift;
+      retVal = true;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Invalidates the stored calibration. A record without content is written,
+  *         so the full calibration is executed again after the next reset.
+  * @param  pHandle handler of the current instance of the Calibration Store component.
+  */
+void CAL_Erase(CAL_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Record.Flags = 0U;
+    CAL_RequestSave(pHandle);
+#ifdef NULL_PTR_CHECK_CAL_STORE
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
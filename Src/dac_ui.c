@@ -24,6 +24,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "mc_type.h"
+#include "parameters_conversion.h"
 #include "dac_ui.h"
 #include "register_interface.h"
 
@@ -48,8 +49,43 @@
 
 DAC_Handle_t DAC_Handle;
 
+/**
+  * @brief  Scales the data of a channel and saturates it to the DAC range.
+  * @param  pHandle pointer on related component instance.
+  * @param  bChannel the DAC channel.
+  * @retval Output value, 16 bits left aligned.
+  */
+static inline uint32_t DAC_Scale(const DAC_Handle_t *pHandle, DAC_Channel_t bChannel)
+{
+  int32_t value = *((int16_t *)pHandle->ptrDataCh[bChannel]); //cstat !MISRAC2012-Rule-11.3
+  value = (int32_t)pHandle->offsetCh[bChannel] + ((value * (int32_t)pHandle->scaleCh[bChannel]) >> 8);
+  value = (value < 0) ? 0 : value;
+  value = (value > 65535) ? 65535 : value;
+  return ((uint32_t)value);
+}
+
+/**
+  * @brief  Restarts the DMA from the first sample of the ring and the trigger timer at the decimated rate.
+  * @param  pHandle pointer on related component instance.
+  */
+static void DAC_StartDMA(DAC_Handle_t *pHandle)
+{
+  LL_TIM_DisableCounter(DAC_TIM);
+  LL_DMA_DisableChannel(DAC_DMA, DAC_DMA_CHANNEL);
+  LL_TIM_SetPrescaler(DAC_TIM, pHandle->decimation);
+  LL_TIM_GenerateEvent_UPDATE(DAC_TIM); /* Loads the prescaler */
+  LL_TIM_SetCounter(DAC_TIM, 0U);
+  /* The DMA reads the first sample of the ring first, DAC_Exec() writes half a ring ahead */
+  pHandle->ringIndex = (uint8_t)(DAC_RING_SIZE / 2U);
+  LL_DMA_SetDataLength(DAC_DMA, DAC_DMA_CHANNEL, DAC_RING_SIZE);
+  LL_DMA_EnableChannel(DAC_DMA, DAC_DMA_CHANNEL);
+  LL_TIM_EnableCounter(DAC_TIM);
+}
+
 /**
   * @brief  Hardware and software initialization of the DAC object.
+  *
+  * By default, Ia and Ib of motor 1 are sent unscaled around mid-scale in #DAC_MODE_DMA.
   * @param  pHandle pointer on related component instance.
   */
 __weak void DAC_Init(DAC_Handle_t *pHandle)
@@ -62,13 +98,43 @@ __weak void DAC_Init(DAC_Handle_t *pHandle)
   else
   {
 #endif
-    /* Enable DAC Channel1 */
-    /* By default send Ia motor 1 */
     (void)RI_GetPtrReg((MC_REG_I_A + 0x1U), (void *)&pHandle->ptrDataCh[DAC_CH1]); //cstat !MISRAC2012-Rule-11.5
-    LL_DAC_Enable(DAC1, LL_DAC_CHANNEL_1);
+    (void)RI_GetPtrReg((MC_REG_I_B + 0x1U), (void *)&pHandle->ptrDataCh[DAC_CH2]); //cstat !MISRAC2012-Rule-11.5
+    pHandle->scaleCh[DAC_CH1] = DAC_SCALE_UNITY;
+    pHandle->scaleCh[DAC_CH2] = DAC_SCALE_UNITY;
+    pHandle->offsetCh[DAC_CH1] = (uint16_t)DACOFF;
+    pHandle->offsetCh[DAC_CH2] = (uint16_t)DACOFF;
+    pHandle->decimation = 0U;
+    pHandle->decimationCount = 0U;
+
+    /* DMA mode: the timer triggers both channels, whose samples are written at once in the dual data register */
+    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM7);
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+    LL_TIM_SetAutoReload(DAC_TIM, DAC_TIM_PERIOD - 1U);
+    LL_TIM_SetTriggerOutput(DAC_TIM, LL_TIM_TRGO_UPDATE);
+    LL_DMA_ConfigTransfer(DAC_DMA, DAC_DMA_CHANNEL, LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_MODE_CIRCULAR
+                          | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_WORD
+                          | LL_DMA_MDATAALIGN_WORD | LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetPeriphRequest(DAC_DMA, DAC_DMA_CHANNEL, DAC_DMA_REQUEST);
+    LL_DMA_ConfigAddresses(DAC_DMA, DAC_DMA_CHANNEL, (uint32_t)pHandle->ring, (uint32_t)&DAC1->DHR12LD,
+                           LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    (void)DAC_SetMode(pHandle, DAC_MODE_DMA);
 #ifdef NULL_PTR_CHECK_DAC_UI
   }
-  #endif
+#endif
+}
+
+/**
+  * @brief  This method is used to update the DAC outputs. The selected
+  *         variables will be provided in the related output channels.
+  *
+  * In #DAC_MODE_DMA, the samples are only stored in the ring and the trigger timer is re-phased.
+  * Not to be called in #DAC_MODE_OFF.
+  * @param  pHandle pointer on related component instance.
+  */
+
+__weak void DAC_Exec(DAC_Handle_t *pHandle)
+{
 #ifdef NULL_PTR_CHECK_DAC_UI
   if (MC_NULL == pHandle)
   {
@@ -77,23 +143,113 @@ __weak void DAC_Init(DAC_Handle_t *pHandle)
   else
   {
 #endif
-    /* Enable DAC Channel2 */
-    /* By default send Ib motor 1 */
-    (void)RI_GetPtrReg((MC_REG_I_B + 0x1U), (void *)&pHandle->ptrDataCh[DAC_CH2]); //cstat !MISRAC2012-Rule-11.5
-    LL_DAC_Enable(DAC1, LL_DAC_CHANNEL_2);
+    if (pHandle->decimationCount < pHandle->decimation)
+    {
+      pHandle->decimationCount++;
+    }
+    else
+    {
+      uint32_t temp1 = DAC_Scale(pHandle, DAC_CH1);
+      uint32_t temp2 = DAC_Scale(pHandle, DAC_CH2);
+      pHandle->decimationCount = 0U;
+      if (DAC_MODE_DMA == pHandle->mode)
+      {
+        pHandle->ring[pHandle->ringIndex] = (temp1 & 0xFFF0U) | ((temp2 & 0xFFF0U) << 16U);
+        pHandle->ringIndex = (uint8_t)((pHandle->ringIndex + 1U) & (DAC_RING_SIZE - 1U));
+        /* TIM7 is not synchronized with TIM1: it is re-phased at each sample, so that its update, which triggers
+           the DAC, stays half a sample period after the High Frequency Task and does not drift against it */
+        LL_TIM_SetCounter(DAC_TIM, DAC_TIM_PERIOD / 2U);
+      }
+      else
+      {
+        LL_DAC_ConvertData12LeftAligned(DAC1, LL_DAC_CHANNEL_1, temp1);
+        LL_DAC_TrigSWConversion(DAC1, LL_DAC_CHANNEL_1);
+        LL_DAC_ConvertData12LeftAligned(DAC1, LL_DAC_CHANNEL_2, temp2);
+        LL_DAC_TrigSWConversion(DAC1, LL_DAC_CHANNEL_2);
+      }
+    }
 #ifdef NULL_PTR_CHECK_DAC_UI
   }
 #endif
-
 }
 
 /**
-  * @brief  This method is used to update the DAC outputs. The selected
-  *         variables will be provided in the related output channels.
+  * @brief  Selects how the DAC outputs are updated.
+  *
+  * Called under the Medium Frequency Task, DAC_Exec() is disabled during the reconfiguration.
   * @param  pHandle pointer on related component instance.
+  * @param  mode #DAC_MODE_OFF, #DAC_MODE_DIRECT or #DAC_MODE_DMA.
+  * @retval Returns false if the mode is unknown.
   */
+__weak bool DAC_SetMode(DAC_Handle_t *pHandle, uint8_t mode)
+{
+  bool result = false;
+#ifdef NULL_PTR_CHECK_DAC_UI
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (mode > DAC_MODE_DMA)
+    {
+      /* Nothing to do */
+    }
+    else
+    {
+      pHandle->mode = DAC_MODE_OFF;
+      LL_TIM_DisableCounter(DAC_TIM);
+      LL_DMA_DisableChannel(DAC_DMA, DAC_DMA_CHANNEL);
+      LL_DAC_Disable(DAC1, LL_DAC_CHANNEL_1);
+      LL_DAC_Disable(DAC1, LL_DAC_CHANNEL_2);
+      if (DAC_MODE_DMA == mode)
+      {
+        LL_DAC_SetTriggerSource(DAC1, LL_DAC_CHANNEL_1, LL_DAC_TRIG_EXT_TIM7_TRGO);
+        LL_DAC_SetTriggerSource(DAC1, LL_DAC_CHANNEL_2, LL_DAC_TRIG_EXT_TIM7_TRGO);
+        LL_DAC_EnableDMAReq(DAC1, LL_DAC_CHANNEL_1); /* One request carries both channels */
+      }
+      else
+      {
+        LL_DAC_SetTriggerSource(DAC1, LL_DAC_CHANNEL_1, LL_DAC_TRIG_SOFTWARE);
+        LL_DAC_SetTriggerSource(DAC1, LL_DAC_CHANNEL_2, LL_DAC_TRIG_SOFTWARE);
+        LL_DAC_DisableDMAReq(DAC1, LL_DAC_CHANNEL_1);
+      }
+      LL_DAC_EnableTrigger(DAC1, LL_DAC_CHANNEL_1);
+      LL_DAC_EnableTrigger(DAC1, LL_DAC_CHANNEL_2);
+      if (mode != DAC_MODE_OFF)
+      {
+        LL_DAC_Enable(DAC1, LL_DAC_CHANNEL_1);
+        LL_DAC_Enable(DAC1, LL_DAC_CHANNEL_2);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if (DAC_MODE_DMA == mode)
+      {
+        DAC_StartDMA(pHandle);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->decimationCount = 0U;
+      pHandle->mode = mode;
+      result = true;
+    }
+#ifdef NULL_PTR_CHECK_DAC_UI
+  }
+#endif
+  return (result);
+}
 
-__weak void DAC_Exec(DAC_Handle_t *pHandle)
+/**
+  * @brief  Sets the rate of the DAC outputs: one sample every decimation+1 High Frequency Task calls.
+  * @param  pHandle pointer on related component instance.
+  * @param  decimation Number of High Frequency Task calls skipped between two samples.
+  */
+__weak void DAC_SetDecimation(DAC_Handle_t *pHandle, uint8_t decimation)
 {
 #ifdef NULL_PTR_CHECK_DAC_UI
   if (MC_NULL == pHandle)
@@ -103,14 +259,9 @@ __weak void DAC_Exec(DAC_Handle_t *pHandle)
   else
   {
 #endif
-    uint32_t temp1;
-    temp1 = DACOFF + (uint32_t)*((uint16_t*) pHandle->ptrDataCh[DAC_CH1]); //cstat !MISRAC2012-Rule-11.3
-    LL_DAC_ConvertData12LeftAligned(DAC1, LL_DAC_CHANNEL_1, temp1);
-    LL_DAC_TrigSWConversion(DAC1, LL_DAC_CHANNEL_1);
-    uint32_t temp2;
-    temp2 = DACOFF + (uint32_t)*((uint16_t*) pHandle->ptrDataCh[DAC_CH2]); //cstat !MISRAC2012-Rule-11.3
-    LL_DAC_ConvertData12LeftAligned(DAC1, LL_DAC_CHANNEL_2, temp2);
-    LL_DAC_TrigSWConversion(DAC1, LL_DAC_CHANNEL_2);
+    pHandle->decimation = decimation;
+    /* Restarts the timer at the new rate */
+    (void)DAC_SetMode(pHandle, pHandle->mode);
 #ifdef NULL_PTR_CHECK_DAC_UI
   }
 #endif
@@ -0,0 +1,566 @@
+
+/**
+  ******************************************************************************
+  * @file    freq_response.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the Frequency Response Analyser component of the Motor Control SDK:
+  *           + sine perturbation of the current, speed or position reference
+  *           + correlation of the reference and of the feedback at the loop rate
+  *           + logarithmic frequency sweep and upload of the gain and phase through MCP
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup FreqResponse
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include "string.h"
+#include "freq_response.h"
+#include "mc_math.h"
+#include "mcp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup FreqResponse Frequency Response Analyser
+  *
+  * @brief Bode plot of the current, speed or position loop measured on the target
+  *
+  * A sine perturbation is added to the reference of the measured loop. At each loop sample, the
+  * reference and the feedback are multiplied by the cosine and the sine of the perturbation and
+  * accumulated: this is a single bin DFT of both signals, which costs four multiply-accumulates per
+  * sample. The sums are taken over an integer number of periods, after SettleCycles periods that let
+  * the transient die out, so the other frequencies cancel out. The Medium Frequency Task then divides
+  * the feedback bin by the reference bin to get the closed loop gain and phase, and moves to the next
+  * frequency. The open loop response L is obtained on the host as H / (1 - H).
+  *
+  * The reference includes the perturbation and whatever the outer loops add to it, so the current loop
+  * is measured in place. The speed loop is measured alone around zero speed, the position loop being
+  * suspended; it pulls the axis back when the sweep ends.
+  *
+  * Configuration (MC_REG_FREQ_RESP_CONFIG): Loop (u8, see #FRA_Loop_t), NbrOfPoints (u8),
+  * SettleCycles (u8), MeasureCycles (u8), Amplitude (int16), reserved (u16), StartFrequency in Hz
+  * (float), StopFrequency in Hz (float).
+  *
+  * Upload (MC_REG_FREQ_RESP_DATA): Offset of the first point (u8), NbrOfPoints in the chunk (u8),
+  * points Completed so far (u8), NbrOfPoints of the sweep (u8), then Frequency in Hz, Gain and Phase
+  * in degrees of each point (float). The first point of the chunk is selected by writing
+  * MC_REG_FREQ_RESP_OFFSET, the points can be read while the sweep is running.
+  *
+  * @{
+  */
+
+#define FRA_PHASE_TURN        4294967296.0f  /* Phase accumulator increment of a full turn */
+#define FRA_RAD_TO_DEG        57.29578f
+
+/**
+  * @brief  Returns the call rate of FRA_Exec() for a loop, expressed in Hz.
+  */
+static float FRA_SamplingFrequency(const FRA_Handle_t *pHandle, FRA_Loop_t loop)
+{
+  return ((FRA_LOOP_CURRENT == loop) ? (float)pHandle->HFFrequencyHz : (float)pHandle->MFFrequencyHz);
+}
+
+/**
+  * @brief  Sets the perturbation of the point PointIndex and hands it over to FRA_Exec().
+  */
+static void FRA_StartPoint(FRA_Handle_t *pHandle)
+{
+  float samplingHz = FRA_SamplingFrequency(pHandle, pHandle->Loop);
+  float frequency = pHandle->StartFrequency;
+  uint32_t phaseStep;
+
+  if (pHandle->NbrOfPoints > 1U)
+  {
+    frequency *= powf(pHandle->StopFrequency / pHandle->StartFrequency,
+                      (float)pHandle->PointIndex / (float)(pHandle->NbrOfPoints - 1U));
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  phaseStep = (uint32_t)((frequency / samplingHz) * FRA_PHASE_TURN);
+  if (0U == phaseStep)
+  {
+    phaseStep = 1U;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  /* Frequency actually generated by the phase accumulator */
+  pHandle->Points[pHandle->PointIndex].Frequency = ((float)phaseStep * samplingHz) / FRA_PHASE_TURN;
+
+  pHandle->PhaseStep = phaseStep;
+  pHandle->Phase = 0U;
+  pHandle->Cycles = 0U;
+  pHandle->EndCycles = (uint16_t)pHandle->SettleCycles + pHandle->MeasureCycles;
+  pHandle->SampleCount = 0U;
+  pHandle->InputCos = 0;
+  pHandle->InputSin = 0;
+  pHandle->OutputCos = 0;
+  pHandle->OutputSin = 0;
+  pHandle->PointStarted = true;
+  /* Published last, FRA_Exec() relies on it */
+  pHandle->Sampling = true;
+}
+
+/**
+  * @brief  Computes the gain and the phase of the point PointIndex from the sums of FRA_Exec().
+  */
+static void FRA_CalcPoint(FRA_Handle_t *pHandle)
+{
+  FRA_Point_t *pPoint = &pHandle->Points[pHandle->PointIndex];
+  float inCos = (float)pHandle->InputCos;
+  float inSin = (float)pHandle->InputSin;
+  float outCos = (float)pHandle->OutputCos;
+  float outSin = (float)pHandle->OutputSin;
+  float inSquare = (inCos * inCos) + (inSin * inSin);
+
+  if (inSquare > 0.0f)
+  {
+    /* Feedback bin divided by the reference bin, both bins being (cos sum) - j (sin sum) */
+    pPoint->Gain = sqrtf(((outCos * outCos) + (outSin * outSin)) / inSquare);
+    pPoint->Phase = atan2f((outCos * inSin) - (outSin * inCos), (outCos * inCos) + (outSin * inSin))
+                    * FRA_RAD_TO_DEG;
+  }
+  else
+  {
+    pPoint->Gain = 0.0f;
+    pPoint->Phase = 0.0f;
+  }
+}
+
+/**
+  * @brief  Initializes the Frequency Response Analyser component.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  *
+  * The configuration of the sweep keeps the values of the handle initializer.
+  */
+void FRA_Init(FRA_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FRA
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->State = FRA_IDLE;
+    pHandle->Sampling = false;
+    pHandle->PointStarted = false;
+    pHandle->PointIndex = 0U;
+    pHandle->Completed = 0U;
+    pHandle->ReadOffset = 0U;
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the loop and the frequencies of the sweep.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @param  pData pointer on the configuration, see @ref FreqResponse for the layout.
+  * @param  size size of the configuration in bytes.
+  * @retval MCP_CMD_OK if the configuration is applied, MCP_ERROR_REGISTER_ACCESS while a sweep is
+  *         running, MCP_ERROR_BAD_RAW_FORMAT if the configuration is malformed or if the stop
+  *         frequency is not below half the sampling frequency of the loop.
+  */
+uint8_t FRA_SetConfig(FRA_Handle_t *pHandle, const uint8_t *pData, uint16_t size)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_FRA
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    int16_t amplitude;
+    float startFrequency;
+    float stopFrequency;
+
+    if (FRA_RUNNING == pHandle->State)
+    {
+      retVal = MCP_ERROR_REGISTER_ACCESS;
+    }
+    else if (size != FRA_CONFIG_SIZE)
+    {
+      retVal = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else
+    {
+      (void)memcpy(&amplitude, &pData[4], 2);
+      (void)memcpy(&startFrequency, &pData[8], 4);
+      (void)memcpy(&stopFrequency, &pData[12], 4);
+      if ((pData[0] < (uint8_t)FRA_LOOP_CURRENT) || (pData[0] > (uint8_t)FRA_LOOP_POSITION)
+          || (0U == pData[1]) || (pData[1] > FRA_MAX_POINTS) || (0U == pData[3]) || (amplitude <= 0)
+          || (!(startFrequency > 0.0f)) || (!(stopFrequency >= startFrequency))
+          || (!(stopFrequency < (0.5f * FRA_SamplingFrequency(pHandle, (FRA_Loop_t)pData[0])))))
+      {
+        retVal = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else
+      {
+        pHandle->Loop = (FRA_Loop_t)pData[0];
+        pHandle->NbrOfPoints = pData[1];
+        pHandle->SettleCycles = pData[2];
+        pHandle->MeasureCycles = pData[3];
+        pHandle->Amplitude = amplitude;
+        pHandle->StartFrequency = startFrequency;
+        pHandle->StopFrequency = stopFrequency;
+      }
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Returns the configuration of the sweep.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @param  pData pointer on the buffer receiving the #FRA_CONFIG_SIZE bytes of the configuration, see
+  *         @ref FreqResponse for the layout.
+  */
+void FRA_GetConfig(const FRA_Handle_t *pHandle, uint8_t *pData)
+{
+#ifdef NULL_PTR_CHECK_FRA
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pData[0] = (uint8_t)pHandle->Loop;
+    pData[1] = pHandle->NbrOfPoints;
+    pData[2] = pHandle->SettleCycles;
+    pData[3] = pHandle->MeasureCycles;
+    (void)memcpy(&pData[4], &pHandle->Amplitude, 2);
+    pData[6] = 0U;
+    pData[7] = 0U;
+    (void)memcpy(&pData[8], &pHandle->StartFrequency, 4);
+    (void)memcpy(&pData[12], &pHandle->StopFrequency, 4);
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+}
+
+/**
+  * @brief  Starts or stops a sweep.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @param  command #FRA_CMD_START or #FRA_CMD_STOP.
+  * @retval MCP_CMD_OK if the command is executed, MCP_ERROR_BAD_DATA_TYPE if the command is not known.
+  *
+  * The motor must be running before a sweep is started, which is checked by the caller. Starting
+  * discards the points of the previous sweep.
+  */
+uint8_t FRA_Command(FRA_Handle_t *pHandle, uint8_t command)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_FRA
+  if (MC_NULL == pHandle)
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    switch (command)
+    {
+      case FRA_CMD_START:
+      {
+        /* The sampling task ignores the sweep until the first point is started by FRA_Process() */
+        pHandle->Sampling = false;
+        pHandle->PointStarted = false;
+        pHandle->PointIndex = 0U;
+        pHandle->Completed = 0U;
+        pHandle->ReadOffset = 0U;
+        pHandle->State = FRA_RUNNING;
+        break;
+      }
+
+      case FRA_CMD_STOP:
+      {
+        FRA_Stop(pHandle);
+        break;
+      }
+
+      default:
+      {
+        retVal = MCP_ERROR_BAD_DATA_TYPE;
+        break;
+      }
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Aborts the sweep in progress, the points measured so far are kept.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  *
+  * It must be called when the PWM is switched off.
+  */
+void FRA_Stop(FRA_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FRA
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (FRA_RUNNING == pHandle->State)
+    {
+      pHandle->Sampling = false;
+      pHandle->State = FRA_ABORTED;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the loop measured by the running sweep.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @retval #FRA_LOOP_NONE if no sweep is running.
+  */
+FRA_Loop_t FRA_GetLoop(const FRA_Handle_t *pHandle)
+{
+  return ((FRA_RUNNING == pHandle->State) ? pHandle->Loop : FRA_LOOP_NONE);
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Returns the perturbation to add to the reference and correlates the response.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @param  Reference reference of the measured loop without the perturbation.
+  * @param  Feedback feedback of the measured loop, in the unit of the reference.
+  * @retval Perturbation, in the unit of the reference. 0 between two points.
+  *
+  * It must be called at each sample of the measured loop, by the High Frequency Task for
+  * #FRA_LOOP_CURRENT and by the Medium Frequency Task otherwise. The phase of the perturbation is
+  * read from the sine table, then the reference and the feedback are accumulated with four
+  * multiply-accumulates.
+  */
+int32_t FRA_Exec(FRA_Handle_t *pHandle, int32_t Reference, int32_t Feedback)
+{
+  int32_t perturbation = 0;
+#ifdef NULL_PTR_CHECK_FRA
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (pHandle->Sampling)
+    {
+      Trig_Components trig = MCM_Trig_Functions((int16_t)(pHandle->Phase >> 16));
+      uint32_t phase;
+
+      perturbation = ((int32_t)pHandle->Amplitude * trig.hSin) >> 15;
+      if (0U == pHandle->SampleCount)
+      {
+        /* Keeps the DC part of the signals out of the sums */
+        pHandle->InputOrigin = Reference;
+        pHandle->OutputOrigin = Feedback;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->SampleCount++;
+
+      if (pHandle->Cycles >= pHandle->SettleCycles)
+      {
+        int32_t input = (Reference + perturbation) - pHandle->InputOrigin;
+        int32_t output = Feedback - pHandle->OutputOrigin;
+
+        pHandle->InputCos += (int64_t)input * trig.hCos;
+        pHandle->InputSin += (int64_t)input * trig.hSin;
+        pHandle->OutputCos += (int64_t)output * trig.hCos;
+        pHandle->OutputSin += (int64_t)output * trig.hSin;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      phase = pHandle->Phase + pHandle->PhaseStep;
+      if (phase < pHandle->Phase)
+      {
+        /* A period is completed, the sums always cover whole periods */
+        pHandle->Cycles++;
+        if (pHandle->Cycles >= pHandle->EndCycles)
+        {
+          pHandle->Sampling = false;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pHandle->Phase = phase;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+  return (perturbation);
+}
+
+/**
+  * @brief  Computes the point whose measurement window is over and starts the next one.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  *
+  * It must be called by the Medium Frequency Task while the motor runs, before FRA_Exec() for the
+  * loops sampled by this task.
+  */
+void FRA_Process(FRA_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_FRA
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if ((FRA_RUNNING == pHandle->State) && (false == pHandle->Sampling))
+    {
+      if (pHandle->PointStarted)
+      {
+        FRA_CalcPoint(pHandle);
+        pHandle->PointStarted = false;
+        pHandle->PointIndex++;
+        pHandle->Completed = pHandle->PointIndex;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if (pHandle->PointIndex >= pHandle->NbrOfPoints)
+      {
+        pHandle->State = FRA_DONE;
+      }
+      else
+      {
+        FRA_StartPoint(pHandle);
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+}
+
+/**
+  * @brief  Copies a chunk of the measured points, starting at the point selected by ReadOffset.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  * @param  pData pointer on the buffer receiving the chunk, see @ref FreqResponse for the layout.
+  * @param  maxSize size of the buffer in bytes.
+  * @param  pSize returns the size of the chunk in bytes.
+  * @retval MCP_CMD_OK if the chunk is copied, MCP_ERROR_NO_TXSYNC_SPACE if the buffer can not hold
+  *         the chunk header.
+  */
+uint8_t FRA_ReadData(const FRA_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize, uint16_t *pSize)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_FRA
+  if ((MC_NULL == pHandle) || (MC_NULL == pData) || (MC_NULL == pSize))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    *pSize = 0U;
+    if (maxSize < FRA_DATA_HEADER_SIZE)
+    {
+      retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+    }
+    else
+    {
+      uint8_t completed = pHandle->Completed;
+      uint8_t offset = (pHandle->ReadOffset < completed) ? pHandle->ReadOffset : completed;
+      uint16_t nbrOfPoints = (maxSize - FRA_DATA_HEADER_SIZE) / FRA_POINT_SIZE;
+
+      if (nbrOfPoints > ((uint16_t)completed - offset))
+      {
+        nbrOfPoints = (uint16_t)completed - offset;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      pData[0] = offset;
+      pData[1] = (uint8_t)nbrOfPoints;
+      pData[2] = completed;
+      pData[3] = pHandle->NbrOfPoints;
+      (void)memcpy(&pData[FRA_DATA_HEADER_SIZE], &pHandle->Points[offset], FRA_POINT_SIZE * (uint32_t)nbrOfPoints);
+      *pSize = FRA_DATA_HEADER_SIZE + (nbrOfPoints * FRA_POINT_SIZE);
+    }
+#ifdef NULL_PTR_CHECK_FRA
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Returns the sweep state.
+  * @param  pHandle handler of the current instance of the Frequency Response Analyser component.
+  */
+FRA_State_t FRA_GetState(const FRA_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
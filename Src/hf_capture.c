@@ -0,0 +1,625 @@
+
+/**
+  ******************************************************************************
+  * @file    hf_capture.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the High Frequency Capture component of the Motor Control SDK:
+  *           + recording of selected registers at the High Frequency Task rate
+  *           + level, edge, fault and forced triggers with pre-trigger frames
+  *           + upload of the capture in chunks through MCP
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup HFCapture
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "string.h"
+#include "hf_capture.h"
+#include "register_interface.h"
+#include "mcp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup HFCapture High Frequency Capture
+  *
+  * @brief Oscilloscope like capture of registers at the FOC rate
+  *
+  * The asynchronous log (MCPA) is limited by the bandwidth of the link, so fast transients can
+  * not be observed sample by sample with it. This component records up to #HFC_MAX_CHANNELS 16 bits
+  * registers at every High Frequency Task call (or every Divider calls) in a RAM ring buffer.
+  * Recording starts when the capture is armed; once the trigger condition is met, the buffer is
+  * filled with the post-trigger frames and the capture is frozen until the host uploads it.
+  *
+  * The registers are the ones RI_GetPtrReg() can point to, so a frame costs one load and one
+  * store per channel in the HF task.
+  *
+  * Configuration (MC_REG_HF_CAPTURE_CONFIG): NbrOfChannels (u8), TriggerMode (u8, see
+  * #HFC_TriggerMode_t), TriggerChannel (u8), Divider (u8), TriggerLevel (int16), PreTrigger in
+  * frames (u16), Depth in frames (u16, read only), then the register ID of each channel (u16).
+  *
+  * Upload (MC_REG_HF_CAPTURE_DATA): Offset of the first frame (u16), NbrOfFrames in the chunk (u16),
+  * Length of the capture in frames (u16), TriggerPos (u16), NbrOfChannels (u8), Divider (u8), then
+  * the frames in chronological order. The first frame of the chunk is selected by writing
+  * MC_REG_HF_CAPTURE_OFFSET, so a chunk can be read again if the answer is lost.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Freezes the capture and locates its first frame in the buffer.
+  */
+static void HFC_Close(HFC_Handle_t *pHandle)
+{
+  uint32_t used = (uint32_t)pHandle->Length * pHandle->NbrOfChannels;
+
+  pHandle->StartIndex = (uint16_t)(((uint32_t)pHandle->WriteIndex + pHandle->EndIndex - used) % pHandle->EndIndex);
+  pHandle->ReadOffset = 0U;
+  pHandle->State = HFC_DONE;
+}
+
+/**
+  * @brief  Makes the last recorded frame the trigger frame, then records the post-trigger frames.
+  */
+static void HFC_Trigger(HFC_Handle_t *pHandle)
+{
+  pHandle->TriggerRequest = false;
+  pHandle->TriggerPos = ((pHandle->Recorded - 1U) < pHandle->PreTrigger)
+                        ? (pHandle->Recorded - 1U) : pHandle->PreTrigger;
+  pHandle->Length = pHandle->TriggerPos + 1U;
+  pHandle->Remaining = pHandle->Depth - pHandle->PreTrigger - 1U;
+  if (0U == pHandle->Remaining)
+  {
+    HFC_Close(pHandle);
+  }
+  else
+  {
+    pHandle->State = HFC_TRIGGERED;
+  }
+}
+
+/**
+  * @brief  Initializes the High Frequency Capture component.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  */
+void HFC_Init(HFC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HFC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->State = HFC_IDLE;
+    pHandle->TriggerRequest = false;
+    pHandle->NbrOfChannels = 0U;
+    pHandle->Divider = 1U;
+    pHandle->TriggerMode = HFC_TRIGGER_NONE;
+    pHandle->TriggerChannel = 0U;
+    pHandle->TriggerLevel = 0;
+    pHandle->PreTrigger = 0U;
+    pHandle->Depth = 0U;
+    pHandle->EndIndex = 0U;
+    pHandle->Length = 0U;
+    pHandle->ReadOffset = 0U;
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the channels and the trigger of the capture.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  * @param  pData pointer on the configuration, see @ref HFCapture for the layout.
+  * @param  size size of the configuration in bytes.
+  * @retval MCP_CMD_OK if the configuration is applied, MCP_ERROR_REGISTER_ACCESS while a capture is
+  *         in progress, MCP_ERROR_UNKNOWN_REG or MCP_ERROR_BAD_DATA_TYPE if a channel can not be
+  *         recorded, MCP_ERROR_BAD_RAW_FORMAT if the configuration is malformed.
+  *
+  * A previous capture is discarded.
+  */
+uint8_t HFC_SetConfig(HFC_Handle_t *pHandle, const uint8_t *pData, uint16_t size)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_HFC
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    int16_t *pSource[HFC_MAX_CHANNELS];
+    uint16_t channelID[HFC_MAX_CHANNELS];
+    uint16_t preTrigger;
+    uint16_t depth = 0U;
+    uint8_t nbrOfChannels;
+    uint8_t i;
+
+    if ((HFC_ARMED == pHandle->State) || (HFC_TRIGGERED == pHandle->State))
+    {
+      retVal = MCP_ERROR_REGISTER_ACCESS;
+    }
+    else if (size < HFC_CONFIG_HEADER_SIZE)
+    {
+      retVal = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else
+    {
+      nbrOfChannels = pData[0];
+      (void)memcpy(&preTrigger, &pData[6], 2);
+      if ((0U == nbrOfChannels) || (nbrOfChannels > HFC_MAX_CHANNELS)
+          || (size != (HFC_CONFIG_HEADER_SIZE + (2U * (uint16_t)nbrOfChannels)))
+          || (pData[1] > (uint8_t)HFC_TRIGGER_FAULT) || (pData[2] >= nbrOfChannels))
+      {
+        retVal = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else
+      {
+        depth = pHandle->BufferSize / nbrOfChannels;
+        if (preTrigger >= depth)
+        {
+          retVal = MCP_ERROR_BAD_RAW_FORMAT;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+
+      for (i = 0U; (MCP_CMD_OK == retVal) && (i < nbrOfChannels); i++)
+      {
+        (void)memcpy(&channelID[i], &pData[HFC_CONFIG_HEADER_SIZE + (2U * (uint16_t)i)], 2);
+        if (((uint8_t)channelID[i] & TYPE_MASK) != TYPE_DATA_16BIT)
+        {
+          retVal = MCP_ERROR_BAD_DATA_TYPE;
+        }
+        else
+        {
+          retVal = RI_GetPtrReg(channelID[i], (void **)&pSource[i]); //cstat !MISRAC2012-Rule-11.3
+        }
+      }
+    }
+
+    if (MCP_CMD_OK == retVal)
+    {
+      pHandle->State = HFC_IDLE;
+      pHandle->NbrOfChannels = nbrOfChannels;
+      pHandle->TriggerMode = (HFC_TriggerMode_t)pData[1];
+      pHandle->TriggerChannel = pData[2];
+      pHandle->Divider = (0U == pData[3]) ? 1U : pData[3];
+      (void)memcpy(&pHandle->TriggerLevel, &pData[4], 2);
+      pHandle->PreTrigger = preTrigger;
+      pHandle->Depth = depth;
+      pHandle->EndIndex = depth * nbrOfChannels;
+      pHandle->Length = 0U;
+      for (i = 0U; i < nbrOfChannels; i++)
+      {
+        pHandle->pSource[i] = pSource[i];
+        pHandle->ChannelID[i] = channelID[i];
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Returns the configuration of the capture.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  * @param  pData pointer on the buffer receiving the configuration, see @ref HFCapture for the layout.
+  * @param  maxSize size of the buffer in bytes.
+  * @retval Size of the configuration in bytes, 0 if it does not fit in the buffer.
+  */
+uint16_t HFC_GetConfig(const HFC_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize)
+{
+  uint16_t size;
+#ifdef NULL_PTR_CHECK_HFC
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    size = 0U;
+  }
+  else
+  {
+#endif
+    uint8_t i;
+
+    size = HFC_CONFIG_HEADER_SIZE + (2U * (uint16_t)pHandle->NbrOfChannels);
+    if (size > maxSize)
+    {
+      size = 0U;
+    }
+    else
+    {
+      pData[0] = pHandle->NbrOfChannels;
+      pData[1] = (uint8_t)pHandle->TriggerMode;
+      pData[2] = pHandle->TriggerChannel;
+      pData[3] = pHandle->Divider;
+      (void)memcpy(&pData[4], &pHandle->TriggerLevel, 2);
+      (void)memcpy(&pData[6], &pHandle->PreTrigger, 2);
+      (void)memcpy(&pData[8], &pHandle->Depth, 2);
+      for (i = 0U; i < pHandle->NbrOfChannels; i++)
+      {
+        (void)memcpy(&pData[HFC_CONFIG_HEADER_SIZE + (2U * (uint16_t)i)], &pHandle->ChannelID[i], 2);
+      }
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+  return (size);
+}
+
+/**
+  * @brief  Arms, stops or forces the trigger of the capture.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  * @param  command #HFC_CMD_ARM, #HFC_CMD_STOP or #HFC_CMD_FORCE.
+  * @retval MCP_CMD_OK if the command is executed, MCP_CMD_NOK if it is not possible in the current
+  *         state, MCP_ERROR_BAD_DATA_TYPE if the command is not known.
+  *
+  * Arming discards the previous capture. Stopping a triggered capture keeps the frames recorded so
+  * far, which is needed when the HF task is no longer executed after a fault.
+  */
+uint8_t HFC_Command(HFC_Handle_t *pHandle, uint8_t command)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_HFC
+  if (MC_NULL == pHandle)
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    switch (command)
+    {
+      case HFC_CMD_ARM:
+      {
+        if (0U == pHandle->NbrOfChannels)
+        {
+          retVal = MCP_CMD_NOK;
+        }
+        else
+        {
+          /* The HF task ignores the capture until it is armed again */
+          pHandle->State = HFC_IDLE;
+          pHandle->TriggerRequest = false;
+          pHandle->WriteIndex = 0U;
+          pHandle->Recorded = 0U;
+          pHandle->Length = 0U;
+          pHandle->Remaining = 0U;
+          pHandle->DividerCounter = 1U;
+          pHandle->LastTriggerValue = *pHandle->pSource[pHandle->TriggerChannel];
+          pHandle->State = HFC_ARMED;
+        }
+        break;
+      }
+
+      case HFC_CMD_STOP:
+      {
+        if (HFC_TRIGGERED == pHandle->State)
+        {
+          HFC_Close(pHandle);
+        }
+        else if (HFC_ARMED == pHandle->State)
+        {
+          pHandle->State = HFC_IDLE;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+        break;
+      }
+
+      case HFC_CMD_FORCE:
+      {
+        if (HFC_ARMED == pHandle->State)
+        {
+          pHandle->TriggerRequest = true;
+        }
+        else
+        {
+          retVal = MCP_CMD_NOK;
+        }
+        break;
+      }
+
+      default:
+      {
+        retVal = MCP_ERROR_BAD_DATA_TYPE;
+        break;
+      }
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+  return (retVal);
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Records one frame and checks the trigger condition.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  *
+  * It must be called by the High Frequency Task, after the FOC variables are updated.
+  */
+void HFC_Exec(HFC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HFC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    HFC_State_t state = pHandle->State;
+
+    if ((HFC_ARMED == state) || (HFC_TRIGGERED == state))
+    {
+      pHandle->DividerCounter--;
+      if (0U == pHandle->DividerCounter)
+      {
+        int16_t *pFrame = &pHandle->pBuffer[pHandle->WriteIndex];
+        uint8_t i;
+
+        pHandle->DividerCounter = pHandle->Divider;
+        for (i = 0U; i < pHandle->NbrOfChannels; i++)
+        {
+          pFrame[i] = *pHandle->pSource[i];
+        }
+        pHandle->WriteIndex += pHandle->NbrOfChannels;
+        if (pHandle->WriteIndex >= pHandle->EndIndex)
+        {
+          pHandle->WriteIndex = 0U;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+
+        if (HFC_ARMED == state)
+        {
+          int16_t value = pFrame[pHandle->TriggerChannel];
+          int16_t level = pHandle->TriggerLevel;
+          bool ready;
+          bool trigger;
+
+          if (pHandle->Recorded < pHandle->Depth)
+          {
+            pHandle->Recorded++;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          ready = (pHandle->Recorded > pHandle->PreTrigger) ? true : false;
+
+          switch (pHandle->TriggerMode)
+          {
+            case HFC_TRIGGER_NONE:
+              trigger = ready;
+              break;
+
+            case HFC_TRIGGER_ABOVE:
+              trigger = ready && (value >= level);
+              break;
+
+            case HFC_TRIGGER_BELOW:
+              trigger = ready && (value <= level);
+              break;
+
+            case HFC_TRIGGER_RISING:
+              trigger = ready && (pHandle->LastTriggerValue < level) && (value >= level);
+              break;
+
+            case HFC_TRIGGER_FALLING:
+              trigger = ready && (pHandle->LastTriggerValue > level) && (value <= level);
+              break;
+
+            default:
+              trigger = false;
+              break;
+          }
+          pHandle->LastTriggerValue = value;
+
+          /* Forced and fault triggers are accepted even if the pre-trigger frames are not all recorded */
+          if (trigger || pHandle->TriggerRequest)
+          {
+            HFC_Trigger(pHandle);
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+        else
+        {
+          pHandle->Length++;
+          pHandle->Remaining--;
+          if (0U == pHandle->Remaining)
+          {
+            HFC_Close(pHandle);
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+        }
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+}
+
+/**
+  * @brief  Reports a motor fault to a capture armed with #HFC_TRIGGER_FAULT.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  *
+  * The trigger is latched at once: the last frame recorded before the fault is the trigger frame
+  * and the pre-trigger frames are kept. The HF task may stop after the fault, so the post-trigger
+  * frames are recorded only while it still runs; stopping the capture then keeps the frames recorded
+  * so far. If no frame is recorded yet, the trigger frame is the next one.
+  * It is called from the safety task, which the HF task can preempt.
+  */
+void HFC_FaultTrigger(HFC_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_HFC
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (HFC_TRIGGER_FAULT == pHandle->TriggerMode)
+    {
+      __disable_irq();
+      if (HFC_ARMED != pHandle->State)
+      {
+        /* Nothing to do */
+      }
+      else if (0U == pHandle->Recorded)
+      {
+        pHandle->TriggerRequest = true;
+      }
+      else
+      {
+        HFC_Trigger(pHandle);
+      }
+      __enable_irq();
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+}
+
+/**
+  * @brief  Copies a chunk of a complete capture, starting at the frame selected by ReadOffset.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  * @param  pData pointer on the buffer receiving the chunk, see @ref HFCapture for the layout.
+  * @param  maxSize size of the buffer in bytes.
+  * @param  pSize returns the size of the chunk in bytes.
+  * @retval MCP_CMD_OK if the chunk is copied, MCP_ERROR_REGISTER_ACCESS if there is no complete
+  *         capture, MCP_ERROR_NO_TXSYNC_SPACE if the buffer can not hold the chunk header.
+  */
+uint8_t HFC_ReadData(const HFC_Handle_t *pHandle, uint8_t *pData, uint16_t maxSize, uint16_t *pSize)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_HFC
+  if ((MC_NULL == pHandle) || (MC_NULL == pData) || (MC_NULL == pSize))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    *pSize = 0U;
+    if (pHandle->State != HFC_DONE)
+    {
+      retVal = MCP_ERROR_REGISTER_ACCESS;
+    }
+    else if (maxSize < HFC_DATA_HEADER_SIZE)
+    {
+      retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+    }
+    else
+    {
+      uint16_t frameSize = 2U * (uint16_t)pHandle->NbrOfChannels;
+      uint16_t offset = (pHandle->ReadOffset < pHandle->Length) ? pHandle->ReadOffset : pHandle->Length;
+      uint16_t nbrOfFrames = (maxSize - HFC_DATA_HEADER_SIZE) / frameSize;
+      uint16_t index;
+      uint16_t chunk;
+      uint8_t *pDest = &pData[HFC_DATA_HEADER_SIZE];
+
+      if (nbrOfFrames > (pHandle->Length - offset))
+      {
+        nbrOfFrames = pHandle->Length - offset;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      (void)memcpy(&pData[0], &offset, 2);
+      (void)memcpy(&pData[2], &nbrOfFrames, 2);
+      (void)memcpy(&pData[4], &pHandle->Length, 2);
+      (void)memcpy(&pData[6], &pHandle->TriggerPos, 2);
+      pData[8] = pHandle->NbrOfChannels;
+      pData[9] = pHandle->Divider;
+
+      /* The chunk is split in two copies when it wraps around the end of the ring buffer */
+      index = (uint16_t)(((uint32_t)pHandle->StartIndex + ((uint32_t)offset * pHandle->NbrOfChannels))
+                         % pHandle->EndIndex);
+      chunk = nbrOfFrames * pHandle->NbrOfChannels;
+      if (chunk > (pHandle->EndIndex - index))
+      {
+        uint16_t first = pHandle->EndIndex - index;
+        (void)memcpy(pDest, &pHandle->pBuffer[index], 2U * (uint32_t)first);
+        (void)memcpy(&pDest[2U * (uint32_t)first], pHandle->pBuffer, 2U * (uint32_t)(chunk - first));
+      }
+      else
+      {
+        (void)memcpy(pDest, &pHandle->pBuffer[index], 2U * (uint32_t)chunk);
+      }
+      *pSize = HFC_DATA_HEADER_SIZE + (nbrOfFrames * frameSize);
+    }
+#ifdef NULL_PTR_CHECK_HFC
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Returns the capture state.
+  * @param  pHandle handler of the current instance of the High Frequency Capture component.
+  */
+HFC_State_t HFC_GetState(const HFC_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -640,6 +640,14 @@ __weak MCI_State_t MC_GetSTMStateMotor1(void)
   return (MCI_GetSTMState(pMCI[M1]));
 }
 
+/**
+ * @brief returns the time from the last start command of Motor 1 to its #RUN state, in microseconds
+ */
+__weak uint32_t MC_GetStartToTorqueTimeMotor1(void)
+{
+  return (MCI_GetStartToTorqueTime(pMCI[M1]));
+}
+
 /**
   * @brief Sets the polarization offset values to use for Motor 1
   *
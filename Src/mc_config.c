@@ -1,360 +1,856 @@
-
-/**
-  ******************************************************************************
-  * @file    mc_config.c
-  * @author  Motor Control SDK Team,ST Microelectronics
-  * @brief   Motor Control Subsystem components configuration and handler structures.
-  ******************************************************************************
-  * @attention
-  *
-  * <h2><center>&copy; Copyright (c) 2023 STMicroelectronics.
-  * All rights reserved.</center></h2>
-  *
-  * This software component is licensed by ST under Ultimate Liberty license
-  * SLA0044,the "License"; You may not use this file except in compliance with
-  * the License. You may obtain a copy of the License at:
-  *                             www.st.com/SLA0044
-  *
-  ******************************************************************************
-  */
-//cstat -MISRAC2012-Rule-21.1
-#include "main.h" //cstat !MISRAC2012-Rule-21.1
-//cstat +MISRAC2012-Rule-21.1
-#include "mc_type.h"
-#include "parameters_conversion.h"
-#include "mc_parameters.h"
-#include "mc_config.h"
-
-/* USER CODE BEGIN Additional include */
-
-/* USER CODE END Additional include */
-#define FREQ_RATIO 1                /* Dummy value for single drive */
-#define FREQ_RELATION HIGHEST_FREQ  /* Dummy value for single drive */
-
-#include "pqd_motor_power_measurement.h"
-
-/* USER CODE BEGIN Additional define */
-
-/* USER CODE END Additional define */
-
-PQD_MotorPowMeas_Handle_t PQD_MotorPowMeasM1 =
-{
-  .ConvFact = PQD_CONVERSION_FACTOR
-};
-
-/**
-  * @brief  PI / PID Speed loop parameters Motor 1.
-  */
-PID_Handle_t PIDSpeedHandle_M1 =
-{
-  .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
-  .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
-  .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
-  .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
-  .hUpperOutputLimit   = (int16_t)IQMAX,
-  .hLowerOutputLimit   = -(int16_t)IQMAX,
-  .hKpDivisor          = (uint16_t)SP_KPDIV,
-  .hKiDivisor          = (uint16_t)SP_KIDIV,
-  .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
-  .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
-  .hDefKdGain          = 0x0000U,
-  .hKdDivisor          = 0x0000U,
-  .hKdDivisorPOW2      = 0x0000U,
-};
-
-/**
-  * @brief  PI / PID Iq loop parameters Motor 1.
-  */
-PID_Handle_t PIDIqHandle_M1 =
-{
-  .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
-  .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
-  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
-  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
-  .hUpperOutputLimit   = INT16_MAX,
-  .hLowerOutputLimit   = -INT16_MAX,
-  .hKpDivisor          = (uint16_t)TF_KPDIV,
-  .hKiDivisor          = (uint16_t)TF_KIDIV,
-  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
-  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
-  .hDefKdGain          = 0x0000U,
-  .hKdDivisor          = 0x0000U,
-  .hKdDivisorPOW2      = 0x0000U,
-};
-
-/**
-  * @brief  PI / PID Id loop parameters Motor 1.
-  */
-PID_Handle_t PIDIdHandle_M1 =
-{
-  .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
-  .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
-  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
-  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
-  .hUpperOutputLimit   = INT16_MAX,
-  .hLowerOutputLimit   = -INT16_MAX,
-  .hKpDivisor          = (uint16_t)TF_KPDIV,
-  .hKiDivisor          = (uint16_t)TF_KIDIV,
-  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
-  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
-  .hDefKdGain          = 0x0000U,
-  .hKdDivisor          = 0x0000U,
-  .hKdDivisorPOW2      = 0x0000U,
-};
-
-PID_Handle_t PID_PosParamsM1 =
-{
-  .hDefKpGain          = (int16_t)PID_POSITION_KP_GAIN,
-  .hDefKiGain          = (int16_t)PID_POSITION_KI_GAIN,
-  .hDefKdGain          = (int16_t)PID_POSITION_KD_GAIN,
-  .wUpperIntegralLimit = (int32_t)(NOMINAL_CURRENT * PID_POSITION_KIDIV),
-  .wLowerIntegralLimit = (int32_t)(-NOMINAL_CURRENT * PID_POSITION_KIDIV),
-  .hUpperOutputLimit   = (int16_t)NOMINAL_CURRENT,
-  .hLowerOutputLimit   = -(int16_t)NOMINAL_CURRENT,
-  .hKpDivisor          = (uint16_t)PID_POSITION_KPDIV,
-  .hKiDivisor          = (uint16_t)PID_POSITION_KIDIV,
-  .hKdDivisor          = (uint16_t)PID_POSITION_KDDIV,
-  .hKpDivisorPOW2      = (uint16_t)PID_POSITION_KPDIV_LOG,
-  .hKiDivisorPOW2      = (uint16_t)PID_POSITION_KIDIV_LOG,
-  .hKdDivisorPOW2      = (uint16_t)PID_POSITION_KDDIV_LOG,
-};
-
-PosCtrl_Handle_t PosCtrlM1 =
-{
-  .SamplingTime  = 1.0f/MEDIUM_FREQUENCY_TASK_RATE,
-  .SysTickPeriod = 1.0f/SYS_TICK_FREQUENCY,
-  .AlignmentCfg  = TC_ABSOLUTE_ALIGNMENT_NOT_SUPPORTED,
-};
-
-/**
-  * @brief  SpeednTorque Controller parameters Motor 1.
-  */
-SpeednTorqCtrl_Handle_t SpeednTorqCtrlM1 =
-{
-  .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
-  .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
-  .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
-  .MaxAppNegativeMecSpeedUnit = (int16_t)(-MIN_APPLICATION_SPEED_UNIT),
-  .MinAppNegativeMecSpeedUnit = (int16_t)(-MAX_APPLICATION_SPEED_UNIT),
-  .MaxPositiveTorque          = (int16_t)NOMINAL_CURRENT,
-  .MinNegativeTorque          = -(int16_t)NOMINAL_CURRENT,
-  .ModeDefault                = DEFAULT_CONTROL_MODE,
-  .MecSpeedRefUnitDefault     = (int16_t)(DEFAULT_TARGET_SPEED_UNIT),
-  .TorqueRefDefault           = (int16_t)DEFAULT_TORQUE_COMPONENT,
-  .IdrefDefault               = (int16_t)DEFAULT_FLUX_COMPONENT,
-};
-
-/**
-  * @brief  PWM parameters Motor 1 for one ADC.
-  */
-PWMC_R3_1_Handle_t PWM_Handle_M1 =
-{
-  {
-    .pFctGetPhaseCurrents       = &R3_1_GetPhaseCurrents,
-    .pFctSetADCSampPointSectX   = &R3_1_SetADCSampPointSectX,
-    .pFctSetOffsetCalib         = &R3_1_SetOffsetCalib,
-    .pFctGetOffsetCalib         = &R3_1_GetOffsetCalib,
-    .pFctSwitchOffPwm           = &R3_1_SwitchOffPWM,
-    .pFctSwitchOnPwm            = &R3_1_SwitchOnPWM,
-    .pFctCurrReadingCalib       = &R3_1_CurrentReadingCalibration,
-    .pFctTurnOnLowSides         = &R3_1_TurnOnLowSides,
-    .pFctOCPSetReferenceVoltage = MC_NULL,
-
-    .pFctRLDetectionModeEnable  = &R3_1_RLDetectionModeEnable,
-    .pFctRLDetectionModeDisable = &R3_1_RLDetectionModeDisable,
-    .pFctRLDetectionModeSetDuty = &R3_1_RLDetectionModeSetDuty,
-    .pFctRLTurnOnLowSidesAndStart = &R3_1_RLTurnOnLowSidesAndStart,
-    .LowSideOutputs    = (LowSideOutputsFunction_t)LOW_SIDE_SIGNALS_ENABLING,
-    .pwm_en_u_port     = M1_PWM_EN_U_GPIO_Port,
-    .pwm_en_u_pin      = M1_PWM_EN_U_Pin,
-    .pwm_en_v_port     = M1_PWM_EN_V_GPIO_Port,
-    .pwm_en_v_pin      = M1_PWM_EN_V_Pin,
-    .pwm_en_w_port     = M1_PWM_EN_W_GPIO_Port,
-    .pwm_en_w_pin      = M1_PWM_EN_W_Pin,
-    .hT_Sqrt3                   = (PWM_PERIOD_CYCLES*SQRT3FACTOR)/16384u,
-    .Sector                     = 0,
-    .CntPhA                     = 0,
-    .CntPhB                     = 0,
-    .CntPhC                     = 0,
-    .SWerror                    = 0,
-    .TurnOnLowSidesAction       = false,
-    .OffCalibrWaitTimeCounter   = 0,
-    .Motor                      = M1,
-    .RLDetectionMode            = false,
-    .SingleShuntTopology        = false,
-    .Ia                         = 0,
-    .Ib                         = 0,
-    .Ic                         = 0,
-    .LPFIqd_const               = LPF_FILT_CONST,
-    .DTTest                     = 0,
-    .DTCompCnt                  = DTCOMPCNT,
-    .PWMperiod                  = PWM_PERIOD_CYCLES,
-    .Ton                        = TON,
-    .Toff                       = TOFF,
-    .OverCurrentFlag            = false,
-    .OverVoltageFlag            = false,
-    .BrakeActionLock            = false,
-    .driverProtectionFlag       = false,
-  },
-  .PhaseAOffset                 = 0,
-  .PhaseBOffset                 = 0,
-  .PhaseCOffset                 = 0,
-  .Half_PWMPeriod               = PWM_PERIOD_CYCLES / 2u,
-  .PolarizationCounter          = 0,
-  .ADC_ExternalTriggerInjected  = 0,
-
-  .pParams_str                  = &R3_1_ParamsM1
-};
-
-/**
-  * @brief  SpeedNPosition sensor parameters Motor 1 - Base Class.
-  */
-VirtualSpeedSensor_Handle_t VirtualSpeedSensorM1 =
-{
-
-  ._Super =
-  {
-    .bElToMecRatio             = POLE_PAIR_NUM,
-    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15*MAX_APPLICATION_SPEED_UNIT),
-    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
-    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
-    .hMaxReliableMecAccelUnitP = 65535,
-    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
-    .DPPConvFactor             = DPP_CONV_FACTOR,
-  },
-
-  .hSpeedSamplingFreqHz        = MEDIUM_FREQUENCY_TASK_RATE,
-  .hTransitionSteps            = (int16_t)((TF_REGULATION_RATE * TRANSITION_DURATION) / 1000.0),
-};
-
-/**
-  * @brief  SpeedNPosition sensor parameters Motor 1 - Encoder.
-  */
-ENCODER_Handle_t ENCODER_M1 =
-{
-  ._Super =
-  {
-    .bElToMecRatio             = POLE_PAIR_NUM,
-    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
-    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
-    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
-    .hMaxReliableMecAccelUnitP = 65535,
-    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
-    .DPPConvFactor             = DPP_CONV_FACTOR,
-  },
-
-  .PulseNumber                 = M1_ENCODER_PPR * 4,
-  .SpeedSamplingFreqHz         = MEDIUM_FREQUENCY_TASK_RATE,
-  .SpeedBufferSize             = ENC_AVERAGING_FIFO_DEPTH,
-  .TIMx                        = TIM3,
-  .ICx_Filter                  = M1_ENC_IC_FILTER_LL,
-};
-
-HALL_Handle_t HALL_M1 = 
-{
-    ._Super =
-  {
-    .bElToMecRatio             = POLE_PAIR_NUM,
-    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
-    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
-    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
-    .hMaxReliableMecAccelUnitP = 65535,
-    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
-    .DPPConvFactor             = DPP_CONV_FACTOR,
-  },
-
-
-};
-
-/**
-  * @brief  Encoder Alignment Controller parameters Motor 1.
-  */
-HallAlign_Handle_t HallAlignCtrlM1 = 
-{
-  .hEACFrequencyHz = MEDIUM_FREQUENCY_TASK_RATE,
-  .hFinalTorque    = FINAL_I_ALIGNMENT,
-  .hElAngle        = ALIGNMENT_ANGLE_S16,
-  .hDurationms     = M1_ALIGNMENT_DURATION,
-  .bElToMecRatio   = POLE_PAIR_NUM,
-};
-
-/**
-  * temperature sensor parameters Motor 1.
-  */
-RegConv_t TempRegConv_M1 =
-{
-    .regADC                = ADC1,
-    .channel               = MC_ADC_CHANNEL_13,
-  .samplingTime          = M1_TEMP_SAMPLING_TIME,
-};
-
-NTC_Handle_t TempSensor_M1 =
-{
-  .bSensorType             = REAL_SENSOR,
-
-  .hLowPassFilterBW        = M1_TEMP_SW_FILTER_BW_FACTOR,
-  .hOverTempThreshold      = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d),
-  .hOverTempDeactThreshold = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d - OV_TEMPERATURE_HYSTERESIS_d),
-  .hSensitivity            = (int16_t)(ADC_REFERENCE_VOLTAGE/dV_dT),
-  .wV0                     = (uint16_t)((V0_V * 65536) / ADC_REFERENCE_VOLTAGE),
-  .hT0                     = T0_C,
-};
-
-/* Bus voltage sensor value filter buffer */
-static uint16_t RealBusVoltageSensorFilterBufferM1[M1_VBUS_SW_FILTER_BW_FACTOR];
-
-/**
-  * Bus voltage sensor parameters Motor 1.
-  */
-RegConv_t VbusRegConv_M1 =
-{
-    .regADC                   = ADC1,
-    .channel                  = MC_ADC_CHANNEL_5,
-    .samplingTime             = M1_VBUS_SAMPLING_TIME,
-};
-
-RDivider_Handle_t BusVoltageSensor_M1 =
-{
-  ._Super =
-  {
-    .SensorType               = REAL_SENSOR,
-    .ConversionFactor         = (uint16_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
-  },
-
-  .LowPassFilterBW            =  M1_VBUS_SW_FILTER_BW_FACTOR,
-  .OverVoltageThreshold       = OVERVOLTAGE_THRESHOLD_d,
-  .OverVoltageThresholdLow    = OVERVOLTAGE_THRESHOLD_d,
-  .OverVoltageHysteresisUpDir = true,
-  .UnderVoltageThreshold      =  UNDERVOLTAGE_THRESHOLD_d,
-  .aBuffer                    = RealBusVoltageSensorFilterBufferM1,
-};
-
-/** RAMP for Motor1
-  *
-  */
-RampExtMngr_Handle_t RampExtMngrHFParamsM1 =
-{
-  .FrequencyHz = TF_REGULATION_RATE
-};
-
-/**
-  * @brief  CircleLimitation Component parameters Motor 1 - Base Component.
-  */
-CircleLimitation_Handle_t CircleLimitationM1 =
-{
-  .MaxModule = MAX_MODULE,
-  .MaxVd     = (uint16_t)((MAX_MODULE * 950) / 1000),
-};
-
-MCI_Handle_t Mci[NBR_OF_MOTORS];
-SpeednTorqCtrl_Handle_t *pSTC[NBR_OF_MOTORS]    = {&SpeednTorqCtrlM1};
-NTC_Handle_t *pTemperatureSensor[NBR_OF_MOTORS] = {&TempSensor_M1};
-PID_Handle_t *pPIDIq[NBR_OF_MOTORS]             = {&PIDIqHandle_M1};
-PID_Handle_t *pPIDId[NBR_OF_MOTORS]             = {&PIDIdHandle_M1};
-PQD_MotorPowMeas_Handle_t *pMPM[NBR_OF_MOTORS]  = {&PQD_MotorPowMeasM1};
-PosCtrl_Handle_t *pPosCtrl[NBR_OF_MOTORS]       = {&PosCtrlM1};
-/* USER CODE BEGIN Additional configuration */
-/* USER CODE END Additional configuration */
-
-/******************* (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
-
+
+/**
+  ******************************************************************************
+  * @file    mc_config.c
+  * @author  Motor Control SDK Team,ST Microelectronics
+  * @brief   Motor Control Subsystem components configuration and handler structures.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044,the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+//cstat -MISRAC2012-Rule-21.1
+#include "main.h" //cstat !MISRAC2012-Rule-21.1
+//cstat +MISRAC2012-Rule-21.1
+#include "mc_type.h"
+#include "parameters_conversion.h"
+#include "mc_parameters.h"
+#include "mc_config.h"
+
+/* USER CODE BEGIN Additional include */
+
+/* USER CODE END Additional include */
+#define FREQ_RATIO 1                /* Dummy value for single drive */
+#define FREQ_RELATION HIGHEST_FREQ  /* Dummy value for single drive */
+
+#include "pqd_motor_power_measurement.h"
+
+/* USER CODE BEGIN Additional define */
+
+/* USER CODE END Additional define */
+
+PQD_MotorPowMeas_Handle_t PQD_MotorPowMeasM1 =
+{
+  .ConvFact = M1_PQD_CONVERSION_FACTOR
+};
+
+/**
+  * @brief  PI / PID Speed loop parameters Motor 1.
+  */
+PID_Handle_t PIDSpeedHandle_M1 =
+{
+  .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+  .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+  .hUpperOutputLimit   = (int16_t)IQMAX,
+  .hLowerOutputLimit   = -(int16_t)IQMAX,
+  .hKpDivisor          = (uint16_t)SP_KPDIV,
+  .hKiDivisor          = (uint16_t)SP_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  PI / PID Iq loop parameters Motor 1.
+  */
+PID_Handle_t PIDIqHandle_M1 =
+{
+  .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+  .hUpperOutputLimit   = INT16_MAX,
+  .hLowerOutputLimit   = -INT16_MAX,
+  .hKpDivisor          = (uint16_t)TF_KPDIV,
+  .hKiDivisor          = (uint16_t)TF_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  PI / PID Id loop parameters Motor 1.
+  */
+PID_Handle_t PIDIdHandle_M1 =
+{
+  .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+  .hUpperOutputLimit   = INT16_MAX,
+  .hLowerOutputLimit   = -INT16_MAX,
+  .hKpDivisor          = (uint16_t)TF_KPDIV,
+  .hKiDivisor          = (uint16_t)TF_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  PI Flux Weakening control parameters Motor 1.
+  */
+PID_Handle_t PIDFluxWeakeningHandle_M1 =
+{
+  .hDefKpGain          = (int16_t)FW_KP_GAIN,
+  .hDefKiGain          = (int16_t)FW_KI_GAIN,
+  .wUpperIntegralLimit = 0,
+  .wLowerIntegralLimit = (int32_t)(-NOMINAL_CURRENT * FW_KIDIV),
+  .hUpperOutputLimit   = 0,
+  .hLowerOutputLimit   = -INT16_MAX,
+  .hKpDivisor          = (uint16_t)FW_KPDIV,
+  .hKiDivisor          = (uint16_t)FW_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)FW_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)FW_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  FluxWeakeningCtrl component parameters Motor 1.
+  */
+FW_Handle_t FW_M1 =
+{
+  .hMaxModule             = MAX_MODULE,
+  .hDefaultFW_V_Ref       = (int16_t)FW_VOLTAGE_REF,
+  .hDemagCurrent          = (int16_t)ID_DEMAG,
+  .wNominalSqCurr         = (int32_t)(NOMINAL_CURRENT * NOMINAL_CURRENT),
+  .hVqdLowPassFilterBW    = M1_VQD_SW_FILTER_BW_FACTOR,
+  .hVqdLowPassFilterBWLOG = M1_VQD_SW_FILTER_BW_FACTOR_LOG,
+#ifdef M1_ENCODER_FUSION
+  .pSPD                   = &FusedSensorM1._Super,
+#else
+  .pSPD                   = &HALL_M1._Super,
+#endif
+  .Rs                     = (float)RS,
+  .Ls                     = (float)LS,
+  /* MOTOR_VOLTAGE_CONSTANT is in Vrms phase to phase per krpm: 128.25 is 1000 rpm in rad/s times sqrt(3/2) */
+  .Flux                   = (float)(MOTOR_VOLTAGE_CONSTANT / (128.25 * POLE_PAIR_NUM)),
+  .ElSpeedConv            = (float)((6.2831853 * POLE_PAIR_NUM) / SPEED_UNIT),
+  .CurrentConv            = (float)CURRENT_CONV_FACTOR,
+};
+
+PID_Handle_t PID_PosParamsM1 =
+{
+  .hDefKpGain          = (int16_t)PID_POSITION_KP_GAIN,
+  .hDefKiGain          = (int16_t)PID_POSITION_KI_GAIN,
+  .hDefKdGain          = (int16_t)PID_POSITION_KD_GAIN,
+  .wUpperIntegralLimit = (int32_t)(IQMAX * PID_POSITION_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-IQMAX * PID_POSITION_KIDIV),
+  .hUpperOutputLimit   = (int16_t)IQMAX,
+  .hLowerOutputLimit   = -(int16_t)IQMAX,
+  .hKpDivisor          = (uint16_t)PID_POSITION_KPDIV,
+  .hKiDivisor          = (uint16_t)PID_POSITION_KIDIV,
+  .hKdDivisor          = (uint16_t)PID_POSITION_KDDIV,
+  .hKpDivisorPOW2      = (uint16_t)PID_POSITION_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)PID_POSITION_KIDIV_LOG,
+  .hKdDivisorPOW2      = (uint16_t)PID_POSITION_KDDIV_LOG,
+};
+
+/* Backlash measured at each table point, learnt with MC_REG_BACKLASH_STATE */
+static int16_t BacklashTableM1[BACKLASH_TABLE_SIZE];
+
+/**
+  * @brief  Backlash Compensation parameters Motor 1.
+  */
+BLC_Handle_t BacklashCompM1 =
+{
+  .pTable        = BacklashTableM1,
+  .TableSize     = BACKLASH_TABLE_SIZE,
+  .PositionMin   = (float)BACKLASH_POSITION_MIN,
+  .PositionMax   = (float)BACKLASH_POSITION_MAX,
+  .Hysteresis    = BACKLASH_HYSTERESIS,
+  .TakeUpRate    = BACKLASH_TAKE_UP_RATE,
+  .Enable        = false,
+  .EngageTorque  = BACKLASH_ENGAGE_TORQUE,
+  .LearnSpeed    = (float)BACKLASH_LEARN_SPEED,
+  .LearnApproach = (float)BACKLASH_LEARN_APPROACH,
+  .SettleTicks   = (uint16_t)((MEDIUM_FREQUENCY_TASK_RATE * BACKLASH_LEARN_SETTLE_MS) / 1000U),
+  .SamplingTime  = 1.0f/MEDIUM_FREQUENCY_TASK_RATE,
+};
+
+PosCtrl_Handle_t PosCtrlM1 =
+{
+  .SamplingTime  = 1.0f/MEDIUM_FREQUENCY_TASK_RATE,
+  .SysTickPeriod = 1.0f/SYS_TICK_FREQUENCY,
+  .AlignmentCfg  = TC_ABSOLUTE_ALIGNMENT_NOT_SUPPORTED,
+  .pENC          = &ENCODER_M1,
+  .InertiaFF     = (float)POSITION_FF_INERTIA,
+  .ViscousFF     = (float)POSITION_FF_VISCOUS,
+  .CoulombFF     = (float)POSITION_FF_COULOMB,
+  .CoulombDeadband = (float)POSITION_FF_COULOMB_DEADBAND,
+  .pBacklash     = &BacklashCompM1,
+};
+
+/* Streamed setpoints buffer */
+static SPS_Sample_t SetpointStreamBufferM1[SETPOINT_STREAM_DEPTH];
+
+/**
+  * @brief  Setpoint Stream parameters Motor 1.
+  */
+SPS_Handle_t SetpointStreamM1 =
+{
+  .pBuffer      = SetpointStreamBufferM1,
+  .BufferSize   = SETPOINT_STREAM_DEPTH,
+  .PrefillLevel = SETPOINT_STREAM_PREFILL,
+};
+
+/* High frequency capture buffer */
+static int16_t HFCaptureBufferM1[HF_CAPTURE_BUFFER_SIZE];
+
+/**
+  * @brief  High Frequency Capture parameters Motor 1.
+  */
+HFC_Handle_t HFCaptureM1 =
+{
+  .pBuffer    = HFCaptureBufferM1,
+  .BufferSize = HF_CAPTURE_BUFFER_SIZE,
+};
+
+/**
+  * @brief  Frequency Response Analyser parameters Motor 1.
+  */
+FRA_Handle_t FreqRespM1 =
+{
+  .HFFrequencyHz  = ISR_FREQUENCY_HZ,
+  .MFFrequencyHz  = MEDIUM_FREQUENCY_TASK_RATE,
+  .Loop           = FREQ_RESP_LOOP,
+  .NbrOfPoints    = FREQ_RESP_POINTS,
+  .SettleCycles   = FREQ_RESP_SETTLE_CYCLES,
+  .MeasureCycles  = FREQ_RESP_MEASURE_CYCLES,
+  .Amplitude      = FREQ_RESP_AMPLITUDE,
+  .StartFrequency = FREQ_RESP_START_HZ,
+  .StopFrequency  = FREQ_RESP_STOP_HZ,
+};
+
+/**
+  * @brief  Current Protection parameters Motor 1.
+  */
+CPR_Handle_t CurrentProtM1 =
+{
+  .pFW                = &FW_M1,
+  .pPIDPos            = &PID_PosParamsM1,
+  .OCThreshold        = (uint16_t)(M1_SW_OC_THRESHOLD_A * CURRENT_CONV_FACTOR),
+  .OCDebounce         = M1_SW_OC_DEBOUNCE,
+  .PeakCurrent        = (uint16_t)(M1_PEAK_CURRENT_A * CURRENT_CONV_FACTOR),
+  .NominalCurrent     = (uint16_t)NOMINAL_CURRENT,
+  .WindingTau         = M1_WINDING_TAU_S,
+  .HousingTau         = M1_HOUSING_TAU_S,
+  .HousingShare       = M1_HOUSING_SHARE,
+  .DeratingStart      = M1_DERATING_START,
+  .ThermalFrequencyHz = MEDIUM_FREQUENCY_TASK_RATE,
+};
+
+/**
+  * @brief  Motor Identification parameters Motor 1.
+  */
+MID_Handle_t MotorIdentM1 =
+{
+  .pPIDIq               = &PIDIqHandle_M1,
+  .pPIDId               = &PIDIdHandle_M1,
+  .pPIDSpeed            = &PIDSpeedHandle_M1,
+  .pVBS                 = &BusVoltageSensor_M1._Super,
+  .CurrentConv          = (float)CURRENT_CONV_FACTOR,
+  .BusRatio             = (float)M1_VQD_BUS_RATIO,
+  .NominalRs            = (float)RS,
+  .PolePairs            = POLE_PAIR_NUM,
+  .SpeedUnit            = SPEED_UNIT,
+  .HFFrequencyHz        = ISR_FREQUENCY_HZ,
+  .MFFrequencyHz        = MEDIUM_FREQUENCY_TASK_RATE,
+  .InjectionFrequencyHz = M1_ID_INJECTION_FREQ_HZ,
+  .SettleTicks          = (M1_ID_SETTLE_MS * MEDIUM_FREQUENCY_TASK_RATE) / 1000U,
+  .MeasureTicks         = (M1_ID_MEASURE_MS * MEDIUM_FREQUENCY_TASK_RATE) / 1000U,
+  .PulseTicks           = (M1_ID_PULSE_MS * MEDIUM_FREQUENCY_TASK_RATE) / 1000U,
+  .TestCurrent          = M1_ID_TEST_CURRENT_A,
+  .TorqueCurrent        = M1_ID_TORQUE_CURRENT_A,
+  .CurrentBandwidth     = M1_ID_CURRENT_BANDWIDTH_HZ,
+  .SpeedBandwidth       = M1_ID_SPEED_BANDWIDTH_HZ,
+};
+
+/**
+  * @brief  Calibration Store parameters Motor 1.
+  */
+CAL_Handle_t CalibStoreM1 =
+{
+  .VerifyPeriod = (uint16_t)((MEDIUM_FREQUENCY_TASK_RATE * CALIB_STORE_VERIFY_PERIOD_MS) / 1000U),
+};
+
+/**
+  * @brief  SpeednTorque Controller parameters Motor 1.
+  */
+SpeednTorqCtrl_Handle_t SpeednTorqCtrlM1 =
+{
+  .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+  .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT),
+  .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+  .MaxAppNegativeMecSpeedUnit = (int16_t)(-MIN_APPLICATION_SPEED_UNIT),
+  .MinAppNegativeMecSpeedUnit = (int16_t)(-MAX_APPLICATION_SPEED_UNIT),
+  .MaxPositiveTorque          = (int16_t)IQMAX,
+  .MinNegativeTorque          = -(int16_t)IQMAX,
+  .ModeDefault                = DEFAULT_CONTROL_MODE,
+  .MecSpeedRefUnitDefault     = (int16_t)(DEFAULT_TARGET_SPEED_UNIT),
+  .TorqueRefDefault           = (int16_t)DEFAULT_TORQUE_COMPONENT,
+  .IdrefDefault               = (int16_t)DEFAULT_FLUX_COMPONENT,
+};
+
+/**
+  * @brief  PWM parameters Motor 1 for one ADC.
+  */
+PWMC_R3_1_Handle_t PWM_Handle_M1 =
+{
+  {
+#ifdef M1_OVERMODULATION
+    .pFctGetPhaseCurrents       = &R3_1_GetPhaseCurrents_OVM,
+    .pFctSetADCSampPointSectX   = &R3_1_SetADCSampPointSectX_OVM,
+#else
+    .pFctGetPhaseCurrents       = &R3_1_GetPhaseCurrents,
+    .pFctSetADCSampPointSectX   = &R3_1_SetADCSampPointSectX,
+#endif
+    .pFctSetOffsetCalib         = &R3_1_SetOffsetCalib,
+    .pFctGetOffsetCalib         = &R3_1_GetOffsetCalib,
+    .pFctSwitchOffPwm           = &R3_1_SwitchOffPWM,
+    .pFctSwitchOnPwm            = &R3_1_SwitchOnPWM,
+    .pFctCurrReadingCalib       = &R3_1_CurrentReadingCalibration,
+    .pFctTurnOnLowSides         = &R3_1_TurnOnLowSides,
+    .pFctOCPSetReferenceVoltage = MC_NULL,
+
+    .pFctRLDetectionModeEnable  = &R3_1_RLDetectionModeEnable,
+    .pFctRLDetectionModeDisable = &R3_1_RLDetectionModeDisable,
+    .pFctRLDetectionModeSetDuty = &R3_1_RLDetectionModeSetDuty,
+    .pFctRLTurnOnLowSidesAndStart = &R3_1_RLTurnOnLowSidesAndStart,
+    .LowSideOutputs    = (LowSideOutputsFunction_t)LOW_SIDE_SIGNALS_ENABLING,
+    .pwm_en_u_port     = M1_PWM_EN_U_GPIO_Port,
+    .pwm_en_u_pin      = M1_PWM_EN_U_Pin,
+    .pwm_en_v_port     = M1_PWM_EN_V_GPIO_Port,
+    .pwm_en_v_pin      = M1_PWM_EN_V_Pin,
+    .pwm_en_w_port     = M1_PWM_EN_W_GPIO_Port,
+    .pwm_en_w_pin      = M1_PWM_EN_W_Pin,
+    .hT_Sqrt3                   = (PWM_PERIOD_CYCLES*SQRT3FACTOR)/16384u,
+    .Sector                     = 0,
+    .CntPhA                     = 0,
+    .CntPhB                     = 0,
+    .CntPhC                     = 0,
+    .SWerror                    = 0,
+    .TurnOnLowSidesAction       = false,
+    .OffCalibrWaitTimeCounter   = 0,
+    .Motor                      = M1,
+    .RLDetectionMode            = false,
+    .SingleShuntTopology        = false,
+    .Ia                         = 0,
+    .Ib                         = 0,
+    .Ic                         = 0,
+    .LPFIqd_const               = LPF_FILT_CONST,
+    .DTTest                     = 0,
+    .DTCompCnt                  = DTCOMPCNT,
+    .PWMperiod                  = PWM_PERIOD_CYCLES,
+    .Ton                        = TON,
+    .Toff                       = TOFF,
+    .DPWMEnableModule           = DPWM_ENABLE_MODULE,
+    .DPWMDisableModule          = DPWM_DISABLE_MODULE,
+    .OverCurrentFlag            = false,
+    .OverVoltageFlag            = false,
+    .BrakeActionLock            = false,
+    .driverProtectionFlag       = false,
+  },
+  .PhaseAOffset                 = 0,
+  .PhaseBOffset                 = 0,
+  .PhaseCOffset                 = 0,
+  .Half_PWMPeriod               = PWM_PERIOD_CYCLES / 2u,
+  .PolarizationCounter          = 0,
+  .ADC_ExternalTriggerInjected  = 0,
+
+  .pParams_str                  = &R3_1_ParamsM1
+};
+
+/**
+  * @brief  SpeedNPosition sensor parameters Motor 1 - Base Class.
+  */
+VirtualSpeedSensor_Handle_t VirtualSpeedSensorM1 =
+{
+
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15*MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .hSpeedSamplingFreqHz        = MEDIUM_FREQUENCY_TASK_RATE,
+  .hTransitionSteps            = (int16_t)((TF_REGULATION_RATE * TRANSITION_DURATION) / 1000.0),
+};
+
+/**
+  * @brief  SpeedNPosition sensor parameters Motor 1 - Encoder.
+  */
+ENCODER_Handle_t ENCODER_M1 =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .PulseNumber                 = M1_ENCODER_PPR * 4,
+  .SpeedSamplingFreqHz         = MEDIUM_FREQUENCY_TASK_RATE,
+  .SpeedBufferSize             = ENC_AVERAGING_FIFO_DEPTH,
+  .TIMx                        = TIM3,
+  .ICx_Filter                  = M1_ENC_IC_FILTER_LL,
+  .TimeTIMx                    = M1_ENC_TIME_TIM,
+  .TimeITR                     = M1_ENC_TIME_ITR,
+  .TimeFrequencyHz             = M1_ENC_TIME_FREQ_HZ,
+  .EdgeTimeoutMs               = ENC_EDGE_TIMEOUT_MS,
+};
+
+HALL_Handle_t HALL_M1 = 
+{
+    ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .SpeedSamplingFreqHz         = MEDIUM_FREQUENCY_TASK_RATE,
+  .MinAmplitude                = M1_HALL_MIN_AMPLITUDE,
+  .MaxAmplitude                = M1_HALL_MAX_AMPLITUDE,
+};
+
+/**
+  * @brief  Encoder Alignment Controller parameters Motor 1.
+  */
+HallAlign_Handle_t HallAlignCtrlM1 = 
+{
+  .hEACFrequencyHz = MEDIUM_FREQUENCY_TASK_RATE,
+  .hFinalTorque    = FINAL_I_ALIGNMENT,
+  .hElAngle        = ALIGNMENT_ANGLE_S16,
+  .hDurationms     = M1_ALIGNMENT_DURATION,
+  .bElToMecRatio   = POLE_PAIR_NUM,
+#ifdef M1_ENCODER_FUSION
+  .pENC            = &ENCODER_M1,
+#else
+  .pENC            = MC_NULL, /* Hall sensors only, their angle needs no encoder seeding */
+#endif
+  .InstantStart    = M1_HALL_INSTANT_START,
+};
+
+#ifdef M1_ENCODER_FUSION
+/**
+  * @brief  SpeedNPosition sensor parameters Motor 1 - Hall sensors fused with the encoder.
+  */
+FUS_Handle_t FusedSensorM1 =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT),
+    .bMaximumSpeedErrorsNumber = M1_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .pHALL                       = &HALL_M1,
+  .pENC                        = &ENCODER_M1,
+  .pHAC                        = &HallAlignCtrlM1,
+  .SpeedSamplingFreqHz         = MEDIUM_FREQUENCY_TASK_RATE,
+  .HallGain                    = M1_FUSION_HALL_GAIN,
+  .MaxAngleError               = (int16_t)((M1_FUSION_MAX_ANGLE_ERROR_DEG * 65536) / 360),
+  .MaxErrorSamples             = M1_FUSION_MAX_ERROR_SAMPLES,
+};
+#endif
+
+/**
+  * temperature sensor parameters Motor 1.
+  */
+RegConv_t TempRegConv_M1 =
+{
+    .regADC                = ADC1,
+    .channel               = MC_ADC_CHANNEL_13,
+  .samplingTime          = M1_TEMP_SAMPLING_TIME,
+};
+
+NTC_Handle_t TempSensor_M1 =
+{
+  .bSensorType             = REAL_SENSOR,
+
+  .hLowPassFilterBW        = M1_TEMP_SW_FILTER_BW_FACTOR,
+  .hOverTempThreshold      = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d),
+  .hOverTempDeactThreshold = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d - OV_TEMPERATURE_HYSTERESIS_d),
+  .hSensitivity            = (int16_t)(ADC_REFERENCE_VOLTAGE/dV_dT),
+  .wV0                     = (uint16_t)((V0_V * 65536) / ADC_REFERENCE_VOLTAGE),
+  .hT0                     = T0_C,
+};
+
+/* Bus voltage sensor value filter buffer */
+static uint16_t RealBusVoltageSensorFilterBufferM1[M1_VBUS_SW_FILTER_BW_FACTOR];
+
+/**
+  * Bus voltage sensor parameters Motor 1.
+  */
+RegConv_t VbusRegConv_M1 =
+{
+    .regADC                   = ADC1,
+    .channel                  = MC_ADC_CHANNEL_5,
+    .samplingTime             = M1_VBUS_SAMPLING_TIME,
+};
+
+RDivider_Handle_t BusVoltageSensor_M1 =
+{
+  ._Super =
+  {
+    .SensorType               = REAL_SENSOR,
+    .ConversionFactor         = (uint16_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+  },
+
+  .LowPassFilterBW            =  M1_VBUS_SW_FILTER_BW_FACTOR,
+  .OverVoltageThreshold       = OVERVOLTAGE_THRESHOLD_d,
+  .OverVoltageThresholdLow    = OVERVOLTAGE_THRESHOLD_d,
+  .OverVoltageHysteresisUpDir = true,
+  .UnderVoltageThreshold      =  UNDERVOLTAGE_THRESHOLD_d,
+  .aBuffer                    = RealBusVoltageSensorFilterBufferM1,
+};
+
+/** RAMP for Motor1
+  *
+  */
+RampExtMngr_Handle_t RampExtMngrHFParamsM1 =
+{
+  .FrequencyHz = TF_REGULATION_RATE
+};
+
+/**
+  * @brief  CircleLimitation Component parameters Motor 1 - Base Component.
+  */
+CircleLimitation_Handle_t CircleLimitationM1 =
+{
+  .MaxModule = MAX_MODULE,
+  .MaxVd     = (uint16_t)((MAX_MODULE * 950) / 1000),
+};
+
+#if NBR_OF_MOTORS > 1
+/* Motor 2, zoom axis: encoder aligned at start-up, no hall sensors, shares the gains of motor 1 */
+PQD_MotorPowMeas_Handle_t PQD_MotorPowMeasM2 =
+{
+  .ConvFact = PQD_CONVERSION_FACTOR
+};
+
+/**
+  * @brief  PI / PID Speed loop parameters Motor 2.
+  */
+PID_Handle_t PIDSpeedHandle_M2 =
+{
+  .hDefKpGain          = (int16_t)PID_SPEED_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_SPEED_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(IQMAX * SP_KIDIV),
+  .wLowerIntegralLimit = -(int32_t)(IQMAX * SP_KIDIV),
+  .hUpperOutputLimit   = (int16_t)IQMAX,
+  .hLowerOutputLimit   = -(int16_t)IQMAX,
+  .hKpDivisor          = (uint16_t)SP_KPDIV,
+  .hKiDivisor          = (uint16_t)SP_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)SP_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)SP_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  PI / PID Iq loop parameters Motor 2.
+  */
+PID_Handle_t PIDIqHandle_M2 =
+{
+  .hDefKpGain          = (int16_t)PID_TORQUE_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_TORQUE_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+  .hUpperOutputLimit   = INT16_MAX,
+  .hLowerOutputLimit   = -INT16_MAX,
+  .hKpDivisor          = (uint16_t)TF_KPDIV,
+  .hKiDivisor          = (uint16_t)TF_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+/**
+  * @brief  PI / PID Id loop parameters Motor 2.
+  */
+PID_Handle_t PIDIdHandle_M2 =
+{
+  .hDefKpGain          = (int16_t)PID_FLUX_KP_DEFAULT,
+  .hDefKiGain          = (int16_t)PID_FLUX_KI_DEFAULT,
+  .wUpperIntegralLimit = (int32_t)(INT16_MAX * TF_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-INT16_MAX * TF_KIDIV),
+  .hUpperOutputLimit   = INT16_MAX,
+  .hLowerOutputLimit   = -INT16_MAX,
+  .hKpDivisor          = (uint16_t)TF_KPDIV,
+  .hKiDivisor          = (uint16_t)TF_KIDIV,
+  .hKpDivisorPOW2      = (uint16_t)TF_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)TF_KIDIV_LOG,
+  .hDefKdGain          = 0x0000U,
+  .hKdDivisor          = 0x0000U,
+  .hKdDivisorPOW2      = 0x0000U,
+};
+
+PID_Handle_t PID_PosParamsM2 =
+{
+  .hDefKpGain          = (int16_t)PID_POSITION_KP_GAIN,
+  .hDefKiGain          = (int16_t)PID_POSITION_KI_GAIN,
+  .hDefKdGain          = (int16_t)PID_POSITION_KD_GAIN,
+  .wUpperIntegralLimit = (int32_t)(IQMAX * PID_POSITION_KIDIV),
+  .wLowerIntegralLimit = (int32_t)(-IQMAX * PID_POSITION_KIDIV),
+  .hUpperOutputLimit   = (int16_t)IQMAX,
+  .hLowerOutputLimit   = -(int16_t)IQMAX,
+  .hKpDivisor          = (uint16_t)PID_POSITION_KPDIV,
+  .hKiDivisor          = (uint16_t)PID_POSITION_KIDIV,
+  .hKdDivisor          = (uint16_t)PID_POSITION_KDDIV,
+  .hKpDivisorPOW2      = (uint16_t)PID_POSITION_KPDIV_LOG,
+  .hKiDivisorPOW2      = (uint16_t)PID_POSITION_KIDIV_LOG,
+  .hKdDivisorPOW2      = (uint16_t)PID_POSITION_KDDIV_LOG,
+};
+
+PosCtrl_Handle_t PosCtrlM2 =
+{
+  .SamplingTime  = 1.0f/MEDIUM_FREQUENCY_TASK_RATE,
+  .SysTickPeriod = 1.0f/SYS_TICK_FREQUENCY,
+  .AlignmentCfg  = TC_ABSOLUTE_ALIGNMENT_NOT_SUPPORTED,
+  .pENC          = &ENCODER_M2,
+  .InertiaFF     = (float)POSITION_FF_INERTIA,
+  .ViscousFF     = (float)POSITION_FF_VISCOUS,
+  .CoulombFF     = (float)POSITION_FF_COULOMB,
+  .CoulombDeadband = (float)POSITION_FF_COULOMB_DEADBAND,
+  .pBacklash     = MC_NULL,
+};
+
+/**
+  * @brief  SpeednTorque Controller parameters Motor 2.
+  */
+SpeednTorqCtrl_Handle_t SpeednTorqCtrlM2 =
+{
+  .STCFrequencyHz             = MEDIUM_FREQUENCY_TASK_RATE,
+  .MaxAppPositiveMecSpeedUnit = (uint16_t)(MAX_APPLICATION_SPEED_UNIT2),
+  .MinAppPositiveMecSpeedUnit = (uint16_t)(MIN_APPLICATION_SPEED_UNIT2),
+  .MaxAppNegativeMecSpeedUnit = (int16_t)(-MIN_APPLICATION_SPEED_UNIT2),
+  .MinAppNegativeMecSpeedUnit = (int16_t)(-MAX_APPLICATION_SPEED_UNIT2),
+  .MaxPositiveTorque          = (int16_t)IQMAX,
+  .MinNegativeTorque          = -(int16_t)IQMAX,
+  .ModeDefault                = DEFAULT_CONTROL_MODE,
+  .MecSpeedRefUnitDefault     = (int16_t)(DEFAULT_TARGET_SPEED_UNIT),
+  .TorqueRefDefault           = (int16_t)DEFAULT_TORQUE_COMPONENT,
+  .IdrefDefault               = (int16_t)DEFAULT_FLUX_COMPONENT,
+};
+
+/**
+  * @brief  Current Protection parameters Motor 2, same motor and power stage as Motor 1 but no flux weakening.
+  */
+CPR_Handle_t CurrentProtM2 =
+{
+  .pFW                = MC_NULL,
+  .pPIDPos            = &PID_PosParamsM2,
+  .OCThreshold        = (uint16_t)(M1_SW_OC_THRESHOLD_A * CURRENT_CONV_FACTOR),
+  .OCDebounce         = M1_SW_OC_DEBOUNCE,
+  .PeakCurrent        = (uint16_t)(M1_PEAK_CURRENT_A * CURRENT_CONV_FACTOR),
+  .NominalCurrent     = (uint16_t)NOMINAL_CURRENT,
+  .WindingTau         = M1_WINDING_TAU_S,
+  .HousingTau         = M1_HOUSING_TAU_S,
+  .HousingShare       = M1_HOUSING_SHARE,
+  .DeratingStart      = M1_DERATING_START,
+  .ThermalFrequencyHz = MEDIUM_FREQUENCY_TASK_RATE,
+};
+
+/**
+  * @brief  PWM parameters Motor 2 for one ADC.
+  */
+PWMC_R3_1_Handle_t PWM_Handle_M2 =
+{
+  {
+    .pFctGetPhaseCurrents       = &R3_1_GetPhaseCurrents,
+    .pFctSetADCSampPointSectX   = &R3_1_SetADCSampPointSectX,
+    .pFctSetOffsetCalib         = &R3_1_SetOffsetCalib,
+    .pFctGetOffsetCalib         = &R3_1_GetOffsetCalib,
+    .pFctSwitchOffPwm           = &R3_1_SwitchOffPWM,
+    .pFctSwitchOnPwm            = &R3_1_SwitchOnPWM,
+    .pFctCurrReadingCalib       = &R3_1_CurrentReadingCalibration,
+    .pFctTurnOnLowSides         = &R3_1_TurnOnLowSides,
+    .pFctOCPSetReferenceVoltage = MC_NULL,
+
+    .pFctRLDetectionModeEnable  = &R3_1_RLDetectionModeEnable,
+    .pFctRLDetectionModeDisable = &R3_1_RLDetectionModeDisable,
+    .pFctRLDetectionModeSetDuty = &R3_1_RLDetectionModeSetDuty,
+    .pFctRLTurnOnLowSidesAndStart = &R3_1_RLTurnOnLowSidesAndStart,
+    .LowSideOutputs    = (LowSideOutputsFunction_t)LOW_SIDE_SIGNALS_ENABLING,
+    .pwm_en_u_port     = M2_PWM_EN_U_GPIO_Port,
+    .pwm_en_u_pin      = M2_PWM_EN_U_Pin,
+    .pwm_en_v_port     = M2_PWM_EN_V_GPIO_Port,
+    .pwm_en_v_pin      = M2_PWM_EN_V_Pin,
+    .pwm_en_w_port     = M2_PWM_EN_W_GPIO_Port,
+    .pwm_en_w_pin      = M2_PWM_EN_W_Pin,
+    .hT_Sqrt3                   = (PWM_PERIOD_CYCLES2*SQRT3FACTOR)/16384u,
+    .Sector                     = 0,
+    .CntPhA                     = 0,
+    .CntPhB                     = 0,
+    .CntPhC                     = 0,
+    .SWerror                    = 0,
+    .TurnOnLowSidesAction       = false,
+    .OffCalibrWaitTimeCounter   = 0,
+    .Motor                      = M2,
+    .RLDetectionMode            = false,
+    .SingleShuntTopology        = false,
+    .Ia                         = 0,
+    .Ib                         = 0,
+    .Ic                         = 0,
+    .LPFIqd_const               = LPF_FILT_CONST,
+    .DTTest                     = 0,
+    .DTCompCnt                  = DTCOMPCNT,
+    .PWMperiod                  = PWM_PERIOD_CYCLES2,
+    .Ton                        = TON,
+    .Toff                       = TOFF,
+    .DPWMEnableModule           = DPWM_ENABLE_MODULE,
+    .DPWMDisableModule          = DPWM_DISABLE_MODULE,
+    .OverCurrentFlag            = false,
+    .OverVoltageFlag            = false,
+    .BrakeActionLock            = false,
+    .driverProtectionFlag       = false,
+  },
+  .PhaseAOffset                 = 0,
+  .PhaseBOffset                 = 0,
+  .PhaseCOffset                 = 0,
+  .Half_PWMPeriod               = PWM_PERIOD_CYCLES2 / 2u,
+  .PolarizationCounter          = 0,
+  .ADC_ExternalTriggerInjected  = 0,
+
+  .pParams_str                  = &R3_1_ParamsM2
+};
+
+/**
+  * @brief  SpeedNPosition sensor parameters Motor 2 - Base Class.
+  */
+VirtualSpeedSensor_Handle_t VirtualSpeedSensorM2 =
+{
+
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM2,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15*MAX_APPLICATION_SPEED_UNIT2),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT2),
+    .bMaximumSpeedErrorsNumber = M2_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .hSpeedSamplingFreqHz        = MEDIUM_FREQUENCY_TASK_RATE,
+  .hTransitionSteps            = (int16_t)((TF_REGULATION_RATE * TRANSITION_DURATION) / 1000.0),
+};
+
+/**
+  * @brief  SpeedNPosition sensor parameters Motor 2 - Encoder.
+  */
+ENCODER_Handle_t ENCODER_M2 =
+{
+  ._Super =
+  {
+    .bElToMecRatio             = POLE_PAIR_NUM2,
+    .hMaxReliableMecSpeedUnit  = (uint16_t)(1.15 * MAX_APPLICATION_SPEED_UNIT2),
+    .hMinReliableMecSpeedUnit  = (uint16_t)(MIN_APPLICATION_SPEED_UNIT2),
+    .bMaximumSpeedErrorsNumber = M2_SS_MEAS_ERRORS_BEFORE_FAULTS,
+    .hMaxReliableMecAccelUnitP = 65535,
+    .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+    .DPPConvFactor             = DPP_CONV_FACTOR,
+  },
+
+  .PulseNumber                 = M2_ENCODER_PPR * 4,
+  .SpeedSamplingFreqHz         = MEDIUM_FREQUENCY_TASK_RATE,
+  .SpeedBufferSize             = ENC_AVERAGING_FIFO_DEPTH,
+  .TIMx                        = TIM4,
+  .ICx_Filter                  = M2_ENC_IC_FILTER_LL,
+  .TimeTIMx                    = MC_NULL,
+  .TimeITR                     = 0U,
+  .TimeFrequencyHz             = M1_ENC_TIME_FREQ_HZ,
+  .EdgeTimeoutMs               = ENC_EDGE_TIMEOUT_MS,
+};
+
+/**
+  * @brief  Encoder Alignment Controller parameters Motor 2.
+  */
+EncAlign_Handle_t EncAlignCtrlM2 =
+{
+  .hEACFrequencyHz = MEDIUM_FREQUENCY_TASK_RATE,
+  .hFinalTorque    = FINAL_I_ALIGNMENT,
+  .hElAngle        = ALIGNMENT_ANGLE_S16_2,
+  .hDurationms     = M2_ALIGNMENT_DURATION,
+  .bElToMecRatio   = POLE_PAIR_NUM2,
+};
+
+/** RAMP for Motor2
+  *
+  */
+RampExtMngr_Handle_t RampExtMngrHFParamsM2 =
+{
+  .FrequencyHz = TF_REGULATION_RATE
+};
+
+/**
+  * @brief  CircleLimitation Component parameters Motor 2 - Base Component.
+  */
+CircleLimitation_Handle_t CircleLimitationM2 =
+{
+  .MaxModule = MAX_MODULE,
+  .MaxVd     = (uint16_t)((MAX_MODULE * 950) / 1000),
+};
+#endif /* NBR_OF_MOTORS > 1 */
+
+MCI_Handle_t Mci[NBR_OF_MOTORS];
+#if NBR_OF_MOTORS > 1
+/* The zoom power stage has no temperature sensor, the one of motor 1 is shared */
+SpeednTorqCtrl_Handle_t *pSTC[NBR_OF_MOTORS]    = {&SpeednTorqCtrlM1, &SpeednTorqCtrlM2};
+NTC_Handle_t *pTemperatureSensor[NBR_OF_MOTORS] = {&TempSensor_M1, &TempSensor_M1};
+PID_Handle_t *pPIDIq[NBR_OF_MOTORS]             = {&PIDIqHandle_M1, &PIDIqHandle_M2};
+PID_Handle_t *pPIDId[NBR_OF_MOTORS]             = {&PIDIdHandle_M1, &PIDIdHandle_M2};
+PQD_MotorPowMeas_Handle_t *pMPM[NBR_OF_MOTORS]  = {&PQD_MotorPowMeasM1, &PQD_MotorPowMeasM2};
+PosCtrl_Handle_t *pPosCtrl[NBR_OF_MOTORS]       = {&PosCtrlM1, &PosCtrlM2};
+#else
+SpeednTorqCtrl_Handle_t *pSTC[NBR_OF_MOTORS]    = {&SpeednTorqCtrlM1};
+NTC_Handle_t *pTemperatureSensor[NBR_OF_MOTORS] = {&TempSensor_M1};
+PID_Handle_t *pPIDIq[NBR_OF_MOTORS]             = {&PIDIqHandle_M1};
+PID_Handle_t *pPIDId[NBR_OF_MOTORS]             = {&PIDIdHandle_M1};
+PQD_MotorPowMeas_Handle_t *pMPM[NBR_OF_MOTORS]  = {&PQD_MotorPowMeasM1};
+PosCtrl_Handle_t *pPosCtrl[NBR_OF_MOTORS]       = {&PosCtrlM1};
+#endif
+/* USER CODE BEGIN Additional configuration */
+/* USER CODE END Additional configuration */
+
+/******************* (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
+
@@ -34,7 +34,7 @@ const char_t FIRMWARE_NAME [] = FIRMWARE_NAME_STR;
 const GlobalConfig_reg_t globalConfig_reg =
 {
   .SDKVersion     = SDK_VERSION,
-  .MotorNumber    =  1 ,
+  .MotorNumber    =  NBR_OF_MOTORS ,
   .MCP_Flag       = FLAG_MCP_OVER_STLINK + FLAG_MCP_OVER_UARTA + FLAG_MCP_OVER_UARTB,
   .MCPA_UARTA_LOG = 10,
   .MCPA_UARTB_LOG = 0,
@@ -74,9 +74,51 @@ static const FOCFwConfig_reg_t M1_FOCConfig_reg =
   .configurationFlag2 = (uint16_t)configurationFlag2_M1, //cstat !MISRAC2012-Rule-10.1_R6
 };
 
+#if NBR_OF_MOTORS > 1
+static const ApplicationConfig_reg_t M2_ApplicationConfig_reg =
+{
+  .maxMechanicalSpeed = MAX_APPLICATION_SPEED_RPM2,
+  .maxReadableCurrent = M1_MAX_READABLE_CURRENT,
+  .nominalCurrent     = 0.8,
+  .nominalVoltage     = 28,
+  .driveType          = DRIVE_TYPE_M2,
+};
+
+//cstat !MISRAC2012-Rule-9.2
+static const MotorConfig_reg_t M2_MotorConfig_reg =
+{
+  .polePairs  = POLE_PAIR_NUM2,
+  .ratedFlux  = 0.2,
+  .rs         = 5.9,
+  .ls         = 0.00025*1.000,
+  .ld         = 0.00025,
+  .maxCurrent = 0.8,
+  .name = "ZOOM"
+};
+
+static const FOCFwConfig_reg_t M2_FOCConfig_reg =
+{
+  .primarySensor      = (uint8_t)PRIM_SENSOR_M2,
+  .auxiliarySensor    = (uint8_t)AUX_SENSOR_M2,
+  .topology           = (uint8_t)TOPOLOGY_M2,
+  .FOCRate            = (uint8_t)FOC_RATE_M2,
+  .PWMFrequency       = (uint32_t)PWM_FREQ_M2,
+  .MediumFrequency    = (uint16_t)MEDIUM_FREQUENCY_TASK_RATE,
+  .configurationFlag1 = (uint16_t)configurationFlag1_M2, //cstat !MISRAC2012-Rule-10.1_R6
+  .configurationFlag2 = (uint16_t)configurationFlag2_M2, //cstat !MISRAC2012-Rule-10.1_R6
+};
+
+/* Both motors are driven by the same power board */
+const char_t * PWR_BOARD_NAME[NBR_OF_MOTORS] = {M1_PWR_BOARD, M1_PWR_BOARD};
+const FOCFwConfig_reg_t* FOCConfig_reg[NBR_OF_MOTORS] = {&M1_FOCConfig_reg, &M2_FOCConfig_reg};
+const MotorConfig_reg_t* MotorConfig_reg[NBR_OF_MOTORS] = {&M1_MotorConfig_reg, &M2_MotorConfig_reg};
+const ApplicationConfig_reg_t* ApplicationConfig_reg[NBR_OF_MOTORS] = {&M1_ApplicationConfig_reg,
+                                                                       &M2_ApplicationConfig_reg};
+#else
 const char_t * PWR_BOARD_NAME[NBR_OF_MOTORS] = {M1_PWR_BOARD};
 const FOCFwConfig_reg_t* FOCConfig_reg[NBR_OF_MOTORS] = {&M1_FOCConfig_reg};
 const MotorConfig_reg_t* MotorConfig_reg[NBR_OF_MOTORS] = {&M1_MotorConfig_reg};
 const ApplicationConfig_reg_t* ApplicationConfig_reg[NBR_OF_MOTORS] = {&M1_ApplicationConfig_reg};
+#endif
 
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
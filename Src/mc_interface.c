@@ -26,6 +26,7 @@
 #include "speed_torq_ctrl.h"
 #include "mc_interface.h"
 #include "motorcontrol.h"
+#include "mcpa.h"
 
 #define ROUNDING_OFF
 
@@ -93,6 +94,8 @@ __weak void MCI_Init(MCI_Handle_t *pHandle, SpeednTorqCtrl_Handle_t *pSTC,
     pHandle->State = IDLE;
     pHandle->CurrentFaults = MC_NO_FAULTS;
     pHandle->PastFaults = MC_NO_FAULTS;
+    pHandle->StartTimestamp = 0U;
+    pHandle->StartToTorqueTime = 0U;
 #ifdef NULL_PTR_CHECK_MC_INT
   }
 #endif
@@ -416,6 +419,7 @@ __weak bool MCI_StartMotor(MCI_Handle_t *pHandle)
     {
       pHandle->DirectCommand = MCI_START;
       pHandle->CommandState = MCI_COMMAND_NOT_ALREADY_EXECUTED;
+      pHandle->StartTimestamp = GLOBAL_TIMESTAMP;
       retVal = true;
     }
     else
@@ -478,6 +482,7 @@ __weak bool MCI_StartWithPolarizationMotor(MCI_Handle_t* pHandle)
     {
       pHandle->DirectCommand = MCI_START;
       pHandle->CommandState = MCI_COMMAND_NOT_ALREADY_EXECUTED;
+      pHandle->StartTimestamp = GLOBAL_TIMESTAMP;
       pHandle->pPWM->offsetCalibStatus = false;
       retVal = false;
   }
@@ -1765,6 +1770,43 @@ __weak void MCI_Clear_PerfMeasure(MCI_Handle_t *pHandle, uint8_t bMotor)
 #endif
 }
 
+/**
+  * @brief  Records the time elapsed since the last start command. It must be
+  *         called by the state machine when it enters the #RUN state, i.e.
+  *         when the closed loop torque control is active.
+  * @param  pHandle Pointer on the component instance to work on.
+  */
+__weak void MCI_StartupCompleted(MCI_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MC_INT
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t wTicks = GLOBAL_TIMESTAMP - pHandle->StartTimestamp;
+    pHandle->StartToTorqueTime = (uint32_t)(((uint64_t)wTicks * 1000000U) / TF_REGULATION_RATE);
+#ifdef NULL_PTR_CHECK_MC_INT
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the time from the last start command to the #RUN state.
+  * @param  pHandle Pointer on the component instance to work on.
+  * @retval uint32_t Start-to-torque time, expressed in microseconds.
+  */
+__weak uint32_t MCI_GetStartToTorqueTime(MCI_Handle_t *pHandle) //cstat !MISRAC2012-Rule-8.13
+{
+#ifdef NULL_PTR_CHECK_MC_INT
+  return ((MC_NULL == pHandle) ? 0U : pHandle->StartToTorqueTime);
+#else
+  return (pHandle->StartToTorqueTime);
+#endif
+}
+
 /**
   * @}
   */
@@ -71,15 +71,68 @@ const R3_1_Params_t R3_1_ParamsM1 =
   .Tcase2            = (uint16_t)SAMPLING_TIME + (uint16_t)TDEAD + (uint16_t)TRISE,
   .Tcase3            = ((uint16_t)TDEAD + (uint16_t)TNOISE + (uint16_t)SAMPLING_TIME) / 2u,
   .TIMx              = TIM1,
+#if NBR_OF_MOTORS > 1
+  .TimShift          = SHIFTED_TIMs,
+#else
+  .TimShift          = NO_SHIFTED_TIMs,
+#endif
 };
 
 ScaleParams_t scaleParams_M1 =
 {
- .voltage = NOMINAL_BUS_VOLTAGE_V/(1.73205 * 32767), /* sqrt(3) = 1.73205 */
+ .voltage = NOMINAL_BUS_VOLTAGE_V/(M1_VQD_BUS_RATIO * 32767),
  .current = CURRENT_CONV_FACTOR_INV,
  .frequency = (1.15 * MAX_APPLICATION_SPEED_UNIT * U_RPM)/(32768* SPEED_UNIT)
 };
 
+#if NBR_OF_MOTORS > 1
+/**
+  * @brief  Current sensor parameters Motor 2 - three shunt 1 ADC, injected group of ADC2
+  */
+const R3_1_Params_t R3_1_ParamsM2 =
+{
+/* Current reading A/D Conversions initialization -----------------------------*/
+  .ADCx              = ADC2,
+  .ADCConfig = {
+                 (uint32_t)(4U << ADC_JSQR_JSQ1_Pos)
+               | 14U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+                 (uint32_t)(12U << ADC_JSQR_JSQ1_Pos)
+               | 14U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+                 (uint32_t)(12U << ADC_JSQR_JSQ1_Pos)
+               | 14U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+                 (uint32_t)(12U << ADC_JSQR_JSQ1_Pos)
+               | 4U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+                 (uint32_t)(12U << ADC_JSQR_JSQ1_Pos)
+               | 4U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+                 (uint32_t)(4U << ADC_JSQR_JSQ1_Pos)
+               | 14U << ADC_JSQR_JSQ2_Pos | 1<< ADC_JSQR_JL_Pos
+               | (LL_ADC_INJ_TRIG_EXT_TIM8_TRGO & ~ADC_INJ_TRIG_EXT_EDGE_DEFAULT),
+               },
+
+/* PWM generation parameters --------------------------------------------------*/
+  .RepetitionCounter = REP_COUNTER,
+  .hTafter           = TW_AFTER,
+  .hTbefore          = TW_BEFORE_R3_1,
+  .Tsampling         = (uint16_t)SAMPLING_TIME,
+  .Tcase2            = (uint16_t)SAMPLING_TIME + (uint16_t)TDEAD + (uint16_t)TRISE,
+  .Tcase3            = ((uint16_t)TDEAD + (uint16_t)TNOISE + (uint16_t)SAMPLING_TIME) / 2u,
+  .TIMx              = TIM8,
+  .TimShift          = NO_SHIFTED_TIMs,
+};
+
+ScaleParams_t scaleParams_M2 =
+{
+ .voltage = NOMINAL_BUS_VOLTAGE_V/(1.73205 * 32767), /* sqrt(3) = 1.73205 */
+ .current = CURRENT_CONV_FACTOR_INV,
+ .frequency = (1.15 * MAX_APPLICATION_SPEED_UNIT2 * U_RPM)/(32768* SPEED_UNIT)
+};
+#endif /* NBR_OF_MOTORS > 1 */
+
 /* USER CODE BEGIN Additional parameters */
 
 /* USER CODE END Additional parameters */
@@ -20,6 +20,21 @@
 #include "parameters_conversion.h"
 #include "mc_perf.h"
 
+/* Clock cycles between two High Frequency Tasks of the same motor */
+#define MC_PERF_HF_PERIOD_CYCLES  ((float_t)SYSCLK_FREQ / (float_t)(PWM_FREQUENCY/REGULATION_EXECUTION_RATE))
+
+/**
+ * @brief  Converts the durations of the tasks of a motor into a CPU load.
+ * @param  mfCycles: duration of the Medium Frequency Task, in clock cycles.
+ * @param  hfCycles: duration of the High Frequency Task, in clock cycles.
+ * @retval CPU load, from 0 to 1 and more if the tasks overrun.
+ */
+static float_t MC_Perf_Load(uint32_t mfCycles, uint32_t hfCycles)
+{
+  return ((((float_t)mfCycles / (float_t)SYSCLK_FREQ ) * (float_t)MEDIUM_FREQUENCY_TASK_RATE)
+          + ((float_t)hfCycles / MC_PERF_HF_PERIOD_CYCLES));
+}
+
 void MC_Perf_Measure_Init(MC_Perf_Handle_t *pHandle)
 {
 #ifdef NULL_PTR_CHECK_MC_PERF
@@ -271,15 +286,13 @@ float_t MC_Perf_GetCPU_Load(const MC_Perf_Handle_t *pHandle)
   else
   {
 #endif
-    float_t MFT_cpu_loadM1;
-    float_t HFT_cpu_loadM1;
+    uint8_t bMotor;
 
-    MFT_cpu_loadM1 = (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_MediumFrequencyTaskM1].DeltaTimeInCycle\
-                   / (float_t)SYSCLK_FREQ ) * (float_t)MEDIUM_FREQUENCY_TASK_RATE);
-    HFT_cpu_loadM1 = (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_HighFrequencyTaskM1].DeltaTimeInCycle\
-                   / (float_t)SYSCLK_FREQ ) * (float_t)(PWM_FREQUENCY/REGULATION_EXECUTION_RATE));
-
-    cpuLoad = MFT_cpu_loadM1 + HFT_cpu_loadM1;
+    for (bMotor = 0U; bMotor < (uint8_t)NBR_OF_MOTORS; bMotor++)
+    {
+      cpuLoad += MC_Perf_Load(pHandle->MC_Perf_TraceLog[(2U * bMotor) + 1U].DeltaTimeInCycle,
+                              pHandle->MC_Perf_TraceLog[2U * bMotor].DeltaTimeInCycle);
+    }
 
     cpuLoad = (cpuLoad > 1.0f) ? 1.0f : cpuLoad;
     cpuLoad *= 100.0f;
@@ -305,10 +318,13 @@ float_t MC_Perf_GetMaxCPU_Load(const MC_Perf_Handle_t *pHandle)
   else
   {
 #endif
-    cpuLoad += (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_MediumFrequencyTaskM1].max / (float_t)SYSCLK_FREQ )\
-                   * (float_t)MEDIUM_FREQUENCY_TASK_RATE);
-    cpuLoad += (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_HighFrequencyTaskM1].max / (float_t)SYSCLK_FREQ )\
-                   * (float_t)(PWM_FREQUENCY/REGULATION_EXECUTION_RATE));
+    uint8_t bMotor;
+
+    for (bMotor = 0U; bMotor < (uint8_t)NBR_OF_MOTORS; bMotor++)
+    {
+      cpuLoad += MC_Perf_Load(pHandle->MC_Perf_TraceLog[(2U * bMotor) + 1U].max,
+                              pHandle->MC_Perf_TraceLog[2U * bMotor].max);
+    }
 
     cpuLoad = (cpuLoad > 1.0f) ? 1.0f : cpuLoad;
     cpuLoad *= 100.0f;
@@ -334,15 +350,16 @@ float_t MC_Perf_GetMinCPU_Load(const MC_Perf_Handle_t *pHandle)
   else
   {
 #endif
-    if (pHandle->MC_Perf_TraceLog[MEASURE_TSK_MediumFrequencyTaskM1].min != UINT32_MAX)
-    {
-      cpu_load_acc += (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_MediumFrequencyTaskM1].min / (float_t)SYSCLK_FREQ )\
-                     * (float_t)MEDIUM_FREQUENCY_TASK_RATE);
-    }
-    if (pHandle->MC_Perf_TraceLog[MEASURE_TSK_HighFrequencyTaskM1].min != UINT32_MAX)
+    uint8_t bMotor;
+    uint32_t mfMin;
+    uint32_t hfMin;
+
+    for (bMotor = 0U; bMotor < (uint8_t)NBR_OF_MOTORS; bMotor++)
     {
-      cpu_load_acc += (((float_t)pHandle->MC_Perf_TraceLog[MEASURE_TSK_HighFrequencyTaskM1].min / (float_t)SYSCLK_FREQ )\
-                   * (float_t)(PWM_FREQUENCY/REGULATION_EXECUTION_RATE));
+      /* A task not measured yet does not count */
+      mfMin = pHandle->MC_Perf_TraceLog[(2U * bMotor) + 1U].min;
+      hfMin = pHandle->MC_Perf_TraceLog[2U * bMotor].min;
+      cpu_load_acc += MC_Perf_Load((UINT32_MAX == mfMin) ? 0U : mfMin, (UINT32_MAX == hfMin) ? 0U : hfMin);
     }
     cpu_load_acc = (cpu_load_acc > 1.0f) ? 1.0f : cpu_load_acc;
     cpu_load_acc *= 100.0f;
@@ -352,4 +369,61 @@ float_t MC_Perf_GetMinCPU_Load(const MC_Perf_Handle_t *pHandle)
   return (cpu_load_acc);
 }
 
+/**
+ * @brief  It returns the current CPU load of the High and Medium frequency tasks of one motor.
+ * @param  pHandle: handler of the performance measurement component.
+ * @param  bMotor: motor reference number, M1 or M2.
+ * @retval CPU load of the motor, in percent.
+ */
+float_t MC_Perf_GetAxisCPU_Load(const MC_Perf_Handle_t *pHandle, uint8_t bMotor)
+{
+  float_t cpuLoad = 0.0f;
+#ifdef NULL_PTR_CHECK_MC_PERF
+  if ((MC_NULL == pHandle) || (bMotor >= (uint8_t)NBR_OF_MOTORS))
+#else
+  if (bMotor >= (uint8_t)NBR_OF_MOTORS)
+#endif
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    cpuLoad = MC_Perf_Load(pHandle->MC_Perf_TraceLog[(2U * bMotor) + 1U].DeltaTimeInCycle,
+                           pHandle->MC_Perf_TraceLog[2U * bMotor].DeltaTimeInCycle);
+    cpuLoad = (cpuLoad > 1.0f) ? 1.0f : cpuLoad;
+    cpuLoad *= 100.0f;
+  }
+  return (cpuLoad);
+}
+
+/**
+ * @brief  It returns the longest High Frequency Task of one motor relative to its time slot.
+ *
+ * The PWM timers of the motors are staggered, each High Frequency Task must end before the one of the next
+ * motor is triggered: the slot is the PWM period divided by the number of motors. Above 100, the tasks of the
+ * motors overlap and the FOC of the next motor is delayed.
+ *
+ * @param  pHandle: handler of the performance measurement component.
+ * @param  bMotor: motor reference number, M1 or M2.
+ * @retval Usage of the time slot, in percent.
+ */
+float_t MC_Perf_GetHFBudget(const MC_Perf_Handle_t *pHandle, uint8_t bMotor)
+{
+  float_t budget = 0.0f;
+#ifdef NULL_PTR_CHECK_MC_PERF
+  if ((MC_NULL == pHandle) || (bMotor >= (uint8_t)NBR_OF_MOTORS))
+#else
+  if (bMotor >= (uint8_t)NBR_OF_MOTORS)
+#endif
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+    budget = ((float_t)pHandle->MC_Perf_TraceLog[2U * bMotor].max * (float_t)NBR_OF_MOTORS * 100.0f)
+           / MC_PERF_HF_PERIOD_CYCLES;
+  }
+  return (budget);
+}
+
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
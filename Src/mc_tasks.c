@@ -54,6 +54,13 @@
 /* USER CODE END Private define */
 
 #define VBUS_TEMP_ERR_MASK (MC_OVER_VOLT| MC_UNDER_VOLT| MC_OVER_TEMP)
+
+/* Main speed and position sensor of motor 1 */
+#ifdef M1_ENCODER_FUSION
+#define M1_MAIN_SENSOR (&FusedSensorM1._Super)
+#else
+#define M1_MAIN_SENSOR (&HALL_M1._Super)
+#endif
 /* Private variables----------------------------------------------------------*/
 
 static FOCVars_t FOCVars[NBR_OF_MOTORS];
@@ -67,9 +74,23 @@ static RampExtMngr_Handle_t *pREMNG[NBR_OF_MOTORS];   /*!< Ramp manager used to
 static uint16_t hMFTaskCounterM1 = 0; //cstat !MISRAC2012-Rule-8.9_a
 static volatile uint16_t hBootCapDelayCounterM1 = ((uint16_t)0);
 static volatile uint16_t hStopPermanencyCounterM1 = ((uint16_t)0);
+#if NBR_OF_MOTORS > 1
+/* Medium Frequency Task of motor 2 runs between two of motor 1 */
+static uint16_t hMFTaskCounterM2 = (uint16_t)(((MF_TASK_OCCURENCE_TICKS) + 1u) / 2u); //cstat !MISRAC2012-Rule-8.9_a
+static volatile uint16_t hBootCapDelayCounterM2 = ((uint16_t)0);
+static volatile uint16_t hStopPermanencyCounterM2 = ((uint16_t)0);
+#endif
 
 static volatile uint8_t bMCBootCompleted = ((uint8_t)0);
 
+/* Last state and position control status reported to the controller as events */
+static MCI_State_t LastEventStateM1 = IDLE;
+static PosCtrlStatus_t LastEventPositionStatusM1 = TC_READY_FOR_COMMAND;
+#if NBR_OF_MOTORS > 1
+static MCI_State_t LastEventStateM2 = IDLE;
+static PosCtrlStatus_t LastEventPositionStatusM2 = TC_READY_FOR_COMMAND;
+#endif
+
 /* Performs the CPU load measure of FOC main tasks */
 MC_Perf_Handle_t PerfTraces;
 
@@ -97,6 +118,15 @@ bool TSK_ChargeBootCapDelayHasElapsedM1(void);
 void TSK_SetStopPermanencyTimeM1(uint16_t hTickCount);
 bool TSK_StopPermanencyTimeHasElapsedM1(void);
 void TSK_SafetyTask_PWMOFF(uint8_t motor);
+static void TSK_FaultProcessing(uint8_t bMotor, uint16_t hSetErrors, uint16_t hResetErrors);
+#if NBR_OF_MOTORS > 1
+void TSK_MediumFrequencyTaskM2(void);
+static uint16_t FOC_CurrControllerM2(void);
+void TSK_SetChargeBootCapDelayM2(uint16_t hTickCount);
+bool TSK_ChargeBootCapDelayHasElapsedM2(void);
+void TSK_SetStopPermanencyTimeM2(uint16_t hTickCount);
+bool TSK_StopPermanencyTimeHasElapsedM2(void);
+#endif
 
 /* USER CODE BEGIN Private Functions */
 
@@ -129,6 +159,12 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     pwmcHandle[M1] = &PWM_Handle_M1._Super;
     R3_1_Init(&PWM_Handle_M1);
     ASPEP_start(&aspepOverUartA);
+    MCPE_Init(&MCPE_UART_A);
+#if NBR_OF_MOTORS > 1
+    /* Configured before startTimers(), its counter is then staggered by half a period from TIM1 */
+    pwmcHandle[M2] = &PWM_Handle_M2._Super;
+    R3_1_Init(&PWM_Handle_M2);
+#endif
 
     /* USER CODE BEGIN MCboot 1 */
 
@@ -147,7 +183,9 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     /******************************************************/
     /*   Main speed sensor component initialization       */
     /******************************************************/
+#ifdef M1_ENCODER_FUSION
     ENC_Init (&ENCODER_M1);
+#endif
         /* Hall sensor init */
     HALL_Init(&HALL_M1);
 
@@ -159,17 +197,27 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
 
     HAC_Init(&HallAlignCtrlM1,pSTC[M1], &VirtualSpeedSensorM1, &HALL_M1);
     pHAC[M1] = &HallAlignCtrlM1;
+#ifdef M1_ENCODER_FUSION
+    /* Hall sensors fused with the encoder */
+    FUS_Init(&FusedSensorM1);
+#endif
     /******************************************************/
     /*   Position Control component initialization        */
     /******************************************************/    
     PID_HandleInit(&PID_PosParamsM1);
        //TC_Init(&PosCtrlM1, &PID_PosParamsM1, &SpeednTorqCtrlM1, &ENCODER_M1);
     TC_Init(&PosCtrlM1, &PID_PosParamsM1, &SpeednTorqCtrlM1, &HALL_M1);
+    SPS_Init(&SetpointStreamM1, &PosCtrlM1);
+    BLC_Init(&BacklashCompM1);
+    HFC_Init(&HFCaptureM1);
+    FRA_Init(&FreqRespM1);
     /******************************************************/
     /*   Speed & torque component initialization          */
     /******************************************************/
     // STC_Init(pSTC[M1],&PIDSpeedHandle_M1, &ENCODER_M1._Super);
-    STC_Init(pSTC[M1],&PIDSpeedHandle_M1, &HALL_M1._Super);
+    STC_Init(pSTC[M1],&PIDSpeedHandle_M1, M1_MAIN_SENSOR);
+    CPR_Init(&CurrentProtM1, pSTC[M1]);
+    MID_Init(&MotorIdentM1);
     /****************************************************/
     /*   Virtual speed sensor component initialization  */
     /****************************************************/
@@ -181,6 +229,12 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     PID_HandleInit(&PIDIqHandle_M1);
     PID_HandleInit(&PIDIdHandle_M1);
 
+    /********************************************************/
+    /*   Flux weakening component initialization            */
+    /********************************************************/
+    PID_HandleInit(&PIDFluxWeakeningHandle_M1);
+    FW_Init(&FW_M1, &PIDSpeedHandle_M1, &PIDFluxWeakeningHandle_M1);
+
     /********************************************************/
     /*   Bus voltage sensor component initialization        */
     /********************************************************/
@@ -213,8 +267,74 @@ __weak void MCboot( MCI_Handle_t* pMCIList[NBR_OF_MOTORS] )
     STC_GetMecSpeedRefUnitDefault(pSTC[M1]),0); /* First command to STC */
     Mci[M1].pPerfMeasure = &PerfTraces;
     MC_Perf_Measure_Init(&PerfTraces);
+
+    /******************************************************/
+    /*   Calibration restored from flash                  */
+    /******************************************************/
+    if (CAL_Init(&CalibStoreM1))
+    {
+      PolarizationOffsets_t PolarizationOffsets;
+      int16_t hPhaseShift;
+
+      if (CAL_GetOffsets(&CalibStoreM1, &PolarizationOffsets))
+      {
+        (void)MCI_SetCalibratedOffsetsMotor(&Mci[M1], &PolarizationOffsets);
+      }
+      else
+      {
+        /* Nothing to do, offsets are measured at first start */
+      }
+      if (CAL_GetHallCorrection(&CalibStoreM1, &hPhaseShift))
+      {
+        HAC_SetHallPhaseShift(&HallAlignCtrlM1, hPhaseShift);
+      }
+      else
+      {
+        /* Nothing to do, hall phase shift is measured by the first alignment */
+      }
+    }
+    else
+    {
+      /* Nothing to do, no valid calibration stored */
+    }
+
     pMCIList[M1] = &Mci[M1];
 
+#if NBR_OF_MOTORS > 1
+    /******************************************************/
+    /*   Motor 2: zoom axis, encoder aligned at start     */
+    /******************************************************/
+    PID_HandleInit(&PIDSpeedHandle_M2);
+    ENC_Init(&ENCODER_M2);
+    EAC_Init(&EncAlignCtrlM2, pSTC[M2], &VirtualSpeedSensorM2, &ENCODER_M2);
+    pEAC[M2] = &EncAlignCtrlM2;
+    PID_HandleInit(&PID_PosParamsM2);
+    TC_Init(&PosCtrlM2, &PID_PosParamsM2, &SpeednTorqCtrlM2, MC_NULL);
+    STC_Init(pSTC[M2], &PIDSpeedHandle_M2, &ENCODER_M2._Super);
+    CPR_Init(&CurrentProtM2, pSTC[M2]);
+    VSS_Init(&VirtualSpeedSensorM2);
+    PID_HandleInit(&PIDIqHandle_M2);
+    PID_HandleInit(&PIDIdHandle_M2);
+
+    /* Both motors are supplied by the same bus */
+    pMPM[M2]->pVBS = &(BusVoltageSensor_M1._Super);
+    pMPM[M2]->pFOCVars = &FOCVars[M2];
+
+    pREMNG[M2] = &RampExtMngrHFParamsM2;
+    REMNG_Init(pREMNG[M2]);
+
+    FOC_Clear(M2);
+    FOCVars[M2].bDriveInput = EXTERNAL;
+    FOCVars[M2].Iqdref = STC_GetDefaultIqdref(pSTC[M2]);
+    FOCVars[M2].UserIdref = STC_GetDefaultIqdref(pSTC[M2]).d;
+    MCI_Init(&Mci[M2], pSTC[M2], &FOCVars[M2], pPosCtrl[M2], pwmcHandle[M2]);
+    Mci[M2].pScale = &scaleParams_M2;
+    MCI_ExecSpeedRamp(&Mci[M2], STC_GetMecSpeedRefUnitDefault(pSTC[M2]), 0); /* First command to STC */
+    Mci[M2].pPerfMeasure = &PerfTraces;
+
+    pMCIList[M2] = &Mci[M2];
+#endif
+
     DAC_Init(&DAC_Handle);
 
     /* Applicative hook in MCBoot() */
@@ -265,7 +385,21 @@ void TSK_MF_StopProcessing(uint8_t motor)
 
   FOC_Clear(motor);
   PQD_Clear(pMPM[motor]);
-  TSK_SetStopPermanencyTimeM1(STOPPERMANENCY_TICKS);
+#if NBR_OF_MOTORS > 1
+  if (M2 == motor)
+  {
+    TSK_SetStopPermanencyTimeM2(STOPPERMANENCY_TICKS2);
+  }
+  else
+#endif
+  {
+    SPS_Clear(&SetpointStreamM1);
+    BLC_StopLearning(&BacklashCompM1);
+    BLC_Clear(&BacklashCompM1);
+    MID_Stop(&MotorIdentM1);
+    FRA_Stop(&FreqRespM1);
+    TSK_SetStopPermanencyTimeM1(STOPPERMANENCY_TICKS);
+  }
   Mci[motor].State = STOP;
 }
 
@@ -317,11 +451,19 @@ __weak void MC_Scheduler(void)
         }
       }
 
+      /* Events queued since the last call */
+      MCPE_Exec(&MCPE_UART_A);
+
+      /* Background write and check of the calibration store */
+      CAL_Exec(&CalibStoreM1);
+
       /* USER CODE BEGIN MC_Scheduler 1 */
 
       /* USER CODE END MC_Scheduler 1 */
       hMFTaskCounterM1 = (uint16_t)MF_TASK_OCCURENCE_TICKS;
     }
+    /* Time base of the follow mode speed estimation */
+    TC_IncTick(pPosCtrl[M1]);
     if(hBootCapDelayCounterM1 > 0U)
     {
       hBootCapDelayCounterM1--;
@@ -338,6 +480,34 @@ __weak void MC_Scheduler(void)
     {
       /* Nothing to do */
     }
+#if NBR_OF_MOTORS > 1
+    if (hMFTaskCounterM2 > 0u)
+    {
+      hMFTaskCounterM2--;
+    }
+    else
+    {
+      TSK_MediumFrequencyTaskM2();
+      hMFTaskCounterM2 = (uint16_t)MF_TASK_OCCURENCE_TICKS;
+    }
+    TC_IncTick(pPosCtrl[M2]);
+    if (hBootCapDelayCounterM2 > 0U)
+    {
+      hBootCapDelayCounterM2--;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (hStopPermanencyCounterM2 > 0U)
+    {
+      hStopPermanencyCounterM2--;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#endif
   }
   else
   {
@@ -364,8 +534,17 @@ __weak void TSK_MediumFrequencyTaskM1(void)
   /* USER CODE END MediumFrequencyTask M1 0 */
 
   int16_t wAux = 0;
-  (void)ENC_CalcAvrgMecSpeedUnit(&ENCODER_M1, &wAux);  // TODO
+  float fLearnRef;
+  float fLearnSpeed;
+  PosCtrlStatus_t positionStatus;
+#ifdef M1_ENCODER_FUSION
+  bool IsSpeedReliable = FUS_CalcAvrgMecSpeedUnit(&FusedSensorM1, &wAux);
+#else
+  bool IsSpeedReliable = HALL_CalcAvrgMecSpeedUnit(&HALL_M1, &wAux);
+#endif
   PQD_CalcElMotorPower(pMPM[M1]);
+  /* Derates the torque limits before the references are computed */
+  CPR_CalcThermal(&CurrentProtM1);
 
   if (MCI_GetCurrentFaults(&Mci[M1]) == MC_NO_FAULTS)
   {
@@ -388,6 +567,7 @@ __weak void TSK_MediumFrequencyTaskM1(void)
               /* Calibration already done. Enables only TIM channels */
               pwmcHandle[M1]->OffCalibrWaitTimeCounter = 1u;
               (void)PWMC_CurrentReadingCalibr(pwmcHandle[M1], CRC_EXEC);
+              HALL_Clear(&HALL_M1);
               R3_1_TurnOnLowSides(pwmcHandle[M1],M1_CHARGE_BOOT_CAP_DUTY_CYCLES);
               TSK_SetChargeBootCapDelayM1(M1_CHARGE_BOOT_CAP_TICKS);
               Mci[M1].State = CHARGE_BOOT_CAP;
@@ -410,6 +590,10 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           {
             if (PWMC_CurrentReadingCalibr(pwmcHandle[M1], CRC_EXEC))
             {
+              PolarizationOffsets_t PolarizationOffsets;
+
+              PWMC_GetOffsetCalib(pwmcHandle[M1], &PolarizationOffsets);
+              CAL_SetOffsets(&CalibStoreM1, &PolarizationOffsets);
               if (MCI_MEASURE_OFFSETS == Mci[M1].DirectCommand)
               {
                 FOC_Clear(M1);
@@ -419,6 +603,7 @@ __weak void TSK_MediumFrequencyTaskM1(void)
               }
               else
               {
+                HALL_Clear(&HALL_M1);
                 R3_1_TurnOnLowSides(pwmcHandle[M1],M1_CHARGE_BOOT_CAP_DUTY_CYCLES);
                 TSK_SetChargeBootCapDelayM1(M1_CHARGE_BOOT_CAP_TICKS);
                 Mci[M1].State = CHARGE_BOOT_CAP;
@@ -445,7 +630,9 @@ __weak void TSK_MediumFrequencyTaskM1(void)
               R3_1_SwitchOffPWM(pwmcHandle[M1]);
               FOCVars[M1].bDriveInput = EXTERNAL;
               STC_SetSpeedSensor( pSTC[M1], &VirtualSpeedSensorM1._Super );
-              ENC_Clear(&ENCODER_M1);
+#ifdef M1_ENCODER_FUSION
+              FUS_Clear(&FusedSensorM1);
+#endif
               FOC_Clear( M1 );
 
               // if (EAC_IsAligned(&EncAlignCtrlM1) == false)
@@ -455,17 +642,35 @@ __weak void TSK_MediumFrequencyTaskM1(void)
               // }
               if (HAC_IsAligned(&HallAlignCtrlM1) == false)
               {
-                HAC_StartAlignment(&HallAlignCtrlM1);
-                Mci[M1].State = ALIGNMENT;
+                if (HAC_InstantAlignment(&HallAlignCtrlM1))
+                {
+                  /* Encoder seeded from the hall angle, the timed alignment is skipped */
+                  STC_SetControlMode(pSTC[M1], MCM_SPEED_MODE);
+                  STC_SetSpeedSensor(pSTC[M1], M1_MAIN_SENSOR);
+                  TC_EncAlignmentCommand(pPosCtrl[M1]);
+                  FOC_InitAdditionalMethods(M1);
+                  FOC_CalcCurrRef(M1);
+                  STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
+                  MCI_ExecBufferedCommands(&Mci[M1]); /* Exec the speed ramp after changing of the speed sensor */
+                  MCI_StartupCompleted(&Mci[M1]);
+                  Mci[M1].State = RUN;
+                }
+                else
+                {
+                  /* Hall angle not plausible, fall back to the timed alignment */
+                  HAC_StartAlignment(&HallAlignCtrlM1);
+                  Mci[M1].State = ALIGNMENT;
+                }
               }
               else
               {
                 STC_SetControlMode(pSTC[M1], MCM_SPEED_MODE);
-                STC_SetSpeedSensor(pSTC[M1], &ENCODER_M1._Super);
+                STC_SetSpeedSensor(pSTC[M1], M1_MAIN_SENSOR);
                 FOC_InitAdditionalMethods(M1);
                 FOC_CalcCurrRef(M1);
                 STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
                 MCI_ExecBufferedCommands(&Mci[M1]); /* Exec the speed ramp after changing of the speed sensor */
+                MCI_StartupCompleted(&Mci[M1]);
                 Mci[M1].State = RUN;
               }
               PWMC_SwitchOnPWM(pwmcHandle[M1]);
@@ -501,11 +706,19 @@ __weak void TSK_MediumFrequencyTaskM1(void)
             {
               R3_1_SwitchOffPWM( pwmcHandle[M1] );
               STC_SetControlMode(pSTC[M1], MCM_SPEED_MODE);
-              STC_SetSpeedSensor(pSTC[M1], &ENCODER_M1._Super);
+              STC_SetSpeedSensor(pSTC[M1], M1_MAIN_SENSOR);
               FOC_Clear(M1);
               R3_1_TurnOnLowSides(pwmcHandle[M1],M1_CHARGE_BOOT_CAP_DUTY_CYCLES);
               TSK_SetStopPermanencyTimeM1(STOPPERMANENCY_TICKS);
               Mci[M1].State = WAIT_STOP_MOTOR;
+              if (HallAlignCtrlM1.HallCalibrated)
+              {
+                CAL_SetHallCorrection(&CalibStoreM1, HallAlignCtrlM1.hElAngle, HALL_M1.PhaseShift);
+              }
+              else
+              {
+                /* Nothing to do */
+              }
               /* USER CODE BEGIN MediumFrequencyTask M1 EndOfEncAlignment */
 
               /* USER CODE END MediumFrequencyTask M1 EndOfEncAlignment */
@@ -526,11 +739,67 @@ __weak void TSK_MediumFrequencyTaskM1(void)
 
             /* USER CODE END MediumFrequencyTask M1 2 */
 
-            TC_PositionRegulation(pPosCtrl[M1]);
-            MCI_ExecBufferedCommands(&Mci[M1]);
+            if (false == IsSpeedReliable)
+            {
+              /* No usable position sensor left */
+              TSK_FaultProcessing(M1, MC_SPEED_FDBK, 0);
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+            PWMC_DPWM_Update(pwmcHandle[M1], FOCVars[M1].Vqd);
 
-              FOC_CalcCurrRef(M1);
+            if (MID_IsRunning(&MotorIdentM1))
+            {
+              /* The identification drives the currents, the position loop is suspended */
+              FOCVars[M1].Iqdref = MID_Exec(&MotorIdentM1, FOCVars[M1].Vqd, FOCVars[M1].Iqd, wAux);
+              if (MID_IsRunning(&MotorIdentM1) == false)
+              {
+                TSK_MF_StopProcessing(M1);
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+            }
+            else
+            {
+              FRA_Process(&FreqRespM1);
+              if (FRA_LOOP_SPEED == FRA_GetLoop(&FreqRespM1))
+              {
+                /* The speed loop is measured alone around zero speed, the position loop is suspended */
+                STC_SetControlMode(pSTC[M1], MCM_SPEED_MODE);
+                (void)STC_ExecRamp(pSTC[M1], (int16_t)FRA_Exec(&FreqRespM1, 0, wAux), 0);
+              }
+              else
+              {
+                if (FRA_LOOP_POSITION == FRA_GetLoop(&FreqRespM1))
+                {
+                  /* The position reference is held, only the perturbation moves it */
+                  TC_SetRefPerturbation(pPosCtrl[M1], FRA_Exec(&FreqRespM1, 0,
+                                                               SPD_GetMecAngle(STC_GetSpeedSensor(pSTC[M1]))));
+                }
+                else
+                {
+                  TC_SetRefPerturbation(pPosCtrl[M1], 0);
+                  if (BLC_LearnExec(&BacklashCompM1, TC_GetCurrentPosition(pPosCtrl[M1]),
+                                    TC_GetTorqueRefFB(pPosCtrl[M1]), &fLearnRef, &fLearnSpeed))
+                  {
+                    /* Reversal tests of the backlash learning drive the position reference */
+                    TC_StreamCommand(pPosCtrl[M1], fLearnRef, fLearnSpeed, 0.0f, 0);
+                  }
+                  else
+                  {
+                    SPS_Exec(&SetpointStreamM1);
+                  }
+                }
+                TC_PositionRegulation(pPosCtrl[M1]);
+              }
+              MCI_ExecBufferedCommands(&Mci[M1]);
 
+              FOC_CalcCurrRef(M1);
+            }
           }
           break;
         }
@@ -583,13 +852,16 @@ __weak void TSK_MediumFrequencyTaskM1(void)
           {
             if (TSK_StopPermanencyTimeHasElapsedM1())
             {
-              ENC_Clear(&ENCODER_M1);
+#ifdef M1_ENCODER_FUSION
+              FUS_Clear(&FusedSensorM1);
+#endif
               R3_1_SwitchOnPWM(pwmcHandle[M1]);
               TC_EncAlignmentCommand(pPosCtrl[M1]);
               FOC_InitAdditionalMethods(M1);
               STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M1]); /* Init the reference speed to current speed */
               MCI_ExecBufferedCommands(&Mci[M1]); /* Exec the speed ramp after changing of the speed sensor */
               FOC_CalcCurrRef(M1);
+              MCI_StartupCompleted(&Mci[M1]);
               Mci[M1].State = RUN;
             }
             else
@@ -613,12 +885,362 @@ __weak void TSK_MediumFrequencyTaskM1(void)
   {
     Mci[M1].State = FAULT_NOW;
   }
+  /* Reports the state changes and the end of the position moves */
+  if (Mci[M1].State != LastEventStateM1)
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_STATE, M1, (uint8_t)Mci[M1].State, (uint16_t)LastEventStateM1);
+    LastEventStateM1 = Mci[M1].State;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  positionStatus = TC_GetControlPositionStatus(pPosCtrl[M1]);
+  if ((TC_TARGET_POSITION_REACHED == positionStatus) && (positionStatus != LastEventPositionStatusM1))
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_MOTION, M1, MCPE_MOTION_TARGET_REACHED, 0U);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  LastEventPositionStatusM1 = positionStatus;
   /* USER CODE BEGIN MediumFrequencyTask M1 6 */
 
   /* USER CODE END MediumFrequencyTask M1 6 */
   MC_BG_Perf_Measure_Stop(&PerfTraces, MEASURE_TSK_MediumFrequencyTaskM1);
 }
 
+#if NBR_OF_MOTORS > 1
+/**
+  * @brief Executes medium frequency periodic Motor Control tasks of Motor 2
+  *
+  * Motor 2 is the zoom axis: its encoder is aligned by the Encoder Alignment Controller at the first start,
+  * its position is regulated without set-point stream nor backlash compensation.
+  */
+__weak void TSK_MediumFrequencyTaskM2(void)
+{
+  MC_BG_Perf_Measure_Start(&PerfTraces, MEASURE_TSK_MediumFrequencyTaskM2);
+  /* USER CODE BEGIN MediumFrequencyTask M2 0 */
+
+  /* USER CODE END MediumFrequencyTask M2 0 */
+
+  int16_t wAux = 0;
+  PosCtrlStatus_t positionStatus;
+  bool IsSpeedReliable = ENC_CalcAvrgMecSpeedUnit(&ENCODER_M2, &wAux);
+  PQD_CalcElMotorPower(pMPM[M2]);
+  /* Derates the torque limits before the references are computed */
+  CPR_CalcThermal(&CurrentProtM2);
+
+  if (MCI_GetCurrentFaults(&Mci[M2]) == MC_NO_FAULTS)
+  {
+    if (MCI_GetOccurredFaults(&Mci[M2]) == MC_NO_FAULTS)
+    {
+      switch (Mci[M2].State)
+      {
+
+        case IDLE:
+        {
+          if ((MCI_START == Mci[M2].DirectCommand) || (MCI_MEASURE_OFFSETS == Mci[M2].DirectCommand))
+          {
+            if (pwmcHandle[M2]->offsetCalibStatus == false)
+            {
+              (void)PWMC_CurrentReadingCalibr(pwmcHandle[M2], CRC_START);
+              Mci[M2].State = OFFSET_CALIB;
+            }
+            else
+            {
+              /* Calibration already done. Enables only TIM channels */
+              pwmcHandle[M2]->OffCalibrWaitTimeCounter = 1u;
+              (void)PWMC_CurrentReadingCalibr(pwmcHandle[M2], CRC_EXEC);
+              R3_1_TurnOnLowSides(pwmcHandle[M2], M2_CHARGE_BOOT_CAP_DUTY_CYCLES);
+              TSK_SetChargeBootCapDelayM2(M2_CHARGE_BOOT_CAP_TICKS);
+              Mci[M2].State = CHARGE_BOOT_CAP;
+            }
+          }
+          else
+          {
+            /* Nothing to be done, FW stays in IDLE state */
+          }
+          break;
+        }
+
+        case OFFSET_CALIB:
+        {
+          if (MCI_STOP == Mci[M2].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M2);
+          }
+          else
+          {
+            if (PWMC_CurrentReadingCalibr(pwmcHandle[M2], CRC_EXEC))
+            {
+              if (MCI_MEASURE_OFFSETS == Mci[M2].DirectCommand)
+              {
+                FOC_Clear(M2);
+                PQD_Clear(pMPM[M2]);
+                Mci[M2].DirectCommand = MCI_NO_COMMAND;
+                Mci[M2].State = IDLE;
+              }
+              else
+              {
+                R3_1_TurnOnLowSides(pwmcHandle[M2], M2_CHARGE_BOOT_CAP_DUTY_CYCLES);
+                TSK_SetChargeBootCapDelayM2(M2_CHARGE_BOOT_CAP_TICKS);
+                Mci[M2].State = CHARGE_BOOT_CAP;
+              }
+            }
+            else
+            {
+              /* Nothing to be done, FW waits for offset calibration to finish */
+            }
+          }
+          break;
+        }
+
+        case CHARGE_BOOT_CAP:
+        {
+          if (MCI_STOP == Mci[M2].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M2);
+          }
+          else
+          {
+            if (TSK_ChargeBootCapDelayHasElapsedM2())
+            {
+              R3_1_SwitchOffPWM(pwmcHandle[M2]);
+              FOCVars[M2].bDriveInput = EXTERNAL;
+              STC_SetSpeedSensor(pSTC[M2], &VirtualSpeedSensorM2._Super);
+              ENC_Clear(&ENCODER_M2);
+              FOC_Clear(M2);
+
+              if (EAC_IsAligned(&EncAlignCtrlM2) == false)
+              {
+                EAC_StartAlignment(&EncAlignCtrlM2);
+                Mci[M2].State = ALIGNMENT;
+              }
+              else
+              {
+                STC_SetControlMode(pSTC[M2], MCM_SPEED_MODE);
+                STC_SetSpeedSensor(pSTC[M2], &ENCODER_M2._Super);
+                FOC_InitAdditionalMethods(M2);
+                FOC_CalcCurrRef(M2);
+                STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M2]); /* Init the reference speed to current speed */
+                MCI_ExecBufferedCommands(&Mci[M2]); /* Exec the speed ramp after changing of the speed sensor */
+                MCI_StartupCompleted(&Mci[M2]);
+                Mci[M2].State = RUN;
+              }
+              PWMC_SwitchOnPWM(pwmcHandle[M2]);
+            }
+            else
+            {
+              /* Nothing to be done, FW waits for bootstrap capacitor to charge */
+            }
+          }
+          break;
+        }
+
+        case ALIGNMENT:
+        {
+          if (MCI_STOP == Mci[M2].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M2);
+          }
+          else
+          {
+            bool isAligned = EAC_IsAligned(&EncAlignCtrlM2);
+            bool EACDone = EAC_Exec(&EncAlignCtrlM2);
+            if ((isAligned == false)  && (EACDone == false))
+            {
+              qd_t IqdRef;
+              IqdRef.q = 0;
+              IqdRef.d = STC_CalcTorqueReference(pSTC[M2]);
+              FOCVars[M2].Iqdref = IqdRef;
+            }
+            else
+            {
+              R3_1_SwitchOffPWM(pwmcHandle[M2]);
+              STC_SetControlMode(pSTC[M2], MCM_SPEED_MODE);
+              STC_SetSpeedSensor(pSTC[M2], &ENCODER_M2._Super);
+              FOC_Clear(M2);
+              R3_1_TurnOnLowSides(pwmcHandle[M2], M2_CHARGE_BOOT_CAP_DUTY_CYCLES);
+              TSK_SetStopPermanencyTimeM2(STOPPERMANENCY_TICKS2);
+              Mci[M2].State = WAIT_STOP_MOTOR;
+              /* USER CODE BEGIN MediumFrequencyTask M2 EndOfEncAlignment */
+
+              /* USER CODE END MediumFrequencyTask M2 EndOfEncAlignment */
+            }
+          }
+          break;
+        }
+
+        case RUN:
+        {
+          if (MCI_STOP == Mci[M2].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M2);
+          }
+          else
+          {
+            /* USER CODE BEGIN MediumFrequencyTask M2 2 */
+
+            /* USER CODE END MediumFrequencyTask M2 2 */
+
+            if (false == IsSpeedReliable)
+            {
+              TSK_FaultProcessing(M2, MC_SPEED_FDBK, 0);
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+            PWMC_DPWM_Update(pwmcHandle[M2], FOCVars[M2].Vqd);
+            TC_PositionRegulation(pPosCtrl[M2]);
+            MCI_ExecBufferedCommands(&Mci[M2]);
+            FOC_CalcCurrRef(M2);
+          }
+          break;
+        }
+
+        case STOP:
+        {
+          if (TSK_StopPermanencyTimeHasElapsedM2())
+          {
+            /* USER CODE BEGIN MediumFrequencyTask M2 5 */
+
+            /* USER CODE END MediumFrequencyTask M2 5 */
+            Mci[M2].DirectCommand = MCI_NO_COMMAND;
+            Mci[M2].State = IDLE;
+          }
+          else
+          {
+            /* Nothing to do, FW waits for to stop */
+          }
+          break;
+        }
+
+        case FAULT_OVER:
+        {
+          if (MCI_ACK_FAULTS == Mci[M2].DirectCommand)
+          {
+            Mci[M2].DirectCommand = MCI_NO_COMMAND;
+            Mci[M2].State = IDLE;
+          }
+          else
+          {
+            /* Nothing to do, FW stays in FAULT_OVER state until acknowledgement */
+          }
+          break;
+        }
+
+        case FAULT_NOW:
+        {
+          Mci[M2].State = FAULT_OVER;
+          break;
+        }
+
+        case WAIT_STOP_MOTOR:
+        {
+          if (MCI_STOP == Mci[M2].DirectCommand)
+          {
+            TSK_MF_StopProcessing(M2);
+          }
+          else
+          {
+            if (TSK_StopPermanencyTimeHasElapsedM2())
+            {
+              ENC_Clear(&ENCODER_M2);
+              R3_1_SwitchOnPWM(pwmcHandle[M2]);
+              TC_EncAlignmentCommand(pPosCtrl[M2]);
+              FOC_InitAdditionalMethods(M2);
+              STC_ForceSpeedReferenceToCurrentSpeed(pSTC[M2]); /* Init the reference speed to current speed */
+              MCI_ExecBufferedCommands(&Mci[M2]); /* Exec the speed ramp after changing of the speed sensor */
+              FOC_CalcCurrRef(M2);
+              MCI_StartupCompleted(&Mci[M2]);
+              Mci[M2].State = RUN;
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+          }
+          break;
+        }
+
+        default:
+          break;
+       }
+    }
+    else
+    {
+      Mci[M2].State = FAULT_OVER;
+    }
+  }
+  else
+  {
+    Mci[M2].State = FAULT_NOW;
+  }
+  /* Reports the state changes and the end of the position moves */
+  if (Mci[M2].State != LastEventStateM2)
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_STATE, M2, (uint8_t)Mci[M2].State, (uint16_t)LastEventStateM2);
+    LastEventStateM2 = Mci[M2].State;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  positionStatus = TC_GetControlPositionStatus(pPosCtrl[M2]);
+  if ((TC_TARGET_POSITION_REACHED == positionStatus) && (positionStatus != LastEventPositionStatusM2))
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_MOTION, M2, MCPE_MOTION_TARGET_REACHED, 0U);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  LastEventPositionStatusM2 = positionStatus;
+  /* USER CODE BEGIN MediumFrequencyTask M2 6 */
+
+  /* USER CODE END MediumFrequencyTask M2 6 */
+  MC_BG_Perf_Measure_Stop(&PerfTraces, MEASURE_TSK_MediumFrequencyTaskM2);
+}
+#endif
+
+/**
+  * @brief  Processes the faults of a motor and reports the faults that appeared or disappeared to the controller.
+  *
+  * May be called from the High Frequency Task, the Safety Task or the Hardware Fault Task.
+  *
+  * @param  bMotor Motor reference number defined
+  *         \link Motors_reference_number here \endlink
+  * @param  hSetErrors Bit field reporting faults currently present
+  * @param  hResetErrors Bit field reporting faults to be cleared
+  */
+static void TSK_FaultProcessing(uint8_t bMotor, uint16_t hSetErrors, uint16_t hResetErrors)
+{
+  uint16_t previousFaults = Mci[bMotor].CurrentFaults;
+  uint16_t changedFaults;
+
+  MCI_FaultProcessing(&Mci[bMotor], hSetErrors, hResetErrors);
+  changedFaults = Mci[bMotor].CurrentFaults ^ previousFaults;
+  if ((changedFaults & Mci[bMotor].CurrentFaults) != 0U)
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_FAULT, bMotor, MCPE_FAULT_SET, changedFaults & Mci[bMotor].CurrentFaults);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if ((changedFaults & previousFaults) != 0U)
+  {
+    (void)MCPE_Push(&MCPE_UART_A, MCPE_CLASS_FAULT, bMotor, MCPE_FAULT_CLEARED, changedFaults & previousFaults);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
 /**
   * @brief  It re-initializes the current and voltage variables. Moreover
   *         it clears qd currents PI controllers, voltage sensor and SpeednTorque
@@ -650,7 +1272,18 @@ __weak void FOC_Clear(uint8_t bMotor)
 
   STC_Clear(pSTC[bMotor]);
 
+  if (M1 == bMotor)
+  {
+    FW_Clear(&FW_M1);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
   PWMC_SwitchOffPWM(pwmcHandle[bMotor]);
+  /* The motor restarts with the continuous modulation */
+  PWMC_DPWM_ModeDisable(pwmcHandle[bMotor]);
 
   MC_Perf_Clear(&PerfTraces,bMotor);
   /* USER CODE BEGIN FOC_Clear 1 */
@@ -695,7 +1328,17 @@ __weak void FOC_CalcCurrRef(uint8_t bMotor)
   if (INTERNAL == FOCVars[bMotor].bDriveInput)
   {
     FOCVars[bMotor].hTeref = STC_CalcTorqueReference(pSTC[bMotor]);
-    FOCVars[bMotor].Iqdref.q = FOCVars[bMotor].hTeref;
+    if (M1 == bMotor)
+    {
+      qd_t IqdTmp;
+      IqdTmp.q = FOCVars[bMotor].hTeref;
+      IqdTmp.d = FOCVars[bMotor].UserIdref;
+      FOCVars[bMotor].Iqdref = FW_CalcCurrRef(&FW_M1, IqdTmp);
+    }
+    else
+    {
+      FOCVars[bMotor].Iqdref.q = FOCVars[bMotor].hTeref;
+    }
 
   }
   else
@@ -761,6 +1404,62 @@ __weak bool TSK_StopPermanencyTimeHasElapsedM1(void)
   return (retVal);
 }
 
+#if NBR_OF_MOTORS > 1
+/**
+  * @brief  It set a counter intended to be used for counting the delay required
+  *         for drivers boot capacitors charging of motor 2.
+  * @param  hTickCount number of ticks to be counted.
+  * @retval void
+  */
+__weak void TSK_SetChargeBootCapDelayM2(uint16_t hTickCount)
+{
+   hBootCapDelayCounterM2 = hTickCount;
+}
+
+/**
+  * @brief  Use this function to know whether the time required to charge boot
+  *         capacitors of motor 2 has elapsed.
+  * @param  none
+  * @retval bool true if time has elapsed, false otherwise.
+  */
+__weak bool TSK_ChargeBootCapDelayHasElapsedM2(void)
+{
+  bool retVal = false;
+  if (((uint16_t)0) == hBootCapDelayCounterM2)
+  {
+    retVal = true;
+  }
+  return (retVal);
+}
+
+/**
+  * @brief  It set a counter intended to be used for counting the permanency
+  *         time in STOP state of motor 2.
+  * @param  hTickCount number of ticks to be counted.
+  * @retval void
+  */
+__weak void TSK_SetStopPermanencyTimeM2(uint16_t hTickCount)
+{
+  hStopPermanencyCounterM2 = hTickCount;
+}
+
+/**
+  * @brief  Use this function to know whether the permanency time in STOP state
+  *         of motor 2 has elapsed.
+  * @param  none
+  * @retval bool true if time is elapsed, false otherwise.
+  */
+__weak bool TSK_StopPermanencyTimeHasElapsedM2(void)
+{
+  bool retVal = false;
+  if (((uint16_t)0) == hStopPermanencyCounterM2)
+  {
+    retVal = true;
+  }
+  return (retVal);
+}
+#endif
+
 #if defined (CCMRAM)
 #if defined (__ICCARM__)
 #pragma location = ".ccmram"
@@ -789,7 +1488,11 @@ __weak uint8_t TSK_HighFrequencyTask(void)
   //     HALL_M1.rawAdcValues[0] = LL_ADC_REG_ReadConversionData12(ADC2);
   //     HALL_M1.rawAdcValues[1]=LL_ADC_REG_ReadConversionData12(ADC2);
   //     HALL_M1.rawAdcValues[2] = LL_ADC_REG_ReadConversionData12(ADC2);
+#ifdef M1_ENCODER_FUSION
+      (void)FUS_CalcAngle(&FusedSensorM1);
+#else
       (void)HALL_CalcAngle(&HALL_M1);
+#endif
   // }
 
   //(void)HALL_CalcAngle(&HALL_M1);
@@ -800,7 +1503,7 @@ __weak uint8_t TSK_HighFrequencyTask(void)
   /* USER CODE END HighFrequencyTask SINGLEDRIVE_2 */
   if(hFOCreturn == MC_DURATION)
   {
-    MCI_FaultProcessing(&Mci[M1], MC_DURATION, 0);
+    TSK_FaultProcessing(M1, MC_DURATION, 0);
   }
   else
   {
@@ -808,7 +1511,25 @@ __weak uint8_t TSK_HighFrequencyTask(void)
 
     /* USER CODE END HighFrequencyTask SINGLEDRIVE_3 */
   }
-  DAC_Exec(&DAC_Handle);
+  if (CPR_CheckCurrent(&CurrentProtM1, FOCVars[M1].Iqd) != MC_NO_ERROR)
+  {
+    /* Same action as the break input, the Safety Task completes the switch off */
+    LL_TIM_DisableAllOutputs(PWM_Handle_M1.pParams_str->TIMx);
+    TSK_FaultProcessing(M1, MC_OVER_CURR, 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if (DAC_Handle.mode != DAC_MODE_OFF)
+  {
+    DAC_Exec(&DAC_Handle);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  HFC_Exec(&HFCaptureM1);
   /* USER CODE BEGIN HighFrequencyTask 1 */
 
   /* USER CODE END HighFrequencyTask 1 */
@@ -857,12 +1578,37 @@ inline uint16_t FOC_CurrControllerM1(void)
   PWMC_GetPhaseCurrents(pwmcHandle[M1], &Iab);
   Ialphabeta = MCM_Clarke(Iab);
   Iqd = MCM_Park(Ialphabeta, hElAngle);
-  Vqd.q = PI_Controller(pPIDIq[M1], (int32_t)(FOCVars[M1].Iqdref.q) - Iqd.q);
-  Vqd.d = PI_Controller(pPIDId[M1], (int32_t)(FOCVars[M1].Iqdref.d) - Iqd.d);
-  Vqd = Circle_Limitation(&CircleLimitationM1, Vqd);
-  hElAngle += SPD_GetInstElSpeedDpp(speedHandle)*REV_PARK_ANGLE_COMPENSATION_FACTOR;
-  Valphabeta = MCM_Rev_Park(Vqd, hElAngle);
+  if (MID_IsInjecting(&MotorIdentM1))
+  {
+    /* The identification applies its test voltages on the alpha axis, the current regulators are bypassed */
+    Valphabeta = MID_CalcVoltage(&MotorIdentM1, Ialphabeta);
+    Vqd = MCM_Park(Valphabeta, hElAngle);
+  }
+  else
+  {
+    int32_t wIqRef = (int32_t)(FOCVars[M1].Iqdref.q);
+    if (FRA_LOOP_CURRENT == FRA_GetLoop(&FreqRespM1))
+    {
+      wIqRef += FRA_Exec(&FreqRespM1, wIqRef, Iqd.q);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    Vqd.q = PI_Controller(pPIDIq[M1], wIqRef - Iqd.q);
+    Vqd.d = PI_Controller(pPIDId[M1], (int32_t)(FOCVars[M1].Iqdref.d) - Iqd.d);
+    Vqd = Circle_Limitation(&CircleLimitationM1, Vqd);
+    FW_DataProcess(&FW_M1, Vqd);
+    hElAngle += SPD_GetInstElSpeedDpp(speedHandle)*REV_PARK_ANGLE_COMPENSATION_FACTOR;
+    Valphabeta = MCM_Rev_Park(Vqd, hElAngle);
+  }
+#ifdef M1_OVERMODULATION
+  hCodeError = PWMC_SetPhaseVoltage_OVM(pwmcHandle[M1], Valphabeta);
+  /* Used by the next current reading when a low-side pulse is too short to be sampled */
+  PWMC_CalcPhaseCurrentsEst(pwmcHandle[M1], Iqd, hElAngle);
+#else
   hCodeError = PWMC_SetPhaseVoltage(pwmcHandle[M1], Valphabeta);
+#endif
 
   FOCVars[M1].Vqd = Vqd;
   FOCVars[M1].Iab = Iab;
@@ -874,6 +1620,98 @@ inline uint16_t FOC_CurrControllerM1(void)
   return (hCodeError);
 }
 
+#if NBR_OF_MOTORS > 1
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief  Executes the FOC current control loop of motor 2.
+  *
+  * Called on the end of the ADC2 injected conversions, triggered by TIM8 half a PWM period after those of
+  * motor 1.
+  *
+  * @retval Number of the  motor instance which FOC loop was executed.
+  */
+__weak uint8_t TSK_HighFrequencyTaskM2(void)
+{
+  uint16_t hFOCreturn;
+  MC_Perf_Measure_Start(&PerfTraces, MEASURE_TSK_HighFrequencyTaskM2);
+
+  (void)ENC_CalcAngle(&ENCODER_M2);
+  hFOCreturn = FOC_CurrControllerM2();
+  /* USER CODE BEGIN HighFrequencyTask DUALDRIVE_2 */
+
+  /* USER CODE END HighFrequencyTask DUALDRIVE_2 */
+  if(hFOCreturn == MC_DURATION)
+  {
+    TSK_FaultProcessing(M2, MC_DURATION, 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  if (CPR_CheckCurrent(&CurrentProtM2, FOCVars[M2].Iqd) != MC_NO_ERROR)
+  {
+    /* Same action as the break input, the Safety Task completes the switch off */
+    LL_TIM_DisableAllOutputs(PWM_Handle_M2.pParams_str->TIMx);
+    TSK_FaultProcessing(M2, MC_OVER_CURR, 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  MC_Perf_Measure_Stop(&PerfTraces, MEASURE_TSK_HighFrequencyTaskM2);
+  return ((uint8_t)M2);
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__((section (".ccmram")))
+#endif
+#endif
+/**
+  * @brief It executes the core of FOC drive of motor 2, see FOC_CurrControllerM1().
+  * @retval int16_t It returns MC_NO_FAULTS if the FOC has been ended before
+  *         next PWM Update event, MC_DURATION otherwise
+  */
+inline uint16_t FOC_CurrControllerM2(void)
+{
+  qd_t Iqd, Vqd;
+  ab_t Iab;
+  alphabeta_t Ialphabeta, Valphabeta;
+  int16_t hElAngle;
+  uint16_t hCodeError;
+  SpeednPosFdbk_Handle_t *speedHandle;
+  speedHandle = STC_GetSpeedSensor(pSTC[M2]);
+  hElAngle = SPD_GetElAngle(speedHandle);
+  PWMC_GetPhaseCurrents(pwmcHandle[M2], &Iab);
+  Ialphabeta = MCM_Clarke(Iab);
+  Iqd = MCM_Park(Ialphabeta, hElAngle);
+  Vqd.q = PI_Controller(pPIDIq[M2], (int32_t)(FOCVars[M2].Iqdref.q) - Iqd.q);
+  Vqd.d = PI_Controller(pPIDId[M2], (int32_t)(FOCVars[M2].Iqdref.d) - Iqd.d);
+  Vqd = Circle_Limitation(&CircleLimitationM2, Vqd);
+  hElAngle += SPD_GetInstElSpeedDpp(speedHandle)*REV_PARK_ANGLE_COMPENSATION_FACTOR2;
+  Valphabeta = MCM_Rev_Park(Vqd, hElAngle);
+  hCodeError = PWMC_SetPhaseVoltage(pwmcHandle[M2], Valphabeta);
+
+  FOCVars[M2].Vqd = Vqd;
+  FOCVars[M2].Iab = Iab;
+  FOCVars[M2].Ialphabeta = Ialphabeta;
+  FOCVars[M2].Iqd = Iqd;
+  FOCVars[M2].Valphabeta = Valphabeta;
+  FOCVars[M2].hElAngle = hElAngle;
+
+  return (hCodeError);
+}
+#endif
+
 /**
   * @brief  Executes safety checks (e.g. bus voltage and temperature) for all drive instances.
   *
@@ -887,6 +1725,9 @@ __weak void TSK_SafetyTask(void)
   if (1U == bMCBootCompleted)
   {
     TSK_SafetyTask_PWMOFF(M1);
+#if NBR_OF_MOTORS > 1
+    TSK_SafetyTask_PWMOFF(M2);
+#endif
     /* User conversion execution */
     RCM_ExecUserConv();
   /* USER CODE BEGIN TSK_SafetyTask 1 */
@@ -910,7 +1751,12 @@ __weak void TSK_SafetyTask_PWMOFF(uint8_t bMotor)
 
   /* USER CODE END TSK_SafetyTask_PWMOFF 0 */
   uint16_t CodeReturn = MC_NO_ERROR;
+#if NBR_OF_MOTORS > 1
+  /* The zoom motor has no temperature sensor */
+  const uint16_t errMask[NBR_OF_MOTORS] = {VBUS_TEMP_ERR_MASK, (MC_OVER_VOLT | MC_UNDER_VOLT)};
+#else
   const uint16_t errMask[NBR_OF_MOTORS] = {VBUS_TEMP_ERR_MASK};
+#endif
   /* Check for fault if FW protection is activated. It returns MC_OVER_TEMP or MC_NO_ERROR */
   if (M1 == bMotor)
   {
@@ -932,15 +1778,30 @@ __weak void TSK_SafetyTask_PWMOFF(uint8_t bMotor)
   {
     /* Nothing to do */
   }
-  MCI_FaultProcessing(&Mci[bMotor], CodeReturn, ~CodeReturn); /* Process faults */
+#if NBR_OF_MOTORS > 1
+  if (M2 == bMotor)
+  {
+    /* The bus is shared, the voltage faults measured by motor 1 also stop motor 2 */
+    CodeReturn |= errMask[bMotor] & Mci[M1].CurrentFaults;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+#endif
+  TSK_FaultProcessing(bMotor, CodeReturn, ~CodeReturn); /* Process faults */
 
   if (MCI_GetFaultState(&Mci[bMotor]) != (uint32_t)MC_NO_FAULTS)
   {
     /* Reset Encoder state */
-    // if (pEAC[bMotor] != MC_NULL)
-    // {
-    //   EAC_SetRestartState(pEAC[bMotor], false);
-    // }
+    if (pEAC[bMotor] != MC_NULL)
+    {
+      EAC_SetRestartState(pEAC[bMotor], false);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
         //Reset Hall state
     if(pHAC[bMotor] != MC_NULL)
     {
@@ -951,9 +1812,17 @@ __weak void TSK_SafetyTask_PWMOFF(uint8_t bMotor)
       /* Nothing to do */
     }
     PWMC_SwitchOffPWM(pwmcHandle[bMotor]);
-    if (MCPA_UART_A.Mark != 0U)
+    if (M1 == bMotor)
     {
-      MCPA_flushDataLog (&MCPA_UART_A);
+      HFC_FaultTrigger(&HFCaptureM1);
+      if (MCPA_UART_A.Mark != 0U)
+      {
+        MCPA_flushDataLog (&MCPA_UART_A);
+      }
+      else
+      {
+        /* Nothing to do */
+      }
     }
     else
     {
@@ -961,6 +1830,18 @@ __weak void TSK_SafetyTask_PWMOFF(uint8_t bMotor)
     }
     FOC_Clear(bMotor);
     PQD_Clear(pMPM[bMotor]); //cstat !MISRAC2012-Rule-11.3
+    if (M1 == bMotor)
+    {
+      SPS_Clear(&SetpointStreamM1);
+      BLC_StopLearning(&BacklashCompM1);
+      BLC_Clear(&BacklashCompM1);
+      MID_Stop(&MotorIdentM1);
+      FRA_Stop(&FreqRespM1);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
     /* USER CODE BEGIN TSK_SafetyTask_PWMOFF 1 */
 
     /* USER CODE END TSK_SafetyTask_PWMOFF 1 */
@@ -1009,7 +1890,11 @@ __weak void TSK_HardwareFaultTask(void)
 
   /* USER CODE END TSK_HardwareFaultTask 0 */
   R3_1_SwitchOffPWM(pwmcHandle[M1]);
-  MCI_FaultProcessing(&Mci[M1], MC_SW_ERROR, 0);
+  TSK_FaultProcessing(M1, MC_SW_ERROR, 0);
+#if NBR_OF_MOTORS > 1
+  R3_1_SwitchOffPWM(pwmcHandle[M2]);
+  TSK_FaultProcessing(M2, MC_SW_ERROR, 0);
+#endif
 
   /* USER CODE BEGIN TSK_HardwareFaultTask 1 */
 
@@ -1078,6 +1963,20 @@ LL_GPIO_LockPin(M1_CURR_AMPL_V_GPIO_Port, M1_CURR_AMPL_V_Pin);
 LL_GPIO_LockPin(M1_BUS_VOLTAGE_GPIO_Port, M1_BUS_VOLTAGE_Pin);
 LL_GPIO_LockPin(M1_CURR_AMPL_U_GPIO_Port, M1_CURR_AMPL_U_Pin);
 LL_GPIO_LockPin(M1_TEMPERATURE_GPIO_Port, M1_TEMPERATURE_Pin);
+#if NBR_OF_MOTORS > 1
+LL_GPIO_LockPin(M2_PWM_UH_GPIO_Port, M2_PWM_UH_Pin);
+LL_GPIO_LockPin(M2_PWM_VH_GPIO_Port, M2_PWM_VH_Pin);
+LL_GPIO_LockPin(M2_PWM_WH_GPIO_Port, M2_PWM_WH_Pin);
+LL_GPIO_LockPin(M2_DP_GPIO_Port, M2_DP_Pin);
+LL_GPIO_LockPin(M2_PWM_EN_U_GPIO_Port, M2_PWM_EN_U_Pin);
+LL_GPIO_LockPin(M2_PWM_EN_V_GPIO_Port, M2_PWM_EN_V_Pin);
+LL_GPIO_LockPin(M2_PWM_EN_W_GPIO_Port, M2_PWM_EN_W_Pin);
+LL_GPIO_LockPin(M2_CURR_AMPL_U_GPIO_Port, M2_CURR_AMPL_U_Pin);
+LL_GPIO_LockPin(M2_CURR_AMPL_V_GPIO_Port, M2_CURR_AMPL_V_Pin);
+LL_GPIO_LockPin(M2_CURR_AMPL_W_GPIO_Port, M2_CURR_AMPL_W_Pin);
+LL_GPIO_LockPin(M2_ENCODER_A_GPIO_Port, M2_ENCODER_A_Pin);
+LL_GPIO_LockPin(M2_ENCODER_B_GPIO_Port, M2_ENCODER_B_Pin);
+#endif
 }
 /* USER CODE BEGIN mc_task 0 */
 
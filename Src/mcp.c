@@ -26,6 +26,16 @@
 #include "mc_config.h"
 #include "mcp_config.h"
 #include "mc_api.h"
+#include "string.h"
+
+/* Register accessors, indexed by the motor number of the data ID (0 for the Global registers) */
+#if NBR_OF_MOTORS > 1
+#define MCP_SET_REG_FCTS {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1, &RI_SetRegisterMotor2}
+#define MCP_GET_REG_FCTS {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1, &RI_GetRegisterMotor2}
+#else
+#define MCP_SET_REG_FCTS {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1}
+#define MCP_GET_REG_FCTS {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1}
+#endif
 
 /** @addtogroup MCSDK
   * @{
@@ -72,7 +82,7 @@ uint8_t RI_SetRegCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace
     uint16_t regID;
     uint8_t typeID;
     uint8_t motorID;
-    uint8_t (*SetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1};
+    uint8_t (*SetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = MCP_SET_REG_FCTS;
     uint8_t number_of_item =0;
     pHandle->txLength = 0;
 
@@ -175,7 +185,7 @@ uint8_t RI_GetRegCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace
     uint16_t regID;
     uint8_t typeID;
     uint8_t motorID;
-    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1};
+    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = MCP_GET_REG_FCTS;
     pHandle->txLength = 0;
     while (rxLength > 0U)
     {
@@ -215,6 +225,248 @@ uint8_t RI_GetRegCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace
   return (retVal);
 }
 
+/**
+  * @brief  Defines a register group from the list of register IDs in the received packet.
+  *
+  * Payload: group number (u8) followed by the IDs (u16) of the registers. Each ID is decoded once, checked with a
+  * read access, and its value pointer is cached when the register can be read directly (see RI_GetDirectPtr).
+  * Only 8, 16 and 32 bits registers can be grouped. An empty list undefines the group.
+  *
+  * @param  pHandle Handler of the current instance of the MCP component
+  *
+  * @retval Returns #MCP_CMD_OK if the group is defined, an error code otherwise.
+  */
+uint8_t RI_DefineGroupCommandParser (MCP_Handle_t * pHandle)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_REG_INT
+  if (MC_NULL == pHandle)
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    uint8_t * rxData = pHandle->rxBuffer;
+    uint16_t rxLength = pHandle->rxLength;
+    uint8_t probe[4]; /* Value read to check that the register exists */
+    uint16_t probeSize;
+    uint16_t dataElementID;
+    MCP_RegGroup_t *pGroup;
+    MCP_RegGroupItem_t *pItem;
+    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = MCP_GET_REG_FCTS;
+    pHandle->txLength = 0;
+
+    if ((0U == rxLength) || (rxData[0] >= MCP_REG_GROUP_MAX))
+    {
+      retVal = MCP_CMD_NOK;
+    }
+    else
+    {
+      pGroup = &MCP_RegGroup[rxData[0]];
+      rxData++;
+      rxLength--;
+      pGroup->nbrOfItems = 0U;
+      pGroup->size = 0U;
+
+      if (((rxLength % MCP_ID_SIZE) != 0U) || ((rxLength / MCP_ID_SIZE) > pGroup->maxItems))
+      {
+        retVal = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else
+      {
+        while ((rxLength > 0U) && (MCP_CMD_OK == retVal))
+        {
+          (void)memcpy(&dataElementID, rxData, MCP_ID_SIZE);
+          rxLength = rxLength - MCP_ID_SIZE;
+          rxData = rxData + MCP_ID_SIZE;
+
+          pItem = &pGroup->pItems[pGroup->nbrOfItems];
+          pItem->regID = dataElementID & REG_MASK;
+          pItem->typeID = (uint8_t)dataElementID & TYPE_MASK;
+          pItem->motorID = (uint8_t)(dataElementID & MOTOR_MASK);
+          pItem->size = RI_GetIDSize(dataElementID);
+
+          if (pItem->motorID > NBR_OF_MOTORS)
+          {
+            retVal = MCP_CMD_NOK;
+          }
+          else if (0U == pItem->size)
+          {
+            retVal = MCP_ERROR_BAD_DATA_TYPE;
+          }
+          else
+          {
+            retVal = GetRegFcts[pItem->motorID](pItem->regID, pItem->typeID, probe, &probeSize, (int16_t)sizeof(probe));
+            if (MCP_CMD_OK == retVal)
+            {
+              /* Registers that are a plain variable are read without going through the getter */
+              (void)RI_GetDirectPtr(pItem->motorID, pItem->regID, &pItem->dataPtr);
+              pGroup->size = pGroup->size + pItem->size;
+              pGroup->nbrOfItems++;
+            }
+            else
+            {
+              /* Nothing to do */
+            }
+          }
+        }
+      }
+
+      if (retVal != MCP_CMD_OK)
+      {
+        pGroup->nbrOfItems = 0U;
+        pGroup->size = 0U;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+#ifdef NULL_PTR_CHECK_REG_INT
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Reads all the registers of a group.
+  *
+  * Payload: group number (u8). The values are sent back packed, in the order of the group definition.
+  *
+  * @param  pHandle Handler of the current instance of the MCP component
+  * @param  txSyncFreeSpace Space available for synchronous transmission
+  *
+  * @retval Returns #MCP_CMD_OK if the command is acknowledged, an error code otherwise.
+  */
+uint8_t RI_GetGroupCommandParser (MCP_Handle_t * pHandle, uint16_t txSyncFreeSpace)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_REG_INT
+  if (MC_NULL == pHandle)
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    uint8_t * txData = pHandle->txBuffer;
+    uint16_t size;
+    uint8_t i;
+    const MCP_RegGroup_t *pGroup;
+    const MCP_RegGroupItem_t *pItem;
+    uint8_t (*GetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = MCP_GET_REG_FCTS;
+    pHandle->txLength = 0;
+
+    if ((pHandle->rxLength != 1U) || (pHandle->rxBuffer[0] >= MCP_REG_GROUP_MAX))
+    {
+      retVal = MCP_CMD_NOK;
+    }
+    else
+    {
+      pGroup = &MCP_RegGroup[pHandle->rxBuffer[0]];
+      if (0U == pGroup->nbrOfItems)
+      {
+        retVal = MCP_CMD_NOK;
+      }
+      else if (pGroup->size > txSyncFreeSpace)
+      {
+        retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+      }
+      else
+      {
+        for (i = 0U; (i < pGroup->nbrOfItems) && (MCP_CMD_OK == retVal); i++)
+        {
+          pItem = &pGroup->pItems[i];
+          if (pItem->dataPtr != NULL)
+          {
+            (void)memcpy(txData, pItem->dataPtr, pItem->size);
+          }
+          else
+          {
+            retVal = GetRegFcts[pItem->motorID](pItem->regID, pItem->typeID, txData, &size,
+                                                (int16_t)(txSyncFreeSpace - pHandle->txLength));
+          }
+          txData = txData + pItem->size;
+          pHandle->txLength += pItem->size;
+        }
+        if (retVal != MCP_CMD_OK)
+        {
+          pHandle->txLength = 0;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+#ifdef NULL_PTR_CHECK_REG_INT
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Writes all the registers of a group.
+  *
+  * Payload: group number (u8) followed by the packed values, in the order of the group definition. The registers
+  * are written in order, writing stops at the first register refusing the access.
+  *
+  * @param  pHandle Handler of the current instance of the MCP component
+  *
+  * @retval Returns #MCP_CMD_OK if all the registers are written, the first error code otherwise.
+  */
+uint8_t RI_SetGroupCommandParser (MCP_Handle_t * pHandle)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_REG_INT
+  if (MC_NULL == pHandle)
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    uint8_t * rxData = pHandle->rxBuffer;
+    uint16_t size;
+    uint8_t i;
+    const MCP_RegGroup_t *pGroup;
+    const MCP_RegGroupItem_t *pItem;
+    uint8_t (*SetRegFcts[NBR_OF_MOTORS+1])(uint16_t, uint8_t, uint8_t*, uint16_t*, int16_t) = MCP_SET_REG_FCTS;
+    pHandle->txLength = 0;
+
+    if ((0U == pHandle->rxLength) || (rxData[0] >= MCP_REG_GROUP_MAX))
+    {
+      retVal = MCP_CMD_NOK;
+    }
+    else
+    {
+      pGroup = &MCP_RegGroup[rxData[0]];
+      rxData++;
+      if (0U == pGroup->nbrOfItems)
+      {
+        retVal = MCP_CMD_NOK;
+      }
+      else if (pHandle->rxLength != (pGroup->size + 1U))
+      {
+        retVal = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else
+      {
+        for (i = 0U; (i < pGroup->nbrOfItems) && (MCP_CMD_OK == retVal); i++)
+        {
+          pItem = &pGroup->pItems[i];
+          retVal = SetRegFcts[pItem->motorID](pItem->regID, pItem->typeID, rxData, &size, (int16_t)pItem->size);
+          rxData = rxData + pItem->size;
+        }
+      }
+    }
+#ifdef NULL_PTR_CHECK_REG_INT
+  }
+#endif
+  return (retVal);
+}
+
 /**
   * @brief  Parses the header from the received packet and call the required function depending on the command sent by the controller device.
   *
@@ -251,7 +503,7 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
     }
 
     motorID = (uint8_t)((*packetHeader - 1U) & MOTOR_MASK);
-    MCI_Handle_t *pMCI = &Mci[motorID];
+    MCI_Handle_t *pMCI = (motorID < (uint8_t)NBR_OF_MOTORS) ? &Mci[motorID] : MC_NULL;
 
     /* Removing MCP Header from RxBuffer */
     pHandle->rxLength = pHandle->rxLength - MCP_HEADER_SIZE;
@@ -265,127 +517,153 @@ void MCP_ReceivedPacket(MCP_Handle_t *pHandle)
      * (case of Read register) */
     pHandle->txLength = 0U;
 
-    switch (command)
+    if ((MC_NULL == pMCI) && (command >= START_MOTOR) && (command <= IQDREF_CLEAR))
     {
-      case GET_MCP_VERSION:
-      {
-        pHandle->txLength = 4U;
-        *pHandle->txBuffer = MCP_VERSION;
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
-
-      case SET_DATA_ELEMENT:
-      {
-        MCPResponse = RI_SetRegCommandParser(pHandle, (uint16_t)txSyncFreeSpace);
-        break;
-      }
-
-      case GET_DATA_ELEMENT:
-      {
-        MCPResponse = RI_GetRegCommandParser(pHandle, (uint16_t)txSyncFreeSpace);
-        break;
-      }
-
-      case START_MOTOR:
+      /* Motor command addressed to a motor that is not driven */
+      MCPResponse = MCP_CMD_NOK;
+    }
+    else
+    {
+      switch (command)
       {
-        MCPResponse = (MCI_StartWithPolarizationMotor(pMCI) == false) ? MCP_CMD_OK : MCP_CMD_NOK;
+        case GET_MCP_VERSION:
+        {
+          pHandle->txLength = 4U;
+          *pHandle->txBuffer = MCP_VERSION;
+          MCPResponse = MCP_CMD_OK;
+          break;
+        }
 
-        break;
-      }
+        case SET_DATA_ELEMENT:
+        {
+          MCPResponse = RI_SetRegCommandParser(pHandle, (uint16_t)txSyncFreeSpace);
+          break;
+        }
 
-      case STOP_MOTOR: /* Todo: Check the pertinance of return value */
-      {
-        (void)MCI_StopMotor(pMCI);
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
+        case GET_DATA_ELEMENT:
+        {
+          MCPResponse = RI_GetRegCommandParser(pHandle, (uint16_t)txSyncFreeSpace);
+          break;
+        }
 
-      case STOP_RAMP:
-      {
-        if (RUN == MCI_GetSTMState(pMCI))
+        case REG_GROUP_DEFINE:
         {
-          MCI_StopRamp(pMCI);
+          MCPResponse = RI_DefineGroupCommandParser(pHandle);
+          break;
         }
-        else
+
+        case REG_GROUP_GET:
         {
-          /* Nothing to do */
+          MCPResponse = RI_GetGroupCommandParser(pHandle, (uint16_t)txSyncFreeSpace);
+          break;
         }
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
 
-      case START_STOP:
-      {
-        /* Queries the STM and a command start or stop depending on the state */
-        if (IDLE == MCI_GetSTMState(pMCI))
+        case REG_GROUP_SET:
         {
+          MCPResponse = RI_SetGroupCommandParser(pHandle);
+          break;
+        }
 
-          MCPResponse = (MCI_StartWithPolarizationMotor(pMCI) == true) ? MCP_CMD_OK : MCP_CMD_NOK;
+        case START_MOTOR:
+        {
+          MCPResponse = (MCI_StartWithPolarizationMotor(pMCI) == false) ? MCP_CMD_OK : MCP_CMD_NOK;
 
+          break;
         }
-        else
+
+        case STOP_MOTOR: /* Todo: Check the pertinance of return value */
         {
           (void)MCI_StopMotor(pMCI);
           MCPResponse = MCP_CMD_OK;
+          break;
         }
-        break;
-      }
 
-      case FAULT_ACK:
-      {
-        (void)MCI_FaultAcknowledged(pMCI);
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
+        case STOP_RAMP:
+        {
+          if (RUN == MCI_GetSTMState(pMCI))
+          {
+            MCI_StopRamp(pMCI);
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          MCPResponse = MCP_CMD_OK;
+          break;
+        }
 
-      case CPULOAD_CLEAR:
-      {
-        MCI_Clear_PerfMeasure(pMCI,M1);
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
+        case START_STOP:
+        {
+          /* Queries the STM and a command start or stop depending on the state */
+          if (IDLE == MCI_GetSTMState(pMCI))
+          {
 
-      case IQDREF_CLEAR:
-      {
-        MCI_Clear_Iqdref(pMCI);
-        MCPResponse = MCP_CMD_OK;
-        break;
-      }
+            MCPResponse = (MCI_StartWithPolarizationMotor(pMCI) == true) ? MCP_CMD_OK : MCP_CMD_NOK;
 
-      case PFC_ENABLE:
-      case PFC_DISABLE:
-      case PFC_FAULT_ACK:
-      {
-        MCPResponse = MCP_CMD_UNKNOWN;
-        break;
-      }
+          }
+          else
+          {
+            (void)MCI_StopMotor(pMCI);
+            MCPResponse = MCP_CMD_OK;
+          }
+          break;
+        }
 
-      case PROFILER_CMD:
-      {
-        MCPResponse = MC_ProfilerCommand(pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace, &pHandle->txLength,
-                                         pHandle->txBuffer);
-        break;
-      }
+        case FAULT_ACK:
+        {
+          (void)MCI_FaultAcknowledged(pMCI);
+          MCPResponse = MCP_CMD_OK;
+          break;
+        }
 
-      case MCP_USER_CMD:
-      {
-        if ((userCommand < MCP_USER_CALLBACK_MAX) && (MCP_UserCallBack[userCommand] != NULL))
+        case CPULOAD_CLEAR:
         {
-          MCPResponse = MCP_UserCallBack[userCommand](pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace,
-                                                      &pHandle->txLength, pHandle->txBuffer);
+          MCI_Clear_PerfMeasure(pMCI, motorID);
+          MCPResponse = MCP_CMD_OK;
+          break;
         }
-        else
+
+        case IQDREF_CLEAR:
         {
-          MCPResponse = MCP_ERROR_CALLBACK_NOT_REGISTRED;
+          MCI_Clear_Iqdref(pMCI);
+          MCPResponse = MCP_CMD_OK;
+          break;
         }
-        break;
-      }
 
-      default :
-      {
-        MCPResponse = MCP_CMD_UNKNOWN;
-        break;
+        case PFC_ENABLE:
+        case PFC_DISABLE:
+        case PFC_FAULT_ACK:
+        {
+          MCPResponse = MCP_CMD_UNKNOWN;
+          break;
+        }
+
+        case PROFILER_CMD:
+        {
+          MCPResponse = MC_ProfilerCommand(pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace, &pHandle->txLength,
+                                           pHandle->txBuffer);
+          break;
+        }
+
+        case MCP_USER_CMD:
+        {
+          if ((userCommand < MCP_USER_CALLBACK_MAX) && (MCP_UserCallBack[userCommand] != NULL))
+          {
+            MCPResponse = MCP_UserCallBack[userCommand](pHandle->rxLength, pHandle->rxBuffer, txSyncFreeSpace,
+                                                        &pHandle->txLength, pHandle->txBuffer);
+          }
+          else
+          {
+            MCPResponse = MCP_ERROR_CALLBACK_NOT_REGISTRED;
+          }
+          break;
+        }
+
+        default :
+        {
+          MCPResponse = MCP_CMD_UNKNOWN;
+          break;
+        }
       }
     }
     pHandle->txBuffer[pHandle->txLength] = MCPResponse;
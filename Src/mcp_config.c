@@ -24,23 +24,50 @@
 #include "aspep.h"
 #include "mcp.h"
 #include "mcpa.h"
+#include "mcp_events.h"
 #include "mcp_config.h"
 
 static uint8_t MCPSyncTxBuff[MCP_TX_SYNCBUFFER_SIZE] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+#ifdef ASPEP_RX_RING_SIZE
+/* Reception ring, followed by room to make a wrapped payload contiguous */
+static uint8_t MCPRxRing[ASPEP_RX_RING_SIZE + MCP_RX_SYNCBUFFER_SIZE] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+#else
 static uint8_t MCPSyncRXBuff[MCP_RX_SYNCBUFFER_SIZE] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+#endif
 
-/* Asynchronous buffer dedicated to UART_A */
-static uint8_t MCPAsyncBuffUARTA_A[MCP_TX_ASYNCBUFFER_SIZE_A] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
-static uint8_t MCPAsyncBuffUARTA_B[MCP_TX_ASYNCBUFFER_SIZE_A] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+/* Pool of asynchronous buffers dedicated to UART_A, and its transmit queue */
+static uint8_t MCPAsyncBuffUARTA[MCP_TX_ASYNC_POOL_DEPTH_A * MCP_TX_ASYNCBUFFER_STRIDE_A] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+static MCTL_Buff_t MCPAsyncPoolUARTA[MCP_TX_ASYNC_POOL_DEPTH_A];
+static uint8_t MCPAsyncQueueUARTA[MCP_TX_ASYNC_POOL_DEPTH_A];
+
+/* Event buffer and event ring dedicated to UART_A */
+static uint8_t MCPEventBuffUARTA[MCP_TX_EVENTBUFFER_SIZE_A] __attribute__((aligned(4))); //cstat !MISRAC2012-Rule-1.4_a
+static MCPE_Event_t MCPEventQueueA[MCPE_QUEUE_SIZE_A];
+static volatile uint8_t MCPEventValidA[MCPE_QUEUE_SIZE_A];
+/* MCPE indexes the ring with free running counters masked by MCPE_QUEUE_SIZE_A - 1 */
+_Static_assert((MCPE_QUEUE_SIZE_A != 0U) && (0U == (MCPE_QUEUE_SIZE_A & (MCPE_QUEUE_SIZE_A - 1U))),
+               "MCPE_QUEUE_SIZE_A must be a power of 2");
 
 /* Buffer dedicated to store pointer of data to be streamed over UART_A */
 static void *dataPtrTableA[MCPA_OVER_UARTA_STREAM];
 static void *dataPtrTableBuffA[MCPA_OVER_UARTA_STREAM];
 static uint8_t dataSizeTableA[MCPA_OVER_UARTA_STREAM];
 static uint8_t dataSizeTableBuffA[MCPA_OVER_UARTA_STREAM]; /* buffered version of dataSizeTableA */
+static uint16_t lastValueTableA[MCPA_OVER_UARTA_STREAM]; /* previous HF samples, for the delta encoding */
+static MCPA_Packing_t packingTableA[MCPA_OVER_UARTA_STREAM]; /* predictions of the HF samples, for the bit packing */
 
 MCP_user_cb_t MCP_UserCallBack[MCP_USER_CALLBACK_MAX];
 
+/* Register groups, defined by the controller with REG_GROUP_DEFINE */
+static MCP_RegGroupItem_t MCPRegGroupItems[MCP_REG_GROUP_MAX][MCP_REG_GROUP_ITEMS_MAX];
+MCP_RegGroup_t MCP_RegGroup[MCP_REG_GROUP_MAX] =
+{
+  { .pItems = MCPRegGroupItems[0], .maxItems = MCP_REG_GROUP_ITEMS_MAX },
+  { .pItems = MCPRegGroupItems[1], .maxItems = MCP_REG_GROUP_ITEMS_MAX },
+  { .pItems = MCPRegGroupItems[2], .maxItems = MCP_REG_GROUP_ITEMS_MAX },
+  { .pItems = MCPRegGroupItems[3], .maxItems = MCP_REG_GROUP_ITEMS_MAX },
+};
+
 /** @addtogroup MCSDK
   * @{
   */
@@ -69,7 +96,7 @@ ASPEP_Handle_t aspepOverUartA =
   .HWIp = &UASPEP_A,
   .Capabilities =
   {
-    .DATA_CRC = 0U,
+    .DATA_CRC = 1U, /* Downgraded to 0 when the controller does not support it */
     .RX_maxSize =  (MCP_RX_SYNC_PAYLOAD_MAX >> 5U) - 1U,
     .TXS_maxSize = (MCP_TX_SYNC_PAYLOAD_MAX >> 5U) - 1U,
     .TXA_maxSize =  (MCP_TX_ASYNC_PAYLOAD_MAX_A >> 6U),
@@ -79,19 +106,28 @@ ASPEP_Handle_t aspepOverUartA =
   {
    .buffer = MCPSyncTxBuff,
   },
-  .asyncBufferA =
-  {
-    .buffer = MCPAsyncBuffUARTA_A,
-  },
-  .asyncBufferB =
+  .asyncPool = MCPAsyncPoolUARTA,
+  .asyncPoolStorage = MCPAsyncBuffUARTA,
+  .asyncBufferStride = MCP_TX_ASYNCBUFFER_STRIDE_A,
+  .asyncPoolSize = MCP_TX_ASYNC_POOL_DEPTH_A,
+  .asyncQueue = MCPAsyncQueueUARTA,
+  .eventBuffer =
   {
-    .buffer = MCPAsyncBuffUARTA_B,
+    .buffer = MCPEventBuffUARTA,
   },
+#ifdef ASPEP_RX_RING_SIZE
+  .rxRing = MCPRxRing,
+  .rxRingSize = ASPEP_RX_RING_SIZE,
+  .fASPEP_rxRemaining = &UASPEP_RX_REMAINING,
+  .fASPEP_receive = &UASPEP_RECEIVE_CIRCULAR,
+#else
   .rxBuffer = MCPSyncRXBuff,
+  .fASPEP_receive = &UASPEP_RECEIVE_BUFFER,
+#endif
   .fASPEP_HWInit = &UASPEP_INIT,
   .fASPEP_HWSync = &UASPEP_IDLE_ENABLE,
-  .fASPEP_receive = &UASPEP_RECEIVE_BUFFER,
   .fASPEP_send = &UASPEP_SEND_PACKET,
+  .fASPEP_dataCRC = &UASPEP_DATA_CRC,
   .liid = 0,
 };
 
@@ -107,9 +143,19 @@ MCPA_Handle_t MCPA_UART_A =
   .dataPtrTableBuff = dataPtrTableBuffA,
   .dataSizeTable = dataSizeTableA,
   .dataSizeTableBuff = dataSizeTableBuffA,
+  .lastValueTable = lastValueTableA,
+  .packingTable = packingTableA,
   .nbrOfDataLog = MCPA_OVER_UARTA_STREAM,
 };
 
+MCPE_Handle_t MCPE_UART_A =
+{
+  .pTransportLayer = (MCTL_Handle_t *) &aspepOverUartA, //cstat !MISRAC2012-Rule-11.3
+  .pQueue = MCPEventQueueA,
+  .pValid = MCPEventValidA,
+  .QueueSize = MCPE_QUEUE_SIZE_A,
+};
+
 /**
   * @}
   */
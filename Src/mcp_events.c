@@ -0,0 +1,211 @@
+
+/**
+  ******************************************************************************
+  * @file    mcp_events.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the MCP Events component of the Motor Control SDK:
+  *           + lock-free queuing of timestamped events from any context
+  *           + filtering of the events by class, as subscribed by the controller
+  *           + transmission of the events as ASPEP asynchronous packets
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup MCPEvents
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "string.h"
+#include "mc_stm_types.h"
+#include "mcp_events.h"
+#include "mcpa.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/**
+  * @defgroup MCPEvents MCP Events
+  *
+  * @brief Push of faults, state changes and motion completion to the controller
+  *
+  * Instead of polling registers, the controller subscribes to classes of events by writing the MC_REG_EVENT_MASK
+  * register. Each event is 8 bytes long and timestamped with GLOBAL_TIMESTAMP. The events are sent in
+  * asynchronous packets that the transport layer transmits before any pending MCPA packet:
+  *
+  * | Event 0 | ... | Event N-1 | 0x00 | MCPE_ASYNC_ID |
+  *
+  * The last byte tells the event packets from the MCPA ones.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Clears the event ring.
+  *
+  * @param  pHandle Handler of the current instance of the MCP Events component
+  */
+void MCPE_Init(MCPE_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MCPE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->Head = 0U;
+    pHandle->Tail = 0U;
+    pHandle->Dropped = 0U;
+    (void)memset((void *)pHandle->pValid, 0, pHandle->QueueSize); //cstat !MISRAC2012-Rule-11.8
+#ifdef NULL_PTR_CHECK_MCPE
+  }
+#endif
+}
+
+/**
+  * @brief  Queues an event for the controller.
+  *
+  * May be called from any task or interrupt. A slot is reserved with an exclusive access on Head, so that a
+  * preempting producer gets the next slot. The event is published once written, by setting its Valid flag.
+  *
+  * @param  pHandle Handler of the current instance of the MCP Events component
+  * @param  eventClass Class of the event, see MCPE_CLASS_xxx
+  * @param  motor Motor the event refers to, M1 for Motor 1
+  * @param  code Meaning depends on the class
+  * @param  data Meaning depends on the class
+  *
+  * @retval Returns false if the class is not subscribed or if the ring is full.
+  */
+bool MCPE_Push(MCPE_Handle_t *pHandle, uint8_t eventClass, uint8_t motor, uint8_t code, uint16_t data)
+{
+  bool result = false;
+#ifdef NULL_PTR_CHECK_MCPE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    if (0U == (pHandle->Subscription & (1U << eventClass)))
+    {
+      /* Not subscribed, nothing to do */
+    }
+    else
+    {
+      uint32_t head;
+      bool full;
+
+      do
+      {
+        head = __LDREXW(&pHandle->Head);
+        full = ((head - pHandle->Tail) >= pHandle->QueueSize);
+        if (full)
+        {
+          __CLREX();
+          break;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      } while (__STREXW(head + 1U, &pHandle->Head) != 0U);
+
+      if (full)
+      {
+        pHandle->Dropped++;
+      }
+      else
+      {
+        uint32_t slot = head & ((uint32_t)pHandle->QueueSize - 1U);
+        MCPE_Event_t *pEvent = &pHandle->pQueue[slot];
+        pEvent->Timestamp = GLOBAL_TIMESTAMP;
+        pEvent->ClassMotor = (uint8_t)((eventClass << 4U) | (motor & 0x0FU));
+        pEvent->Code = code;
+        pEvent->Data = data;
+        /* The event must be complete before the consumer can see it */
+        __DMB();
+        pHandle->pValid[slot] = 1U;
+        result = true;
+      }
+    }
+#ifdef NULL_PTR_CHECK_MCPE
+  }
+#endif
+  return (result);
+}
+
+/**
+  * @brief  Sends the queued events in one asynchronous packet.
+  *
+  * Events are sent in order, up to the first slot reserved but not written yet. Nothing is sent if the transport
+  * layer has no free event buffer, the events are then sent at the next call. Must not be preempted by another call.
+  *
+  * @param  pHandle Handler of the current instance of the MCP Events component
+  */
+void MCPE_Exec(MCPE_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_MCPE
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t mask = (uint32_t)pHandle->QueueSize - 1U;
+    uint8_t *buffer;
+
+    if ((pHandle->Tail == pHandle->Head) || (0U == pHandle->pValid[pHandle->Tail & mask]))
+    {
+      /* Nothing to send */
+    }
+    else if (pHandle->pTransportLayer->fGetBuffer(pHandle->pTransportLayer, (void **)&buffer, //cstat !MISRAC2012-Rule-11.3
+                                                  MCTL_EVENT))
+    {
+      uint16_t maxEvents = (pHandle->pTransportLayer->txAsyncMaxPayload - 2U) / MCPE_EVENT_SIZE;
+      uint16_t length = 0U;
+      uint16_t nbr = 0U;
+      uint32_t slot = pHandle->Tail & mask;
+
+      while ((nbr < maxEvents) && (nbr < pHandle->QueueSize) && (pHandle->pValid[slot] != 0U))
+      {
+        (void)memcpy(&buffer[length], &pHandle->pQueue[slot], MCPE_EVENT_SIZE);
+        length += MCPE_EVENT_SIZE;
+        pHandle->pValid[slot] = 0U;
+        /* The slot must be released before the producers can reserve it again */
+        __DMB();
+        pHandle->Tail++;
+        slot = pHandle->Tail & mask;
+        nbr++;
+      }
+      buffer[length] = 0U;
+      buffer[length + 1U] = MCPE_ASYNC_ID;
+      length += 2U;
+      (void)pHandle->pTransportLayer->fSendPacket(pHandle->pTransportLayer, buffer, length, MCTL_EVENT);
+    }
+    else
+    {
+      /* The previous event packet is not sent yet */
+    }
+#ifdef NULL_PTR_CHECK_MCPE
+  }
+#endif
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -333,7 +333,7 @@ __weak uint16_t PWMC_SetPhaseVoltage(PWMC_Handle_t *pHandle, alphabeta_t Valfa_b
           wTimePhB = wTimePhA + (wZ / 131072);
           wTimePhC = wTimePhB - (wX / 131072);
 
-          if((pHandle->DPWM_Mode == true) || (pHandle->SingleShuntTopology == true))
+          if(true == pHandle->SingleShuntTopology)
           {
             pHandle->lowDuty = 2U;
             pHandle->midDuty = 1U;
@@ -351,6 +351,7 @@ __weak uint16_t PWMC_SetPhaseVoltage(PWMC_Handle_t *pHandle, alphabeta_t Valfa_b
     pHandle->CntPhA = (uint16_t)(MAX(wTimePhA, 0));
     pHandle->CntPhB = (uint16_t)(MAX(wTimePhB, 0));
     pHandle->CntPhC = (uint16_t)(MAX(wTimePhC, 0));
+    PWMC_DPWM_ClampLow(pHandle);
 
     if (1U == pHandle->DTTest)
     {
@@ -885,6 +886,148 @@ __weak bool PWMC_GetDPWM_Mode(PWMC_Handle_t *pHandle)
 #endif
 }
 
+/**
+  * @brief  Enables the Discontinuous PWM mode when the applied voltage rises above DPWMEnableModule and disables it
+  *         when the voltage falls below DPWMDisableModule.
+  *
+  * At low modulation the discontinuous modulation doubles the current ripple for the same PWM frequency and the
+  * unclamped phases get pulses shorter than the dead time, the continuous modulation is kept. Near the full
+  * modulation the ripple of both modulations is close and a third of the commutations is saved. To be called by
+  * the Medium Frequency Task.
+  *
+  * @param  pHandle: Handler of the current instance of the PWM component.
+  * @param  Vqd: Voltage applied by the last FOC cycle, expressed in s16V.
+  */
+__weak void PWMC_DPWM_Update(PWMC_Handle_t *pHandle, qd_t Vqd)
+{
+#ifdef NULL_PTR_CHECK_PWR_CUR_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint32_t wModule2 = (uint32_t)((int32_t)Vqd.q * Vqd.q) + (uint32_t)((int32_t)Vqd.d * Vqd.d);
+
+    if (true == pHandle->DPWM_Mode)
+    {
+      if (wModule2 < ((uint32_t)pHandle->DPWMDisableModule * pHandle->DPWMDisableModule))
+      {
+        pHandle->DPWM_Mode = false;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      if (wModule2 > ((uint32_t)pHandle->DPWMEnableModule * pHandle->DPWMEnableModule))
+      {
+        pHandle->DPWM_Mode = true;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+#ifdef NULL_PTR_CHECK_PWR_CUR_FDB
+  }
+#endif
+}
+
+/**
+  * @brief  Sets the voltage above which PWMC_DPWM_Update() enables the Discontinuous PWM mode. The disable threshold
+  *         moves with it, keeping the hysteresis.
+  *
+  * @param  pHandle: Handler of the current instance of the PWM component.
+  * @param  hEnableModule: Enable threshold, expressed in s16V. 32767 keeps the continuous modulation.
+  */
+__weak void PWMC_DPWM_SetThreshold(PWMC_Handle_t *pHandle, uint16_t hEnableModule)
+{
+#ifdef NULL_PTR_CHECK_PWR_CUR_FDB
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint16_t hHysteresis = pHandle->DPWMEnableModule - pHandle->DPWMDisableModule;
+
+    pHandle->DPWMEnableModule = hEnableModule;
+    pHandle->DPWMDisableModule = (hEnableModule > hHysteresis) ? (hEnableModule - hHysteresis) : 0U;
+#ifdef NULL_PTR_CHECK_PWR_CUR_FDB
+  }
+#endif
+}
+
+#if defined (CCMRAM)
+#if defined (__ICCARM__)
+#pragma location = ".ccmram"
+#elif defined (__CC_ARM) || defined(__GNUC__)
+__attribute__( ( section ( ".ccmram" ) ) )
+#endif
+#endif
+/**
+  * @brief  Clamps the phase with the lowest duty cycle to the negative rail when the Discontinuous PWM mode is
+  *         enabled.
+  *
+  * The three compare values are lowered by the lowest one: the line to line voltages are unchanged, the zero vector
+  * with all the high sides on disappears and its time goes to the zero vector with all the low sides on. Each phase
+  * stops switching for the 120 electrical degrees where its voltage is the lowest. The low side current sampling
+  * window is the widest the voltage allows and the bootstrap capacitors stay charged. The duty cycles used by the
+  * sampling point selection are lowered alike. To be called after the computation of the compare values and
+  * before the sampling point selection.
+  *
+  * @param  pHandle: Handler of the current instance of the PWM component.
+  */
+void PWMC_DPWM_ClampLow(PWMC_Handle_t *pHandle)
+{
+  if (true == pHandle->DPWM_Mode)
+  {
+    uint16_t hMinCnt = pHandle->CntPhA;
+
+    if (pHandle->CntPhB < hMinCnt)
+    {
+      hMinCnt = pHandle->CntPhB;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    if (pHandle->CntPhC < hMinCnt)
+    {
+      hMinCnt = pHandle->CntPhC;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    pHandle->CntPhA -= hMinCnt;
+    pHandle->CntPhB -= hMinCnt;
+    pHandle->CntPhC -= hMinCnt;
+
+    if (false == pHandle->SingleShuntTopology)
+    {
+      /* lowDuty, midDuty and highDuty are the compare values of the phases */
+      pHandle->lowDuty -= hMinCnt;
+      pHandle->midDuty -= hMinCnt;
+      pHandle->highDuty -= hMinCnt;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
 /** @brief  Enables the RL detection mode by calling the function in @p pHandle PWMC component.
   *
   */
@@ -20,6 +20,7 @@
   ******************************************************************************
   */
 
+#include <stddef.h>
 #include "mc_type.h"
 #include "string.h"
 #include "register_interface.h"
@@ -30,450 +31,870 @@
 #include "dac_ui.h"
 #include "mc_configuration_registers.h"
 
-uint8_t RI_SetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+/* Accessors of the registers that are not a plain variable ------------------*/
+
+static void RI_GetDacOut1(void *pObj, uint8_t *data)
 {
-  uint8_t retVal = MCP_CMD_OK;
-  switch(typeID)
-  {
-    case TYPE_DATA_8BIT:
-    {
-      switch (regID)
-      {
-        case MC_REG_STATUS:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+  *(uint16_t *)data = DAC_GetChannelConfig((DAC_Handle_t *)pObj, DAC_CH1); //cstat !MISRAC2012-Rule-11.3
+}
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
-      }
-      *size = 1;
-      break;
-    }
+static uint8_t RI_SetDacOut1(void *pObj, const uint8_t *data)
+{
+  DAC_SetChannelConfig((DAC_Handle_t *)pObj, DAC_CH1, *(const uint16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-    case TYPE_DATA_16BIT:
-    {
-      uint16_t regdata16 = *(uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
-      switch (regID)
-      {
+static void RI_GetDacOut2(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = DAC_GetChannelConfig((DAC_Handle_t *)pObj, DAC_CH2); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_BUS_VOLTAGE:
-        case MC_REG_HEATS_TEMP:
-        case MC_REG_MOTOR_POWER:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static uint8_t RI_SetDacOut2(void *pObj, const uint8_t *data)
+{
+  DAC_SetChannelConfig((DAC_Handle_t *)pObj, DAC_CH2, *(const uint16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_DAC_OUT1:
-        {
-          DAC_SetChannelConfig(&DAC_Handle , DAC_CH1, regdata16);
-          break;
-        }
+static uint8_t RI_SetDacMode(void *pObj, const uint8_t *data)
+{
+  return (DAC_SetMode((DAC_Handle_t *)pObj, *data) ? MCP_CMD_OK : MCP_ERROR_REGISTER_ACCESS);
+}
 
-        case MC_REG_DAC_OUT2:
-        {
-          DAC_SetChannelConfig(&DAC_Handle , DAC_CH2, regdata16);
-          break;
-        }
+static uint8_t RI_SetDacDecimation(void *pObj, const uint8_t *data)
+{
+  DAC_SetDecimation((DAC_Handle_t *)pObj, *data);
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_DAC_USER1:
-        case MC_REG_DAC_USER2:
-        break;
+static void RI_GetCPULoad(void *pObj, uint8_t *data)
+{
+  float_t load = MC_Perf_GetCPU_Load(((const MCI_Handle_t *)pObj)->pPerfMeasure);
+  (void)memcpy(data, &load, 4);
+}
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
-      }
-      *size = 2;
-      break;
-    }
+static void RI_GetMinCPULoad(void *pObj, uint8_t *data)
+{
+  float_t load = MC_Perf_GetMinCPU_Load(((const MCI_Handle_t *)pObj)->pPerfMeasure);
+  (void)memcpy(data, &load, 4);
+}
 
-    case TYPE_DATA_32BIT:
-    {
+static void RI_GetMaxCPULoad(void *pObj, uint8_t *data)
+{
+  float_t load = MC_Perf_GetMaxCPU_Load(((const MCI_Handle_t *)pObj)->pPerfMeasure);
+  (void)memcpy(data, &load, 4);
+}
 
-      switch (regID)
-      {
-        case MC_REG_FAULTS_FLAGS:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static void RI_GetAxisCPULoad(void *pObj, uint8_t *data)
+{
+  const MCI_Handle_t *pMCIN = (const MCI_Handle_t *)pObj;
+  float_t load = MC_Perf_GetAxisCPU_Load(pMCIN->pPerfMeasure, (uint8_t)(pMCIN - Mci));
+  (void)memcpy(data, &load, 4);
+}
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
-      }
-      *size = 4;
-      break;
-    }
+static void RI_GetHFBudget(void *pObj, uint8_t *data)
+{
+  const MCI_Handle_t *pMCIN = (const MCI_Handle_t *)pObj;
+  float_t budget = MC_Perf_GetHFBudget(pMCIN->pPerfMeasure, (uint8_t)(pMCIN - Mci));
+  (void)memcpy(data, &budget, 4);
+}
 
-    case TYPE_DATA_STRING:
-    {
-      const char_t *charData = (const char_t *)data;
-      char_t *dummy = (char_t *)data;
-      retVal = MCP_ERROR_RO_REG;
-      /* Used to compute String length stored in RXBUFF even if Reg does not exist */
-      /* It allows to jump to the next command in the buffer */
-      (void)RI_MovString(charData, dummy, size, dataAvailable);
-      break;
-    }
+static void RI_GetStatus(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)MCI_GetSTMState((MCI_Handle_t *)pObj);
+}
 
-    case TYPE_DATA_RAW:
-    {
-      uint16_t rawSize = *(uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
-      /* The size consumed by the structure is the structure size + 2 bytes used to store the size */
-      *size = rawSize + 2U;
-      uint8_t *rawData = data; /* rawData points to the first data (after size extraction) */
-      rawData++;
-      rawData++;
+static void RI_GetControlMode(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)MCI_GetControlMode((MCI_Handle_t *)pObj);
+}
 
-      if (*size > (uint16_t)dataAvailable)
-      {
-        /* The decoded size of the raw structure can not match with transmitted buffer, error in buffer
-           construction */
-        *size = 0;
-        retVal = MCP_ERROR_BAD_RAW_FORMAT; /* This error stop the parsing of the CMD buffer */
-      }
-      else
-      {
-        switch (regID)
-        {
-          case MC_REG_APPLICATION_CONFIG:
-          case MC_REG_MOTOR_CONFIG:
-          case MC_REG_GLOBAL_CONFIG:
-          case MC_REG_FOCFW_CONFIG:
-          {
-            retVal = MCP_ERROR_RO_REG;
-            break;
-          }
+static uint8_t RI_SetControlMode(void *pObj, const uint8_t *data)
+{
+  MCI_Handle_t *pMCIN = (MCI_Handle_t *)pObj;
+  if ((uint8_t)MCM_TORQUE_MODE == *data)
+  {
+    MCI_ExecTorqueRamp(pMCIN, MCI_GetTeref(pMCIN), 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
 
-          default:
-          {
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            break;
-          }
-        }
+  if ((uint8_t)MCM_SPEED_MODE == *data)
+  {
+    MCI_ExecSpeedRamp(pMCIN, MCI_GetMecSpeedRefUnit(pMCIN), 0);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (MCP_CMD_OK);
+}
 
-      }
-      break;
-    }
+static void RI_GetStreamState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)SPS_GetState((SPS_Handle_t *)pObj);
+}
 
-    default:
-    {
-      retVal = MCP_ERROR_BAD_DATA_TYPE;
-      *size =0; /* From this point we are not able anymore to decode the RX buffer */
-      break;
-    }
+static void RI_GetInstantStart(void *pObj, uint8_t *data)
+{
+  *data = (((HallAlign_Handle_t *)pObj)->InstantStart == true) ? 1U : 0U;
+}
+
+static uint8_t RI_SetInstantStart(void *pObj, const uint8_t *data)
+{
+  ((HallAlign_Handle_t *)pObj)->InstantStart = (*data != 0U) ? true : false;
+  return (MCP_CMD_OK);
+}
+
+static void RI_GetCalibFlags(void *pObj, uint8_t *data)
+{
+  *data = ((CAL_Handle_t *)pObj)->Record.Flags;
+}
+
+static uint8_t RI_SetCalibFlags(void *pObj, const uint8_t *data)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  /* Only clearing the stored calibration is allowed */
+  if (0U == *data)
+  {
+    CAL_Erase((CAL_Handle_t *)pObj);
+  }
+  else
+  {
+    retVal = MCP_ERROR_BAD_DATA_TYPE;
   }
   return (retVal);
 }
 
-uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+static void RI_GetBacklashState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)BLC_GetLearnState((BLC_Handle_t *)pObj);
+}
+
+static uint8_t RI_SetBacklashState(void *pObj, const uint8_t *data)
 {
   uint8_t retVal = MCP_CMD_OK;
-  uint8_t motorID=0;
-  MCI_Handle_t *pMCIN = &Mci[motorID];
+  MCI_Handle_t *pMCIN = &Mci[M1];
+  /* 1 starts the learning of the backlash table, 0 aborts it */
+  if (0U == *data)
+  {
+    BLC_StopLearning((BLC_Handle_t *)pObj);
+  }
+  else if ((RUN == MCI_GetSTMState(pMCIN)) && (MCM_POSITION_MODE == MCI_GetControlMode(pMCIN)))
+  {
+    BLC_StartLearning((BLC_Handle_t *)pObj, TC_GetCurrentPosition(&PosCtrlM1));
+  }
+  else
+  {
+    /* The learning needs the motor running in position mode */
+    retVal = MCP_ERROR_REGISTER_ACCESS;
+  }
+  return (retVal);
+}
 
-  switch(typeID)
+static void RI_GetIdentState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)MID_GetState((MID_Handle_t *)pObj);
+}
+
+static uint8_t RI_SetIdentState(void *pObj, const uint8_t *data)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  MCI_Handle_t *pMCIN = &Mci[M1];
+  /* 1 starts the motor and its identification, 0 aborts it */
+  if (0U == *data)
   {
-    case TYPE_DATA_8BIT:
+    if (MID_IsRunning((MID_Handle_t *)pObj))
     {
-      switch (regID)
-      {
-        case MC_REG_STATUS:
-          {
-            retVal = MCP_ERROR_RO_REG;
-            break;
-          }
+      (void)MCI_StopMotor(pMCIN);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else if (IDLE == MCI_GetSTMState(pMCIN))
+  {
+    MID_Start((MID_Handle_t *)pObj);
+    if (MCI_StartMotor(pMCIN) == false)
+    {
+      MID_Stop((MID_Handle_t *)pObj);
+      retVal = MCP_ERROR_REGISTER_ACCESS;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    /* The identification starts the motor, it must be idle */
+    retVal = MCP_ERROR_REGISTER_ACCESS;
+  }
+  return (retVal);
+}
 
-        case MC_REG_CONTROL_MODE:
-        {
-          uint8_t regdata8 = *data;
-          if ((uint8_t)MCM_TORQUE_MODE == regdata8)
-          {
-            MCI_ExecTorqueRamp(pMCIN, MCI_GetTeref(pMCIN), 0);
-          }
-          else
-          {
-            /* Nothing to do */
-          }
+static void RI_GetIdentKe(void *pObj, uint8_t *data)
+{
+  float ke = MID_GetKe((MID_Handle_t *)pObj);
+  (void)memcpy(data, &ke, 4);
+}
 
-          if ((uint8_t)MCM_SPEED_MODE == regdata8)
-          {
-            MCI_ExecSpeedRamp(pMCIN, MCI_GetMecSpeedRefUnit(pMCIN), 0);
-          }
-          else
-          {
-            /* Nothing to do */
-          }
+static void RI_GetBacklashEnable(void *pObj, uint8_t *data)
+{
+  *data = (((BLC_Handle_t *)pObj)->Enable == true) ? 1U : 0U;
+}
 
-          break;
-        }
+static uint8_t RI_SetBacklashEnable(void *pObj, const uint8_t *data)
+{
+  ((BLC_Handle_t *)pObj)->Enable = (*data != 0U) ? true : false;
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_POSITION_CTRL_STATE:
-        case MC_REG_POSITION_ALIGN_STATE:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static void RI_GetPositionCtrlState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)TC_GetControlPositionStatus((PosCtrl_Handle_t *)pObj);
+}
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
-      }
-      *size = 1;
-      break;
-    }
+static void RI_GetPositionAlignState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)TC_GetAlignmentStatus((PosCtrl_Handle_t *)pObj);
+}
 
-    case TYPE_DATA_16BIT:
-    {
-      uint16_t regdata16 = *(uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
-      switch (regID)
-      {
-        case MC_REG_SPEED_KP:
-        {
-          PID_SetKP(&PIDSpeedHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static void RI_GetHFCaptureState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)HFC_GetState((HFC_Handle_t *)pObj);
+}
 
-        case MC_REG_SPEED_KI:
-        {
-          PID_SetKI(&PIDSpeedHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static uint8_t RI_SetHFCaptureState(void *pObj, const uint8_t *data)
+{
+  return (HFC_Command((HFC_Handle_t *)pObj, *data));
+}
 
-        case MC_REG_SPEED_KD:
-        {
-          PID_SetKD(&PIDSpeedHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static void RI_GetFreqRespState(void *pObj, uint8_t *data)
+{
+  *data = (uint8_t)FRA_GetState((FRA_Handle_t *)pObj);
+}
 
-        case MC_REG_I_Q_KP:
-        {
-          PID_SetKP(&PIDIqHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static uint8_t RI_SetFreqRespState(void *pObj, const uint8_t *data)
+{
+  uint8_t retVal;
+  /* The sweep perturbs the loops of a running motor, never those of the identification */
+  if ((FRA_CMD_START == *data)
+      && ((MCI_GetSTMState(&Mci[M1]) != RUN) || MID_IsRunning(&MotorIdentM1)))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+    retVal = FRA_Command((FRA_Handle_t *)pObj, *data);
+  }
+  return (retVal);
+}
 
-        case MC_REG_I_Q_KI:
-        {
-          PID_SetKI(&PIDIqHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static void RI_GetKP(void *pObj, uint8_t *data)
+{
+  *(int16_t *)data = PID_GetKP((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_Q_KD:
-        {
-          PID_SetKD(&PIDIqHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static uint8_t RI_SetKP(void *pObj, const uint8_t *data)
+{
+  PID_SetKP((PID_Handle_t *)pObj, *(const int16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_D_KP:
-        {
-          PID_SetKP(&PIDIdHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static void RI_GetKI(void *pObj, uint8_t *data)
+{
+  *(int16_t *)data = PID_GetKI((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_D_KI:
-        {
-          PID_SetKI(&PIDIdHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static uint8_t RI_SetKI(void *pObj, const uint8_t *data)
+{
+  PID_SetKI((PID_Handle_t *)pObj, *(const int16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_D_KD:
-        {
-          PID_SetKD(&PIDIdHandle_M1, (int16_t)regdata16);
-          break;
-        }
+static void RI_GetKD(void *pObj, uint8_t *data)
+{
+  *(int16_t *)data = PID_GetKD((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_BUS_VOLTAGE:
-        case MC_REG_HEATS_TEMP:
-        case MC_REG_MOTOR_POWER:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static uint8_t RI_SetKD(void *pObj, const uint8_t *data)
+{
+  PID_SetKD((PID_Handle_t *)pObj, *(const int16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_A:
-        case MC_REG_I_B:
-        case MC_REG_I_ALPHA_MEAS:
-        case MC_REG_I_BETA_MEAS:
-        case MC_REG_I_Q_MEAS:
-        case MC_REG_I_D_MEAS:
-        case MC_REG_FLUXWK_BUS_MEAS:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static void RI_GetKPDiv(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = PID_GetKPDivisorPOW2((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_Q_REF:
-        {
-          qd_t currComp;
-          currComp = MCI_GetIqdref(pMCIN);
-          currComp.q = (int16_t)regdata16;
-          MCI_SetCurrentReferences(pMCIN,currComp);
-          break;
-        }
+static uint8_t RI_SetKPDiv(void *pObj, const uint8_t *data)
+{
+  PID_SetKPDivisorPOW2((PID_Handle_t *)pObj, *(const uint16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_D_REF:
-        {
-          qd_t currComp;
-          currComp = MCI_GetIqdref(pMCIN);
-          currComp.d = (int16_t)regdata16;
-          MCI_SetCurrentReferences(pMCIN,currComp);
-          break;
-        }
+static void RI_GetKIDiv(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = PID_GetKIDivisorPOW2((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_V_Q:
-        case MC_REG_V_D:
-        case MC_REG_V_ALPHA:
-        case MC_REG_V_BETA:
-        case MC_REG_ENCODER_EL_ANGLE:
-        case MC_REG_ENCODER_SPEED:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+static uint8_t RI_SetKIDiv(void *pObj, const uint8_t *data)
+{
+  PID_SetKIDivisorPOW2((PID_Handle_t *)pObj, *(const uint16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_DAC_USER1:
-        case MC_REG_DAC_USER2:
-          break;
+static void RI_GetKDDiv(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = PID_GetKDDivisorPOW2((PID_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_POSITION_KP:
-        {
-          PID_SetKP(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static uint8_t RI_SetKDDiv(void *pObj, const uint8_t *data)
+{
+  PID_SetKDDivisorPOW2((PID_Handle_t *)pObj, *(const uint16_t *)data); //cstat !MISRAC2012-Rule-11.3
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_POSITION_KI:
-        {
-          PID_SetKI(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static void RI_GetBusVoltage(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = VBS_GetAvBusVoltage_V((BusVoltageSensor_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_POSITION_KD:
-        {
-          PID_SetKD(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static void RI_GetHeatsinkTemp(void *pObj, uint8_t *data)
+{
+  *(int16_t *)data = NTC_GetAvTemp_C((NTC_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_SPEED_KP_DIV:
-        {
-          PID_SetKPDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
-          break;
-        }
+static void RI_GetFluxWkBus(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = FW_GetVref((FW_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_SPEED_KI_DIV:
-        {
-          PID_SetKIDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
-          break;
-        }
+static uint8_t RI_SetFluxWkBus(void *pObj, const uint8_t *data)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  uint16_t vref = *(const uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
+  /* In tenth of percentage of MAX_MODULE, 1000 disables the flux weakening */
+  if (vref > 1000U)
+  {
+    retVal = MCP_ERROR_BAD_DATA_TYPE;
+  }
+  else
+  {
+    FW_SetVref((FW_Handle_t *)pObj, vref);
+  }
+  return (retVal);
+}
 
-        case MC_REG_SPEED_KD_DIV:
-        {
-          PID_SetKDDivisorPOW2(&PIDSpeedHandle_M1, regdata16);
-          break;
-        }
+static void RI_GetFluxWkBusMeas(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = FW_GetAvVPercentage((FW_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_D_KP_DIV:
-        {
-          PID_SetKPDivisorPOW2(&PIDIdHandle_M1, regdata16);
-          break;
-        }
+static uint8_t RI_SetDPWMThreshold(void *pObj, const uint8_t *data)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  uint16_t module = *(const uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
+  /* In s16V, 32767 keeps the continuous modulation */
+  if (module > (uint16_t)INT16_MAX)
+  {
+    retVal = MCP_ERROR_BAD_DATA_TYPE;
+  }
+  else
+  {
+    PWMC_DPWM_SetThreshold((PWMC_Handle_t *)pObj, module);
+  }
+  return (retVal);
+}
 
-        case MC_REG_I_D_KI_DIV:
-        {
-          PID_SetKIDivisorPOW2(&PIDIdHandle_M1, regdata16);
-          break;
-        }
+static uint8_t RI_SetIqRef(void *pObj, const uint8_t *data)
+{
+  MCI_Handle_t *pMCIN = (MCI_Handle_t *)pObj;
+  qd_t currComp = MCI_GetIqdref(pMCIN);
+  currComp.q = *(const int16_t *)data; //cstat !MISRAC2012-Rule-11.3
+  MCI_SetCurrentReferences(pMCIN, currComp);
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_D_KD_DIV:
-        {
-          PID_SetKDDivisorPOW2(&PIDIdHandle_M1, regdata16);
-          break;
-        }
+static uint8_t RI_SetIdRef(void *pObj, const uint8_t *data)
+{
+  MCI_Handle_t *pMCIN = (MCI_Handle_t *)pObj;
+  qd_t currComp = MCI_GetIqdref(pMCIN);
+  currComp.d = *(const int16_t *)data; //cstat !MISRAC2012-Rule-11.3
+  MCI_SetCurrentReferences(pMCIN, currComp);
+  return (MCP_CMD_OK);
+}
 
-        case MC_REG_I_Q_KP_DIV:
-        {
-          PID_SetKPDivisorPOW2(&PIDIqHandle_M1, regdata16);
-          break;
-        }
+static void RI_GetS16Speed(void *pObj, uint8_t *data)
+{
+  *(int16_t *)data = SPD_GetS16Speed((SpeednPosFdbk_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_Q_KI_DIV:
-        {
-          PID_SetKIDivisorPOW2(&PIDIqHandle_M1, regdata16);
-          break;
-        }
+static void RI_GetStreamLevel(void *pObj, uint8_t *data)
+{
+  *(uint16_t *)data = SPS_GetLevel((SPS_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_I_Q_KD_DIV:
-        {
-          PID_SetKDDivisorPOW2(&PIDIqHandle_M1, regdata16);
-          break;
-        }
+static void RI_GetFaultsFlags(void *pObj, uint8_t *data)
+{
+  *(uint32_t *)data = MCI_GetFaultState((MCI_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_POSITION_KP_DIV:
-        {
-          PID_SetKPDivisorPOW2(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static void RI_GetSpeedMeas(void *pObj, uint8_t *data)
+{
+  *(int32_t *)data = (((int32_t)MCI_GetAvrgMecSpeedUnit((MCI_Handle_t *)pObj) * U_RPM) / SPEED_UNIT); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_POSITION_KI_DIV:
-        {
-          PID_SetKIDivisorPOW2(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static void RI_GetSpeedRef(void *pObj, uint8_t *data)
+{
+  *(int32_t *)data = (((int32_t)MCI_GetMecSpeedRefUnit((MCI_Handle_t *)pObj) * U_RPM) / SPEED_UNIT); //cstat !MISRAC2012-Rule-11.3
+}
 
-        case MC_REG_POSITION_KD_DIV:
-        {
-          PID_SetKDDivisorPOW2(&PID_PosParamsM1, regdata16);
-          break;
-        }
+static uint8_t RI_SetSpeedRef(void *pObj, const uint8_t *data)
+{
+  uint32_t regdata32 = *(const uint32_t *)data; //cstat !MISRAC2012-Rule-11.3
+  MCI_ExecSpeedRamp((MCI_Handle_t *)pObj, ((((int16_t)regdata32) * ((int16_t)SPEED_UNIT)) / (int16_t)U_RPM), 0);
+  return (MCP_CMD_OK);
+}
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
-      }
-      *size = 2;
-      break;
+static uint8_t RI_SetInertiaFF(void *pObj, const uint8_t *data)
+{
+  PosCtrl_Handle_t *pPosCtrl = (PosCtrl_Handle_t *)pObj;
+  float gain;
+  (void)memcpy(&gain, data, 4);
+  TC_SetFeedForwardGains(pPosCtrl, gain, pPosCtrl->ViscousFF, pPosCtrl->CoulombFF);
+  return (MCP_CMD_OK);
+}
+
+static uint8_t RI_SetViscousFF(void *pObj, const uint8_t *data)
+{
+  PosCtrl_Handle_t *pPosCtrl = (PosCtrl_Handle_t *)pObj;
+  float gain;
+  (void)memcpy(&gain, data, 4);
+  TC_SetFeedForwardGains(pPosCtrl, pPosCtrl->InertiaFF, gain, pPosCtrl->CoulombFF);
+  return (MCP_CMD_OK);
+}
+
+static uint8_t RI_SetCoulombFF(void *pObj, const uint8_t *data)
+{
+  PosCtrl_Handle_t *pPosCtrl = (PosCtrl_Handle_t *)pObj;
+  float gain;
+  (void)memcpy(&gain, data, 4);
+  TC_SetFeedForwardGains(pPosCtrl, pPosCtrl->InertiaFF, pPosCtrl->ViscousFF, gain);
+  return (MCP_CMD_OK);
+}
+
+static void RI_GetStartToTorqueTime(void *pObj, uint8_t *data)
+{
+  *(uint32_t *)data = MCI_GetStartToTorqueTime((MCI_Handle_t *)pObj); //cstat !MISRAC2012-Rule-11.3
+}
+
+static void RI_GetCurrentPosition(void *pObj, uint8_t *data)
+{
+  float_t position = MCI_GetCurrentPosition((MCI_Handle_t *)pObj);
+  (void)memcpy(data, &position, 4);
+}
+
+static void RI_GetMotorPower(void *pObj, uint8_t *data)
+{
+  float_t power = PQD_GetAvrgElMotorPowerW((PQD_MotorPowMeas_Handle_t *)pObj);
+  (void)memcpy(data, &power, 4);
+}
+
+/* Descriptor of a register, the value being in pValue (if any) */
+#define RI_REG(regID, flags, pValue, pObj, getFct, setFct) \
+  {(regID), (flags), 0U, (pValue), (pObj), (getFct), (setFct)}
+
+/* Descriptor of a register, the value being a field of the FOC variables of pMCI */
+#define RI_REG_FOC(regID, flags, field, pMCI, setFct) \
+  {(regID), ((flags) | RI_VALUE_FOCVARS), (uint16_t)offsetof(FOCVars_t, field), NULL, (pMCI), NULL, (setFct)}
+
+/* Registers of the Global table, sorted by regID */
+static const RI_Register_t RegTableGlobal[] =
+{
+  RI_REG(MC_REG_FAULTS_FLAGS, RI_ACCESS_NONE, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_STATUS, RI_ACCESS_NONE, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_EVENT_MASK, RI_ACCESS_RW, &MCPE_UART_A.Subscription, NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_MODE, RI_ACCESS_RW, &DAC_Handle.mode, &DAC_Handle, NULL, &RI_SetDacMode),
+  RI_REG(MC_REG_DAC_DECIMATION, RI_ACCESS_RW, &DAC_Handle.decimation, &DAC_Handle, NULL, &RI_SetDacDecimation),
+  RI_REG(MC_REG_ASPEP_CRC_CYCLES, RI_ACCESS_READ, &aspepOverUartA.dataCRCCycles, NULL, NULL, NULL),
+  RI_REG(MC_REG_ASPEP_CRC_MAX_CYCLES, RI_ACCESS_READ, &aspepOverUartA.dataCRCMaxCycles, NULL, NULL, NULL),
+  RI_REG(MC_REG_BUS_VOLTAGE, RI_ACCESS_NONE, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_HEATS_TEMP, RI_ACCESS_NONE, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_OUT1, RI_ACCESS_RW, NULL, &DAC_Handle, &RI_GetDacOut1, &RI_SetDacOut1),
+  RI_REG(MC_REG_DAC_OUT2, RI_ACCESS_RW, NULL, &DAC_Handle, &RI_GetDacOut2, &RI_SetDacOut2),
+  RI_REG(MC_REG_DAC_USER1, RI_ACCESS_RW, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_USER2, RI_ACCESS_RW, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_PERF_CPU_LOAD, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &Mci[M1], &RI_GetCPULoad, NULL),
+  RI_REG(MC_REG_PERF_MIN_CPU_LOAD, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &Mci[M1], &RI_GetMinCPULoad, NULL),
+  RI_REG(MC_REG_PERF_MAX_CPU_LOAD, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &Mci[M1], &RI_GetMaxCPULoad, NULL),
+  RI_REG(MC_REG_ASYNC_POOL_HIGH_WATER, RI_ACCESS_READ, &aspepOverUartA.asyncHighWater, NULL, NULL, NULL),
+  RI_REG(MC_REG_ASYNC_POOL_DROPS, RI_ACCESS_READ, &aspepOverUartA.asyncDropped, NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_SCALE1, RI_ACCESS_RW, &DAC_Handle.scaleCh[DAC_CH1], NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_SCALE2, RI_ACCESS_RW, &DAC_Handle.scaleCh[DAC_CH2], NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_OFFSET1, RI_ACCESS_RW, &DAC_Handle.offsetCh[DAC_CH1], NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_OFFSET2, RI_ACCESS_RW, &DAC_Handle.offsetCh[DAC_CH2], NULL, NULL, NULL),
+  RI_REG(MC_REG_ASPEP_CRC_MAX_LENGTH, RI_ACCESS_READ, &aspepOverUartA.dataCRCMaxLength, NULL, NULL, NULL)
+};
+
+/* Registers of Motor 1, sorted by regID */
+static const RI_Register_t RegTableM1[] =
+{
+  RI_REG(MC_REG_FAULTS_FLAGS, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetFaultsFlags, NULL),
+  RI_REG(MC_REG_STATUS, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetStatus, NULL),
+  RI_REG(MC_REG_SPEED_MEAS, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetSpeedMeas, NULL),
+  RI_REG(MC_REG_CONTROL_MODE, RI_ACCESS_RW, NULL, &Mci[M1], &RI_GetControlMode, &RI_SetControlMode),
+  RI_REG(MC_REG_SPEED_KP, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_SPEED_REF, RI_ACCESS_RW, NULL, &Mci[M1], &RI_GetSpeedRef, &RI_SetSpeedRef),
+  RI_REG(MC_REG_SPEED_KI, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_STREAM_STATE, RI_ACCESS_READ, NULL, &SetpointStreamM1, &RI_GetStreamState, NULL),
+  RI_REG(MC_REG_SPEED_KD, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_HALL_INSTANT_START, RI_ACCESS_RW, NULL, &HallAlignCtrlM1, &RI_GetInstantStart, &RI_SetInstantStart),
+  RI_REG(MC_REG_CALIB_STORE, RI_ACCESS_RW, NULL, &CalibStoreM1, &RI_GetCalibFlags, &RI_SetCalibFlags),
+  RI_REG(MC_REG_I_Q_KP, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_BACKLASH_STATE, RI_ACCESS_RW, NULL, &BacklashCompM1, &RI_GetBacklashState, &RI_SetBacklashState),
+  RI_REG(MC_REG_I_Q_KI, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_BACKLASH_ENABLE, RI_ACCESS_RW, NULL, &BacklashCompM1, &RI_GetBacklashEnable, &RI_SetBacklashEnable),
+  RI_REG(MC_REG_I_Q_KD, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_HF_CAPTURE_STATE, RI_ACCESS_RW, NULL, &HFCaptureM1, &RI_GetHFCaptureState, &RI_SetHFCaptureState),
+  RI_REG(MC_REG_I_D_KP, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_POSITION_STREAM_UNDERRUNS, RI_ACCESS_READ, &SetpointStreamM1.Underruns, NULL, NULL, NULL),
+  RI_REG(MC_REG_I_D_KI, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_FF_INERTIA, RI_ACCESS_RW, &PosCtrlM1.InertiaFF, &PosCtrlM1, NULL, &RI_SetInertiaFF),
+  RI_REG(MC_REG_I_D_KD, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_POSITION_FF_VISCOUS, RI_ACCESS_RW, &PosCtrlM1.ViscousFF, &PosCtrlM1, NULL, &RI_SetViscousFF),
+  RI_REG(MC_REG_POSITION_FF_COULOMB, RI_ACCESS_RW, &PosCtrlM1.CoulombFF, &PosCtrlM1, NULL, &RI_SetCoulombFF),
+  RI_REG(MC_REG_START_TO_TORQUE_TIME, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetStartToTorqueTime, NULL),
+  RI_REG(MC_REG_PERF_AXIS_CPU_LOAD, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetAxisCPULoad, NULL),
+  RI_REG(MC_REG_SC_STATE, RI_ACCESS_RW, NULL, &MotorIdentM1, &RI_GetIdentState, &RI_SetIdentState),
+  RI_REG(MC_REG_PERF_HF_BUDGET, RI_ACCESS_READ, NULL, &Mci[M1], &RI_GetHFBudget, NULL),
+  RI_REG(MC_REG_FLUXWK_KP, RI_ACCESS_RW, NULL, &PIDFluxWeakeningHandle_M1, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_FLUXWK_KI, RI_ACCESS_RW, NULL, &PIDFluxWeakeningHandle_M1, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_CTRL_STATE, RI_ACCESS_READ, NULL, &PosCtrlM1, &RI_GetPositionCtrlState, NULL),
+  RI_REG(MC_REG_FLUXWK_BUS, RI_ACCESS_RW, NULL, &FW_M1, &RI_GetFluxWkBus, &RI_SetFluxWkBus),
+  RI_REG(MC_REG_POSITION_ALIGN_STATE, RI_ACCESS_READ, NULL, &PosCtrlM1, &RI_GetPositionAlignState, NULL),
+  RI_REG(MC_REG_BUS_VOLTAGE, RI_ACCESS_READ, NULL, &BusVoltageSensor_M1._Super, &RI_GetBusVoltage, NULL),
+  RI_REG(MC_REG_HEATS_TEMP, RI_ACCESS_READ, NULL, &TempSensor_M1, &RI_GetHeatsinkTemp, NULL),
+#ifdef M1_ENCODER_FUSION
+  RI_REG(MC_REG_FUSION_STATUS, RI_ACCESS_READ, &FusedSensorM1.Status, NULL, NULL, NULL),
+#endif
+  RI_REG(MC_REG_FLUXWK_BUS_MEAS, RI_ACCESS_READ, NULL, &FW_M1, &RI_GetFluxWkBusMeas, NULL),
+  RI_REG(MC_REG_FREQ_RESP_STATE, RI_ACCESS_RW, NULL, &FreqRespM1, &RI_GetFreqRespState, &RI_SetFreqRespState),
+  RI_REG_FOC(MC_REG_I_A, RI_ACCESS_READ, Iab.a, &Mci[M1], NULL),
+  RI_REG(MC_REG_FREQ_RESP_OFFSET, RI_ACCESS_RW, &FreqRespM1.ReadOffset, NULL, NULL, NULL),
+  RI_REG_FOC(MC_REG_I_B, RI_ACCESS_READ, Iab.b, &Mci[M1], NULL),
+  RI_REG(MC_REG_DPWM_STATE, RI_ACCESS_READ, &PWM_Handle_M1._Super.DPWM_Mode, NULL, NULL, NULL),
+  RI_REG_FOC(MC_REG_I_ALPHA_MEAS, RI_ACCESS_READ, Ialphabeta.alpha, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_I_BETA_MEAS, RI_ACCESS_READ, Ialphabeta.beta, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_I_Q_MEAS, RI_ACCESS_READ, Iqd.q, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_I_D_MEAS, RI_ACCESS_READ, Iqd.d, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_I_Q_REF, RI_ACCESS_RW, Iqdref.q, &Mci[M1], &RI_SetIqRef),
+  RI_REG_FOC(MC_REG_I_D_REF, RI_ACCESS_RW, Iqdref.d, &Mci[M1], &RI_SetIdRef),
+  RI_REG_FOC(MC_REG_V_Q, RI_ACCESS_READ, Vqd.q, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_V_D, RI_ACCESS_READ, Vqd.d, &Mci[M1], NULL),
+  RI_REG_FOC(MC_REG_V_ALPHA, RI_ACCESS_READ, Valphabeta.alpha, &Mci[M1], NULL),
+  RI_REG(MC_REG_CURRENT_POSITION, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &Mci[M1], &RI_GetCurrentPosition, NULL),
+  RI_REG_FOC(MC_REG_V_BETA, RI_ACCESS_READ, Valphabeta.beta, &Mci[M1], NULL),
+  RI_REG(MC_REG_ENCODER_EL_ANGLE, RI_ACCESS_READ, &ENCODER_M1._Super.hElAngle, NULL, NULL, NULL),
+  RI_REG(MC_REG_ENCODER_SPEED, RI_ACCESS_READ, &ENCODER_M1._Super.hAvrMecSpeedUnit, &ENCODER_M1._Super, &RI_GetS16Speed, NULL),
+  RI_REG(MC_REG_DAC_USER1, RI_ACCESS_RW, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_DAC_USER2, RI_ACCESS_RW, NULL, NULL, NULL, NULL),
+  RI_REG(MC_REG_POSITION_KP, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_POSITION_KI, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_KD, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_SPEED_KP_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_SPEED_KI_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_SPEED_KD_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M1, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_I_D_KP_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_I_D_KI_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_I_D_KD_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M1, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_I_Q_KP_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_I_Q_KI_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_I_Q_KD_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M1, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_POSITION_KP_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_POSITION_KI_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_SC_RS, RI_ACCESS_READ, &MotorIdentM1.Rs, NULL, NULL, NULL),
+  RI_REG(MC_REG_POSITION_KD_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM1, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_SC_LS, RI_ACCESS_READ, &MotorIdentM1.Ls, NULL, NULL, NULL),
+  RI_REG(MC_REG_SC_KE, RI_ACCESS_READ, NULL, &MotorIdentM1, &RI_GetIdentKe, NULL),
+  RI_REG(MC_REG_SC_VBUS, RI_ACCESS_READ, &MotorIdentM1.BusVoltage, NULL, NULL, NULL),
+  RI_REG(MC_REG_SC_CURRENT, RI_ACCESS_RW, &MotorIdentM1.TestCurrent, NULL, NULL, NULL),
+  RI_REG(MC_REG_SC_SPDBANDWIDTH, RI_ACCESS_RW, &MotorIdentM1.SpeedBandwidth, NULL, NULL, NULL),
+  RI_REG(MC_REG_SC_CURRBANDWIDTH, RI_ACCESS_RW, &MotorIdentM1.CurrentBandwidth, NULL, NULL, NULL),
+  RI_REG(MC_REG_FLUXWK_KP_DIV, RI_ACCESS_RW, NULL, &PIDFluxWeakeningHandle_M1, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_SC_J, RI_ACCESS_READ, &MotorIdentM1.Inertia, NULL, NULL, NULL),
+  RI_REG(MC_REG_FLUXWK_KI_DIV, RI_ACCESS_RW, NULL, &PIDFluxWeakeningHandle_M1, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_SC_F, RI_ACCESS_READ, &MotorIdentM1.Friction, NULL, NULL, NULL),
+  RI_REG(MC_REG_MOTOR_POWER, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &PQD_MotorPowMeasM1, &RI_GetMotorPower, NULL),
+  RI_REG(MC_REG_POSITION_STREAM_LEVEL, RI_ACCESS_READ, &SetpointStreamM1.Level, &SetpointStreamM1, &RI_GetStreamLevel, NULL),
+  RI_REG(MC_REG_POSITION_TORQUE_FF, RI_ACCESS_READ, &PosCtrlM1.TorqueRefFF, NULL, NULL, NULL),
+  RI_REG(MC_REG_POSITION_TORQUE_FB, RI_ACCESS_READ, &PosCtrlM1.TorqueRefFB, NULL, NULL, NULL),
+  RI_REG(MC_REG_HALL_AMPLITUDE, RI_ACCESS_READ, &HALL_M1.Amplitude, NULL, NULL, NULL),
+  RI_REG(MC_REG_HALL_INSTANT_FALLBACKS, RI_ACCESS_READ, &HallAlignCtrlM1.InstantFallbacks, NULL, NULL, NULL),
+  RI_REG(MC_REG_HF_CAPTURE_OFFSET, RI_ACCESS_RW, &HFCaptureM1.ReadOffset, NULL, NULL, NULL),
+  RI_REG(MC_REG_THERMAL_LOAD, RI_ACCESS_READ, &CurrentProtM1.ThermalLoad, NULL, NULL, NULL),
+  RI_REG(MC_REG_CURRENT_LIMIT, RI_ACCESS_READ, &CurrentProtM1.CurrentLimit, NULL, NULL, NULL),
+#ifdef M1_ENCODER_FUSION
+  RI_REG(MC_REG_FUSION_ANGLE_ERROR, RI_ACCESS_READ, &FusedSensorM1.HallAngleError, NULL, NULL, NULL),
+#endif
+  RI_REG(MC_REG_DPWM_THRESHOLD, RI_ACCESS_RW, &PWM_Handle_M1._Super.DPWMEnableModule, &PWM_Handle_M1._Super, NULL, &RI_SetDPWMThreshold)
+};
+
+#if NBR_OF_MOTORS > 1
+/* Registers of Motor 2, sorted by regID. The set-point stream, backlash compensation, HF capture,
+   flux weakening, sensor fusion, motor identification and frequency response only exist on Motor 1 */
+static const RI_Register_t RegTableM2[] =
+{
+  RI_REG(MC_REG_FAULTS_FLAGS, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetFaultsFlags, NULL),
+  RI_REG(MC_REG_STATUS, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetStatus, NULL),
+  RI_REG(MC_REG_SPEED_MEAS, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetSpeedMeas, NULL),
+  RI_REG(MC_REG_CONTROL_MODE, RI_ACCESS_RW, NULL, &Mci[M2], &RI_GetControlMode, &RI_SetControlMode),
+  RI_REG(MC_REG_SPEED_KP, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_SPEED_REF, RI_ACCESS_RW, NULL, &Mci[M2], &RI_GetSpeedRef, &RI_SetSpeedRef),
+  RI_REG(MC_REG_SPEED_KI, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_SPEED_KD, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_I_Q_KP, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_I_Q_KI, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_I_Q_KD, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_I_D_KP, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_I_D_KI, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_FF_INERTIA, RI_ACCESS_RW, &PosCtrlM2.InertiaFF, &PosCtrlM2, NULL, &RI_SetInertiaFF),
+  RI_REG(MC_REG_I_D_KD, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_POSITION_FF_VISCOUS, RI_ACCESS_RW, &PosCtrlM2.ViscousFF, &PosCtrlM2, NULL, &RI_SetViscousFF),
+  RI_REG(MC_REG_POSITION_FF_COULOMB, RI_ACCESS_RW, &PosCtrlM2.CoulombFF, &PosCtrlM2, NULL, &RI_SetCoulombFF),
+  RI_REG(MC_REG_START_TO_TORQUE_TIME, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetStartToTorqueTime, NULL),
+  RI_REG(MC_REG_PERF_AXIS_CPU_LOAD, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetAxisCPULoad, NULL),
+  RI_REG(MC_REG_PERF_HF_BUDGET, RI_ACCESS_READ, NULL, &Mci[M2], &RI_GetHFBudget, NULL),
+  RI_REG(MC_REG_POSITION_CTRL_STATE, RI_ACCESS_READ, NULL, &PosCtrlM2, &RI_GetPositionCtrlState, NULL),
+  RI_REG(MC_REG_POSITION_ALIGN_STATE, RI_ACCESS_READ, NULL, &PosCtrlM2, &RI_GetPositionAlignState, NULL),
+  RI_REG(MC_REG_BUS_VOLTAGE, RI_ACCESS_READ, NULL, &BusVoltageSensor_M1._Super, &RI_GetBusVoltage, NULL),
+  RI_REG_FOC(MC_REG_I_A, RI_ACCESS_READ, Iab.a, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_I_B, RI_ACCESS_READ, Iab.b, &Mci[M2], NULL),
+  RI_REG(MC_REG_DPWM_STATE, RI_ACCESS_READ, &PWM_Handle_M2._Super.DPWM_Mode, NULL, NULL, NULL),
+  RI_REG_FOC(MC_REG_I_ALPHA_MEAS, RI_ACCESS_READ, Ialphabeta.alpha, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_I_BETA_MEAS, RI_ACCESS_READ, Ialphabeta.beta, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_I_Q_MEAS, RI_ACCESS_READ, Iqd.q, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_I_D_MEAS, RI_ACCESS_READ, Iqd.d, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_I_Q_REF, RI_ACCESS_RW, Iqdref.q, &Mci[M2], &RI_SetIqRef),
+  RI_REG_FOC(MC_REG_I_D_REF, RI_ACCESS_RW, Iqdref.d, &Mci[M2], &RI_SetIdRef),
+  RI_REG_FOC(MC_REG_V_Q, RI_ACCESS_READ, Vqd.q, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_V_D, RI_ACCESS_READ, Vqd.d, &Mci[M2], NULL),
+  RI_REG_FOC(MC_REG_V_ALPHA, RI_ACCESS_READ, Valphabeta.alpha, &Mci[M2], NULL),
+  RI_REG(MC_REG_CURRENT_POSITION, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &Mci[M2], &RI_GetCurrentPosition, NULL),
+  RI_REG_FOC(MC_REG_V_BETA, RI_ACCESS_READ, Valphabeta.beta, &Mci[M2], NULL),
+  RI_REG(MC_REG_ENCODER_EL_ANGLE, RI_ACCESS_READ, &ENCODER_M2._Super.hElAngle, NULL, NULL, NULL),
+  RI_REG(MC_REG_ENCODER_SPEED, RI_ACCESS_READ, &ENCODER_M2._Super.hAvrMecSpeedUnit, &ENCODER_M2._Super, &RI_GetS16Speed, NULL),
+  RI_REG(MC_REG_POSITION_KP, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKP, &RI_SetKP),
+  RI_REG(MC_REG_POSITION_KI, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKI, &RI_SetKI),
+  RI_REG(MC_REG_POSITION_KD, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKD, &RI_SetKD),
+  RI_REG(MC_REG_SPEED_KP_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_SPEED_KI_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_SPEED_KD_DIV, RI_ACCESS_RW, NULL, &PIDSpeedHandle_M2, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_I_D_KP_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_I_D_KI_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_I_D_KD_DIV, RI_ACCESS_RW, NULL, &PIDIdHandle_M2, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_I_Q_KP_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_I_Q_KI_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_I_Q_KD_DIV, RI_ACCESS_RW, NULL, &PIDIqHandle_M2, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_POSITION_KP_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKPDiv, &RI_SetKPDiv),
+  RI_REG(MC_REG_POSITION_KI_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKIDiv, &RI_SetKIDiv),
+  RI_REG(MC_REG_POSITION_KD_DIV, RI_ACCESS_RW, NULL, &PID_PosParamsM2, &RI_GetKDDiv, &RI_SetKDDiv),
+  RI_REG(MC_REG_MOTOR_POWER, RI_ACCESS_READ | RI_WRITE_UNKNOWN, NULL, &PQD_MotorPowMeasM2, &RI_GetMotorPower, NULL),
+  RI_REG(MC_REG_POSITION_TORQUE_FF, RI_ACCESS_READ, &PosCtrlM2.TorqueRefFF, NULL, NULL, NULL),
+  RI_REG(MC_REG_POSITION_TORQUE_FB, RI_ACCESS_READ, &PosCtrlM2.TorqueRefFB, NULL, NULL, NULL),
+  RI_REG(MC_REG_THERMAL_LOAD, RI_ACCESS_READ, &CurrentProtM2.ThermalLoad, NULL, NULL, NULL),
+  RI_REG(MC_REG_CURRENT_LIMIT, RI_ACCESS_READ, &CurrentProtM2.CurrentLimit, NULL, NULL, NULL),
+  RI_REG(MC_REG_DPWM_THRESHOLD, RI_ACCESS_RW, &PWM_Handle_M2._Super.DPWMEnableModule, &PWM_Handle_M2._Super, NULL, &RI_SetDPWMThreshold)
+};
+#endif
+
+typedef struct
+{
+  const RI_Register_t *pTable;
+  uint16_t nbrOfRegs;
+} RI_RegTable_t;
+
+/* Descriptor tables, indexed by motorID (0 is the Global table) */
+static const RI_RegTable_t RegTables[NBR_OF_MOTORS + 1] =
+{
+  {RegTableGlobal, (uint16_t)(sizeof(RegTableGlobal) / sizeof(RI_Register_t))},
+  {RegTableM1, (uint16_t)(sizeof(RegTableM1) / sizeof(RI_Register_t))},
+#if NBR_OF_MOTORS > 1
+  {RegTableM2, (uint16_t)(sizeof(RegTableM2) / sizeof(RI_Register_t))},
+#endif
+};
+
+/**
+  * @brief  Tells whether a raw register is backed by a component that only exists on Motor 1.
+  */
+static bool RI_IsMotor1OnlyRaw(uint16_t regID)
+{
+  return ((MC_REG_POSITION_STREAM == regID) || (MC_REG_BACKLASH_TABLE == regID)
+          || (MC_REG_HF_CAPTURE_CONFIG == regID) || (MC_REG_HF_CAPTURE_DATA == regID)
+          || (MC_REG_FREQ_RESP_CONFIG == regID) || (MC_REG_FREQ_RESP_DATA == regID));
+}
+
+/**
+  * @brief  Looks for a register in the descriptor table of a motor, by binary search.
+  *
+  *  The tables must be sorted by regID, Utilities/host_tests/test_ri_lookup checks it.
+  *
+  * @param  motorID 0 for the Global registers, 1 for Motor 1, 2 for Motor 2
+  * @param  regID Register ID, type included
+  *
+  * @retval Returns the descriptor of the register, NULL if it is not known.
+  */
+static const RI_Register_t *RI_FindRegister(uint8_t motorID, uint16_t regID)
+{
+  const RI_Register_t *pTable = RegTables[motorID].pTable;
+  const RI_Register_t *pReg = MC_NULL;
+  uint16_t low = 0U;
+  uint16_t high = RegTables[motorID].nbrOfRegs;
+  uint16_t mid;
+
+  while ((low < high) && (MC_NULL == pReg))
+  {
+    mid = (low + high) / 2U;
+    if (pTable[mid].regID < regID)
+    {
+      low = mid + 1U;
+    }
+    else if (pTable[mid].regID > regID)
+    {
+      high = mid;
+    }
+    else
+    {
+      pReg = &pTable[mid];
     }
+  }
+  return (pReg);
+}
 
-    case TYPE_DATA_32BIT:
+/**
+  * @brief  Returns the address of the variable holding the value of a register, NULL if there is none.
+  */
+static void *RI_GetValuePtr(const RI_Register_t *pReg)
+{
+  uint8_t *pBase;
+
+  if ((pReg->flags & RI_VALUE_FOCVARS) != 0U)
+  {
+    pBase = (uint8_t *)((const MCI_Handle_t *)pReg->pObj)->pFOCVars; //cstat !MISRAC2012-Rule-11.3
+  }
+  else
+  {
+    pBase = (uint8_t *)pReg->pValue;
+  }
+  return ((MC_NULL == pBase) ? MC_NULL : &pBase[pReg->offset]);
+}
+
+/**
+  * @brief  Writes an 8, 16 or 32 bits register.
+  *
+  * @param  motorID 0 for the Global registers, 1 for Motor 1, 2 for Motor 2
+  * @param  regID Register ID, type included
+  * @param  data Value to write
+  * @param  size Returns the size of the register
+  *
+  * @retval Returns #MCP_CMD_OK, or #MCP_ERROR_RO_REG / #MCP_ERROR_UNKNOWN_REG.
+  */
+static uint8_t RI_SetScalar(uint8_t motorID, uint16_t regID, const uint8_t *data, uint16_t *size)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  const RI_Register_t *pReg = RI_FindRegister(motorID, regID);
+
+  *size = RI_GetIDSize(regID);
+  if ((MC_NULL == pReg) || ((pReg->flags & RI_WRITE_UNKNOWN) != 0U))
+  {
+    retVal = MCP_ERROR_UNKNOWN_REG;
+  }
+  else if (0U == (pReg->flags & RI_ACCESS_WRITE))
+  {
+    retVal = MCP_ERROR_RO_REG;
+  }
+  else if (pReg->setFct != MC_NULL)
+  {
+    retVal = pReg->setFct(pReg->pObj, data);
+  }
+  else
+  {
+    void *pValue = RI_GetValuePtr(pReg);
+    if (pValue != MC_NULL)
+    {
+      (void)memcpy(pValue, data, *size);
+    }
+    else
     {
-      uint32_t regdata32 = *(uint32_t *)data; //cstat !MISRAC2012-Rule-11.3
+      /* Nothing to do, the write is ignored */
+    }
+  }
+  return (retVal);
+}
 
-      switch (regID)
-      {
-        case MC_REG_FAULTS_FLAGS:
-        case MC_REG_SPEED_MEAS:
-        {
-          retVal = MCP_ERROR_RO_REG;
-          break;
-        }
+/**
+  * @brief  Reads an 8, 16 or 32 bits register.
+  *
+  * @param  motorID 0 for the Global registers, 1 for Motor 1, 2 for Motor 2
+  * @param  regID Register ID, type included
+  * @param  data Returns the value
+  * @param  size Returns the size of the register
+  * @param  freeSpace Space available in data
+  *
+  * @retval Returns #MCP_CMD_OK, or #MCP_ERROR_NO_TXSYNC_SPACE / #MCP_ERROR_UNKNOWN_REG.
+  */
+static uint8_t RI_GetScalar(uint8_t motorID, uint16_t regID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  uint8_t regSize = RI_GetIDSize(regID);
 
-        case MC_REG_SPEED_REF:
-        {
-          MCI_ExecSpeedRamp(pMCIN,((((int16_t)regdata32) * ((int16_t)SPEED_UNIT)) / (int16_t)U_RPM), 0);
-          break;
-        }
+  if (freeSpace < (int16_t)regSize)
+  {
+    retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+  }
+  else
+  {
+    const RI_Register_t *pReg = RI_FindRegister(motorID, regID);
 
-        default:
-        {
-          retVal = MCP_ERROR_UNKNOWN_REG;
-          break;
-        }
+    *size = regSize;
+    if ((MC_NULL == pReg) || (0U == (pReg->flags & RI_ACCESS_READ)))
+    {
+      retVal = MCP_ERROR_UNKNOWN_REG;
+    }
+    else if (pReg->getFct != MC_NULL)
+    {
+      pReg->getFct(pReg->pObj, data);
+    }
+    else
+    {
+      const void *pValue = RI_GetValuePtr(pReg);
+      if (pValue != MC_NULL)
+      {
+        (void)memcpy(data, pValue, regSize);
+      }
+      else
+      {
+        /* Nothing to do, the value is left unchanged */
       }
-      *size = 4;
+    }
+  }
+  return (retVal);
+}
+
+uint8_t RI_SetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  switch(typeID)
+  {
+    case TYPE_DATA_8BIT:
+    case TYPE_DATA_16BIT:
+    case TYPE_DATA_32BIT:
+    {
+      retVal = RI_SetScalar(0U, regID, data, size);
       break;
     }
 
@@ -517,64 +938,16 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
             break;
           }
 
-          case MC_REG_SPEED_RAMP:
+          default:
           {
-            int32_t rpm;
-            uint16_t duration;
-
-            rpm = *(int32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
-            duration = *(uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
-            MCI_ExecSpeedRamp(pMCIN, (int16_t)((rpm * SPEED_UNIT) / U_RPM), duration);
+            retVal = MCP_ERROR_UNKNOWN_REG;
             break;
           }
+        }
 
-          case MC_REG_TORQUE_RAMP:
-          {
-            uint32_t torque;
-            uint16_t duration;
-
-            torque = *(uint32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
-            duration = *(uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
-            MCI_ExecTorqueRamp(pMCIN, (int16_t)torque, duration);
-            break;
-          }
-
-          case MC_REG_POSITION_RAMP:
-          {
-            FloatToU32 Position;
-            FloatToU32 Duration;
-            /* 32 bits access are split into 2x16 bits access */
-            Position.U32_Val = ((int32_t)(*(int16_t *)&rawData[2]))<<16 | *(uint16_t *)rawData;
-            /* 32 bits access are split into 2x16 bits access */
-            Duration.U32_Val = ((int32_t)(*(int16_t *)&rawData[6]))<<16 | *(uint16_t *)&rawData[4];
-            MCI_ExecPositionCommand(pMCIN, Position.Float_Val, Duration.Float_Val);
-            break;
-          }
-
-          case MC_REG_CURRENT_REF:
-          {
-            qd_t currComp;
-            currComp.q = *((int16_t *) rawData); //cstat !MISRAC2012-Rule-11.3
-            currComp.d = *((int16_t *) &rawData[2]); //cstat !MISRAC2012-Rule-11.3
-            MCI_SetCurrentReferences(pMCIN, currComp);
-            break;
-          }
-
-          case MC_REG_ASYNC_UARTA:
-          {
-            retVal =  MCPA_cfgLog (&MCPA_UART_A, rawData);
-            break;
-          }
-
-          default:
-          {
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            break;
-          }
-        }
-      }
-      break;
-    }
+      }
+      break;
+    }
 
     default:
     {
@@ -586,562 +959,329 @@ uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint
   return (retVal);
 }
 
-uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16_t *size,int16_t freeSpace){
-    uint8_t retVal = MCP_CMD_OK;
-    uint8_t motorID=0;
-    MCI_Handle_t *pMCIN = &Mci[motorID];
-    switch (typeID)
-    {
-      case TYPE_DATA_8BIT:
-      {
-        if (freeSpace > 0)
-        {
-          switch (regID)
-          {
-            default:
-            {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
-            }
-          }
-          *size = 1;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
-        }
-        break;
-      }
-
-      case TYPE_DATA_16BIT:
-      {
-       int16_t *regdata16 = (int16_t *) data; //cstat !MISRAC2012-Rule-11.3
-        if (freeSpace >= 2)
-        {
-          switch (regID)
-          {
-            case MC_REG_DAC_OUT1:
-            {
-              *regdata16 = (int16_t)DAC_GetChannelConfig(&DAC_Handle , DAC_CH1);
-              break;
-            }
-
-            case MC_REG_DAC_OUT2:
-            {
-              *regdata16 = (int16_t)DAC_GetChannelConfig(&DAC_Handle , DAC_CH2);
-              break;
-            }
-            case MC_REG_DAC_USER1:
-            case MC_REG_DAC_USER2:
-              break;
-
-            default:
-            {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
-            }
-          }
-          *size = 2;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
-        }
-        break;
-      }
-
-      case TYPE_DATA_32BIT:
-      {
-        uint32_t *regdataU32 = (uint32_t *)data; //cstat !MISRAC2012-Rule-11.3
-        if (freeSpace >= 4)
-        {
-          switch (regID)
-          {
-            case MC_REG_PERF_CPU_LOAD:
-            {
-              FloatToU32 ReadVal;
-              ReadVal.Float_Val = MC_Perf_GetCPU_Load(pMCIN->pPerfMeasure);
-              *regdataU32 = ReadVal.U32_Val;
-              break;
-            }
-
-            case MC_REG_PERF_MIN_CPU_LOAD:
-            {
-              FloatToU32 ReadVal;
-              ReadVal.Float_Val = MC_Perf_GetMinCPU_Load(pMCIN->pPerfMeasure);
-              *regdataU32 = ReadVal.U32_Val;
-              break;
-            }
-
-            case MC_REG_PERF_MAX_CPU_LOAD:
-            {
-              FloatToU32 ReadVal;
-              ReadVal.Float_Val = MC_Perf_GetMaxCPU_Load(pMCIN->pPerfMeasure);
-              *regdataU32 = ReadVal.U32_Val;
-              break;
-            }
-
-            default:
-            {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
-            }
-          }
-          *size = 4;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
-        }
-        break;
-      }
-
-      case TYPE_DATA_STRING:
-      {
-        char_t *charData = (char_t *)data;
-        switch (regID)
-        {
-          case MC_REG_FW_NAME:
-            retVal = RI_MovString (FIRMWARE_NAME ,charData, size, freeSpace);
-            break;
-
-          case MC_REG_CTRL_STAGE_NAME:
-          {
-            retVal = RI_MovString (CTL_BOARD ,charData, size, freeSpace);
-            break;
-          }
-          default:
-          {
-
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            *size= 0 ; /* */
-
-            break;
-          }
-        }
-        break;
-
-      }
-      case TYPE_DATA_RAW:
-      {
-        /* First 2 bytes of the answer is reserved to the size */
-        uint16_t *rawSize = (uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
-        uint8_t * rawData = data;
-        rawData++;
-        rawData++;
-
-        switch (regID)
-        {
-          case MC_REG_GLOBAL_CONFIG:
-          {
-            *rawSize = (uint16_t)sizeof(GlobalConfig_reg_t);
-            if (((*rawSize) + 2U) > (uint16_t)freeSpace)
-            {
-              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
-            }
-            else
-            {
-              (void)memcpy(rawData, &globalConfig_reg, sizeof(GlobalConfig_reg_t));
-            }
-            break;
-          }
-          case MC_REG_ASYNC_UARTA:
-          case MC_REG_ASYNC_UARTB:
-          case MC_REG_ASYNC_STLNK:
-          default:
-          {
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            break;
-          }
-        }
-
-        /* Size of the answer is size of the data + 2 bytes containing data size */
-        *size = (*rawSize) + 2U;
-        break;
-      }
-
-      default:
-      {
-        retVal = MCP_ERROR_BAD_DATA_TYPE;
-        break;
-      }
-    }
-  return (retVal);
-}
-
-  uint8_t RI_GetRegisterMotor1(uint16_t regID,uint8_t typeID,uint8_t * data,uint16_t *size,int16_t freeSpace) {
-    uint8_t retVal = MCP_CMD_OK;
-    uint8_t motorID=0;
-    MCI_Handle_t *pMCIN = &Mci[motorID];
-    BusVoltageSensor_Handle_t* BusVoltageSensor= &BusVoltageSensor_M1._Super;
-    switch (typeID)
-    {
-      case TYPE_DATA_8BIT:
-      {
-        if (freeSpace > 0)
-        {
-          switch (regID)
-          {
-            case MC_REG_STATUS:
-            {
-              *data = (uint8_t)MCI_GetSTMState(pMCIN);
-              break;
-            }
-
-            case MC_REG_CONTROL_MODE:
-            {
-              *data = (uint8_t)MCI_GetControlMode(pMCIN);
-              break;
-            }
-
-            case MC_REG_POSITION_CTRL_STATE:
-            {
-              *data = (uint8_t) TC_GetControlPositionStatus(&PosCtrlM1);
-              break;
-            }
-
-            case MC_REG_POSITION_ALIGN_STATE:
-            {
-              *data = (uint8_t) TC_GetAlignmentStatus(&PosCtrlM1);
-              break;
-            }
-
-            default:
-            {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
-            }
-          }
-          *size = 1;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
-        }
-        break;
-      }
-
-      case TYPE_DATA_16BIT:
-      {
-        uint16_t *regdataU16 = (uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
-        int16_t *regdata16 = (int16_t *) data; //cstat !MISRAC2012-Rule-11.3
-
-        if (freeSpace >= 2)
-        {
-          switch (regID)
-          {
-            case MC_REG_SPEED_KP:
-            {
-              *regdata16 = PID_GetKP(&PIDSpeedHandle_M1);
-              break;
-            }
-
-            case MC_REG_SPEED_KI:
-            {
-              *regdata16 = PID_GetKI(&PIDSpeedHandle_M1);
-              break;
-            }
-
-            case MC_REG_SPEED_KD:
-            {
-              *regdata16 = PID_GetKD(&PIDSpeedHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_Q_KP:
-            {
-              *regdata16 = PID_GetKP(&PIDIqHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_Q_KI:
-            {
-              *regdata16 = PID_GetKI(&PIDIqHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_Q_KD:
-            {
-              *regdata16 = PID_GetKD(&PIDIqHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_D_KP:
-            {
-              *regdata16 = PID_GetKP(&PIDIdHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_D_KI:
-            {
-              *regdata16 = PID_GetKI(&PIDIdHandle_M1);
-              break;
-            }
-
-            case MC_REG_I_D_KD:
-            {
-              *regdata16 = PID_GetKD(&PIDIdHandle_M1);
-              break;
-            }
-
-            case MC_REG_BUS_VOLTAGE:
-            {
-              *regdataU16 = VBS_GetAvBusVoltage_V(BusVoltageSensor);
-              break;
-            }
-
-            case MC_REG_HEATS_TEMP:
-            {
-              *regdata16 = NTC_GetAvTemp_C(&TempSensor_M1);
-              break;
-            }
-
-            case MC_REG_I_A:
-            {
-              *regdata16 = MCI_GetIab(pMCIN).a;
-              break;
-            }
-
-            case MC_REG_I_B:
-            {
-              *regdata16 = MCI_GetIab(pMCIN).b;
-              break;
-            }
-
-            case MC_REG_I_ALPHA_MEAS:
-            {
-              *regdata16 = MCI_GetIalphabeta(pMCIN).alpha;
-              break;
-            }
-
-            case MC_REG_I_BETA_MEAS:
-            {
-              *regdata16 = MCI_GetIalphabeta(pMCIN).beta;
-              break;
-            }
-
-            case MC_REG_I_Q_MEAS:
-            {
-              *regdata16 = MCI_GetIqd(pMCIN).q;
-              break;
-            }
-
-            case MC_REG_I_D_MEAS:
-            {
-              *regdata16 = MCI_GetIqd(pMCIN).d;
-              break;
-            }
-
-            case MC_REG_I_Q_REF:
-            {
-              *regdata16 = MCI_GetIqdref(pMCIN).q;
-              break;
-            }
-
-            case MC_REG_I_D_REF:
-            {
-              *regdata16 = MCI_GetIqdref(pMCIN).d;
-              break;
-            }
+/**
+  * @brief  Writes a register of a motor.
+  *
+  * @param  motorID Motor reference number, M1 or M2
+  */
+static uint8_t RI_SetRegisterMotor(uint8_t motorID, uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size,
+                                   int16_t dataAvailable)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  MCI_Handle_t *pMCIN = &Mci[motorID];
 
-            case MC_REG_V_Q:
-            {
-              *regdata16 = MCI_GetVqd(pMCIN).q;
-              break;
-            }
+  switch(typeID)
+  {
+    case TYPE_DATA_8BIT:
+    case TYPE_DATA_16BIT:
+    case TYPE_DATA_32BIT:
+    {
+      retVal = RI_SetScalar(motorID + 1U, regID, data, size);
+      break;
+    }
 
-            case MC_REG_V_D:
-            {
-              *regdata16 = MCI_GetVqd(pMCIN).d;
-              break;
-            }
+    case TYPE_DATA_STRING:
+    {
+      const char_t *charData = (const char_t *)data;
+      char_t *dummy = (char_t *)data;
+      retVal = MCP_ERROR_RO_REG;
+      /* Used to compute String length stored in RXBUFF even if Reg does not exist */
+      /* It allows to jump to the next command in the buffer */
+      (void)RI_MovString(charData, dummy, size, dataAvailable);
+      break;
+    }
 
-            case MC_REG_V_ALPHA:
-            {
-              *regdata16 = MCI_GetValphabeta(pMCIN).alpha;
-              break;
-            }
+    case TYPE_DATA_RAW:
+    {
+      uint16_t rawSize = *(uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
+      /* The size consumed by the structure is the structure size + 2 bytes used to store the size */
+      *size = rawSize + 2U;
+      uint8_t *rawData = data; /* rawData points to the first data (after size extraction) */
+      rawData++;
+      rawData++;
 
-            case MC_REG_V_BETA:
-            {
-              *regdata16 = MCI_GetValphabeta(pMCIN).beta;
-              break;
-            }
+      if (*size > (uint16_t)dataAvailable)
+      {
+        /* The decoded size of the raw structure can not match with transmitted buffer, error in buffer
+           construction */
+        *size = 0;
+        retVal = MCP_ERROR_BAD_RAW_FORMAT; /* This error stop the parsing of the CMD buffer */
+      }
+      else if ((motorID != M1) && RI_IsMotor1OnlyRaw(regID))
+      {
+        retVal = MCP_ERROR_UNKNOWN_REG;
+      }
+      else
+      {
+        switch (regID)
+        {
+          case MC_REG_APPLICATION_CONFIG:
+          case MC_REG_MOTOR_CONFIG:
+          case MC_REG_GLOBAL_CONFIG:
+          case MC_REG_FOCFW_CONFIG:
+          {
+            retVal = MCP_ERROR_RO_REG;
+            break;
+          }
 
-            case MC_REG_ENCODER_EL_ANGLE:
-            {
-              *regdata16 = SPD_GetElAngle ((SpeednPosFdbk_Handle_t*) &ENCODER_M1); //cstat !MISRAC2012-Rule-11.3
-              break;
-            }
+          case MC_REG_SPEED_RAMP:
+          {
+            int32_t rpm;
+            uint16_t duration;
 
-            case MC_REG_ENCODER_SPEED:
-            {
-              *regdata16 = SPD_GetS16Speed ((SpeednPosFdbk_Handle_t*) &ENCODER_M1); //cstat !MISRAC2012-Rule-11.3
-              break;
-            }
+            rpm = *(int32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
+            duration = *(uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
+            MCI_ExecSpeedRamp(pMCIN, (int16_t)((rpm * SPEED_UNIT) / U_RPM), duration);
+            break;
+          }
 
-            case MC_REG_DAC_USER1:
-            case MC_REG_DAC_USER2:
-              break;
+          case MC_REG_TORQUE_RAMP:
+          {
+            uint32_t torque;
+            uint16_t duration;
 
-            case MC_REG_POSITION_KP:
-            {
-              *regdata16 = PID_GetKP( &PID_PosParamsM1);
-              break;
-            }
+            torque = *(uint32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
+            duration = *(uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
+            MCI_ExecTorqueRamp(pMCIN, (int16_t)torque, duration);
+            break;
+          }
 
-            case MC_REG_POSITION_KI:
-            {
-              *regdata16 = PID_GetKI( &PID_PosParamsM1);
-              break;
-            }
+          case MC_REG_POSITION_RAMP:
+          {
+            FloatToU32 Position;
+            FloatToU32 Duration;
+            /* 32 bits access are split into 2x16 bits access */
+            Position.U32_Val = ((int32_t)(*(int16_t *)&rawData[2]))<<16 | *(uint16_t *)rawData;
+            /* 32 bits access are split into 2x16 bits access */
+            Duration.U32_Val = ((int32_t)(*(int16_t *)&rawData[6]))<<16 | *(uint16_t *)&rawData[4];
+            MCI_ExecPositionCommand(pMCIN, Position.Float_Val, Duration.Float_Val);
+            break;
+          }
 
-            case MC_REG_POSITION_KD:
-            {
-              *regdata16 = PID_GetKD( &PID_PosParamsM1);
-              break;
-            }
+          case MC_REG_POSITION_STREAM:
+          {
+            retVal = SPS_WriteBlock(&SetpointStreamM1, rawData, rawSize);
+            break;
+          }
 
-            case MC_REG_SPEED_KP_DIV:
+          case MC_REG_BACKLASH_TABLE:
+          {
+            /* Same layout as the read access, the table size can not be changed */
+            float positionMin = 0.0f;
+            float positionMax = 0.0f;
+            if ((rawData[0] != BacklashCompM1.TableSize)
+               || (rawSize != (BLC_TABLE_HEADER_SIZE + (2U * (uint16_t)BacklashCompM1.TableSize))))
             {
-              *regdataU16 = (uint16_t)PID_GetKPDivisorPOW2(&PIDSpeedHandle_M1);
-              break;
+              retVal = MCP_ERROR_BAD_RAW_FORMAT;
             }
-
-            case MC_REG_SPEED_KI_DIV:
+            else
             {
-              *regdataU16 = (uint16_t)PID_GetKIDivisorPOW2(&PIDSpeedHandle_M1);
-              break;
+              (void)memcpy(&positionMin, &rawData[8], 4);
+              (void)memcpy(&positionMax, &rawData[12], 4);
             }
 
-            case MC_REG_SPEED_KD_DIV:
+            if (retVal != MCP_CMD_OK)
             {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDSpeedHandle_M1);
-              break;
+              /* Nothing to do */
             }
-            case MC_REG_I_D_KP_DIV:
+            else if (false == (positionMin < positionMax))
             {
-              *regdataU16 = PID_GetKPDivisorPOW2(&PIDIdHandle_M1);
-              break;
+              /* The table points are spread from PositionMin to PositionMax, NaN is also rejected */
+              retVal = MCP_ERROR_BAD_RAW_FORMAT;
             }
-
-            case MC_REG_I_D_KI_DIV:
+            else if ((BLC_GetLearnState(&BacklashCompM1) >= BLC_LEARN_PRELOAD)
+                     && (BLC_GetLearnState(&BacklashCompM1) <= BLC_LEARN_REVERSE))
             {
-              *regdataU16 = PID_GetKIDivisorPOW2(&PIDIdHandle_M1);
-              break;
+              /* The table is being learnt */
+              retVal = MCP_ERROR_REGISTER_ACCESS;
             }
-
-            case MC_REG_I_D_KD_DIV:
+            else
             {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDIdHandle_M1);
-              break;
+              (void)memcpy(&BacklashCompM1.Hysteresis, &rawData[2], 2);
+              (void)memcpy(&BacklashCompM1.TakeUpRate, &rawData[4], 2);
+              (void)memcpy(&BacklashCompM1.EngageTorque, &rawData[6], 2);
+              BacklashCompM1.PositionMin = positionMin;
+              BacklashCompM1.PositionMax = positionMax;
+              (void)memcpy(BacklashCompM1.pTable, &rawData[BLC_TABLE_HEADER_SIZE],
+                           2U * (uint16_t)BacklashCompM1.TableSize);
+              BLC_Init(&BacklashCompM1);
             }
+            break;
+          }
 
-            case MC_REG_I_Q_KP_DIV:
-            {
-              *regdataU16 = PID_GetKPDivisorPOW2(&PIDIqHandle_M1);
-              break;
-            }
+          case MC_REG_HF_CAPTURE_CONFIG:
+          {
+            retVal = HFC_SetConfig(&HFCaptureM1, rawData, rawSize);
+            break;
+          }
 
-            case MC_REG_I_Q_KI_DIV:
-            {
-              *regdataU16 = PID_GetKIDivisorPOW2(&PIDIqHandle_M1);
-              break;
-            }
+          case MC_REG_HF_CAPTURE_DATA:
+          {
+            retVal = MCP_ERROR_RO_REG;
+            break;
+          }
 
-            case MC_REG_I_Q_KD_DIV:
-            {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PIDIqHandle_M1);
-              break;
-            }
+          case MC_REG_FREQ_RESP_CONFIG:
+          {
+            retVal = FRA_SetConfig(&FreqRespM1, rawData, rawSize);
+            break;
+          }
 
-            case MC_REG_POSITION_KP_DIV:
-            {
-              *regdataU16 = PID_GetKPDivisorPOW2(&PID_PosParamsM1);
-              break;
-            }
+          case MC_REG_FREQ_RESP_DATA:
+          {
+            retVal = MCP_ERROR_RO_REG;
+            break;
+          }
 
-            case MC_REG_POSITION_KI_DIV:
-            {
-              *regdataU16 = PID_GetKIDivisorPOW2(&PID_PosParamsM1);
-              break;
-            }
+          case MC_REG_CURRENT_REF:
+          {
+            qd_t currComp;
+            currComp.q = *((int16_t *) rawData); //cstat !MISRAC2012-Rule-11.3
+            currComp.d = *((int16_t *) &rawData[2]); //cstat !MISRAC2012-Rule-11.3
+            MCI_SetCurrentReferences(pMCIN, currComp);
+            break;
+          }
 
-            case MC_REG_POSITION_KD_DIV:
-            {
-              *regdataU16 = PID_GetKDDivisorPOW2(&PID_PosParamsM1);
-              break;
-            }
+          case MC_REG_ASYNC_UARTA:
+          {
+            retVal =  MCPA_cfgLog (&MCPA_UART_A, rawData, rawSize);
+            break;
+          }
 
-            default:
-            {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
-            }
+          default:
+          {
+            retVal = MCP_ERROR_UNKNOWN_REG;
+            break;
           }
-          *size = 2;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
         }
-        break;
       }
+      break;
+    }
+
+    default:
+    {
+      retVal = MCP_ERROR_BAD_DATA_TYPE;
+      *size =0; /* From this point we are not able anymore to decode the RX buffer */
+      break;
+    }
+  }
+  return (retVal);
+}
+
+uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  return (RI_SetRegisterMotor(M1, regID, typeID, data, size, dataAvailable));
+}
+
+#if NBR_OF_MOTORS > 1
+uint8_t RI_SetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  return (RI_SetRegisterMotor(M2, regID, typeID, data, size, dataAvailable));
+}
+#endif
 
+uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16_t *size,int16_t freeSpace){
+    uint8_t retVal = MCP_CMD_OK;
+    switch (typeID)
+    {
+      case TYPE_DATA_8BIT:
+      case TYPE_DATA_16BIT:
       case TYPE_DATA_32BIT:
       {
-        uint32_t *regdataU32 = (uint32_t *)data; //cstat !MISRAC2012-Rule-11.3
-        int32_t *regdata32 = (int32_t *)data; //cstat !MISRAC2012-Rule-11.3
+        retVal = RI_GetScalar(0U, regID, data, size, freeSpace);
+        break;
+      }
 
-        if (freeSpace >= 4)
+      case TYPE_DATA_STRING:
+      {
+        char_t *charData = (char_t *)data;
+        switch (regID)
         {
-          switch (regID)
+          case MC_REG_FW_NAME:
+            retVal = RI_MovString (FIRMWARE_NAME ,charData, size, freeSpace);
+            break;
+
+          case MC_REG_CTRL_STAGE_NAME:
+          {
+            retVal = RI_MovString (CTL_BOARD ,charData, size, freeSpace);
+            break;
+          }
+          default:
           {
-            case MC_REG_FAULTS_FLAGS:
-            {
-              *regdataU32 = MCI_GetFaultState(pMCIN);
-              break;
-            }
-            case MC_REG_SPEED_MEAS:
-            {
-              *regdata32 = (((int32_t)MCI_GetAvrgMecSpeedUnit(pMCIN) * U_RPM) / SPEED_UNIT);
-              break;
-            }
 
-            case MC_REG_SPEED_REF:
-            {
-              *regdata32 = (((int32_t)MCI_GetMecSpeedRefUnit(pMCIN) * U_RPM) / SPEED_UNIT);
-              break;
-            }
+            retVal = MCP_ERROR_UNKNOWN_REG;
+            *size= 0 ; /* */
 
-            case MC_REG_CURRENT_POSITION:
-            {
-              FloatToU32 ReadVal;
-              ReadVal.Float_Val = MCI_GetCurrentPosition(pMCIN);
-              *regdataU32 = ReadVal.U32_Val;
-              break;
-            }
+            break;
+          }
+        }
+        break;
+
+      }
+      case TYPE_DATA_RAW:
+      {
+        /* First 2 bytes of the answer is reserved to the size */
+        uint16_t *rawSize = (uint16_t *)data; //cstat !MISRAC2012-Rule-11.3
+        uint8_t * rawData = data;
+        rawData++;
+        rawData++;
 
-            case MC_REG_MOTOR_POWER:
+        switch (regID)
+        {
+          case MC_REG_GLOBAL_CONFIG:
+          {
+            *rawSize = (uint16_t)sizeof(GlobalConfig_reg_t);
+            if (((*rawSize) + 2U) > (uint16_t)freeSpace)
             {
-              FloatToU32 ReadVal; //cstat !MISRAC2012-Rule-19.2
-              ReadVal.Float_Val = PQD_GetAvrgElMotorPowerW(pMPM[M1]);
-              *regdataU32 = ReadVal.U32_Val; //cstat !UNION-type-punning
-              break;
+              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
             }
-
-            default:
+            else
             {
-              retVal = MCP_ERROR_UNKNOWN_REG;
-              break;
+              (void)memcpy(rawData, &globalConfig_reg, sizeof(GlobalConfig_reg_t));
             }
+            break;
+          }
+          case MC_REG_ASYNC_UARTA:
+          case MC_REG_ASYNC_UARTB:
+          case MC_REG_ASYNC_STLNK:
+          default:
+          {
+            retVal = MCP_ERROR_UNKNOWN_REG;
+            break;
           }
-          *size = 4;
-        }
-        else
-        {
-          retVal = MCP_ERROR_NO_TXSYNC_SPACE;
         }
+
+        /* Size of the answer is size of the data + 2 bytes containing data size */
+        *size = (*rawSize) + 2U;
+        break;
+      }
+
+      default:
+      {
+        retVal = MCP_ERROR_BAD_DATA_TYPE;
+        break;
+      }
+    }
+  return (retVal);
+}
+
+/**
+  * @brief  Reads a register of a motor.
+  *
+  * @param  motorID Motor reference number, M1 or M2
+  */
+  static uint8_t RI_GetRegisterMotor(uint8_t motorID, uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size,
+                                     int16_t freeSpace)
+  {
+    uint8_t retVal = MCP_CMD_OK;
+    MCI_Handle_t *pMCIN = &Mci[motorID];
+    switch (typeID)
+    {
+      case TYPE_DATA_8BIT:
+      case TYPE_DATA_16BIT:
+      case TYPE_DATA_32BIT:
+      {
+        retVal = RI_GetScalar(motorID + 1U, regID, data, size, freeSpace);
         break;
       }
 
@@ -1180,118 +1320,228 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
         rawData++;
         rawData++;
 
-        switch (regID)
+        if ((motorID != M1) && RI_IsMotor1OnlyRaw(regID))
         {
-          case MC_REG_APPLICATION_CONFIG:
+          /* Set-point stream, backlash compensation, HF capture and frequency response only exist on Motor 1 */
+          *rawSize = 0U;
+          retVal = MCP_ERROR_UNKNOWN_REG;
+        }
+        else
+        {
+          switch (regID)
           {
-            *rawSize = (uint16_t)sizeof(ApplicationConfig_reg_t);
-            if (((*rawSize) + 2U) > (uint16_t)freeSpace)
-            {
-              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+            case MC_REG_APPLICATION_CONFIG:
+            {
+              *rawSize = (uint16_t)sizeof(ApplicationConfig_reg_t);
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                ApplicationConfig_reg_t const *pApplicationConfig_reg = ApplicationConfig_reg[motorID];
+                (void)memcpy(rawData, (const uint8_t *)pApplicationConfig_reg, sizeof(ApplicationConfig_reg_t));
+              }
+              break;
             }
-            else
+
+            case MC_REG_MOTOR_CONFIG:
             {
-              ApplicationConfig_reg_t const *pApplicationConfig_reg = ApplicationConfig_reg[motorID];
-              (void)memcpy(rawData, (const uint8_t *)pApplicationConfig_reg, sizeof(ApplicationConfig_reg_t));
+              *rawSize = (uint16_t)sizeof(MotorConfig_reg_t);
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                MotorConfig_reg_t const *pMotorConfig_reg = MotorConfig_reg[motorID];
+                (void)memcpy(rawData, (const uint8_t *)pMotorConfig_reg, sizeof(MotorConfig_reg_t));
+              }
+              break;
             }
-            break;
-          }
 
-          case MC_REG_MOTOR_CONFIG:
-          {
-            *rawSize = (uint16_t)sizeof(MotorConfig_reg_t);
-            if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+            case MC_REG_FOCFW_CONFIG:
             {
-              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              *rawSize = (uint16_t)sizeof(FOCFwConfig_reg_t);
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                FOCFwConfig_reg_t const *pFOCConfig_reg = FOCConfig_reg[motorID];
+                (void)memcpy(rawData, (const uint8_t *)pFOCConfig_reg, sizeof(FOCFwConfig_reg_t));
+              }
+
+              break;
             }
-            else
+            case MC_REG_SCALE_CONFIG:
+            {
+              *rawSize = 12;
+              if ((*rawSize) +2U > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                memcpy(rawData, pMCIN->pScale, sizeof(ScaleParams_t) );
+              }
+              break;
+            }
+            case MC_REG_SPEED_RAMP:
             {
-              MotorConfig_reg_t const *pMotorConfig_reg = MotorConfig_reg[motorID];
-              (void)memcpy(rawData, (const uint8_t *)pMotorConfig_reg, sizeof(MotorConfig_reg_t));
+              int32_t *rpm = (int32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
+              uint16_t *duration = (uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
+              *rpm = (((int32_t)MCI_GetLastRampFinalSpeed(pMCIN) * U_RPM) / (int32_t)SPEED_UNIT);
+              *duration = MCI_GetLastRampFinalDuration(pMCIN);
+              *rawSize = 6;
+              break;
             }
-            break;
-          }
 
-          case MC_REG_FOCFW_CONFIG:
-          {
-            *rawSize = (uint16_t)sizeof(FOCFwConfig_reg_t);
-            if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+            case MC_REG_TORQUE_RAMP:
             {
-              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              int16_t *torque = (int16_t *)rawData; //cstat !MISRAC2012-Rule-11.3
+              uint16_t *duration = (uint16_t *)&rawData[2]; //cstat !MISRAC2012-Rule-11.3
+
+              *rawSize = 4;
+              *torque = MCI_GetLastRampFinalTorque(pMCIN);
+              *duration = MCI_GetLastRampFinalDuration(pMCIN) ;
+              break;
             }
-            else
+
+            case MC_REG_CURRENT_REF:
             {
-              FOCFwConfig_reg_t const *pFOCConfig_reg = FOCConfig_reg[motorID];
-              (void)memcpy(rawData, (const uint8_t *)pFOCConfig_reg, sizeof(FOCFwConfig_reg_t));
+              uint16_t *iqref = (uint16_t *)rawData; //cstat !MISRAC2012-Rule-11.3
+              uint16_t *idref = (uint16_t *)&rawData[2]; //cstat !MISRAC2012-Rule-11.3
+
+              *rawSize = 4;
+              *iqref = (uint16_t)MCI_GetIqdref(pMCIN).q;
+              *idref = (uint16_t)MCI_GetIqdref(pMCIN).d;
+              break;
             }
 
-            break;
-          }
-          case MC_REG_SCALE_CONFIG:
-          {
-            *rawSize = 12;
-            if ((*rawSize) +2U > (uint16_t)freeSpace)
+            case MC_REG_POSITION_RAMP:
             {
-              retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              float Position;
+              float Duration;
+
+              *rawSize = 8;
+              Position = TC_GetMoveDuration(pMCIN->pPosCtrl);   /* Does this duration make sense ? */
+              Duration = TC_GetTargetPosition(pMCIN->pPosCtrl);
+              (void)memcpy(rawData, &Position, 4);
+              (void)memcpy(&rawData[4], &Duration, 4);
+              break;
             }
-            else
-            {
-              memcpy(rawData, &scaleParams_M1, sizeof(ScaleParams_t) );
+
+            case MC_REG_POSITION_STREAM:
+            {
+              *rawSize = 20;
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                uint16_t level = SPS_GetLevel(&SetpointStreamM1);
+                rawData[0] = (uint8_t)SPS_GetState(&SetpointStreamM1);
+                rawData[1] = SetpointStreamM1.Flags;
+                (void)memcpy(&rawData[2], &level, 2);
+                (void)memcpy(&rawData[4], &SetpointStreamM1.NextTimestamp, 4);
+                (void)memcpy(&rawData[8], &SetpointStreamM1.Underruns, 4);
+                (void)memcpy(&rawData[12], &SetpointStreamM1.Overruns, 4);
+                (void)memcpy(&rawData[16], &SetpointStreamM1.Discontinuities, 4);
+              }
+              break;
             }
-            break;
-          }
-          case MC_REG_SPEED_RAMP:
-          {
-            int32_t *rpm = (int32_t *)rawData; //cstat !MISRAC2012-Rule-11.3
-            uint16_t *duration = (uint16_t *)&rawData[4]; //cstat !MISRAC2012-Rule-11.3
-            *rpm = (((int32_t)MCI_GetLastRampFinalSpeed(pMCIN) * U_RPM) / (int32_t)SPEED_UNIT);
-            *duration = MCI_GetLastRampFinalDuration(pMCIN);
-            *rawSize = 6;
-            break;
-          }
 
-          case MC_REG_TORQUE_RAMP:
-          {
-            int16_t *torque = (int16_t *)rawData; //cstat !MISRAC2012-Rule-11.3
-            uint16_t *duration = (uint16_t *)&rawData[2]; //cstat !MISRAC2012-Rule-11.3
+            case MC_REG_BACKLASH_TABLE:
+            {
+              *rawSize = BLC_TABLE_HEADER_SIZE + (2U * (uint16_t)BacklashCompM1.TableSize);
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                rawData[0] = BacklashCompM1.TableSize;
+                rawData[1] = 0U;
+                (void)memcpy(&rawData[2], &BacklashCompM1.Hysteresis, 2);
+                (void)memcpy(&rawData[4], &BacklashCompM1.TakeUpRate, 2);
+                (void)memcpy(&rawData[6], &BacklashCompM1.EngageTorque, 2);
+                (void)memcpy(&rawData[8], &BacklashCompM1.PositionMin, 4);
+                (void)memcpy(&rawData[12], &BacklashCompM1.PositionMax, 4);
+                (void)memcpy(&rawData[BLC_TABLE_HEADER_SIZE], BacklashCompM1.pTable,
+                             2U * (uint16_t)BacklashCompM1.TableSize);
+              }
+              break;
+            }
 
-            *rawSize = 4;
-            *torque = MCI_GetLastRampFinalTorque(pMCIN);
-            *duration = MCI_GetLastRampFinalDuration(pMCIN) ;
-            break;
-          }
+            case MC_REG_HF_CAPTURE_CONFIG:
+            {
+              *rawSize = (freeSpace > 2) ? HFC_GetConfig(&HFCaptureM1, rawData, (uint16_t)freeSpace - 2U) : 0U;
+              if (0U == *rawSize)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                /* Nothing to do */
+              }
+              break;
+            }
 
-          case MC_REG_CURRENT_REF:
-          {
-            uint16_t *iqref = (uint16_t *)rawData; //cstat !MISRAC2012-Rule-11.3
-            uint16_t *idref = (uint16_t *)&rawData[2]; //cstat !MISRAC2012-Rule-11.3
+            case MC_REG_HF_CAPTURE_DATA:
+            {
+              /* As many frames as the answer can hold, from the frame selected by MC_REG_HF_CAPTURE_OFFSET */
+              if (freeSpace > 2)
+              {
+                retVal = HFC_ReadData(&HFCaptureM1, rawData, (uint16_t)freeSpace - 2U, rawSize);
+              }
+              else
+              {
+                *rawSize = 0U;
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              break;
+            }
 
-            *rawSize = 4;
-            *iqref = (uint16_t)MCI_GetIqdref(pMCIN).q;
-            *idref = (uint16_t)MCI_GetIqdref(pMCIN).d;
-            break;
-          }
+            case MC_REG_FREQ_RESP_CONFIG:
+            {
+              *rawSize = FRA_CONFIG_SIZE;
+              if (((*rawSize) + 2U) > (uint16_t)freeSpace)
+              {
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              else
+              {
+                FRA_GetConfig(&FreqRespM1, rawData);
+              }
+              break;
+            }
 
-          case MC_REG_POSITION_RAMP:
-          {
-            float Position;
-            float Duration;
-
-            *rawSize = 8;
-            Position = TC_GetMoveDuration(&PosCtrlM1);   /* Does this duration make sense ? */
-            Duration = TC_GetTargetPosition(&PosCtrlM1);
-            (void)memcpy(rawData, &Position, 4);
-            (void)memcpy(&rawData[4], &Duration, 4);
-            break;
-          }
+            case MC_REG_FREQ_RESP_DATA:
+            {
+              /* As many points as the answer can hold, from the point selected by MC_REG_FREQ_RESP_OFFSET */
+              if (freeSpace > 2)
+              {
+                retVal = FRA_ReadData(&FreqRespM1, rawData, (uint16_t)freeSpace - 2U, rawSize);
+              }
+              else
+              {
+                *rawSize = 0U;
+                retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+              }
+              break;
+            }
 
-          case MC_REG_ASYNC_UARTA:
-          case MC_REG_ASYNC_UARTB:
-          case MC_REG_ASYNC_STLNK:
-          default:
-          {
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            break;
+            case MC_REG_ASYNC_UARTA:
+            case MC_REG_ASYNC_UARTB:
+            case MC_REG_ASYNC_STLNK:
+            default:
+            {
+              retVal = MCP_ERROR_UNKNOWN_REG;
+              break;
+            }
           }
         }
 
@@ -1309,6 +1559,18 @@ uint8_t RI_GetRegisterGlobal(uint16_t regID,uint8_t typeID,uint8_t * data,uint16
     return (retVal);
   }
 
+uint8_t RI_GetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  return (RI_GetRegisterMotor(M1, regID, typeID, data, size, freeSpace));
+}
+
+#if NBR_OF_MOTORS > 1
+uint8_t RI_GetRegisterMotor2(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  return (RI_GetRegisterMotor(M2, regID, typeID, data, size, freeSpace));
+}
+#endif
+
 uint8_t RI_MovString(const char_t *srcString, char_t *destString, uint16_t *size, int16_t maxSize)
 {
   uint8_t retVal = MCP_CMD_OK;
@@ -1370,11 +1632,20 @@ uint8_t RI_GetIDSize(uint16_t dataID)
   return (result);
 }
 
+/**
+  * @brief  Returns the address of the variable holding the value of a register, for the asynchronous log and the
+  *         DAC. Unknown registers, and registers without such a variable, point to a null value.
+  *
+  * @param  dataID Register ID, type and motor number included
+  * @param  dataPtr Returns the address of the value
+  *
+  * @retval Returns #MCP_CMD_OK, or #MCP_ERROR_UNKNOWN_REG.
+  */
 __weak uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr)
 {
 
   uint8_t retVal = MCP_CMD_OK;
-  static uint16_t nullData16=0;
+  static uint32_t nullData = 0;
 
 #ifdef NULL_PTR_CHECK_REG_INT
   if (MC_NULL == dataPtr)
@@ -1384,121 +1655,80 @@ __weak uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr)
   else
   {
 #endif
+    /* Registers without a valid motor number are looked for in the table of Motor 1 */
+    uint8_t motorID = (uint8_t)(dataID & MOTOR_MASK);
+    const RI_Register_t *pReg = MC_NULL;
+    void *pValue = MC_NULL;
 
-    MCI_Handle_t *pMCIN = &Mci[0];
-    uint16_t regID = dataID & REG_MASK;
-    uint8_t typeID = ((uint8_t)dataID) & TYPE_MASK;
-
-    switch (typeID)
+    if ((0U == motorID) || (motorID > (uint8_t)NBR_OF_MOTORS))
     {
-      case TYPE_DATA_16BIT:
-      {
-        switch (regID)
-        {
-          case MC_REG_I_A:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iab.a);
-             break;
-          }
-
-          case MC_REG_I_B:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iab.b);
-            break;
-          }
-
-          case MC_REG_I_ALPHA_MEAS:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Ialphabeta.alpha);
-            break;
-          }
-
-          case MC_REG_I_BETA_MEAS:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Ialphabeta.beta);
-            break;
-          }
-
-          case MC_REG_I_Q_MEAS:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iqd.q);
-            break;
-          }
-
-          case MC_REG_I_D_MEAS:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iqd.d);
-            break;
-          }
-
-          case MC_REG_I_Q_REF:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iqdref.q);
-            break;
-          }
-
-          case MC_REG_I_D_REF:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Iqdref.d);
-            break;
-          }
-
-          case MC_REG_V_Q:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Vqd.q);
-            break;
-          }
-
-          case MC_REG_V_D:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Vqd.d);
-            break;
-          }
-
-          case MC_REG_V_ALPHA:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Valphabeta.alpha);
-            break;
-          }
-
-          case MC_REG_V_BETA:
-          {
-            *dataPtr = &(pMCIN->pFOCVars->Valphabeta.beta);
-            break;
-          }
-
-          case MC_REG_ENCODER_SPEED:
-          {
-            *dataPtr = &((&ENCODER_M1)->_Super.hAvrMecSpeedUnit);
-            break;
-          }
-
-          case MC_REG_ENCODER_EL_ANGLE:
-          {
-            *dataPtr = &((&ENCODER_M1)->_Super.hElAngle);
-            break;
-          }
+      motorID = 1U;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+    pReg = RI_FindRegister(motorID, dataID & REG_MASK);
 
-          default:
-          {
-            *dataPtr = &nullData16;
-            retVal = MCP_ERROR_UNKNOWN_REG;
-            break;
-          }
-        }
-        break;
-      }
+    if ((pReg != MC_NULL) && ((pReg->flags & RI_ACCESS_READ) != 0U))
+    {
+      pValue = RI_GetValuePtr(pReg);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
 
-      default:
-      {
-        *dataPtr = &nullData16;
-        retVal = MCP_ERROR_UNKNOWN_REG;
-        break;
-      }
+    if (MC_NULL == pValue)
+    {
+      *dataPtr = &nullData;
+      retVal = MCP_ERROR_UNKNOWN_REG;
+    }
+    else
+    {
+      *dataPtr = pValue;
     }
 #ifdef NULL_PTR_CHECK_REG_INT
   }
 #endif
   return (retVal);
 }
+
+/**
+  * @brief  Returns the address of the variable holding the value of a register, when reading this variable is
+  *         exactly what a read access of the register does. Such registers can be read without calling
+  *         RI_GetRegisterGlobal or RI_GetRegisterMotorX.
+  *
+  * @param  motorID 0 for the Global registers, 1 for Motor 1, 2 for Motor 2
+  * @param  regID Register ID, type included
+  * @param  dataPtr Returns the address of the value, NULL if the register has to be read through its accessor
+  *
+  * @retval Returns #MCP_CMD_OK if the register can be read directly, #MCP_CMD_NOK otherwise.
+  */
+uint8_t RI_GetDirectPtr(uint8_t motorID, uint16_t regID, void **dataPtr)
+{
+  uint8_t retVal = MCP_CMD_NOK;
+  const RI_Register_t *pReg = MC_NULL;
+
+  *dataPtr = MC_NULL;
+  if (motorID <= NBR_OF_MOTORS)
+  {
+    pReg = RI_FindRegister(motorID, regID);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if ((pReg != MC_NULL) && ((pReg->flags & RI_ACCESS_READ) != 0U) && (MC_NULL == pReg->getFct))
+  {
+    *dataPtr = RI_GetValuePtr(pReg);
+    retVal = (MC_NULL == *dataPtr) ? MCP_CMD_NOK : MCP_CMD_OK;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (retVal);
+}
 /************************ (C) COPYRIGHT 2023 STMicroelectronics *****END OF FILE****/
@@ -254,9 +254,41 @@ void RCM_RegisterRegConv(RegConv_t *regConv)
   regConv->convHandle = handle;
 }
 
+/*
+ * Returns the regular data register of @p regADC in u16 format, left aligned on 16 bits.
+ *
+ * When the regular oversampling is enabled, the ADC ignores the data alignment and provides the right aligned
+ * accumulation of 2^(OVSR+1) conversions, shifted right by OVSS bits. The result is brought back to 16 bits so that
+ * the clients of the RCM keep the same full scale with or without oversampling.
+ */
+static inline uint16_t RCM_ReadConversionData(ADC_TypeDef *regADC)
+{
+  uint32_t data = LL_ADC_REG_ReadConversionData32(regADC);
+  if (LL_ADC_OVS_DISABLE == (LL_ADC_GetOverSamplingScope(regADC) & LL_ADC_OVS_GRP_REGULAR_CONTINUED))
+  {
+    /* Nothing to do, the alignment is the one configured on the ADC */
+  }
+  else
+  {
+    /* Number of significant bits of the oversampled result */
+    uint32_t width = 12U + (LL_ADC_GetOverSamplingRatio(regADC) >> ADC_CFGR2_OVSR_Pos) + 1U
+                   - (LL_ADC_GetOverSamplingShift(regADC) >> ADC_CFGR2_OVSS_Pos);
+    if (width > 16U)
+    {
+      data >>= (width - 16U);
+    }
+    else
+    {
+      data <<= (16U - width);
+    }
+  }
+  return ((uint16_t)data);
+}
+
 /*
  * This function is used to read the result of a regular conversion.
- * This function polls on the ADC end of conversion.
+ * This function polls on the ADC end of conversion. With the regular oversampling, the end of conversion is set once
+ * all the oversampled conversions are accumulated.
  * As ADC have injected channels for currents sensing,
  * There is no issue to execute regular conversion asynchronously.
  *
@@ -278,7 +310,7 @@ uint16_t RCM_ExecRegularConv (RegConv_t *regConv)
   {
     /* Nothing to do */
   }
-  retVal = LL_ADC_REG_ReadConversionData12(RCM_handle_array[handle]->regADC);
+  retVal = RCM_ReadConversionData(RCM_handle_array[handle]->regADC);
   return (retVal);
 }
 
@@ -0,0 +1,478 @@
+
+/**
+  ******************************************************************************
+  * @file    setpoint_stream.c
+  * @author  LenseDrive
+  * @brief   This file provides firmware functions that implement the following features
+  *          of the Setpoint Stream component of the Motor Control SDK:
+  *           + buffering of timestamped setpoint blocks sent by the host
+  *           + interpolation of the setpoints at the position loop rate
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  * @ingroup SetpointStream
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "string.h"
+#include "setpoint_stream.h"
+#include "mcp.h"
+
+/** @addtogroup MCSDK
+  * @{
+  */
+
+/** @addtogroup PositionControl
+  * @{
+  */
+
+/**
+  * @defgroup SetpointStream Setpoint Stream
+  *
+  * @brief Streamed setpoint channel of the Position Control
+  *
+  * This component is the receive counterpart of the MCPA asynchronous log: the host sends
+  * blocks of equally spaced, timestamped position setpoints (optionally with speed and torque
+  * feed-forward) through the MC_REG_POSITION_STREAM register. They are stored in a ring buffer
+  * and played back at the Medium Frequency Task rate, interpolating between two consecutive
+  * samples (cubic Hermite when speed is provided, linear otherwise).
+  *
+  * Block layout: Flags (u8), NbrOfSamples (u8), SamplePeriod in MF ticks (u16), Timestamp of the
+  * first sample in sample units (u32), then for each sample Position (float, rad) followed by
+  * Speed (float, rad/s) if #SPS_FLAG_SPEED is set and TorqueFF (int16) if #SPS_FLAG_TORQUE is set.
+  *
+  * Samples whose timestamp was already received are discarded, so the host can safely resend
+  * a block. Buffer level, underruns and state are available as registers and can be logged
+  * asynchronously with MCPA.
+  *
+  * A block with #SPS_FLAG_ABORT stops the stream at the current setpoint without stopping the
+  * motor. The stream is also cancelled as soon as another position command (move or follow) is
+  * accepted by the position controller, so that it no longer overwrites that command.
+  *
+  * @{
+  */
+
+/**
+  * @brief  Initializes the Setpoint Stream component.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  * @param  pPosCtrl handler of the Position Control component fed by the stream.
+  */
+void SPS_Init(SPS_Handle_t *pHandle, PosCtrl_Handle_t *pPosCtrl)
+{
+#ifdef NULL_PTR_CHECK_SPS
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->pPosCtrl = pPosCtrl;
+    pHandle->Underruns = 0U;
+    pHandle->Overruns = 0U;
+    pHandle->Discontinuities = 0U;
+    SPS_Clear(pHandle);
+#ifdef NULL_PTR_CHECK_SPS
+  }
+#endif
+}
+
+/**
+  * @brief  Flushes the buffer and stops the stream.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  *
+  * Statistic counters are kept, so that the host can read them after a stop.
+  */
+void SPS_Clear(SPS_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SPS
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    pHandle->WriteIndex = 0U;
+    pHandle->ReadIndex = 0U;
+    pHandle->Level = 0U;
+    pHandle->NextTimestamp = 0U;
+    pHandle->SamplePeriod = 1U;
+    pHandle->Phase = 0U;
+    pHandle->Flags = 0U;
+    pHandle->AbortRequest = false;
+    pHandle->State = SPS_IDLE;
+#ifdef NULL_PTR_CHECK_SPS
+  }
+#endif
+}
+
+/**
+  * @brief  Stores a block of setpoints received from the host.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  * @param  pData pointer on the block, see @ref SetpointStream for the layout.
+  * @param  size size of the block in bytes.
+  * @retval MCP_CMD_OK if all the new samples are buffered or if an abort is requested,
+  *         MCP_CMD_NOK if some of them were dropped because the buffer is full or if the
+  *         block does not match the stream format,
+  *         MCP_ERROR_BAD_RAW_FORMAT if the block is malformed.
+  */
+uint8_t SPS_WriteBlock(SPS_Handle_t *pHandle, const uint8_t *pData, uint16_t size)
+{
+  uint8_t retVal = MCP_CMD_OK;
+#ifdef NULL_PTR_CHECK_SPS
+  if ((MC_NULL == pHandle) || (MC_NULL == pData))
+  {
+    retVal = MCP_CMD_NOK;
+  }
+  else
+  {
+#endif
+    uint32_t timestamp;
+    uint16_t period;
+    uint16_t sampleSize = 4U;
+    uint8_t flags;
+    uint8_t nbrOfSamples;
+    bool store = true;
+
+    if (size < SPS_BLOCK_HEADER_SIZE)
+    {
+      retVal = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else if ((pData[0] & SPS_FLAG_ABORT) != 0U)
+    {
+      /* The stream is stopped by the next SPS_Exec(), nothing else is stored */
+      pHandle->AbortRequest = true;
+      store = false;
+    }
+    else
+    {
+      flags = pData[0];
+      nbrOfSamples = pData[1];
+      (void)memcpy(&period, &pData[2], 2);
+      (void)memcpy(&timestamp, &pData[4], 4);
+
+      if ((flags & SPS_FLAG_SPEED) != 0U)
+      {
+        sampleSize += 4U;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      if ((flags & SPS_FLAG_TORQUE) != 0U)
+      {
+        sampleSize += 2U;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if ((0U == period) || (size != (SPS_BLOCK_HEADER_SIZE + ((uint16_t)nbrOfSamples * sampleSize))))
+      {
+        retVal = MCP_ERROR_BAD_RAW_FORMAT;
+      }
+      else if (((flags & SPS_FLAG_RESTART) != 0U) || (SPS_IDLE == pHandle->State) || (SPS_DONE == pHandle->State))
+      {
+        /* First block of a new stream defines its format */
+        SPS_Clear(pHandle);
+        pHandle->Flags = flags & (SPS_FLAG_SPEED | SPS_FLAG_TORQUE);
+        pHandle->SamplePeriod = period;
+        pHandle->NextTimestamp = timestamp;
+        pHandle->State = SPS_PREFILL;
+      }
+      else if ((period != pHandle->SamplePeriod)
+               || ((flags & (SPS_FLAG_SPEED | SPS_FLAG_TORQUE)) != (pHandle->Flags & (SPS_FLAG_SPEED | SPS_FLAG_TORQUE))))
+      {
+        /* Format can only be changed with a restart */
+        retVal = MCP_CMD_NOK;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+
+    if ((MCP_CMD_OK == retVal) && (true == store))
+    {
+      const uint8_t *pSample = &pData[SPS_BLOCK_HEADER_SIZE];
+      uint16_t mask = pHandle->BufferSize - 1U;
+      uint8_t first = 0U;
+      uint8_t i;
+
+      if ((int32_t)(timestamp - pHandle->NextTimestamp) < 0)
+      {
+        /* Skip samples already received */
+        uint32_t late = pHandle->NextTimestamp - timestamp;
+        first = (late < (uint32_t)nbrOfSamples) ? (uint8_t)late : nbrOfSamples;
+      }
+      else if (timestamp != pHandle->NextTimestamp)
+      {
+        pHandle->Discontinuities++;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+      pSample = &pSample[(uint16_t)first * sampleSize];
+
+      for (i = first; i < nbrOfSamples; i++)
+      {
+        if ((uint16_t)(pHandle->WriteIndex - pHandle->ReadIndex) < pHandle->BufferSize)
+        {
+          SPS_Sample_t *pDest = &pHandle->pBuffer[pHandle->WriteIndex & mask];
+          uint8_t offset = 4U;
+
+          (void)memcpy(&pDest->Position, pSample, 4);
+          pDest->Speed = 0.0f;
+          pDest->TorqueFF = 0;
+          if ((flags & SPS_FLAG_SPEED) != 0U)
+          {
+            (void)memcpy(&pDest->Speed, &pSample[offset], 4);
+            offset += 4U;
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          if ((flags & SPS_FLAG_TORQUE) != 0U)
+          {
+            (void)memcpy(&pDest->TorqueFF, &pSample[offset], 2);
+          }
+          else
+          {
+            /* Nothing to do */
+          }
+          pHandle->WriteIndex++;
+        }
+        else
+        {
+          pHandle->Overruns++;
+          retVal = MCP_CMD_NOK;
+        }
+        pSample = &pSample[sampleSize];
+      }
+
+      pHandle->Level = pHandle->WriteIndex - pHandle->ReadIndex;
+
+      if ((int32_t)((timestamp + nbrOfSamples) - pHandle->NextTimestamp) > 0)
+      {
+        pHandle->NextTimestamp = timestamp + nbrOfSamples;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+
+      if ((flags & SPS_FLAG_LAST) != 0U)
+      {
+        pHandle->Flags |= SPS_FLAG_LAST;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SPS
+  }
+#endif
+  return (retVal);
+}
+
+/**
+  * @brief  Interpolates the next setpoint and feeds it to the position controller.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  *
+  * It must be called at the Medium Frequency Task rate, before TC_PositionRegulation().
+  * When the buffer runs empty before the last block, the last received position is held
+  * and the underrun counter is incremented.
+  *
+  * The stream is cancelled when the position controller left the streaming mode because
+  * another position command was accepted, and on an abort request from the host. In the
+  * latter case the current setpoint is held at zero speed.
+  */
+void SPS_Exec(SPS_Handle_t *pHandle)
+{
+#ifdef NULL_PTR_CHECK_SPS
+  if (MC_NULL == pHandle)
+  {
+    /* Nothing to do */
+  }
+  else
+  {
+#endif
+    uint16_t mask = pHandle->BufferSize - 1U;
+    uint16_t level = pHandle->WriteIndex - pHandle->ReadIndex;
+
+    if (((SPS_PLAYING == pHandle->State) || (SPS_UNDERRUN == pHandle->State))
+        && (pHandle->pPosCtrl->PositionCtrlStatus != TC_STREAMING_ON_GOING))
+    {
+      /* A move or follow command took over the position controller */
+      SPS_Clear(pHandle);
+    }
+    else if (true == pHandle->AbortRequest)
+    {
+      if ((SPS_PLAYING == pHandle->State) || (SPS_UNDERRUN == pHandle->State))
+      {
+        TC_StreamCommand(pHandle->pPosCtrl, pHandle->pPosCtrl->Theta, 0.0f, 0.0f, 0);
+        pHandle->pPosCtrl->PositionCtrlStatus = TC_TARGET_POSITION_REACHED;
+      }
+      else
+      {
+        /* Nothing to do, the stream does not drive the position controller */
+      }
+      SPS_Clear(pHandle);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if (SPS_PREFILL == pHandle->State)
+    {
+      if ((level >= pHandle->PrefillLevel) || (((pHandle->Flags & SPS_FLAG_LAST) != 0U) && (level > 0U)))
+      {
+        pHandle->Phase = 0U;
+        pHandle->State = SPS_PLAYING;
+      }
+      else
+      {
+        /* Nothing to do, waiting for more samples */
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    if ((SPS_PLAYING == pHandle->State) || (SPS_UNDERRUN == pHandle->State))
+    {
+      const SPS_Sample_t *pS0 = &pHandle->pBuffer[pHandle->ReadIndex & mask];
+
+      if (level >= 2U)
+      {
+        const SPS_Sample_t *pS1 = &pHandle->pBuffer[(pHandle->ReadIndex + 1U) & mask];
+        float period = (float)pHandle->SamplePeriod * pHandle->pPosCtrl->SamplingTime;
+        float t = (float)pHandle->Phase / (float)pHandle->SamplePeriod;
+        float delta = pS1->Position - pS0->Position;
+        float position;
+        float speed;
+        float acceleration;
+
+        if ((pHandle->Flags & SPS_FLAG_SPEED) != 0U)
+        {
+          /* Cubic Hermite spline between the two samples */
+          float m0 = pS0->Speed * period;
+          float m1 = pS1->Speed * period;
+          float t2 = t * t;
+          float a = (-2.0f * delta) + m0 + m1;
+          float b = (3.0f * delta) - (2.0f * m0) - m1;
+
+          position = pS0->Position + (((a * t + b) * t + m0) * t);
+          speed = ((3.0f * a * t2) + (2.0f * b * t) + m0) / period;
+          acceleration = ((6.0f * a * t) + (2.0f * b)) / (period * period);
+        }
+        else
+        {
+          position = pS0->Position + (delta * t);
+          speed = delta / period;
+          acceleration = 0.0f;
+        }
+
+        TC_StreamCommand(pHandle->pPosCtrl, position, speed, acceleration,
+                         (int16_t)(pS0->TorqueFF + (int16_t)((float)(pS1->TorqueFF - pS0->TorqueFF) * t)));
+        pHandle->State = SPS_PLAYING;
+
+        pHandle->Phase++;
+        if (pHandle->Phase >= pHandle->SamplePeriod)
+        {
+          pHandle->Phase = 0U;
+          pHandle->ReadIndex++;
+          pHandle->Level = pHandle->WriteIndex - pHandle->ReadIndex;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+      else
+      {
+        /* Hold the last received setpoint */
+        TC_StreamCommand(pHandle->pPosCtrl, pS0->Position, 0.0f, 0.0f, pS0->TorqueFF);
+        pHandle->Phase = 0U;
+
+        if ((pHandle->Flags & SPS_FLAG_LAST) != 0U)
+        {
+          pHandle->pPosCtrl->PositionCtrlStatus = TC_TARGET_POSITION_REACHED;
+          pHandle->State = SPS_DONE;
+        }
+        else if (SPS_PLAYING == pHandle->State)
+        {
+          pHandle->Underruns++;
+          pHandle->State = SPS_UNDERRUN;
+        }
+        else
+        {
+          /* Nothing to do, still in underrun */
+        }
+      }
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+#ifdef NULL_PTR_CHECK_SPS
+  }
+#endif
+}
+
+/**
+  * @brief  Returns the number of samples waiting in the buffer.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  */
+uint16_t SPS_GetLevel(const SPS_Handle_t *pHandle)
+{
+  return ((uint16_t)(pHandle->WriteIndex - pHandle->ReadIndex));
+}
+
+/**
+  * @brief  Returns the playback state.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  */
+SPS_State_t SPS_GetState(const SPS_Handle_t *pHandle)
+{
+  return (pHandle->State);
+}
+
+/**
+  * @brief  Returns the number of times the buffer ran empty while playing.
+  * @param  pHandle handler of the current instance of the Setpoint Stream component.
+  */
+uint32_t SPS_GetUnderruns(const SPS_Handle_t *pHandle)
+{
+  return (pHandle->Underruns);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
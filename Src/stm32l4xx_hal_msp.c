@@ -180,7 +180,21 @@ void HAL_ADC_MspInit(ADC_HandleTypeDef* hadc)
     HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
 
   /* USER CODE BEGIN ADC2_MspInit 1 */
+#if NBR_OF_MOTORS > 1
+    /**ADC2 GPIO Configuration, M2 current sensing on the injected group
+    PA7     ------> ADC2_IN12
+    PC3     ------> ADC2_IN4
+    PC5     ------> ADC2_IN14
+    */
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    GPIO_InitStruct.Pin = M2_CURR_AMPL_U_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_ANALOG_ADC_CONTROL;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(M2_CURR_AMPL_U_GPIO_Port, &GPIO_InitStruct);
 
+    GPIO_InitStruct.Pin = M2_CURR_AMPL_V_Pin|M2_CURR_AMPL_W_Pin;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+#endif
   /* USER CODE END ADC2_MspInit 1 */
   }
 
@@ -367,6 +381,37 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* htim_base)
   /* USER CODE END TIM1_MspInit 1 */
 
   }
+#if NBR_OF_MOTORS > 1
+  else if(htim_base->Instance==TIM8)
+  {
+    /* Peripheral clock enable */
+    __HAL_RCC_TIM8_CLK_ENABLE();
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    /**TIM8 GPIO Configuration
+    PA6     ------> TIM8_BKIN
+    */
+    GPIO_InitStruct.Pin = M2_DP_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF3_TIM8;
+    HAL_GPIO_Init(M2_DP_GPIO_Port, &GPIO_InitStruct);
+
+    /* TIM8 interrupt Init, same priorities as TIM1 */
+    HAL_NVIC_SetPriority(TIM8_BRK_IRQn, 9, 0);
+    HAL_NVIC_EnableIRQ(TIM8_BRK_IRQn);
+    HAL_NVIC_SetPriority(TIM8_UP_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(TIM8_UP_IRQn);
+  }
+#endif
+#ifdef M1_ENCODER_FUSION
+  else if(htim_base->Instance==TIM15)
+  {
+    /* Peripheral clock enable, TIM15 only drives the ADC2 trigger */
+    __HAL_RCC_TIM15_CLK_ENABLE();
+  }
+#endif
 
 }
 
@@ -436,6 +481,32 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef* htim)
 
   /* USER CODE END TIM1_MspPostInit 1 */
   }
+#if NBR_OF_MOTORS > 1
+  else if(htim->Instance==TIM8)
+  {
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    /**TIM8 GPIO Configuration
+    PC6     ------> TIM8_CH1
+    PC7     ------> TIM8_CH2
+    PC8     ------> TIM8_CH3
+    */
+    GPIO_InitStruct.Pin = M2_PWM_UH_Pin|M2_PWM_VH_Pin|M2_PWM_WH_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_PULLDOWN;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+    GPIO_InitStruct.Alternate = GPIO_AF3_TIM8;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+    /* Enable signals of the M2 gate driver, driven by the PWM component */
+    HAL_GPIO_WritePin(GPIOC, M2_PWM_EN_U_Pin|M2_PWM_EN_V_Pin|M2_PWM_EN_W_Pin, GPIO_PIN_RESET);
+    GPIO_InitStruct.Pin = M2_PWM_EN_U_Pin|M2_PWM_EN_V_Pin|M2_PWM_EN_W_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = 0;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+  }
+#endif
 
 }
 /**
@@ -505,6 +576,77 @@ void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef* htim_base)
 
 // }
 
+#if (NBR_OF_MOTORS > 1) || defined(M1_ENCODER_FUSION)
+/**
+* @brief TIM_Encoder MSP Initialization
+* This function configures the hardware resources used by the M1 and M2 encoders
+* @param htim_encoder: TIM_Encoder handle pointer
+* @retval None
+*/
+void HAL_TIM_Encoder_MspInit(TIM_HandleTypeDef* htim_encoder)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+#ifdef M1_ENCODER_FUSION
+  if(htim_encoder->Instance==TIM3)
+  {
+    /* Peripheral clock enable */
+    __HAL_RCC_TIM3_CLK_ENABLE();
+
+#if NBR_OF_MOTORS > 1
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    /**TIM3 GPIO Configuration, PC6 and PC7 are taken by TIM8
+    PB4     ------> TIM3_CH1
+    PB5     ------> TIM3_CH2
+    */
+#else
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    /**TIM3 GPIO Configuration
+    PC6     ------> TIM3_CH1
+    PC7     ------> TIM3_CH2
+    */
+#endif
+    GPIO_InitStruct.Pin = M1_ENCODER_A_Pin|M1_ENCODER_B_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF2_TIM3;
+    HAL_GPIO_Init(M1_ENCODER_A_GPIO_Port, &GPIO_InitStruct);
+
+    /* TIM3 interrupt Init */
+    HAL_NVIC_SetPriority(TIM3_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(TIM3_IRQn);
+#ifdef ENC_MT_SPEED_MEASUREMENT
+    /* TIM5 timestamps the encoder edges captured by TIM3, ENC_Init() configures it */
+    __HAL_RCC_TIM5_CLK_ENABLE();
+#endif
+  }
+#endif
+#if NBR_OF_MOTORS > 1
+  if(htim_encoder->Instance==TIM4)
+  {
+    /* Peripheral clock enable */
+    __HAL_RCC_TIM4_CLK_ENABLE();
+
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    /**TIM4 GPIO Configuration
+    PB6     ------> TIM4_CH1
+    PB7     ------> TIM4_CH2
+    */
+    GPIO_InitStruct.Pin = M2_ENCODER_A_Pin|M2_ENCODER_B_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = GPIO_AF2_TIM4;
+    HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+
+    /* TIM4 interrupt Init */
+    HAL_NVIC_SetPriority(TIM4_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(TIM4_IRQn);
+  }
+#endif
+}
+#endif
+
 /**
 * @brief UART MSP Initialization
 * This function configures the hardware resources used in this example
@@ -74,8 +74,10 @@ extern TIM_HandleTypeDef htim6;
 /* please refer to the startup file (startup_stm32l4xx.s).                    */
 /******************************************************************************/
 
+#ifndef M1_ENCODER_FUSION
 /**
   * @brief This function handles TIM3 global interrupt.
+  *        With M1_ENCODER_FUSION TIM3 is the M1 encoder timer, see SPD_TIM_M1_IRQHandler().
   */
 void TIM3_IRQHandler(void)
 {
@@ -87,6 +89,7 @@ void TIM3_IRQHandler(void)
 
   /* USER CODE END TIM3_IRQn 1 */
 }
+#endif
 
 /**
   * @brief This function handles TIM6 global interrupt, DAC channel1 and channel2 underrun error interrupts.
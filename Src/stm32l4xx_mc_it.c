@@ -57,6 +57,11 @@ void ADC1_2_IRQHandler(void);
 void TIMx_UP_M1_IRQHandler(void);
 void TIMx_BRK_M1_IRQHandler(void);
 void SPD_TIM_M1_IRQHandler(void);
+#if NBR_OF_MOTORS > 1
+void TIMx_UP_M2_IRQHandler(void);
+void TIMx_BRK_M2_IRQHandler(void);
+void SPD_TIM_M2_IRQHandler(void);
+#endif
 void HardFault_Handler(void);
 void SysTick_Handler(void);
 void EXTI15_10_IRQHandler (void);
@@ -70,12 +75,26 @@ void ADC1_2_IRQHandler(void)
   /* USER CODE BEGIN ADC_IRQn 0 */
 
   /* USER CODE END ADC_IRQn 0 */
+#if NBR_OF_MOTORS > 1
+  /* The PWM timers are staggered by half a period, at most one current reading is pending */
+  if ( LL_ADC_IsActiveFlag_JEOS( ADC2 ) )
+  {
+    LL_ADC_ClearFlag_JEOS( ADC2 );
+    // Highfrequency task M2
+    TSK_HighFrequencyTaskM2();
+  }
+  else
+  {
+#endif
   if ( LL_ADC_IsActiveFlag_JEOS( ADC1 ) )
   {
     LL_ADC_ClearFlag_JEOS( ADC1 );
   }
     // Highfrequency task Single or M1
   TSK_HighFrequencyTask();
+#if NBR_OF_MOTORS > 1
+  }
+#endif
 
   /* USER CODE BEGIN ADC_IRQn 1 */
 
@@ -127,33 +146,105 @@ void TIMx_BRK_M1_IRQHandler(void)
   /* USER CODE END TIMx_BRK_M1_IRQn 1 */
 }
 
+#if NBR_OF_MOTORS > 1
+/**
+  * @brief  This function handles second motor TIMx Update interrupt request.
+  * @param  None
+  */
+void TIMx_UP_M2_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIMx_UP_M2_IRQn 0 */
+
+  /* USER CODE END TIMx_UP_M2_IRQn 0 */
+  LL_TIM_ClearFlag_UPDATE(TIM8);
+  R3_1_TIMx_UP_IRQHandler(&PWM_Handle_M2);
+
+  /* USER CODE BEGIN TIMx_UP_M2_IRQn 1 */
+
+  /* USER CODE END TIMx_UP_M2_IRQn 1 */
+}
+
+/**
+  * @brief  This function handles second motor BRK interrupt.
+  * @param  None
+  */
+void TIMx_BRK_M2_IRQHandler(void)
+{
+  /* USER CODE BEGIN TIMx_BRK_M2_IRQn 0 */
+
+  /* USER CODE END TIMx_BRK_M2_IRQn 0 */
+  if (LL_TIM_IsActiveFlag_BRK(TIM8))
+  {
+    LL_TIM_ClearFlag_BRK(TIM8);
+    PWMC_DP_Handler(&PWM_Handle_M2._Super);
+  }
+
+  if (LL_TIM_IsActiveFlag_BRK2(TIM8))
+  {
+    LL_TIM_ClearFlag_BRK2(TIM8);
+    PWMC_OVP_Handler(&PWM_Handle_M2._Super, TIM8);
+  }
+
+  /* USER CODE BEGIN TIMx_BRK_M2_IRQn 1 */
+
+  /* USER CODE END TIMx_BRK_M2_IRQn 1 */
+}
+
+/**
+  * @brief  This function handles TIMx global interrupt request for M2 Speed Sensor.
+  * @param  None
+  */
+void SPD_TIM_M2_IRQHandler(void)
+{
+  /* USER CODE BEGIN SPD_TIM_M2_IRQn 0 */
+
+  /* USER CODE END SPD_TIM_M2_IRQn 0 */
+
+  /* Encoder Timer UPDATE IT is dynamicaly enabled/disabled, checking enable state is required */
+  if (LL_TIM_IsEnabledIT_UPDATE (ENCODER_M2.TIMx) && LL_TIM_IsActiveFlag_UPDATE (ENCODER_M2.TIMx))
+  {
+    LL_TIM_ClearFlag_UPDATE(ENCODER_M2.TIMx);
+    ENC_IRQHandler(&ENCODER_M2);
+  }
+  else
+  {
+  /* No other IT to manage for encoder config */
+  }
+  /* USER CODE BEGIN SPD_TIM_M2_IRQn 1 */
+
+  /* USER CODE END SPD_TIM_M2_IRQn 1 */
+}
+#endif
+
 /**
   * @brief  This function handles TIMx global interrupt request for M1 Speed Sensor.
   * @param  None
   */
-// void SPD_TIM_M1_IRQHandler(void)
-// {
-//   /* USER CODE BEGIN SPD_TIM_M1_IRQn 0 */
-
-//   /* USER CODE END SPD_TIM_M1_IRQn 0 */
-
-//  /* Encoder Timer UPDATE IT is dynamicaly enabled/disabled, checking enable state is required */
-//   if (LL_TIM_IsEnabledIT_UPDATE (ENCODER_M1.TIMx) && LL_TIM_IsActiveFlag_UPDATE (ENCODER_M1.TIMx))
-//   {
-//     LL_TIM_ClearFlag_UPDATE(ENCODER_M1.TIMx);
-//     ENC_IRQHandler(&ENCODER_M1);
-//     /* USER CODE BEGIN M1 ENCODER_Update */
-
-//     /* USER CODE END M1 ENCODER_Update   */
-//   }
-//   else
-//   {
-//   /* No other IT to manage for encoder config */
-//   }
-//   /* USER CODE BEGIN SPD_TIM_M1_IRQn 1 */
-
-//   /* USER CODE END SPD_TIM_M1_IRQn 1 */
-// }
+#ifdef M1_ENCODER_FUSION
+void SPD_TIM_M1_IRQHandler(void)
+{
+  /* USER CODE BEGIN SPD_TIM_M1_IRQn 0 */
+
+  /* USER CODE END SPD_TIM_M1_IRQn 0 */
+
+  /* Encoder Timer UPDATE IT is dynamicaly enabled/disabled, checking enable state is required */
+  if (LL_TIM_IsEnabledIT_UPDATE (ENCODER_M1.TIMx) && LL_TIM_IsActiveFlag_UPDATE (ENCODER_M1.TIMx))
+  {
+    LL_TIM_ClearFlag_UPDATE(ENCODER_M1.TIMx);
+    ENC_IRQHandler(&ENCODER_M1);
+    /* USER CODE BEGIN M1 ENCODER_Update */
+
+    /* USER CODE END M1 ENCODER_Update   */
+  }
+  else
+  {
+  /* No other IT to manage for encoder config */
+  }
+  /* USER CODE BEGIN SPD_TIM_M1_IRQn 1 */
+
+  /* USER CODE END SPD_TIM_M1_IRQn 1 */
+}
+#endif
 
 /**
   * @brief This function handles DMA_RX_A channel DMACH_RX_A global interrupt.
@@ -169,6 +260,13 @@ void DMA1_Channel6_IRQHandler(void)
     LL_DMA_ClearFlag_TC (DMA_RX_A, DMACH_RX_A);
     ASPEP_HWDataReceivedIT (&aspepOverUartA);
   }
+#ifdef ASPEP_RX_RING_SIZE
+  /* Half of the reception ring is filled, parse it before it is overwritten */
+  if (LL_DMA_IsActiveFlag_HT (DMA_RX_A, DMACH_RX_A) ){
+    LL_DMA_ClearFlag_HT (DMA_RX_A, DMACH_RX_A);
+    ASPEP_HWDataReceivedIT (&aspepOverUartA);
+  }
+#endif
   /* USER CODE BEGIN DMA1_Channel6_IRQHandler 1 */
 
   /* USER CODE BEGIN DMA1_Channel6_IRQHandler 1 */
@@ -203,6 +301,26 @@ void USART2_IRQHandler(void)
     LL_USART_DisableIT_ERROR (USARTA);
     LL_USART_EnableIT_IDLE (USARTA);
   }
+#ifdef ASPEP_RX_RING_SIZE
+  if ( LL_USART_IsActiveFlag_IDLE (USARTA) && LL_USART_IsEnabledIT_IDLE (USARTA) )
+  { /* End of a burst: the idle line interrupt stays enabled with circular reception */
+    LL_USART_ClearFlag_IDLE (USARTA);
+    if ( LL_USART_IsEnabledIT_ERROR (USARTA) )
+    {
+      ASPEP_HWRxIdleIT (&aspepOverUartA);
+    }
+    else
+    { /* End of the unexpected data following an error: skip them */
+      LL_USART_EnableIT_ERROR (USARTA);
+      /* To be sure we fetch the potential pendig data*/
+      /* We disable the DMA request, Read the dummy data, endable back the DMA request */
+      LL_USART_DisableDMAReq_RX (USARTA);
+      LL_USART_ReceiveData8(USARTA);
+      LL_USART_EnableDMAReq_RX (USARTA);
+      ASPEP_HWDMAReset (&aspepOverUartA);
+    }
+  }
+#else
   if ( LL_USART_IsActiveFlag_IDLE (USARTA) && LL_USART_IsEnabledIT_IDLE (USARTA) )
   { /* Stopping the debugger will generate an OverRun error*/
     LL_USART_DisableIT_IDLE (USARTA);
@@ -215,6 +333,7 @@ void USART2_IRQHandler(void)
     LL_USART_EnableDMAReq_RX (USARTA);
     ASPEP_HWDMAReset (&aspepOverUartA);
   }
+#endif
 
   /* USER CODE BEGIN USART2_IRQHandler 1 */
 
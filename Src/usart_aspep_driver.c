@@ -21,7 +21,9 @@
   */
 
 #include <stdint.h>
+#include <string.h>
 #include "mc_stm_types.h"
+#include "stm32l4xx_ll_crc.h"
 #include "usart_aspep_driver.h"
 
 void UASPEP_DAMCONFIG_TX(UASPEP_Handle_t *pHandle);
@@ -45,6 +47,14 @@ void UASPEP_INIT(void *pHWHandle)
   UASPEP_Handle_t *pHandle = (UASPEP_Handle_t *)pHWHandle; //cstat !MISRAC2012-Rule-11.5
   UASPEP_DAMCONFIG_TX(pHandle);
   UASPEP_DAMCONFIG_RX(pHandle);
+
+  /* CRC unit configured for the ASPEP data CRC: polynomial 0x1021, initial value 0xFFFF, no reflection */
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_CRC);
+  LL_CRC_SetPolynomialSize(CRC, LL_CRC_POLYLENGTH_16B);
+  LL_CRC_SetPolynomialCoef(CRC, 0x1021U);
+  LL_CRC_SetInitialData(CRC, 0xFFFFU);
+  LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_NONE);
+  LL_CRC_SetOutputDataReverseMode(CRC, LL_CRC_OUTDATA_REVERSE_NONE);
 }
 
 /**
@@ -161,6 +171,87 @@ void UASPEP_RECEIVE_BUFFER(void *pHWHandle, void* buffer, uint16_t length)
   LL_DMA_EnableChannel(pHandle->rxDMA, pHandle->rxChannel);
 }
 
+/**
+  * @brief  Enables the configured DMA to receive continuously in a ring buffer.
+  *
+  * The DMA is armed once in circular mode. The end of each burst is signaled by the USART idle line
+  * interrupt, half and full ring DMA interrupts bound the latency of bursts longer than half the ring.
+  *
+  * @param  pHWHandle Hardware components chosen for communication
+  * @param  buffer Ring buffer which will receive the communicated data
+  * @param  length Size of the ring buffer
+  */
+void UASPEP_RECEIVE_CIRCULAR(void *pHWHandle, void *buffer, uint16_t length)
+{
+  UASPEP_Handle_t *pHandle = (UASPEP_Handle_t *)pHWHandle; //cstat !MISRAC2012-Rule-11.5
+  LL_DMA_DisableChannel(pHandle->rxDMA, pHandle->rxChannel);
+  LL_DMA_SetMode(pHandle->rxDMA, pHandle->rxChannel, LL_DMA_MODE_CIRCULAR);
+  //cstat !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6
+  LL_DMA_SetMemoryAddress(pHandle->rxDMA, pHandle->rxChannel, (uint32_t)buffer);
+  LL_DMA_SetDataLength(pHandle->rxDMA, pHandle->rxChannel, length);
+  LL_DMA_EnableIT_HT(pHandle->rxDMA, pHandle->rxChannel);
+
+  LL_USART_ClearFlag_IDLE(pHandle->USARTx);
+  LL_USART_EnableIT_IDLE(pHandle->USARTx);
+  LL_DMA_EnableChannel(pHandle->rxDMA, pHandle->rxChannel);
+}
+
+/**
+  * @brief  Returns the number of bytes the circular DMA will receive before wrapping around.
+  *
+  * @param  pHWHandle Hardware components chosen for communication
+  */
+uint16_t UASPEP_RX_REMAINING(void *pHWHandle)
+{
+  UASPEP_Handle_t *pHandle = (UASPEP_Handle_t *)pHWHandle; //cstat !MISRAC2012-Rule-11.5
+  return ((uint16_t)LL_DMA_GetDataLength(pHandle->rxDMA, pHandle->rxChannel));
+}
+
+/**
+  * @brief  Computes the ASPEP data CRC with the CRC unit.
+  *
+  * The payload is fed word-wise, byte swapped so that the bytes are processed in memory order, and the
+  * remaining bytes are fed one by one. The unit is shared between the Medium Frequency Task and the
+  * transmission interrupt. The whole state of the unit, the running CRC and the initial value, is saved
+  * before the computation and restored after it, so that a preempted computation resumes unaffected.
+  *
+  * @param  pHWHandle Hardware components chosen for communication
+  * @param  data Payload on which the CRC is computed
+  * @param  length Size of the payload in bytes
+  * @param  crc Computed CRC
+  *
+  * @return Returns true, the CRC unit is always available
+  */
+bool UASPEP_DATA_CRC(void *pHWHandle, const uint8_t *data, uint16_t length, uint16_t *crc)
+{
+  uint32_t savedData = LL_CRC_ReadData32(CRC);
+  uint32_t savedInit = LL_CRC_GetInitialData(CRC);
+  uint32_t word;
+  uint16_t i = 0U;
+
+  (void)pHWHandle;
+  LL_CRC_SetInitialData(CRC, 0xFFFFU);
+  LL_CRC_ResetCRCCalculationUnit(CRC);
+  while ((i + 4U) <= length)
+  {
+    (void)memcpy(&word, &data[i], 4U); /* Payloads received in the ring are not word aligned */
+    LL_CRC_FeedData32(CRC, __REV(word));
+    i += 4U;
+  }
+  while (i < length)
+  {
+    LL_CRC_FeedData8(CRC, data[i]);
+    i++;
+  }
+  *crc = (uint16_t)LL_CRC_ReadData16(CRC);
+
+  /* Resumes the computation this one may have preempted */
+  LL_CRC_SetInitialData(CRC, savedData);
+  LL_CRC_ResetCRCCalculationUnit(CRC);
+  LL_CRC_SetInitialData(CRC, savedInit);
+  return (true);
+}
+
 /**
   * @brief  Sets IDLE state : no transmission on going.
   *
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_host.h
+  * @author  LenseDrive
+  * @brief   Host replacement of the CMSIS GCC intrinsics, force included by
+  *          the host tests before any firmware header.
+  *
+  *          cmsis_gcc.h implements the intrinsics with Cortex-M instructions.
+  *          Its include guard is defined here so that it is skipped, and the
+  *          intrinsics used by the firmware are given their C meaning. The
+  *          tests are single threaded: masking the interrupts does nothing
+  *          and the exclusive stores always succeed.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CMSIS_HOST_H
+#define CMSIS_HOST_H
+
+#include <stdint.h>
+
+#define __CMSIS_GCC_H
+
+#define __ASM                           __asm
+#define __INLINE                        inline
+#define __STATIC_INLINE                 static inline
+#define __STATIC_FORCEINLINE            __attribute__((always_inline)) static inline
+#define __NO_RETURN                     __attribute__((__noreturn__))
+#define __USED                          __attribute__((used))
+#define __WEAK                          __attribute__((weak))
+#define __PACKED                        __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                 struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION                  union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                    __attribute__((aligned(x)))
+#define __RESTRICT                      __restrict
+#define __COMPILER_BARRIER()            __ASM volatile("":::"memory")
+#define __UNALIGNED_UINT16_READ(addr)   (*(const uint16_t *)(const void *)(addr))
+#define __UNALIGNED_UINT32_READ(addr)   (*(const uint32_t *)(const void *)(addr))
+
+#define __NOP()                         __COMPILER_BARRIER()
+#define __WFI()                         __COMPILER_BARRIER()
+#define __ISB()                         __COMPILER_BARRIER()
+#define __DSB()                         __COMPILER_BARRIER()
+#define __DMB()                         __COMPILER_BARRIER()
+#define __enable_irq()                  __COMPILER_BARRIER()
+#define __disable_irq()                 __COMPILER_BARRIER()
+#define __CLREX()                       __COMPILER_BARRIER()
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+  return (0U);
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t priMask)
+{
+  (void)priMask;
+}
+
+__STATIC_INLINE uint32_t __get_BASEPRI(void)
+{
+  return (0U);
+}
+
+__STATIC_INLINE void __set_BASEPRI(uint32_t basePri)
+{
+  (void)basePri;
+}
+
+__STATIC_INLINE uint32_t __get_FPSCR(void)
+{
+  return (0U);
+}
+
+__STATIC_INLINE void __set_FPSCR(uint32_t fpscr)
+{
+  (void)fpscr;
+}
+
+__STATIC_INLINE uint32_t __REV(uint32_t value)
+{
+  return (__builtin_bswap32(value));
+}
+
+__STATIC_INLINE uint32_t __REV16(uint32_t value)
+{
+  return (((value & 0x00FF00FFU) << 8U) | ((value >> 8U) & 0x00FF00FFU));
+}
+
+__STATIC_INLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < 32U; i++)
+  {
+    result = (result << 1U) | ((value >> i) & 1U);
+  }
+  return (result);
+}
+
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  return ((0U == value) ? 32U : (uint8_t)__builtin_clz(value));
+}
+
+__STATIC_INLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  return (*addr);
+}
+
+__STATIC_INLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  *addr = value;
+  return (0U);
+}
+
+__STATIC_INLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+  return ((val > max) ? max : ((val < (-max - 1)) ? (-max - 1) : val));
+}
+
+__STATIC_INLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  uint32_t max = (1U << sat) - 1U;
+  return ((val < 0) ? 0U : (((uint32_t)val > max) ? max : (uint32_t)val));
+}
+
+#endif /* CMSIS_HOST_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
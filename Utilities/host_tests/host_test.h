@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    host_test.h
+  * @author  LenseDrive
+  * @brief   Minimal check macros of the host unit tests. Each test program
+  *          returns a non zero exit code when one of its checks failed.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <math.h>
+
+static int HT_Checks;
+static int HT_Failures;
+
+/* Checks a condition, reports it when it does not hold */
+#define HT_CHECK(cond) \
+  do \
+  { \
+    HT_Checks++; \
+    if (!(cond)) \
+    { \
+      HT_Failures++; \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+/* Checks that a value is within tol of the expected one */
+#define HT_CHECK_NEAR(val, expected, tol) \
+  do \
+  { \
+    double ht_v = (double)(val); \
+    double ht_e = (double)(expected); \
+    HT_Checks++; \
+    if (fabs(ht_v - ht_e) > (double)(tol)) \
+    { \
+      HT_Failures++; \
+      printf("%s:%d: %s = %g, expected %g +/- %g\n", __FILE__, __LINE__, #val, ht_v, ht_e, (double)(tol)); \
+    } \
+  } while (0)
+
+/* Prints the summary of the test program and gives its exit code */
+#define HT_RESULT(name) \
+  (printf("%s: %d checks, %d failed\n", (name), HT_Checks, HT_Failures), (HT_Failures == 0) ? 0 : 1)
+
+#endif /* HOST_TEST_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    test_cpr.c
+  * @author  LenseDrive
+  * @brief   Host test of the thermal derating of the Current Protection
+  *          component in torque mode.
+  *
+  *          The motor is driven at the torque reference computed by the speed
+  *          and torque controller, which feeds the thermal model back. The
+  *          reference must never exceed the derated limit, also while a ramp
+  *          started before the derating is in progress, and the position
+  *          regulator must follow the limit.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <stdlib.h>
+#include "host_test.h"
+#include "current_protection.h"
+
+#define MF_RATE_HZ    1000U
+#define HF_PER_MF     20U
+#define PEAK          12000U
+#define NOMINAL       4000U
+
+static PID_Handle_t PISpeed =
+{
+  .hDefKpGain          = 1000,
+  .hDefKiGain          = 100,
+  .wUpperIntegralLimit = (int32_t)PEAK * 1024,
+  .wLowerIntegralLimit = -(int32_t)PEAK * 1024,
+  .hUpperOutputLimit   = (int16_t)PEAK,
+  .hLowerOutputLimit   = -(int16_t)PEAK,
+  .hKpDivisor          = 1024U,
+  .hKiDivisor          = 1024U,
+  .hKpDivisorPOW2      = 10U,
+  .hKiDivisorPOW2      = 10U,
+};
+
+static PID_Handle_t PIDPos =
+{
+  .hDefKpGain          = 2000,
+  .hDefKiGain          = 10,
+  .wUpperIntegralLimit = (int32_t)PEAK * 4096,
+  .wLowerIntegralLimit = -(int32_t)PEAK * 4096,
+  .hUpperOutputLimit   = (int16_t)PEAK,
+  .hLowerOutputLimit   = -(int16_t)PEAK,
+  .hKpDivisor          = 1024U,
+  .hKiDivisor          = 4096U,
+  .hKpDivisorPOW2      = 10U,
+  .hKiDivisorPOW2      = 12U,
+};
+
+static SpeednPosFdbk_Handle_t Sensor;
+
+static SpeednTorqCtrl_Handle_t STC =
+{
+  .STCFrequencyHz             = MF_RATE_HZ,
+  .MaxAppPositiveMecSpeedUnit = 3000U,
+  .MinAppPositiveMecSpeedUnit = 0U,
+  .MaxAppNegativeMecSpeedUnit = 0,
+  .MinAppNegativeMecSpeedUnit = -3000,
+  .MaxPositiveTorque          = (int16_t)PEAK,
+  .MinNegativeTorque          = -(int16_t)PEAK,
+  .ModeDefault                = MCM_TORQUE_MODE,
+  .MecSpeedRefUnitDefault     = 0,
+  .TorqueRefDefault           = 0,
+  .IdrefDefault               = 0,
+};
+
+static CPR_Handle_t CPR =
+{
+  .pFW                = MC_NULL,
+  .pPIDPos            = &PIDPos,
+  .OCThreshold        = 30000U,
+  .OCDebounce         = 3U,
+  .PeakCurrent        = PEAK,
+  .NominalCurrent     = NOMINAL,
+  .WindingTau         = 2.0f,
+  .HousingTau         = 20.0f,
+  .HousingShare       = 0.5f,
+  .DeratingStart      = 0.5f,
+  .ThermalFrequencyHz = MF_RATE_HZ,
+};
+
+/* Runs one MF period: thermal model, torque reference, then the HF samples at this reference */
+static int16_t Step(void)
+{
+  qd_t iqd;
+  uint32_t i;
+
+  CPR_CalcThermal(&CPR);
+  iqd.q = STC_CalcTorqueReference(&STC);
+  iqd.d = 0;
+  for (i = 0U; i < HF_PER_MF; i++)
+  {
+    (void)CPR_CheckCurrent(&CPR, iqd);
+  }
+  return (iqd.q);
+}
+
+/* Checks that the torque reference and both regulators are within the current limit */
+static void CheckLimits(int16_t torque)
+{
+  int32_t limit = (int32_t)CPR_GetCurrentLimit(&CPR);
+
+  HT_CHECK(abs(torque) <= limit);
+  HT_CHECK(PIDPos.hUpperOutputLimit == limit);
+  HT_CHECK(PIDPos.hLowerOutputLimit == -limit);
+  HT_CHECK(PIDPos.wUpperIntegralLimit == (limit * (int32_t)PIDPos.hKiDivisor));
+  HT_CHECK(PISpeed.hUpperOutputLimit == limit);
+  HT_CHECK(STC.MaxPositiveTorque == limit);
+}
+
+int main(void)
+{
+  int16_t torque = 0;
+  uint32_t t;
+
+  PID_HandleInit(&PISpeed);
+  PID_HandleInit(&PIDPos);
+  STC_Init(&STC, &PISpeed, &Sensor);
+  CPR_Init(&CPR, &STC);
+  HT_CHECK(CPR_GetCurrentLimit(&CPR) == PEAK);
+
+  /* Full torque from cold: the reference is held at the peak, then derated down to the nominal current */
+  HT_CHECK(STC_ExecRamp(&STC, (int16_t)PEAK, 0U));
+  for (t = 0U; t < (60U * MF_RATE_HZ); t++)
+  {
+    torque = Step();
+    CheckLimits(torque);
+    if (1U == t)
+    {
+      HT_CHECK(torque == (int16_t)PEAK);
+    }
+  }
+  HT_CHECK_NEAR(CPR_GetCurrentLimit(&CPR), NOMINAL, 0.05 * NOMINAL);
+  HT_CHECK_NEAR(torque, NOMINAL, 0.05 * NOMINAL);
+  HT_CHECK(CPR_GetThermalLoad(&CPR) >= 950U);
+
+  /* A target beyond the derated limit is refused */
+  HT_CHECK(!STC_ExecRamp(&STC, (int16_t)PEAK, 0U));
+
+  /* Cool down with no current, the limit recovers */
+  HT_CHECK(STC_ExecRamp(&STC, 0, 0U));
+  for (t = 0U; t < (120U * MF_RATE_HZ); t++)
+  {
+    torque = Step();
+    CheckLimits(torque);
+  }
+  HT_CHECK(CPR_GetCurrentLimit(&CPR) == PEAK);
+
+  /* Negative ramp towards the peak, started before the derating: it is stopped at the limit */
+  HT_CHECK(STC_ExecRamp(&STC, -(int16_t)PEAK, 60000U));
+  for (t = 0U; t < (60U * MF_RATE_HZ); t++)
+  {
+    torque = Step();
+    CheckLimits(torque);
+  }
+  HT_CHECK(CPR_GetCurrentLimit(&CPR) < PEAK);
+  HT_CHECK_NEAR(torque, -(double)NOMINAL, 0.05 * NOMINAL);
+
+  return (HT_RESULT("test_cpr"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,233 @@
+/**
+  ******************************************************************************
+  * @file    test_dpwm.c
+  * @author  LenseDrive
+  * @brief   Host test of the discontinuous PWM (DPWMMIN) of the PWM and
+  *          current feedback component, and model of its trade-off.
+  *
+  *          Over a full electrical turn, the clamped compare values must give
+  *          the same line to line voltages as the continuous SVPWM, with one
+  *          phase always at 0, and the duty cycles used by the sampling point
+  *          selection must follow them. PWMC_DPWM_Update() must keep the
+  *          continuous modulation with the default threshold.
+  *
+  *          An ideal inverter model at the PWM frequency gives the current
+  *          ripple of both modulations and the switching loss removed by the
+  *          clamping, which set the thresholds of DPWM_ENABLE_VOLTAGE. These
+  *          are model figures, not measurements.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "host_test.h"
+#include "parameters_conversion.h"
+#include "pwm_curr_fdbk.h"
+
+#define TURN_STEPS      3600U   /* Voltage angles of a full electrical turn */
+#define MODEL_STEPS     400U    /* Fundamental steps of the ripple model */
+#define MODEL_SUBSTEPS  200U    /* Time steps of a PWM period in the ripple model */
+
+static uint32_t MidSamplings;
+
+/* Sampling point selection: counts the periods whose sampling can be done at the middle of the period */
+static uint16_t SetADCSampPoint(PWMC_Handle_t *pHandle)
+{
+  if ((uint16_t)((pHandle->PWMperiod / 2U) - pHandle->lowDuty) > TW_AFTER)
+  {
+    MidSamplings++;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  return (0U);
+}
+
+/* RMS current ripple of phase a over a turn, in Vdc.Tpwm/L, for a modulation index m (1 at the SVPWM limit) */
+static double ModelRipple(double m, bool dpwm)
+{
+  double sum = 0.0;
+  double v[3];
+  double duty[3];
+  double amplitude = m / sqrt(3.0);
+  double offset;
+  double ripple;
+  double pole[3];
+  double t;
+  uint32_t n;
+  uint32_t k;
+  uint8_t i;
+
+  for (n = 0U; n < MODEL_STEPS; n++)
+  {
+    double theta = (2.0 * M_PI * n) / MODEL_STEPS;
+
+    for (i = 0U; i < 3U; i++)
+    {
+      v[i] = amplitude * cos(theta - ((2.0 * M_PI * i) / 3.0));
+    }
+    /* DPWMMIN rests the lowest phase on the negative rail, SVPWM centers the three duties */
+    offset = dpwm ? -fmin(v[0], fmin(v[1], v[2]))
+                  : (0.5 - ((fmax(v[0], fmax(v[1], v[2])) + fmin(v[0], fmin(v[1], v[2]))) / 2.0));
+    for (i = 0U; i < 3U; i++)
+    {
+      duty[i] = v[i] + offset;
+    }
+
+    /* Integral of the phase a voltage minus its average over a center aligned period */
+    ripple = 0.0;
+    for (k = 0U; k < MODEL_SUBSTEPS; k++)
+    {
+      t = fabs(((2.0 * (k + 0.5)) / MODEL_SUBSTEPS) - 1.0);
+      for (i = 0U; i < 3U; i++)
+      {
+        pole[i] = (t < duty[i]) ? 1.0 : 0.0;
+      }
+      ripple += (pole[0] - ((pole[0] + pole[1] + pole[2]) / 3.0) - v[0]) / MODEL_SUBSTEPS;
+      sum += (ripple * ripple) / MODEL_SUBSTEPS;
+    }
+  }
+  return (sqrt(sum / MODEL_STEPS));
+}
+
+/* Share of the switching loss removed by the clamping, for a load angle phi: the clamped phase carries |i| */
+static double ModelLossRemoved(double phi)
+{
+  double total = 0.0;
+  double removed = 0.0;
+  double current;
+  uint32_t n;
+
+  for (n = 0U; n < TURN_STEPS; n++)
+  {
+    double theta = (2.0 * M_PI * n) / TURN_STEPS;
+
+    current = fabs(cos(theta - phi));
+    total += current;
+    if (cos(theta) <= fmin(cos(theta - ((2.0 * M_PI) / 3.0)), cos(theta + ((2.0 * M_PI) / 3.0))))
+    {
+      removed += current;
+    }
+  }
+  return (removed / total);
+}
+
+/* Checks the clamped compare values against the continuous ones over a turn at modulation m */
+static void CheckTurn(double m, uint32_t *pMidSVPWM, uint32_t *pMidDPWM)
+{
+  PWMC_Handle_t svpwm =
+  {
+    .pFctSetADCSampPointSectX = &SetADCSampPoint,
+    .PWMperiod                = PWM_PERIOD_CYCLES,
+    .hT_Sqrt3                 = (PWM_PERIOD_CYCLES * SQRT3FACTOR) / 16384U,
+    .DPWM_Mode                = false,
+  };
+  PWMC_Handle_t dpwm = svpwm;
+  alphabeta_t v;
+  uint16_t lowest;
+  uint16_t highest;
+  uint32_t i;
+
+  dpwm.DPWM_Mode = true;
+  *pMidSVPWM = 0U;
+  *pMidDPWM = 0U;
+  for (i = 0U; i < TURN_STEPS; i++)
+  {
+    double theta = (2.0 * M_PI * i) / TURN_STEPS;
+
+    v.alpha = (int16_t)(32767.0 * m * cos(theta));
+    v.beta = (int16_t)(32767.0 * m * sin(theta));
+    MidSamplings = 0U;
+    (void)PWMC_SetPhaseVoltage(&svpwm, v);
+    *pMidSVPWM += MidSamplings;
+    MidSamplings = 0U;
+    (void)PWMC_SetPhaseVoltage(&dpwm, v);
+    *pMidDPWM += MidSamplings;
+
+    HT_CHECK(((int32_t)svpwm.CntPhA - svpwm.CntPhB) == ((int32_t)dpwm.CntPhA - dpwm.CntPhB));
+    HT_CHECK(((int32_t)svpwm.CntPhB - svpwm.CntPhC) == ((int32_t)dpwm.CntPhB - dpwm.CntPhC));
+    lowest = (dpwm.CntPhA < dpwm.CntPhB) ? dpwm.CntPhA : dpwm.CntPhB;
+    lowest = (lowest < dpwm.CntPhC) ? lowest : dpwm.CntPhC;
+    highest = (dpwm.CntPhA > dpwm.CntPhB) ? dpwm.CntPhA : dpwm.CntPhB;
+    highest = (highest > dpwm.CntPhC) ? highest : dpwm.CntPhC;
+    HT_CHECK(0U == lowest);
+    HT_CHECK(highest == dpwm.lowDuty);
+    HT_CHECK(lowest == dpwm.highDuty);
+  }
+}
+
+int main(void)
+{
+  PWMC_Handle_t pwmc =
+  {
+    .DPWMEnableModule  = DPWM_ENABLE_MODULE,
+    .DPWMDisableModule = DPWM_DISABLE_MODULE,
+  };
+  qd_t vqd = {0, 0};
+  uint32_t midSVPWM;
+  uint32_t midDPWM;
+  double svpwm;
+  double dpwm;
+  double m;
+  uint32_t k;
+
+  /* Same line to line voltages, one phase clamped; at full modulation more periods are sampled at mid period */
+  for (k = 1U; k <= 10U; k++)
+  {
+    m = k / 10.0;
+    CheckTurn(m, &midSVPWM, &midDPWM);
+    HT_CHECK(midDPWM >= midSVPWM);
+  }
+  printf("m = 1.0: mid period sampling svpwm %5.1f %%, dpwm %5.1f %%\n", (100.0 * midSVPWM) / TURN_STEPS,
+         (100.0 * midDPWM) / TURN_STEPS);
+  HT_CHECK(midDPWM > ((3U * midSVPWM) / 2U));
+
+  /* Model: the ripple is about doubled at low modulation, the same at full modulation */
+  for (k = 1U; k <= 11U; k += 2U)
+  {
+    m = (k < 10U) ? (k / 10.0) : 1.0; /* 0.1 to 0.9, then 1 */
+    svpwm = ModelRipple(m, false);
+    dpwm = ModelRipple(m, true);
+    printf("m = %.1f: ripple dpwm / svpwm %.2f\n", m, dpwm / svpwm);
+  }
+  HT_CHECK_NEAR(ModelRipple(0.3, true) / ModelRipple(0.3, false), 1.9, 0.05);
+  HT_CHECK_NEAR(ModelRipple(0.9, true) / ModelRipple(0.9, false), 1.16, 0.05);
+  HT_CHECK_NEAR(ModelRipple(1.0, true) / ModelRipple(1.0, false), 1.03, 0.05);
+
+  /* Model: a third of the commutations, 25 % to 43 % of the switching loss from a 90 to a 0 degree load angle */
+  for (k = 0U; k <= 90U; k += 30U)
+  {
+    printf("load angle %2u deg: switching loss removed %2.0f %%\n", k, 100.0 * ModelLossRemoved((M_PI * k) / 180.0));
+  }
+  HT_CHECK_NEAR(ModelLossRemoved(0.0), 0.43, 0.01);
+  HT_CHECK_NEAR(ModelLossRemoved(M_PI / 2.0), 0.25, 0.01);
+
+  /* The default threshold keeps the continuous modulation, even at full modulation */
+  vqd.q = INT16_MAX;
+  PWMC_DPWM_Update(&pwmc, vqd);
+  HT_CHECK(false == PWMC_GetDPWM_Mode(&pwmc));
+
+  /* A threshold written by the host enables it, with the default hysteresis */
+  PWMC_DPWM_SetThreshold(&pwmc, (uint16_t)((MAX_MODULE * 800U) / 1000U));
+  HT_CHECK(pwmc.DPWMDisableModule == (uint16_t)(pwmc.DPWMEnableModule - (DPWM_ENABLE_MODULE - DPWM_DISABLE_MODULE)));
+  vqd.q = (int16_t)(pwmc.DPWMEnableModule + 1U);
+  PWMC_DPWM_Update(&pwmc, vqd);
+  HT_CHECK(PWMC_GetDPWM_Mode(&pwmc));
+  vqd.q = (int16_t)(pwmc.DPWMDisableModule + 1U);
+  PWMC_DPWM_Update(&pwmc, vqd);
+  HT_CHECK(PWMC_GetDPWM_Mode(&pwmc));
+  vqd.q = (int16_t)(pwmc.DPWMDisableModule - 1U);
+  PWMC_DPWM_Update(&pwmc, vqd);
+  HT_CHECK(false == PWMC_GetDPWM_Mode(&pwmc));
+
+  return (HT_RESULT("test_dpwm"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
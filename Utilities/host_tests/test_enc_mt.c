@@ -0,0 +1,192 @@
+/**
+  ******************************************************************************
+  * @file    test_enc_mt.c
+  * @author  LenseDrive
+  * @brief   Host test of the M/T speed measurement of the encoder component.
+  *
+  *          TIM3 (encoder) and TIM5 (edge timestamps) are replaced by plain
+  *          TIM_TypeDef structures. The test moves a virtual encoder, writes
+  *          the captures the hardware would latch on the last rising edge of
+  *          channel A, and runs ENC_CalcAvrgMecSpeedUnit() at the MF rate.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <math.h>
+#include "host_test.h"
+#include "parameters_conversion.h"
+#include "encoder_speed_pos_fdbk.h"
+
+#define MF_PERIOD_S   (1.0 / (double)MEDIUM_FREQUENCY_TASK_RATE)
+#define TIME_FREQ_HZ  ((double)M1_ENC_TIME_FREQ_HZ)
+#define PULSE_NUMBER  (M1_ENCODER_PPR * 4)
+
+static TIM_TypeDef EncTim;
+static TIM_TypeDef TimeTim;
+static ENCODER_Handle_t Enc;
+
+/* Virtual encoder: position in counts, moving at a constant speed from the start of a segment */
+static double SegStartTime;
+static double SegStartPos;
+static double SegSpeed;
+static uint32_t TimeBase;
+
+static void Setup(uint32_t timeBase)
+{
+  EncTim = (TIM_TypeDef){0};
+  TimeTim = (TIM_TypeDef){0};
+  Enc = (ENCODER_Handle_t)
+  {
+    ._Super =
+    {
+      .bElToMecRatio             = POLE_PAIR_NUM,
+      .hMaxReliableMecSpeedUnit  = INT16_MAX,
+      .hMinReliableMecSpeedUnit  = 0,
+      .bMaximumSpeedErrorsNumber = 3,
+      .hMaxReliableMecAccelUnitP = 65535,
+      .hMeasurementFrequency     = TF_REGULATION_RATE_SCALED,
+      .DPPConvFactor             = DPP_CONV_FACTOR,
+    },
+    .PulseNumber         = PULSE_NUMBER,
+    .SpeedSamplingFreqHz = MEDIUM_FREQUENCY_TASK_RATE,
+    .SpeedBufferSize     = ENC_AVERAGING_FIFO_DEPTH,
+    .TIMx                = &EncTim,
+    .TimeTIMx            = &TimeTim,
+    .TimeITR             = M1_ENC_TIME_ITR,
+    .TimeFrequencyHz     = M1_ENC_TIME_FREQ_HZ,
+    .EdgeTimeoutMs       = ENC_EDGE_TIMEOUT_MS,
+  };
+  TimeBase = timeBase;
+  SegStartTime = 0.0;
+  SegStartPos = 0.0;
+  SegSpeed = 0.0;
+  ENC_Init(&Enc);
+}
+
+static double PosAt(double t)
+{
+  return (SegStartPos + (SegSpeed * (t - SegStartTime)));
+}
+
+/* Changes the speed (counts per second) of the virtual encoder from time t */
+static void SetSpeed(double t, double countsPerS)
+{
+  SegStartPos = PosAt(t);
+  SegStartTime = t;
+  SegSpeed = countsPerS;
+}
+
+/* Latches the captures of the last rising edge of channel A (every ENC_EDGE_COUNTS counts) before time t */
+static void Capture(double t)
+{
+  double pos = PosAt(t);
+  double edgePos;
+  double edgeTime;
+
+  if (SegSpeed > 0.0)
+  {
+    edgePos = floor(pos / ENC_EDGE_COUNTS) * ENC_EDGE_COUNTS;
+  }
+  else if (SegSpeed < 0.0)
+  {
+    edgePos = ceil(pos / ENC_EDGE_COUNTS) * ENC_EDGE_COUNTS;
+  }
+  else
+  {
+    edgePos = NAN;
+  }
+
+  if ((SegSpeed != 0.0) && (fabs(edgePos - SegStartPos) <= fabs(pos - SegStartPos)))
+  {
+    int64_t count = ((int64_t)edgePos % PULSE_NUMBER + PULSE_NUMBER) % PULSE_NUMBER;
+
+    edgeTime = SegStartTime + ((edgePos - SegStartPos) / SegSpeed);
+    EncTim.CCR1 = (uint32_t)count;
+    TimeTim.CCR1 = TimeBase + (uint32_t)llround(edgeTime * TIME_FREQ_HZ);
+  }
+  else
+  {
+    /* No edge in this segment, the previous captures are kept */
+  }
+  TimeTim.CNT = TimeBase + (uint32_t)llround(t * TIME_FREQ_HZ);
+}
+
+/* Runs the MF task from t0 for n periods, returns the last speed and checks each one against expected */
+static int16_t Run(double *pT, int n, double expected, double tol)
+{
+  int16_t speed = 0;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    *pT += MF_PERIOD_S;
+    Capture(*pT);
+    (void)ENC_CalcAvrgMecSpeedUnit(&Enc, &speed);
+    if (tol >= 0.0)
+    {
+      HT_CHECK_NEAR(speed, expected, tol);
+    }
+  }
+  return (speed);
+}
+
+/* Speed in counts per second of a mechanical speed expressed in #SPEED_UNIT */
+static double Counts(double speedUnit)
+{
+  return ((speedUnit * PULSE_NUMBER) / SPEED_UNIT);
+}
+
+int main(void)
+{
+  double t;
+  int16_t speed;
+  int16_t previous;
+  int i;
+
+  /* Constant speed, the count wraps modulo PulseNumber every 100 ms */
+  Setup(0U);
+  t = 0.0;
+  SetSpeed(t, Counts(100.0));
+  (void)Run(&t, 2, 0.0, -1.0);
+  (void)Run(&t, 500, 100.0, 1.0);
+
+  /* Reverse */
+  SetSpeed(t, Counts(-100.0));
+  (void)Run(&t, 2, 0.0, -1.0);
+  (void)Run(&t, 200, -100.0, 1.0);
+
+  /* Low speed: one edge every 5 MF periods, the speed is held between the edges instead of dropping to 0 */
+  Setup(0U);
+  t = 0.0;
+  SetSpeed(t, Counts(5.0));
+  (void)Run(&t, 20, 0.0, -1.0);
+  (void)Run(&t, 200, 5.0, 1.0);
+
+  /* Stop: the speed is bounded by one edge over the elapsed time, then zero after the edge timeout */
+  SetSpeed(t, 0.0);
+  previous = Run(&t, 1, 0.0, -1.0);
+  for (i = 1; i < ENC_EDGE_TIMEOUT_MS; i++)
+  {
+    speed = Run(&t, 1, 0.0, -1.0);
+    HT_CHECK(speed <= previous);
+    HT_CHECK(speed >= 0);
+    previous = speed;
+  }
+  (void)Run(&t, 10, 0.0, 0.0);
+
+  /* TimeTIMx wraps around 2^32 half a millisecond after the start */
+  Setup(UINT32_MAX - (uint32_t)(TIME_FREQ_HZ / 2000.0));
+  t = 0.0;
+  SetSpeed(t, Counts(250.0));
+  (void)Run(&t, 2, 0.0, -1.0);
+  (void)Run(&t, 100, 250.0, 1.0);
+
+  return (HT_RESULT("test_enc_mt"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
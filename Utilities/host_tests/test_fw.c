@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    test_fw.c
+  * @author  LenseDrive
+  * @brief   Host plant simulation of the flux weakening of motor 1.
+  *
+  *          The firmware speed, current and flux weakening regulators and the
+  *          circle limitation drive a PMSM model (dq electrical equations and
+  *          rotor inertia) at the FOC rate. Three flux weakening settings are
+  *          compared: disabled (FW_VOLTAGE_REF of 1000), the SDK algorithm
+  *          bounded by the demagnetisation current only, and the algorithm
+  *          also bounded by the current that minimises the stator voltage.
+  *
+  *          The lens motor does not reach the voltage circle at its maximum
+  *          application speed on the nominal bus, so the flux weakening must
+  *          stay inactive there. On a low bus voltage, the unbounded SDK
+  *          algorithm winds Id down to ID_DEMAG and loses speed, the bounded
+  *          one does not. On a high inductance motor, the flux weakening
+  *          raises the voltage limited speed.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <math.h>
+#include "host_test.h"
+#include "parameters_conversion.h"
+#include "flux_weakening_ctrl.h"
+#include "circle_limitation.h"
+
+#define HF_PER_MF    (ISR_FREQUENCY_HZ / MEDIUM_FREQUENCY_TASK_RATE)
+#define SIM_SECONDS  3U
+
+typedef enum
+{
+  FW_OFF,       /* FW_VOLTAGE_REF of 1000 */
+  FW_SDK,       /* Id bounded by ID_DEMAG only */
+  FW_BOUNDED,   /* Id also bounded by the voltage minimising current */
+} FwMode_t;
+
+typedef struct
+{
+  double Rs;        /* ohm */
+  double Ls;        /* H */
+  double Flux;      /* Wb */
+  double Inertia;   /* kg.m2 */
+  int16_t TorqueKp; /* Current loop gains, TF_KPDIV and TF_KIDIV divisors */
+  int16_t TorqueKi;
+} Motor_t;
+
+typedef struct
+{
+  double Speed;     /* Hz, mechanical */
+  double Id;        /* A */
+  double Iq;        /* A */
+  uint16_t AvV;     /* Vqd magnitude, tenth of percent of MAX_MODULE */
+} Result_t;
+
+/* The lens motor of drive_parameters.h, flux from the voltage constant as in mc_config.c */
+static const Motor_t LensMotor =
+{
+  .Rs       = RS,
+  .Ls       = LS,
+  .Flux     = MOTOR_VOLTAGE_CONSTANT / (128.25 * POLE_PAIR_NUM),
+  .Inertia  = 2e-6,
+  .TorqueKp = PID_TORQUE_KP_DEFAULT,
+  .TorqueKi = PID_TORQUE_KI_DEFAULT,
+};
+
+/* A motor whose inductance voltage is large against the back EMF, so flux weakening raises its speed */
+static const Motor_t HighInductanceMotor =
+{
+  .Rs       = 1.0,
+  .Ls       = 0.004,
+  .Flux     = 0.012,
+  .Inertia  = 3e-5,
+  .TorqueKp = 12450,
+  .TorqueKi = 97,
+};
+
+static int16_t SpeedUnit;
+
+/* Speed sensor of the flux weakening bound */
+int16_t SPD_GetAvrgMecSpeedUnit(const SpeednPosFdbk_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (SpeedUnit);
+}
+
+static PID_Handle_t MakePID(int16_t kp, int16_t ki, uint16_t kpDiv, uint16_t kiDiv, int16_t upper, int16_t lower)
+{
+  PID_Handle_t pid =
+  {
+    .hDefKpGain          = kp,
+    .hDefKiGain          = ki,
+    .hKpDivisor          = kpDiv,
+    .hKiDivisor          = kiDiv,
+    .hKpDivisorPOW2      = (uint16_t)__builtin_ctz(kpDiv),
+    .hKiDivisorPOW2      = (uint16_t)__builtin_ctz(kiDiv),
+    .wUpperIntegralLimit = (int32_t)upper * kiDiv,
+    .wLowerIntegralLimit = (int32_t)lower * kiDiv,
+    .hUpperOutputLimit   = upper,
+    .hLowerOutputLimit   = lower,
+  };
+
+  PID_HandleInit(&pid);
+  return (pid);
+}
+
+/* Runs the speed loop towards target (01Hz) for SIM_SECONDS on a bus of busVoltage volts */
+static Result_t Run(const Motor_t *pMotor, double busVoltage, int16_t target, FwMode_t mode)
+{
+  const double dt = 1.0 / ISR_FREQUENCY_HZ;
+  const double voltsPerUnit = busVoltage / sqrt(3.0) / 32768.0;
+  const int16_t peak = (int16_t)IQMAX;
+  PID_Handle_t pidIq = MakePID(pMotor->TorqueKp, pMotor->TorqueKi, TF_KPDIV, TF_KIDIV, INT16_MAX, -INT16_MAX);
+  PID_Handle_t pidId = pidIq;
+  PID_Handle_t pidSpeed = MakePID(PID_SPEED_KP_DEFAULT, PID_SPEED_KI_DEFAULT, SP_KPDIV, SP_KIDIV, peak, -peak);
+  PID_Handle_t pidFW = MakePID(FW_KP_GAIN, FW_KI_GAIN, FW_KPDIV, FW_KIDIV, 0, -INT16_MAX);
+  SpeednPosFdbk_Handle_t sensor;
+  FW_Handle_t fw =
+  {
+    .hMaxModule             = MAX_MODULE,
+    .hDefaultFW_V_Ref       = (FW_OFF == mode) ? 1000 : FW_VOLTAGE_REF,
+    .hDemagCurrent          = (int16_t)ID_DEMAG,
+    .wNominalSqCurr         = (int32_t)(NOMINAL_CURRENT * NOMINAL_CURRENT),
+    .hVqdLowPassFilterBW    = M1_VQD_SW_FILTER_BW_FACTOR,
+    .hVqdLowPassFilterBWLOG = M1_VQD_SW_FILTER_BW_FACTOR_LOG,
+    .pSPD                   = (FW_BOUNDED == mode) ? &sensor : MC_NULL,
+    .Rs                     = (float)pMotor->Rs,
+    .Ls                     = (float)pMotor->Ls,
+    .Flux                   = (float)pMotor->Flux,
+    .ElSpeedConv            = (float)((2.0 * M_PI * POLE_PAIR_NUM) / SPEED_UNIT),
+    .CurrentConv            = (float)CURRENT_CONV_FACTOR,
+  };
+  CircleLimitation_Handle_t circle =
+  {
+    .MaxModule = MAX_MODULE,
+    .MaxVd     = (uint16_t)((MAX_MODULE * 950) / 1000),
+  };
+  qd_t iqdRef = {0, 0};
+  qd_t vqd;
+  double id = 0.0;
+  double iq = 0.0;
+  double speed = 0.0;  /* rad/s, mechanical */
+  double we;
+  double decay = exp((-pMotor->Rs * dt) / pMotor->Ls);
+  double idSteady;
+  double iqSteady;
+  uint32_t k;
+  Result_t result;
+
+  pidFW.wLowerIntegralLimit = -(int32_t)NOMINAL_CURRENT * FW_KIDIV;
+  FW_Init(&fw, &pidSpeed, &pidFW);
+  FW_Clear(&fw);
+  FW_SetNominalCurrent(&fw, (uint16_t)peak);
+
+  for (k = 0U; k < (SIM_SECONDS * ISR_FREQUENCY_HZ); k++)
+  {
+    if (0U == (k % HF_PER_MF))
+    {
+      qd_t torque = {0, 0};
+
+      SpeedUnit = (int16_t)((speed / (2.0 * M_PI)) * SPEED_UNIT);
+      torque.q = PI_Controller(&pidSpeed, target - SpeedUnit);
+      iqdRef = FW_CalcCurrRef(&fw, torque);
+    }
+    vqd.q = PI_Controller(&pidIq, iqdRef.q - (int16_t)(iq * CURRENT_CONV_FACTOR));
+    vqd.d = PI_Controller(&pidId, iqdRef.d - (int16_t)(id * CURRENT_CONV_FACTOR));
+    vqd = Circle_Limitation(&circle, vqd);
+    FW_DataProcess(&fw, vqd);
+
+    /* Exact step of the dq equations at constant speed, then the mechanical equation */
+    we = speed * POLE_PAIR_NUM;
+    idSteady = ((vqd.d * voltsPerUnit) + (we * pMotor->Ls * iq)) / pMotor->Rs;
+    iqSteady = ((vqd.q * voltsPerUnit) - (we * pMotor->Ls * id) - (we * pMotor->Flux)) / pMotor->Rs;
+    id = idSteady + ((id - idSteady) * decay);
+    iq = iqSteady + ((iq - iqSteady) * decay);
+    speed += ((1.5 * POLE_PAIR_NUM * pMotor->Flux * iq) / pMotor->Inertia) * dt;
+  }
+
+  result.Speed = speed / (2.0 * M_PI);
+  result.Id = id;
+  result.Iq = iq;
+  result.AvV = FW_GetAvVPercentage(&fw);
+  printf("Rs %4.1f ohm, %4.1f V, target %6.1f Hz, FW %d: %6.1f Hz, Id %6.3f A, Iq %6.3f A, |Vqd| %5.1f %%\n",
+         pMotor->Rs, busVoltage, (double)target / SPEED_UNIT, (int)mode, result.Speed, result.Id, result.Iq,
+         (double)result.AvV / 10.0);
+  return (result);
+}
+
+int main(void)
+{
+  const int16_t maxSpeed = (int16_t)((MAX_APPLICATION_SPEED_RPM * SPEED_UNIT) / 60);
+  Result_t off;
+  Result_t sdk;
+  Result_t bounded;
+
+  /* Maximum application speed on the nominal bus: far from the voltage circle, flux weakening stays inactive */
+  bounded = Run(&LensMotor, NOMINAL_BUS_VOLTAGE_V, maxSpeed, FW_BOUNDED);
+  HT_CHECK_NEAR(bounded.Speed, MAX_APPLICATION_SPEED_RPM / 60.0, 0.5);
+  HT_CHECK(bounded.AvV < 100U);
+  HT_CHECK(fabs(bounded.Id) < 0.001);
+
+  /* 10 V bus, voltage limited: the SDK algorithm loses speed, the bounded one keeps it */
+  off = Run(&LensMotor, 10.0, 8000, FW_OFF);
+  sdk = Run(&LensMotor, 10.0, 8000, FW_SDK);
+  bounded = Run(&LensMotor, 10.0, 8000, FW_BOUNDED);
+  HT_CHECK(sdk.Speed < (0.7 * off.Speed));
+  HT_CHECK_NEAR(sdk.Id, ID_DEMAG_A, 0.01);
+  HT_CHECK(bounded.Speed >= (off.Speed - 1.0));
+  HT_CHECK(bounded.Id > (ID_DEMAG_A / 4.0));
+
+  /* High inductance motor: flux weakening raises the voltage limited speed */
+  off = Run(&HighInductanceMotor, NOMINAL_BUS_VOLTAGE_V, 1500, FW_OFF);
+  bounded = Run(&HighInductanceMotor, NOMINAL_BUS_VOLTAGE_V, 1500, FW_BOUNDED);
+  HT_CHECK(off.Speed < 120.0);
+  HT_CHECK(bounded.Speed > (1.3 * off.Speed));
+
+  return (HT_RESULT("test_fw"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file    test_hfc.c
+  * @author  LenseDrive
+  * @brief   Host test of the fault trigger of the High Frequency Capture
+  *          component.
+  *
+  *          The fault is latched when it is reported: the last frame recorded
+  *          before it is the trigger frame. The capture must survive a stop
+  *          when the HF task no longer runs after the fault, and be completed
+  *          with the post-trigger frames when it still runs.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "hf_capture.h"
+#include "register_interface.h"
+#include "mcp.h"
+
+#define CHANNELS      2U
+#define DEPTH         64U
+#define PRE_TRIGGER   10U
+
+static int16_t Buffer[CHANNELS * DEPTH];
+static int16_t Source[CHANNELS];
+static int16_t Tick;
+
+static HFC_Handle_t Hfc =
+{
+  .pBuffer    = Buffer,
+  .BufferSize = CHANNELS * DEPTH,
+};
+
+/* Register interface: channel n of the capture is register n + 1 */
+uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  uint16_t index = (uint16_t)(dataID >> 6U) - 1U;
+
+  if (index < CHANNELS)
+  {
+    *dataPtr = &Source[index];
+  }
+  else
+  {
+    retVal = MCP_ERROR_UNKNOWN_REG;
+  }
+  return (retVal);
+}
+
+/* Runs HF task periods, the channels are the period count and its opposite */
+static void Run(uint16_t periods)
+{
+  uint16_t i;
+
+  for (i = 0U; i < periods; i++)
+  {
+    Tick++;
+    Source[0] = Tick;
+    Source[1] = -Tick;
+    HFC_Exec(&Hfc);
+  }
+}
+
+static void Configure(HFC_TriggerMode_t mode)
+{
+  uint8_t config[HFC_CONFIG_HEADER_SIZE + (2U * CHANNELS)] = { 0 };
+  uint16_t preTrigger = PRE_TRIGGER;
+  uint16_t id;
+  uint8_t i;
+
+  config[0] = CHANNELS;
+  config[1] = (uint8_t)mode;
+  config[3] = 1U;
+  (void)memcpy(&config[6], &preTrigger, 2U);
+  for (i = 0U; i < CHANNELS; i++)
+  {
+    id = (uint16_t)(((i + 1U) << 6U) | TYPE_DATA_16BIT);
+    (void)memcpy(&config[HFC_CONFIG_HEADER_SIZE + (2U * i)], &id, 2U);
+  }
+  HT_CHECK(MCP_CMD_OK == HFC_SetConfig(&Hfc, config, sizeof(config)));
+  HT_CHECK(DEPTH == Hfc.Depth);
+}
+
+/* Uploads the capture in one chunk, checks its frames and returns the trigger frame */
+static int16_t Upload(uint16_t length, uint16_t triggerPos)
+{
+  uint8_t data[HFC_DATA_HEADER_SIZE + (sizeof(Buffer))];
+  int16_t frame[CHANNELS];
+  uint16_t header[4];
+  uint16_t size;
+  uint16_t i;
+
+  HT_CHECK(MCP_CMD_OK == HFC_ReadData(&Hfc, data, sizeof(data), &size));
+  (void)memcpy(header, data, sizeof(header));
+  HT_CHECK(0U == header[0]);
+  HT_CHECK(length == header[1]);
+  HT_CHECK(length == header[2]);
+  HT_CHECK(triggerPos == header[3]);
+  HT_CHECK(size == (HFC_DATA_HEADER_SIZE + (length * CHANNELS * 2U)));
+  for (i = 1U; i < length; i++)
+  {
+    (void)memcpy(frame, &data[HFC_DATA_HEADER_SIZE + (i * CHANNELS * 2U)], sizeof(frame));
+    HT_CHECK(frame[0] == (int16_t)(data[HFC_DATA_HEADER_SIZE] + i));
+    HT_CHECK(frame[1] == -frame[0]);
+  }
+  (void)memcpy(frame, &data[HFC_DATA_HEADER_SIZE + (triggerPos * CHANNELS * 2U)], sizeof(frame));
+  return (frame[0]);
+}
+
+int main(void)
+{
+  int16_t faultTick;
+
+  HFC_Init(&Hfc);
+  Configure(HFC_TRIGGER_FAULT);
+
+  /* The HF task stops with the PWM: the pre-trigger frames recorded before the fault are kept */
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_ARM));
+  Run(30U);
+  faultTick = Tick;
+  HFC_FaultTrigger(&Hfc);
+  HT_CHECK(HFC_TRIGGERED == HFC_GetState(&Hfc));
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_STOP));
+  HT_CHECK(HFC_DONE == HFC_GetState(&Hfc));
+  HT_CHECK(faultTick == Upload(PRE_TRIGGER + 1U, PRE_TRIGGER));
+
+  /* Fault before all the pre-trigger frames, the HF task keeps running: the capture is completed */
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_ARM));
+  Run(5U);
+  faultTick = Tick;
+  HFC_FaultTrigger(&Hfc);
+  Run(DEPTH);
+  HT_CHECK(HFC_DONE == HFC_GetState(&Hfc));
+  HT_CHECK(faultTick == Upload(5U + (DEPTH - PRE_TRIGGER - 1U), 4U));
+
+  /* Fault before the first frame: the next frame is the trigger frame */
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_ARM));
+  HFC_FaultTrigger(&Hfc);
+  HT_CHECK(HFC_ARMED == HFC_GetState(&Hfc));
+  Run(1U);
+  HT_CHECK(HFC_TRIGGERED == HFC_GetState(&Hfc));
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_STOP));
+  HT_CHECK(Tick == Upload(1U, 0U));
+
+  /* A capture armed on a level is not triggered by a fault */
+  Configure(HFC_TRIGGER_ABOVE);
+  Hfc.TriggerLevel = INT16_MAX;
+  HT_CHECK(MCP_CMD_OK == HFC_Command(&Hfc, HFC_CMD_ARM));
+  Run(30U);
+  HFC_FaultTrigger(&Hfc);
+  Run(1U);
+  HT_CHECK(HFC_ARMED == HFC_GetState(&Hfc));
+
+  return (HT_RESULT("test_hfc"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,820 @@
+/**
+  ******************************************************************************
+  * @file    test_mcp_e2e.c
+  * @author  LenseDrive
+  * @brief   End to end host test of the MCP stack: the firmware ASPEP, MCP,
+  *          MCPA and MCP Events components against the host library.
+  *
+  *          Both sides are linked in the same program and exchange their
+  *          bytes over a socketpair. The USART driver is replaced by the
+  *          performer end of the socketpair. Each time the host waits for
+  *          bytes and finds none, the performer runs: the received bytes are
+  *          written in the reception ring as the circular DMA would, then the
+  *          medium frequency MCP processing and a few high frequency task
+  *          periods run, and the packets sent are completed at once.
+  *
+  *          The streamed registers are functions of the high frequency period
+  *          count, so that each decoded frame can be checked on its own.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include "host_test.h"
+#include "mc_config.h"
+#include "mc_api.h"
+#include "register_interface.h"
+#include "usart_aspep_driver.h"
+#include "mcp_config.h"
+#include "mcp_host.h"
+
+#define HF_PER_PUMP   8U      /* High frequency task periods run each time the host finds no byte */
+#define FRAMES_MIN    400U    /* Frames decoded by each streaming case */
+
+#define E2E_REG_I_A          (MC_REG_I_A | 1U)
+#define E2E_REG_I_B          (MC_REG_I_B | 1U)
+#define E2E_REG_SPEED_MEAS   (MC_REG_SPEED_MEAS | 1U)
+#define E2E_REG_SPEED_KP     (MC_REG_SPEED_KP | 1U)
+
+MCI_Handle_t Mci[NBR_OF_MOTORS];
+
+static int HostFd;
+static int PerfFd;
+
+/* Performer side of the USART driver */
+static uint8_t *RxRing;
+static uint16_t RxRingSize;
+static uint16_t RxRingWrite;
+static bool TxBusy;
+static bool InHFTask;
+static uint32_t TxPeriods = 1U;    /* HF periods per end of transfer, more than 1 for a link slower than the log */
+
+/* Registers of the performer */
+static uint32_t Tick;
+static uint16_t RegIA;
+static uint16_t RegIB;
+static uint32_t RegSpeed;
+static uint16_t RegSpeedKp = 1000U;
+
+/* Values of the registers at high frequency period t */
+static uint16_t ValueIA(uint32_t t)
+{
+  return ((uint16_t)t);
+}
+
+static uint16_t ValueIB(uint32_t t)
+{
+  return ((uint16_t)(t * 40503U)); /* Large steps, encoded on 3 bytes as deltas */
+}
+
+/* Fake USART driver ---------------------------------------------------------*/
+
+void UASPEP_INIT(void *pHWHandle)
+{
+  (void)pHWHandle;
+}
+
+void UASPEP_IDLE_ENABLE(void *pHWHandle)
+{
+  (void)pHWHandle;
+}
+
+void UASPEP_RECEIVE_BUFFER(void *pHWHandle, void *buffer, uint16_t length)
+{
+  (void)pHWHandle;
+  (void)buffer;
+  (void)length;
+}
+
+void UASPEP_RECEIVE_CIRCULAR(void *pHWHandle, void *buffer, uint16_t length)
+{
+  (void)pHWHandle;
+  RxRing = (uint8_t *)buffer;
+  RxRingSize = length;
+  RxRingWrite = 0U;
+}
+
+uint16_t UASPEP_RX_REMAINING(void *pHWHandle)
+{
+  (void)pHWHandle;
+  return (RxRingSize - RxRingWrite);
+}
+
+bool UASPEP_DATA_CRC(void *pHWHandle, const uint8_t *data, uint16_t length, uint16_t *crc)
+{
+  (void)pHWHandle;
+  (void)data;
+  (void)length;
+  (void)crc;
+  /* The data CRC of the async packets is not computed by the High Frequency Task */
+  HT_CHECK(false == InHFTask);
+  return (false); /* Software CRC */
+}
+
+bool UASPEP_SEND_PACKET(void *pHWHandle, void *data, uint16_t length)
+{
+  const uint8_t *p = (const uint8_t *)data;
+  ssize_t n;
+
+  (void)pHWHandle;
+  HT_CHECK(false == TxBusy);
+  while (length > 0U)
+  {
+    n = write(PerfFd, p, length);
+    if (n <= 0)
+    {
+      HT_CHECK(n > 0);
+      break;
+    }
+    p += n;
+    length -= (uint16_t)n;
+  }
+  TxBusy = true;
+  return (true);
+}
+
+/* Register interface of the performer ---------------------------------------*/
+
+uint8_t RI_SetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  (void)regID;
+  (void)typeID;
+  (void)data;
+  (void)dataAvailable;
+  *size = 0U;
+  return (MCP_ERROR_UNKNOWN_REG);
+}
+
+uint8_t RI_SetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t dataAvailable)
+{
+  uint8_t retVal = MCP_ERROR_UNKNOWN_REG;
+  uint16_t rawSize;
+
+  if (TYPE_DATA_RAW == typeID)
+  {
+    rawSize = (uint16_t)data[0] | (uint16_t)((uint16_t)data[1] << 8U);
+    *size = rawSize + 2U;
+    if ((int16_t)*size > dataAvailable)
+    {
+      *size = 0U;
+      retVal = MCP_ERROR_BAD_RAW_FORMAT;
+    }
+    else if (MC_REG_ASYNC_UARTA == regID)
+    {
+      retVal = MCPA_cfgLog(&MCPA_UART_A, &data[2], rawSize);
+    }
+    else
+    {
+      /* Unknown register */
+    }
+  }
+  else if (TYPE_DATA_16BIT == typeID)
+  {
+    *size = 2U;
+    if (MC_REG_SPEED_KP == regID)
+    {
+      (void)memcpy(&RegSpeedKp, data, 2);
+      retVal = MCP_CMD_OK;
+    }
+    else if ((MC_REG_I_A == regID) || (MC_REG_I_B == regID))
+    {
+      retVal = MCP_ERROR_RO_REG;
+    }
+    else
+    {
+      /* Unknown register */
+    }
+  }
+  else
+  {
+    *size = 0U;
+    retVal = MCP_ERROR_BAD_DATA_TYPE;
+  }
+  return (retVal);
+}
+
+uint8_t RI_GetRegisterGlobal(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  (void)regID;
+  (void)typeID;
+  (void)data;
+  (void)freeSpace;
+  *size = 0U;
+  return (MCP_ERROR_UNKNOWN_REG);
+}
+
+uint8_t RI_GetRegisterMotor1(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t freeSpace)
+{
+  const void *pValue = NULL;
+  uint8_t retVal = MCP_CMD_OK;
+
+  *size = (TYPE_DATA_32BIT == typeID) ? 4U : 2U;
+  switch (regID)
+  {
+    case MC_REG_I_A:
+      pValue = &RegIA;
+      break;
+    case MC_REG_I_B:
+      pValue = &RegIB;
+      break;
+    case MC_REG_SPEED_MEAS:
+      pValue = &RegSpeed;
+      break;
+    case MC_REG_SPEED_KP:
+      pValue = &RegSpeedKp;
+      break;
+    default:
+      retVal = MCP_ERROR_UNKNOWN_REG;
+      break;
+  }
+  if ((MCP_CMD_OK == retVal) && ((int16_t)*size > freeSpace))
+  {
+    retVal = MCP_ERROR_NO_TXSYNC_SPACE;
+  }
+  if (MCP_CMD_OK == retVal)
+  {
+    (void)memcpy(data, pValue, *size);
+  }
+  else
+  {
+    *size = 0U;
+  }
+  return (retVal);
+}
+
+uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr)
+{
+  uint8_t retVal = MCP_CMD_OK;
+
+  switch (dataID & REG_MASK)
+  {
+    case MC_REG_I_A:
+      *dataPtr = &RegIA;
+      break;
+    case MC_REG_I_B:
+      *dataPtr = &RegIB;
+      break;
+    case MC_REG_SPEED_MEAS:
+      *dataPtr = &RegSpeed;
+      break;
+    default:
+      retVal = MCP_ERROR_UNKNOWN_REG;
+      break;
+  }
+  return (retVal);
+}
+
+uint8_t RI_GetDirectPtr(uint8_t motorID, uint16_t regID, void **dataPtr)
+{
+  (void)motorID;
+  (void)regID;
+  *dataPtr = NULL;
+  return (MCP_ERROR_UNKNOWN_REG);
+}
+
+uint8_t RI_GetIDSize(uint16_t dataID)
+{
+  uint8_t typeID = (uint8_t)dataID & TYPE_MASK;
+  return ((TYPE_DATA_8BIT == typeID) ? 1U : ((TYPE_DATA_16BIT == typeID) ? 2U : 4U));
+}
+
+/* Motor control interface, not used by these tests */
+
+bool MCI_StartWithPolarizationMotor(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (false);
+}
+
+bool MCI_StopMotor(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (false);
+}
+
+bool MCI_FaultAcknowledged(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (false);
+}
+
+MCI_State_t MCI_GetSTMState(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (IDLE);
+}
+
+void MCI_StopRamp(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void MCI_Clear_Iqdref(MCI_Handle_t *pHandle)
+{
+  (void)pHandle;
+}
+
+void MCI_Clear_PerfMeasure(MCI_Handle_t *pHandle, uint8_t bMotor)
+{
+  (void)pHandle;
+  (void)bMotor;
+}
+
+uint8_t MC_ProfilerCommand(uint16_t rxLength, uint8_t *rxBuffer, int16_t txSyncFreeSpace, uint16_t *txLength,
+                           uint8_t *txBuffer)
+{
+  (void)rxLength;
+  (void)rxBuffer;
+  (void)txSyncFreeSpace;
+  (void)txBuffer;
+  *txLength = 0U;
+  return (MCP_CMD_UNKNOWN);
+}
+
+/* Performer execution -------------------------------------------------------*/
+
+/* Completes the transmissions, as the end of transfer interrupt does */
+static void CompleteTx(void)
+{
+  while (TxBusy)
+  {
+    TxBusy = false;
+    ASPEP_HWDataTransmittedIT(&aspepOverUartA);
+  }
+}
+
+/* Writes received bytes in the ring as the circular DMA does, then parses them at the end of the burst (idle line)
+   or before it (half ring interrupt) */
+static void Receive(const uint8_t *bytes, uint16_t length, bool idle)
+{
+  uint16_t i;
+
+  for (i = 0U; i < length; i++)
+  {
+    RxRing[RxRingWrite] = bytes[i];
+    RxRingWrite = ((RxRingWrite + 1U) < RxRingSize) ? (RxRingWrite + 1U) : 0U;
+  }
+  if (idle)
+  {
+    ASPEP_HWRxIdleIT(&aspepOverUartA);
+  }
+  else
+  {
+    ASPEP_HWDataReceivedIT(&aspepOverUartA);
+  }
+}
+
+/* Runs the performer: reception, MCP processing as in MC_Scheduler(), then the high frequency task */
+static void Pump(void)
+{
+  uint8_t bytes[64];
+  ssize_t n;
+  uint32_t k;
+
+  n = read(PerfFd, bytes, sizeof(bytes));
+  if (n > 0)
+  {
+    Receive(bytes, (uint16_t)n, true);
+  }
+
+  MCP_Over_UartA.rxBuffer = MCP_Over_UartA.pTransportLayer->fRXPacketProcess(MCP_Over_UartA.pTransportLayer,
+                                                                            &MCP_Over_UartA.rxLength);
+  if (MCP_Over_UartA.rxBuffer != NULL)
+  {
+    if (MCP_Over_UartA.pTransportLayer->fGetBuffer(MCP_Over_UartA.pTransportLayer,
+                                                   (void **)&MCP_Over_UartA.txBuffer, MCTL_SYNC))
+    {
+      MCP_ReceivedPacket(&MCP_Over_UartA);
+      MCP_Over_UartA.pTransportLayer->fSendPacket(MCP_Over_UartA.pTransportLayer, MCP_Over_UartA.txBuffer,
+                                                  MCP_Over_UartA.txLength, MCTL_SYNC);
+    }
+  }
+  MCPE_Exec(&MCPE_UART_A);
+  if (0U == (Tick % TxPeriods))
+  {
+    CompleteTx();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  for (k = 0U; k < HF_PER_PUMP; k++)
+  {
+    Tick++;
+    RegIA = ValueIA(Tick);
+    RegIB = ValueIB(Tick);
+    RegSpeed = Tick;
+    GLOBAL_TIMESTAMP = Tick;
+    InHFTask = true;
+    if (MCPA_UART_A.Mark != 0U)
+    {
+      MCPA_dataLog(&MCPA_UART_A);
+    }
+    InHFTask = false;
+    if (0U == (Tick % TxPeriods))
+    {
+      CompleteTx();
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+}
+
+/* Host transport ------------------------------------------------------------*/
+
+static int HostWrite(void *pCtx, const uint8_t *data, uint16_t length)
+{
+  ssize_t n;
+
+  (void)pCtx;
+  while (length > 0U)
+  {
+    n = write(HostFd, data, length);
+    if (n <= 0)
+    {
+      return (-1);
+    }
+    data += n;
+    length -= (uint16_t)n;
+  }
+  return (0);
+}
+
+/* The performer runs each time the host finds no byte to read */
+static int HostRead(void *pCtx, uint8_t *data, uint16_t length, uint32_t timeoutMs)
+{
+  struct pollfd pfd = { .fd = HostFd, .events = POLLIN };
+  ssize_t n;
+
+  (void)pCtx;
+  (void)timeoutMs;
+  if (poll(&pfd, 1, 0) <= 0)
+  {
+    Pump();
+  }
+  n = read(HostFd, data, length);
+  return ((n > 0) ? (int)n : (((n < 0) && (EAGAIN == errno)) ? 0 : -1));
+}
+
+/* Reception errors ----------------------------------------------------------*/
+
+/* Replays the last request sent by the host after a bad header and around an overrun of the reception ring */
+static void ReceptionErrors(const MCPH_Handle_t *pHost)
+{
+  static const uint8_t badHeader[ASPEP_HEADER_SIZE] = { 0x5AU, 0xA5U, 0x5AU, 0xA5U };
+  uint8_t request[64];
+  uint8_t burst[sizeof(badHeader) + sizeof(request)];
+  uint8_t filler[200];
+  uint32_t header;
+  uint16_t length;
+  uint8_t answered;
+  int i;
+
+  (void)memcpy(&header, pHost->txBuffer, sizeof(header));
+  length = (uint16_t)(ASPEP_HEADER_SIZE + ((header >> 4U) & 0x1FFFU) + ASPEP_DATACRC_SIZE);
+  HT_CHECK(length <= sizeof(request));
+  (void)memcpy(request, pHost->txBuffer, length);
+  (void)memset(filler, 0x5A, sizeof(filler));
+  answered = aspepOverUartA.syncPacketCount;
+
+  /* Alone, the request is answered */
+  Receive(request, length, true);
+  Pump();
+  answered++;
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+
+  /* Bad header at the start of a burst: the burst is dropped at once, the next one is received */
+  (void)memcpy(burst, badHeader, sizeof(badHeader));
+  (void)memcpy(&burst[sizeof(badHeader)], request, length);
+  Receive(burst, (uint16_t)(sizeof(badHeader) + length), true);
+  Pump();
+  HT_CHECK(ASPEP_OK == aspepOverUartA.badPacketFlag);
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+  HT_CHECK(false == aspepOverUartA.rxDiscard);
+  Receive(request, length, true);
+  Pump();
+  answered++;
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+
+  /* Bad header parsed before the end of its burst: the rest of the burst is skipped until the idle line */
+  Receive(badHeader, sizeof(badHeader), false);
+  HT_CHECK(aspepOverUartA.rxDiscard);
+  Receive(request, length, false);
+  Pump();
+  Receive(NULL, 0U, true);
+  HT_CHECK(false == aspepOverUartA.rxDiscard);
+  Pump();
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+  Receive(request, length, true);
+  Pump();
+  answered++;
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+
+  /* Overrun: more than the ring is received before the pending request is processed, it is dropped */
+  Receive(request, length, false);
+  HT_CHECK(aspepOverUartA.NewPacketAvailable);
+  for (i = 0; i < 3; i++)
+  {
+    Receive(filler, sizeof(filler), false);
+  }
+  HT_CHECK(1U == aspepOverUartA.rxRingOverruns);
+  HT_CHECK(false == aspepOverUartA.NewPacketAvailable);
+  Receive(NULL, 0U, true);
+  Pump();
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+
+  /* A full ring without overrun: the pending request is kept, the filler after it is a bad header */
+  Receive(request, length, false);
+  Receive(filler, sizeof(filler), false);
+  Receive(filler, (uint16_t)(ASPEP_RX_RING_SIZE - sizeof(filler) - length), false);
+  HT_CHECK(1U == aspepOverUartA.rxRingOverruns);
+  Pump();
+  answered++;
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+  HT_CHECK(aspepOverUartA.rxDiscard);
+  Receive(NULL, 0U, true);
+  Pump();
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+  Receive(request, length, true);
+  Pump();
+  answered++;
+  HT_CHECK(answered == aspepOverUartA.syncPacketCount);
+
+  /* Drops the answers and NACKs, the host did not wait for them */
+  while (read(HostFd, burst, sizeof(burst)) > 0)
+  {
+    /* Nothing to do */
+  }
+}
+
+/* Async stream checks -------------------------------------------------------*/
+
+typedef struct
+{
+  MCPH_AsyncConfig_t config;
+  uint32_t packets;
+  uint32_t frames;
+  uint32_t framesMF;
+  uint32_t errors;
+  uint32_t events;
+  int index;             /* Frame index in the current packet */
+  int indexMF;           /* Index of the last frame with MF values in the current packet */
+  uint32_t timestamp;
+  uint16_t lastIA;
+} E2E_Stream_t;
+
+static void CheckFrame(void *pUser, uint32_t timestamp, const uint16_t *hf, const uint32_t *mf)
+{
+  E2E_Stream_t *pStream = (E2E_Stream_t *)pUser;
+  uint8_t MFRate = pStream->config.MFRate;
+
+  HT_CHECK(hf[1] == ValueIB(hf[0]));
+  if (0 == pStream->index)
+  {
+    /* The timestamp is the period of the first frame */
+    HT_CHECK((uint16_t)timestamp == hf[0]);
+    pStream->timestamp = timestamp;
+  }
+  else
+  {
+    HT_CHECK(timestamp == pStream->timestamp);
+    HT_CHECK((uint16_t)(hf[0] - pStream->lastIA) == (pStream->config.HFRate + 1U));
+  }
+
+  if (MCPH_ASYNC_MF_NONE == MFRate)
+  {
+    HT_CHECK(NULL == mf);
+  }
+  else if (MCPH_ASYNC_MF_ONCE == MFRate)
+  {
+    /* Checked once the packet is decoded */
+  }
+  else
+  {
+    /* The performer restarts the MF motif at each packet: MF values after frames MFRate, 2*MFRate+1, ... */
+    HT_CHECK((mf != NULL) == ((pStream->index % (MFRate + 1)) == MFRate));
+  }
+  if (mf != NULL)
+  {
+    /* MF values sampled in the same period as the HF ones */
+    HT_CHECK((uint16_t)mf[0] == hf[0]);
+    pStream->indexMF = pStream->index;
+    pStream->framesMF++;
+  }
+  pStream->lastIA = hf[0];
+  pStream->index++;
+  pStream->frames++;
+}
+
+static void CheckEvent(void *pUser, const MCPH_Event_t *pEvent)
+{
+  E2E_Stream_t *pStream = (E2E_Stream_t *)pUser;
+
+  HT_CHECK(MCPH_EVENT_MOTION == pEvent->eventClass);
+  HT_CHECK(0U == pEvent->motor);
+  HT_CHECK(1U == pEvent->code);
+  HT_CHECK(0x1234U == pEvent->data);
+  pStream->events++;
+}
+
+static void AsyncPacket(void *pUser, const uint8_t *payload, uint16_t length)
+{
+  E2E_Stream_t *pStream = (E2E_Stream_t *)pUser;
+  int frames;
+
+  HT_CHECK(length >= 2U);
+  if (MCPH_ASYNC_ID_EVENTS == payload[length - 1U])
+  {
+    HT_CHECK(MCPH_DecodeEvents(payload, length, &CheckEvent, pStream) >= 0);
+  }
+  else if (payload[length - 2U] == pStream->config.mark)
+  {
+    pStream->index = 0;
+    pStream->indexMF = -1;
+    frames = MCPH_DecodeAsync(&pStream->config, payload, length, &CheckFrame, pStream);
+    HT_CHECK(frames > 0);
+    HT_CHECK(pStream->index == frames);
+    if (MCPH_ASYNC_MF_ONCE == pStream->config.MFRate)
+    {
+      /* Once per packet, with the last frame */
+      HT_CHECK(pStream->indexMF == (frames - 1));
+      HT_CHECK(pStream->framesMF == (pStream->packets + 1U));
+    }
+    if (frames < 0)
+    {
+      pStream->errors++;
+    }
+    pStream->packets++;
+  }
+  else
+  {
+    /* Packet of the previous configuration */
+  }
+}
+
+/* Streams FRAMES_MIN frames with the given rates and encoding */
+static void Stream(MCPH_Handle_t *pHost, uint8_t HFRate, uint8_t MFRate, uint8_t encoding, uint8_t mark)
+{
+  E2E_Stream_t stream = {0};
+  MCPH_AsyncConfig_t stop = {0};
+  uint8_t status = 0xFFU;
+  uint32_t polls = 0U;
+
+  stream.config.bufferSize = 96U;
+  stream.config.HFRate = HFRate;
+  stream.config.HFNum = 2U;
+  stream.config.MFRate = MFRate;
+  stream.config.MFNum = 1U;
+  stream.config.channelID[0] = E2E_REG_I_A;
+  stream.config.channelID[1] = E2E_REG_I_B;
+  stream.config.channelID[2] = E2E_REG_SPEED_MEAS;
+  stream.config.mark = mark;
+  stream.config.encoding = encoding;
+  pHost->fAsync = &AsyncPacket;
+  pHost->pAsyncUser = &stream;
+
+  HT_CHECK(MCPH_OK == MCPH_ConfigAsync(pHost, &stream.config, &status));
+  HT_CHECK(MCP_CMD_OK == status);
+  while ((stream.frames < FRAMES_MIN) && (polls < 10000U))
+  {
+    HT_CHECK(MCPH_OK == MCPH_Poll(pHost, 1U));
+    polls++;
+  }
+  HT_CHECK(stream.frames >= FRAMES_MIN);
+  HT_CHECK(0U == stream.errors);
+  if (MCPH_ASYNC_MF_NONE == MFRate)
+  {
+    HT_CHECK(0U == stream.framesMF);
+  }
+  else
+  {
+    HT_CHECK(stream.framesMF > 0U);
+  }
+
+  /* An event pushed while streaming is sent before the pending async packets */
+  HT_CHECK(MCPE_Push(&MCPE_UART_A, MCPE_CLASS_MOTION, 0U, MCPE_MOTION_TARGET_REACHED, 0x1234U));
+  polls = 0U;
+  while ((0U == stream.events) && (polls < 1000U))
+  {
+    HT_CHECK(MCPH_OK == MCPH_Poll(pHost, 1U));
+    polls++;
+  }
+  HT_CHECK(1U == stream.events);
+
+  HT_CHECK(MCPH_OK == MCPH_ConfigAsync(pHost, &stop, &status));
+  HT_CHECK(MCP_CMD_OK == status);
+  HT_CHECK(MCPH_OK == MCPH_Poll(pHost, 5U));
+  HT_CHECK(0U == MCPA_UART_A.Mark);
+  pHost->fAsync = NULL;
+}
+
+int main(void)
+{
+  static MCPH_Handle_t Host;
+  MCPH_Transport_t transport = { .pCtx = NULL, .fWrite = &HostWrite, .fRead = &HostRead };
+  int fds[2];
+  uint16_t ids[3] = { E2E_REG_I_A, E2E_REG_SPEED_MEAS, E2E_REG_SPEED_KP };
+  uint8_t values[16];
+  uint16_t size = 0U;
+  uint16_t kp = 1234U;
+  uint8_t status = 0xFFU;
+  uint16_t dropped;
+  void *dwt;
+
+  /* The data CRC reads the cycle counter of the DWT unit */
+  dwt = mmap((void *)(DWT_BASE & ~0xFFFUL), 0x1000, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (dwt != (void *)(DWT_BASE & ~0xFFFUL))
+  {
+    printf("test_mcp_e2e: cannot map the DWT unit\n");
+    return (1);
+  }
+
+  HT_CHECK(0 == socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  HostFd = fds[0];
+  PerfFd = fds[1];
+  (void)fcntl(HostFd, F_SETFL, O_NONBLOCK);
+  (void)fcntl(PerfFd, F_SETFL, O_NONBLOCK);
+
+  ASPEP_start(&aspepOverUartA);
+  MCPE_Init(&MCPE_UART_A);
+  MCPE_UART_A.Subscription = 1U << MCPE_CLASS_MOTION;
+
+  /* Connection, with the data CRC */
+  MCPH_Init(&Host, &transport, 200U);
+  HT_CHECK(MCPH_OK == MCPH_Connect(&Host, true));
+  HT_CHECK(Host.dataCRC);
+  HT_CHECK(ASPEP_CONNECTED == aspepOverUartA.ASPEP_State);
+  HT_CHECK(Host.txAsyncMaxPayload == aspepOverUartA._Super.txAsyncMaxPayload);
+
+  /* Registers */
+  HT_CHECK(MCPH_OK == MCPH_SetRegister(&Host, E2E_REG_SPEED_KP, &kp, 2U, &status));
+  HT_CHECK(MCP_CMD_OK == status);
+  HT_CHECK(1234U == RegSpeedKp);
+  HT_CHECK(MCPH_OK == MCPH_SetRegister(&Host, E2E_REG_I_A, &kp, 2U, &status));
+  HT_CHECK(MCP_ERROR_RO_REG == status);
+  HT_CHECK(MCPH_OK == MCPH_GetRegisters(&Host, ids, 3U, values, sizeof(values), &size, &status));
+  HT_CHECK(MCP_CMD_OK == status);
+  HT_CHECK(8U == size);
+  /* Both read in the same period */
+  HT_CHECK((values[0] | (values[1] << 8U)) == ValueIA(values[2] | (values[3] << 8U) | (values[4] << 16U)
+                                                      | ((uint32_t)values[5] << 24U)));
+  HT_CHECK((values[6] | (values[7] << 8U)) == 1234U);
+  /* Motor commands addressed to a motor that is not driven are refused, without payload */
+  HT_CHECK(MCPH_OK == MCPH_Request(&Host, STOP_MOTOR, NBR_OF_MOTORS + 1U, NULL, 0U, values, sizeof(values), &size,
+                                   &status));
+  HT_CHECK(MCP_CMD_NOK == status);
+  HT_CHECK(0U == size);
+  ReceptionErrors(&Host);
+
+  /* Async stream: MF values every frame, every other frame, every 4 frames, once per packet and never, with the
+     three encodings of the HF values */
+  Stream(&Host, 0U, 0U, 0U, 0x11U);
+  Stream(&Host, 0U, 1U, 0U, 0x12U);
+  Stream(&Host, 0U, 3U, 0U, 0x13U);
+  Stream(&Host, 1U, 3U, 0U, 0x14U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_ONCE, 0U, 0x15U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_NONE, 0U, 0x16U);
+  Stream(&Host, 0U, 0U, 1U, 0x21U);
+  Stream(&Host, 0U, 1U, 1U, 0x22U);
+  Stream(&Host, 2U, 3U, 1U, 0x23U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_ONCE, 1U, 0x24U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_NONE, 1U, 0x25U);
+  Stream(&Host, 0U, 0U, 2U, 0x31U);
+  Stream(&Host, 0U, 1U, 2U, 0x32U);
+  Stream(&Host, 2U, 3U, 2U, 0x33U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_ONCE, 2U, 0x34U);
+  Stream(&Host, 0U, MCPH_ASYNC_MF_NONE, 2U, 0x35U);
+  HT_CHECK(0U == Host.badPackets);
+
+  /* Pool whose size is not a power of 2, on a slow link that keeps it full: the transmit queue wraps explicitly
+     and keeps the packets in order */
+  aspepOverUartA.asyncPoolSize = 3U;
+  ASPEP_start(&aspepOverUartA);
+  HT_CHECK(MCPH_OK == MCPH_Connect(&Host, true));
+  TxPeriods = 64U;
+  dropped = aspepOverUartA.asyncDropped;
+  Stream(&Host, 0U, 1U, 0U, 0x31U);
+  Stream(&Host, 0U, 1U, 1U, 0x32U);
+  HT_CHECK(aspepOverUartA.asyncDropped > dropped);
+  TxPeriods = 1U;
+  HT_CHECK(0U == Host.badPackets);
+
+  return (HT_RESULT("test_mcp_e2e"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
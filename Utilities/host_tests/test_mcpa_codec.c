@@ -0,0 +1,329 @@
+/**
+  ******************************************************************************
+  * @file    test_mcpa_codec.c
+  * @author  LenseDrive
+  * @brief   Round trip and throughput benchmark of the MCPA async log
+  *          encodings: the firmware encoder against the host decoder.
+  *
+  *          The same HF samples are logged raw, as zig-zag varint deltas
+  *          and bit packed by MCPA_dataLog(), the packets are decoded by
+  *          MCPH_DecodeAsync() and every frame must match its samples. For
+  *          each encoding, the size per value, the encode and decode times
+  *          per frame and the frames per second the ASPEP link can carry are
+  *          printed.
+  *
+  *          The times are measured on the host: they compare the encodings,
+  *          they are not the cycle counts of the performer.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "host_test.h"
+#include "mcp.h"
+#include "mcpa.h"
+#include "register_interface.h"
+#include "mcp_host.h"
+
+#define CODEC_CHANNELS     4U
+#define CODEC_FRAMES       100000U
+#define CODEC_BUFFER_SIZE  512U       /* Async packet size requested by the controller */
+#define CODEC_MARK         0x5AU
+#define CODEC_ARENA_SIZE   (CODEC_FRAMES * CODEC_CHANNELS * MCPA_VARINT_MAX_SIZE * 2U)
+#define CODEC_MAX_PACKETS  (CODEC_ARENA_SIZE / 64U)
+
+/* ASPEP link: 1.8432 Mbaud with 10 bits per byte, a 4 bytes header and a 2 bytes data CRC around each packet */
+#define LINK_BYTES_PER_S   184320.0
+#define LINK_PACKET_BYTES  6U
+
+/* HF registers logged by the performer, read by MCPA_dataLog() through RI_GetPtrReg() */
+static uint16_t Channel[CODEC_CHANNELS];
+static uint16_t Samples[CODEC_FRAMES][CODEC_CHANNELS];
+
+/* Packets sent by MCPA, back to back in the arena */
+static uint8_t Arena[CODEC_ARENA_SIZE];
+static uint32_t ArenaUsed;
+static uint32_t PacketOffset[CODEC_MAX_PACKETS];
+static uint16_t PacketLength[CODEC_MAX_PACKETS];
+static uint32_t Packets;
+
+/* Round trip check of the decoded frames */
+static uint32_t DecodedFrames;
+static uint32_t Mismatches;
+
+/* HF channels, then the first channel again as MF value */
+static void *dataPtrTable[CODEC_CHANNELS + 1U];
+static void *dataPtrTableBuff[CODEC_CHANNELS + 1U];
+static uint8_t dataSizeTable[CODEC_CHANNELS + 1U];
+static uint8_t dataSizeTableBuff[CODEC_CHANNELS + 1U];
+static uint16_t lastValueTable[CODEC_CHANNELS];
+static MCPA_Packing_t packingTable[CODEC_CHANNELS];
+
+/* Fake transport layer: the async buffers are taken in the arena, sending keeps them there */
+
+static bool CodecGetBuffer(MCTL_Handle_t *pHandle, void **buffer, uint8_t syncAsync)
+{
+  bool result = false;
+
+  (void)pHandle;
+  HT_CHECK(MCTL_ASYNC == syncAsync);
+  if (((ArenaUsed + CODEC_BUFFER_SIZE) <= CODEC_ARENA_SIZE) && (Packets < CODEC_MAX_PACKETS))
+  {
+    *buffer = &Arena[ArenaUsed];
+    result = true;
+  }
+  return (result);
+}
+
+static uint8_t CodecSendPacket(MCTL_Handle_t *pHandle, void *txBuffer, uint16_t txDataLength, uint8_t syncAsync)
+{
+  (void)pHandle;
+  (void)syncAsync;
+  HT_CHECK((uint8_t *)txBuffer == &Arena[ArenaUsed]);
+  HT_CHECK(txDataLength <= CODEC_BUFFER_SIZE);
+  PacketOffset[Packets] = ArenaUsed;
+  PacketLength[Packets] = txDataLength;
+  Packets++;
+  ArenaUsed += txDataLength;
+  return (MCP_CMD_OK);
+}
+
+static MCTL_Handle_t Transport =
+{
+  .fGetBuffer        = &CodecGetBuffer,
+  .fSendPacket       = &CodecSendPacket,
+  .txAsyncMaxPayload = CODEC_BUFFER_SIZE,
+};
+
+static MCPA_Handle_t Mcpa =
+{
+  .pTransportLayer   = &Transport,
+  .dataPtrTable      = dataPtrTable,
+  .dataPtrTableBuff  = dataPtrTableBuff,
+  .dataSizeTable     = dataSizeTable,
+  .dataSizeTableBuff = dataSizeTableBuff,
+  .lastValueTable    = lastValueTable,
+  .packingTable      = packingTable,
+  .nbrOfDataLog      = CODEC_CHANNELS + 1U,
+};
+
+/* Register interface of the performer, the channel registers only */
+
+uint8_t RI_GetPtrReg(uint16_t dataID, void **dataPtr)
+{
+  uint8_t retVal = MCP_CMD_OK;
+  uint16_t index = (uint16_t)(dataID >> 6U) - 1U;
+
+  if (index < CODEC_CHANNELS)
+  {
+    *dataPtr = &Channel[index];
+  }
+  else
+  {
+    retVal = MCP_ERROR_UNKNOWN_REG;
+  }
+  return (retVal);
+}
+
+uint8_t RI_GetIDSize(uint16_t dataID)
+{
+  uint8_t typeID = (uint8_t)dataID & TYPE_MASK;
+  return ((TYPE_DATA_8BIT == typeID) ? 1U : ((TYPE_DATA_16BIT == typeID) ? 2U : 4U));
+}
+
+/* Returns the monotonic time in nanoseconds */
+static uint64_t Now(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+/* Deterministic noise */
+static uint32_t Random(void)
+{
+  static uint32_t state = 2463534242U;
+
+  state ^= state << 13U;
+  state ^= state >> 17U;
+  state ^= state << 5U;
+  return (state);
+}
+
+/* Phase currents and torque current with a few counts of noise, electrical angle of a motor at 50 Hz */
+static void MotorSamples(void)
+{
+  uint32_t t;
+  double angle;
+
+  for (t = 0U; t < CODEC_FRAMES; t++)
+  {
+    angle = (2.0 * M_PI * 50.0 * t) / 16000.0;
+    Samples[t][0] = (uint16_t)(int16_t)((10000.0 * sin(angle)) + (double)(Random() % 17U) - 8.0);
+    Samples[t][1] = (uint16_t)(int16_t)((10000.0 * sin(angle - (2.0 * M_PI / 3.0))) + (double)(Random() % 17U) - 8.0);
+    Samples[t][2] = (uint16_t)(int16_t)(4000 + (int32_t)(Random() % 65U) - 32);
+    Samples[t][3] = (uint16_t)(t * 205U);
+  }
+}
+
+/* Steps on the torque current, much larger than the residuals of the previous packet */
+static void StepSamples(void)
+{
+  uint32_t t;
+
+  for (t = 0U; t < CODEC_FRAMES; t++)
+  {
+    Samples[t][2] = (uint16_t)(Samples[t][2] + ((((t / 997U) % 2U) != 0U) ? 20000U : 0U));
+  }
+}
+
+/* Uniform noise: every delta takes the largest varint */
+static void NoiseSamples(void)
+{
+  uint32_t t;
+  uint8_t i;
+
+  for (t = 0U; t < CODEC_FRAMES; t++)
+  {
+    for (i = 0U; i < CODEC_CHANNELS; i++)
+    {
+      Samples[t][i] = (uint16_t)Random();
+    }
+  }
+}
+
+static void CheckFrame(void *pUser, uint32_t timestamp, const uint16_t *hf, const uint32_t *mf)
+{
+  (void)pUser;
+  if ((DecodedFrames >= CODEC_FRAMES) || (timestamp > DecodedFrames)
+      || (0 != memcmp(hf, Samples[DecodedFrames], sizeof(Samples[0])))
+      || ((mf != NULL) && ((uint16_t)mf[0] != Samples[DecodedFrames][0])))
+  {
+    Mismatches++;
+  }
+  DecodedFrames++;
+}
+
+/* Logs all the samples with one encoding, decodes them back and prints the throughput */
+static double Run(const char *name, uint8_t encoding, uint8_t MFRate)
+{
+  MCPH_AsyncConfig_t config = { 0 };
+  uint8_t cfg[6U + (2U * (CODEC_CHANNELS + 1U)) + 2U];
+  uint16_t cfgSize;
+  uint64_t start;
+  uint64_t encodeNs;
+  uint64_t decodeNs;
+  uint32_t t;
+  uint32_t p;
+  uint32_t frames = 0U;
+  double bytesPerFrame;
+  uint8_t i;
+
+  config.bufferSize = CODEC_BUFFER_SIZE;
+  config.HFRate = 0U;
+  config.HFNum = CODEC_CHANNELS;
+  config.MFRate = MFRate;
+  config.MFNum = (MCPH_ASYNC_MF_NONE == MFRate) ? 0U : 1U;
+  config.mark = CODEC_MARK;
+  config.encoding = encoding;
+  (void)memcpy(cfg, &config.bufferSize, 2U);
+  cfg[2] = config.HFRate;
+  cfg[3] = config.HFNum;
+  cfg[4] = config.MFRate;
+  cfg[5] = config.MFNum;
+  for (i = 0U; i < (CODEC_CHANNELS + config.MFNum); i++)
+  {
+    config.channelID[i] = (uint16_t)((((i % CODEC_CHANNELS) + 1U) << 6U) | MCPH_TYPE_16BIT);
+    (void)memcpy(&cfg[6U + (2U * i)], &config.channelID[i], 2U);
+  }
+  cfgSize = 6U + (2U * (CODEC_CHANNELS + config.MFNum));
+  cfg[cfgSize] = CODEC_MARK;
+  cfg[cfgSize + 1U] = encoding;
+  HT_CHECK(MCP_CMD_OK == MCPA_cfgLog(&Mcpa, cfg, cfgSize + 2U));
+
+  ArenaUsed = 0U;
+  Packets = 0U;
+  start = Now();
+  for (t = 0U; t < CODEC_FRAMES; t++)
+  {
+    GLOBAL_TIMESTAMP = t;
+    (void)memcpy(Channel, Samples[t], sizeof(Channel));
+    MCPA_dataLog(&Mcpa);
+  }
+  MCPA_flushDataLog(&Mcpa);
+  encodeNs = Now() - start;
+
+  start = Now();
+  for (p = 0U; p < Packets; p++)
+  {
+    frames += (uint32_t)MCPH_DecodeAsync(&config, &Arena[PacketOffset[p]], PacketLength[p], NULL, NULL);
+  }
+  decodeNs = Now() - start;
+  HT_CHECK(CODEC_FRAMES == frames);
+
+  DecodedFrames = 0U;
+  Mismatches = 0U;
+  for (p = 0U; p < Packets; p++)
+  {
+    HT_CHECK(CODEC_MARK == Arena[PacketOffset[p] + PacketLength[p] - 2U]);
+    HT_CHECK(MCPH_DecodeAsync(&config, &Arena[PacketOffset[p]], PacketLength[p], &CheckFrame, NULL) > 0);
+  }
+  HT_CHECK(CODEC_FRAMES == DecodedFrames);
+  HT_CHECK(0U == Mismatches);
+
+  /* Stops the log, the next run starts from a fresh configuration */
+  cfg[cfgSize] = 0U;
+  HT_CHECK(MCP_CMD_OK == MCPA_cfgLog(&Mcpa, cfg, cfgSize + 2U));
+
+  bytesPerFrame = (double)(ArenaUsed + (Packets * LINK_PACKET_BYTES)) / CODEC_FRAMES;
+  printf("%-18s %4.2f bytes/value, encode %6.1f ns/frame, decode %6.1f ns/frame, link %6.0f frames/s\n", name,
+         (double)ArenaUsed / (CODEC_FRAMES * CODEC_CHANNELS), (double)encodeNs / CODEC_FRAMES,
+         (double)decodeNs / CODEC_FRAMES, LINK_BYTES_PER_S / bytesPerFrame);
+  return (bytesPerFrame);
+}
+
+int main(void)
+{
+  double raw;
+  double varint;
+  double packed;
+
+  /* Motor signals: the phase currents and the angle move by up to 200 counts per period, so only the
+     torque current deltas fit in one byte and the varint log is about 20 % smaller. Their 2nd order
+     residuals take 7 bits or less (1 bit for the angle), so the bit packed log is about 2.7 times smaller */
+  MotorSamples();
+  raw = Run("motor raw", MCPA_ENCODING_RAW, MCPH_ASYNC_MF_NONE);
+  varint = Run("motor varint", MCPA_ENCODING_DELTA_VARINT, MCPH_ASYNC_MF_NONE);
+  packed = Run("motor bit packed", MCPA_ENCODING_BIT_PACKED, MCPH_ASYNC_MF_NONE);
+  HT_CHECK((raw / varint) > 1.15);
+  HT_CHECK((raw / packed) > 2.0);
+
+  /* MF values between the bit packed frames, and once per packet */
+  (void)Run("motor packed MF", MCPA_ENCODING_BIT_PACKED, 2U);
+  (void)Run("motor packed MF 1", MCPA_ENCODING_BIT_PACKED, MCPH_ASYNC_MF_ONCE);
+  (void)Run("motor raw MF", MCPA_ENCODING_RAW, 2U);
+
+  /* Residuals larger than the width chosen from the previous packet are escaped */
+  StepSamples();
+  (void)Run("steps bit packed", MCPA_ENCODING_BIT_PACKED, MCPH_ASYNC_MF_NONE);
+
+  /* Worst case: the varints are larger than the raw values, the bit packed values take 16 bits, but
+     both are still decoded */
+  NoiseSamples();
+  raw = Run("noise raw", MCPA_ENCODING_RAW, MCPH_ASYNC_MF_NONE);
+  varint = Run("noise varint", MCPA_ENCODING_DELTA_VARINT, MCPH_ASYNC_MF_NONE);
+  packed = Run("noise bit packed", MCPA_ENCODING_BIT_PACKED, MCPH_ASYNC_MF_NONE);
+  HT_CHECK(varint > raw);
+  HT_CHECK(varint <= ((raw * MCPA_VARINT_MAX_SIZE) / 2.0));
+  HT_CHECK(packed <= (raw * 1.05));
+
+  return (HT_RESULT("test_mcpa_codec"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    test_ovm.c
+  * @author  LenseDrive
+  * @brief   Host test of the fundamental voltage of the overmodulation
+  *          modulator, PWMC_SetPhaseVoltage_OVM().
+  *
+  *          The voltage vector is turned at constant magnitude, the phase to
+  *          neutral voltage of the compare values is averaged over each PWM
+  *          period and its fundamental is extracted. With M1_OVERMODULATION,
+  *          32768 s16V is the six-step fundamental, 2/pi of the bus: the
+  *          fundamental must follow the command in the linear range and in
+  *          OVM mode 1, without a step at the range boundaries, and keep
+  *          rising in OVM mode 2.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <math.h>
+#include "host_test.h"
+#include "pwm_curr_fdbk.h"
+
+#define OVM_PERIOD        5000U    /* PWM period in timer counts */
+#define OVM_STEPS         3600U    /* Voltage angles of a full electrical turn */
+#define OVM_MODE1_START   29717    /* Boundaries of the modulator ranges, see pwm_curr_fdbk_ovm.c */
+#define OVM_MODE2_START   31186
+#define OVM_SWEEP_STEP    50
+
+static uint16_t SetADCSampPoint(PWMC_Handle_t *pHandle)
+{
+  (void)pHandle;
+  return (0U);
+}
+
+/* Fundamental of the phase a voltage for a command of the given magnitude, relative to the six-step one */
+static double Fundamental(int32_t magnitude)
+{
+  PWMC_Handle_t pwmc =
+  {
+    .pFctSetADCSampPointSectX = &SetADCSampPoint,
+    .PWMperiod                = OVM_PERIOD,
+    .hT_Sqrt3                 = (uint16_t)((OVM_PERIOD * SQRT3FACTOR) / 16384U),
+  };
+  double re = 0.0;
+  double im = 0.0;
+  double a;
+  double b;
+  double c;
+  double va;
+  uint32_t k;
+
+  for (k = 0U; k < OVM_STEPS; k++)
+  {
+    double theta = (2.0 * M_PI * k) / OVM_STEPS;
+    alphabeta_t v =
+    {
+      .alpha = (int16_t)lrint(magnitude * cos(theta)),
+      .beta  = (int16_t)lrint(magnitude * sin(theta)),
+    };
+
+    (void)PWMC_SetPhaseVoltage_OVM(&pwmc, v);
+    /* Compare values count the low side time of each half period, in bus voltage units */
+    a = pwmc.CntPhA / (OVM_PERIOD / 2.0);
+    b = pwmc.CntPhB / (OVM_PERIOD / 2.0);
+    c = pwmc.CntPhC / (OVM_PERIOD / 2.0);
+    va = a - ((a + b + c) / 3.0);
+    re += va * cos(theta);
+    im += va * sin(theta);
+  }
+  return (((2.0 * sqrt((re * re) + (im * im))) / OVM_STEPS) / (2.0 / M_PI));
+}
+
+int main(void)
+{
+  double previous = 0.0;
+  double fundamental;
+  double maxError = 0.0;
+  int32_t magnitude;
+
+  for (magnitude = 1000; magnitude <= INT16_MAX; magnitude += OVM_SWEEP_STEP)
+  {
+    fundamental = Fundamental(magnitude);
+
+    /* Linear range and OVM mode 1: the fundamental is the command */
+    if (magnitude < OVM_MODE2_START)
+    {
+      HT_CHECK_NEAR(fundamental, magnitude / 32768.0, 0.001);
+      maxError = fmax(maxError, fabs(fundamental - (magnitude / 32768.0)));
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    /* Monotonic over the whole range, also across the range boundaries */
+    HT_CHECK(fundamental > previous);
+    previous = fundamental;
+  }
+  printf("linear and OVM mode 1 error %.4f, fundamental at 32767: %.4f of the six-step\n", maxError, previous);
+
+  /* The boundary of the linear range is continuous */
+  HT_CHECK_NEAR(Fundamental(OVM_MODE1_START), Fundamental(OVM_MODE1_START - 1), 0.0005);
+
+  /* OVM mode 2 ends at the six-step voltage */
+  HT_CHECK(previous > 0.99);
+
+  return (HT_RESULT("test_ovm"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,292 @@
+/**
+  ******************************************************************************
+  * @file    test_ri_lookup.c
+  * @author  LenseDrive
+  * @brief   Host test of the register descriptor tables of the register
+  *          interface.
+  *
+  *          register_interface.c is included so that its static tables and
+  *          RI_FindRegister() can be reached. Each table must be strictly
+  *          sorted by regID, and the binary search must find the same
+  *          descriptor as a linear scan of the table for every possible
+  *          register ID.
+  *
+  *          The register interface of the baseline, made of switch
+  *          statements, is built in the same program with its functions
+  *          renamed (see test_ri_baseline.inc in the Makefile). Every
+  *          register ID of the Global and Motor 1 tables is read and
+  *          written with both versions from the same firmware state: the
+  *          return codes, the sizes, the values read and the state left
+  *          behind must be the same, except for the registers added since
+  *          the baseline. The firmware components are linked as they are,
+  *          the functions of the components that are never reached are
+  *          left unresolved at link time.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdlib.h>
+#include "../../Src/register_interface.c"
+#include "host_test.h"
+
+/* Baseline register interface, its MCPA_cfgLog() did not take the configuration size */
+#define RI_SetRegisterGlobal  BL_SetRegisterGlobal
+#define RI_SetRegisterMotor1  BL_SetRegisterMotor1
+#define RI_GetRegisterGlobal  BL_GetRegisterGlobal
+#define RI_GetRegisterMotor1  BL_GetRegisterMotor1
+#define RI_MovString          BL_MovString
+#define RI_GetIDSize          BL_GetIDSize
+#define RI_GetPtrReg          BL_GetPtrReg
+#define MCPA_cfgLog(pHandle, cfgdata) MCPA_cfgLog((pHandle), (cfgdata), rawSize)
+uint8_t BL_MovString(const char_t *srcString, char_t *destString, uint16_t *size, int16_t maxSize);
+uint8_t BL_GetIDSize(uint16_t dataID);
+#include "test_ri_baseline.inc"
+#undef RI_SetRegisterGlobal
+#undef RI_SetRegisterMotor1
+#undef RI_GetRegisterGlobal
+#undef RI_GetRegisterMotor1
+#undef RI_MovString
+#undef RI_GetIDSize
+#undef RI_GetPtrReg
+#undef MCPA_cfgLog
+
+#define DATA_SIZE  64U
+
+typedef uint8_t (*AccessFct_t)(uint16_t regID, uint8_t typeID, uint8_t *data, uint16_t *size, int16_t space);
+
+/* Result of one access, with the firmware state it leaves */
+typedef struct
+{
+  uint8_t retVal;
+  uint16_t size;
+  uint8_t data[DATA_SIZE];
+  uint8_t *pState;
+} Access_t;
+
+/* Registers added or implemented since the baseline, any access to them may differ */
+static const uint16_t AddedRegs[] =
+{
+  MC_REG_POSITION_STREAM_STATE, MC_REG_HALL_INSTANT_START, MC_REG_CALIB_STORE, MC_REG_BACKLASH_STATE,
+  MC_REG_BACKLASH_ENABLE, MC_REG_HF_CAPTURE_STATE, MC_REG_EVENT_MASK, MC_REG_DAC_MODE, MC_REG_DAC_DECIMATION,
+  MC_REG_SC_STATE, MC_REG_FUSION_STATUS, MC_REG_FREQ_RESP_STATE, MC_REG_FREQ_RESP_OFFSET, MC_REG_DPWM_STATE,
+  MC_REG_POSITION_STREAM_LEVEL, MC_REG_POSITION_TORQUE_FF, MC_REG_POSITION_TORQUE_FB, MC_REG_HALL_AMPLITUDE,
+  MC_REG_HALL_INSTANT_FALLBACKS, MC_REG_HF_CAPTURE_OFFSET, MC_REG_ASYNC_POOL_HIGH_WATER, MC_REG_ASYNC_POOL_DROPS,
+  MC_REG_DAC_SCALE1, MC_REG_DAC_SCALE2, MC_REG_DAC_OFFSET1, MC_REG_DAC_OFFSET2, MC_REG_THERMAL_LOAD,
+  MC_REG_CURRENT_LIMIT, MC_REG_FUSION_ANGLE_ERROR, MC_REG_DPWM_THRESHOLD, MC_REG_ASPEP_CRC_MAX_LENGTH,
+  MC_REG_POSITION_STREAM_UNDERRUNS, MC_REG_POSITION_FF_INERTIA, MC_REG_POSITION_FF_VISCOUS,
+  MC_REG_POSITION_FF_COULOMB, MC_REG_START_TO_TORQUE_TIME, MC_REG_PERF_AXIS_CPU_LOAD, MC_REG_PERF_HF_BUDGET,
+  MC_REG_ASPEP_CRC_CYCLES, MC_REG_ASPEP_CRC_MAX_CYCLES, MC_REG_SC_RS, MC_REG_SC_LS, MC_REG_SC_KE, MC_REG_SC_VBUS,
+  MC_REG_SC_CURRENT, MC_REG_SC_SPDBANDWIDTH, MC_REG_SC_CURRBANDWIDTH, MC_REG_SC_J, MC_REG_SC_F,
+  MC_REG_POSITION_STREAM, MC_REG_BACKLASH_TABLE, MC_REG_HF_CAPTURE_CONFIG, MC_REG_HF_CAPTURE_DATA,
+  MC_REG_FREQ_RESP_CONFIG, MC_REG_FREQ_RESP_DATA, MC_REG_FLUXWK_KP, MC_REG_FLUXWK_KI, MC_REG_FLUXWK_BUS,
+  MC_REG_FLUXWK_BUS_MEAS, MC_REG_FLUXWK_KP_DIV, MC_REG_FLUXWK_KI_DIV
+};
+
+/* Values written to every register: the first two bytes are the size of the raw registers */
+static const uint8_t Patterns[][DATA_SIZE] =
+{
+  {0U},
+  {0x01U, 0x00U, 0x02U, 0x00U, 0x03U, 0x00U, 0x04U, 0x00U},
+  {0x08U, 0x00U, 0x34U, 0x12U, 0x00U, 0x00U, 0x80U, 0x3FU, 0xE8U, 0x03U},
+  {0xFFU, 0x7FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU},
+};
+
+/* Space given to the read accesses */
+static const int16_t FreeSpaces[] = {0, 1, 3, (int16_t)DATA_SIZE};
+
+/* Objects of mc_tasks.c, which is not linked */
+static FOCVars_t FOCVars;
+MC_Perf_Handle_t PerfTraces;
+
+/* Firmware state: the data and bss segments of the program */
+extern uint8_t __data_start[];
+extern uint8_t _end[];
+static size_t StateSize;
+static uint8_t *pInitialState;
+
+/* Reference lookup: linear scan of the descriptor table, as before the binary search */
+static const RI_Register_t *LinearFind(uint8_t motorID, uint16_t regID)
+{
+  const RI_Register_t *pReg = MC_NULL;
+  uint16_t i;
+
+  for (i = 0U; (i < RegTables[motorID].nbrOfRegs) && (MC_NULL == pReg); i++)
+  {
+    if (RegTables[motorID].pTable[i].regID == regID)
+    {
+      pReg = &RegTables[motorID].pTable[i];
+    }
+  }
+  return (pReg);
+}
+
+/* Initializes the components reached by the registers as MCboot() does, with values that can be told apart */
+static void InitFirmware(void)
+{
+  uint8_t *pFOCVars = (uint8_t *)&FOCVars;
+  uint16_t i;
+
+  for (i = 0U; i < (uint16_t)sizeof(FOCVars); i++)
+  {
+    pFOCVars[i] = (uint8_t)(i * 37U);
+  }
+  for (i = 0U; i < (uint16_t)MC_PERF_NB_TRACES; i++)
+  {
+    PerfTraces.MC_Perf_TraceLog[i].DeltaTimeInCycle = 1000U * (i + 1U);
+    PerfTraces.MC_Perf_TraceLog[i].min = 500U * (i + 1U);
+    PerfTraces.MC_Perf_TraceLog[i].max = 2000U * (i + 1U);
+  }
+
+  PID_HandleInit(&PIDSpeedHandle_M1);
+  PID_HandleInit(&PIDIqHandle_M1);
+  PID_HandleInit(&PIDIdHandle_M1);
+  PID_HandleInit(&PIDFluxWeakeningHandle_M1);
+  PID_HandleInit(&PID_PosParamsM1);
+  TC_Init(&PosCtrlM1, &PID_PosParamsM1, &SpeednTorqCtrlM1, &HALL_M1);
+  SPS_Init(&SetpointStreamM1, &PosCtrlM1);
+  STC_Init(&SpeednTorqCtrlM1, &PIDSpeedHandle_M1, &HALL_M1._Super);
+  FW_Init(&FW_M1, &PIDSpeedHandle_M1, &PIDFluxWeakeningHandle_M1);
+  NTC_Init(&TempSensor_M1);
+  PQD_MotorPowMeasM1.pVBS = &BusVoltageSensor_M1._Super;
+  PQD_MotorPowMeasM1.pFOCVars = &FOCVars;
+  MCI_Init(&Mci[M1], &SpeednTorqCtrlM1, &FOCVars, &PosCtrlM1, &PWM_Handle_M1._Super);
+  Mci[M1].pScale = &scaleParams_M1;
+  Mci[M1].pPerfMeasure = &PerfTraces;
+  MCI_ExecSpeedRamp(&Mci[M1], STC_GetMecSpeedRefUnitDefault(&SpeednTorqCtrlM1), 0);
+}
+
+static bool IsAdded(uint16_t regID)
+{
+  bool added = false;
+  uint16_t i;
+
+  for (i = 0U; i < (uint16_t)(sizeof(AddedRegs) / sizeof(AddedRegs[0])); i++)
+  {
+    added = added || (AddedRegs[i] == regID);
+  }
+  return (added);
+}
+
+/* Restores the initial firmware state, the check counters excepted */
+static void RestoreState(void)
+{
+  int checks = HT_Checks;
+  int failures = HT_Failures;
+
+  (void)memcpy(__data_start, pInitialState, StateSize);
+  /* Volatile stores: the compiler does not see that the copy overwrites the counters */
+  *(volatile int *)&HT_Checks = checks;
+  *(volatile int *)&HT_Failures = failures;
+}
+
+/* Runs an access from the initial firmware state and records its result */
+static void Run(AccessFct_t fct, uint16_t regID, const uint8_t *pattern, int16_t space, Access_t *pAccess)
+{
+  RestoreState();
+  (void)memcpy(pAccess->data, pattern, DATA_SIZE);
+  pAccess->size = 0xA5A5U;
+  pAccess->retVal = fct(regID & REG_MASK, (uint8_t)regID & TYPE_MASK, pAccess->data, &pAccess->size, space);
+  (void)memcpy(pAccess->pState, __data_start, StateSize);
+  RestoreState();
+}
+
+/* Compares the baseline access with the new one, returns true if they match */
+static bool SameAccess(const Access_t *pOld, const Access_t *pNew, uint16_t regID, const char *pName)
+{
+  bool same = (pOld->retVal == pNew->retVal) && (pOld->size == pNew->size)
+              && (0 == memcmp(pOld->data, pNew->data, DATA_SIZE))
+              && (0 == memcmp(pOld->pState, pNew->pState, StateSize));
+
+  if (!same)
+  {
+    printf("%s 0x%04x: baseline %u size %u, new %u size %u%s%s\n", pName, regID, pOld->retVal, pOld->size,
+           pNew->retVal, pNew->size, (0 == memcmp(pOld->data, pNew->data, DATA_SIZE)) ? "" : ", data differs",
+           (0 == memcmp(pOld->pState, pNew->pState, StateSize)) ? "" : ", state differs");
+  }
+  return (same);
+}
+
+int main(void)
+{
+  const AccessFct_t oldSet[2] = {&BL_SetRegisterGlobal, &BL_SetRegisterMotor1};
+  const AccessFct_t newSet[2] = {&RI_SetRegisterGlobal, &RI_SetRegisterMotor1};
+  const AccessFct_t oldGet[2] = {&BL_GetRegisterGlobal, &BL_GetRegisterMotor1};
+  const AccessFct_t newGet[2] = {&RI_GetRegisterGlobal, &RI_GetRegisterMotor1};
+  Access_t oldAccess;
+  Access_t newAccess;
+  uint8_t motorID;
+  uint32_t regID;
+  uint16_t i;
+  uint32_t found;
+  uint32_t compared = 0U;
+
+  for (motorID = 0U; motorID <= (uint8_t)NBR_OF_MOTORS; motorID++)
+  {
+    const RI_Register_t *pTable = RegTables[motorID].pTable;
+
+    /* Strictly increasing regID, which also rules out duplicates */
+    HT_CHECK(RegTables[motorID].nbrOfRegs > 0U);
+    for (i = 1U; i < RegTables[motorID].nbrOfRegs; i++)
+    {
+      if (pTable[i - 1U].regID >= pTable[i].regID)
+      {
+        printf("table %u: 0x%04x before 0x%04x at %u\n", motorID, pTable[i - 1U].regID, pTable[i].regID, i);
+      }
+      HT_CHECK(pTable[i - 1U].regID < pTable[i].regID);
+    }
+
+    /* Every register ID, known or not, gives the same descriptor */
+    found = 0U;
+    for (regID = 0U; regID <= UINT16_MAX; regID++)
+    {
+      const RI_Register_t *pReg = RI_FindRegister(motorID, (uint16_t)regID);
+
+      HT_CHECK(pReg == LinearFind(motorID, (uint16_t)regID));
+      found += (MC_NULL == pReg) ? 0U : 1U;
+    }
+    HT_CHECK(found == RegTables[motorID].nbrOfRegs);
+  }
+
+  /* Every register ID of the Global and Motor 1 tables behaves as in the baseline */
+  InitFirmware();
+  StateSize = (size_t)(_end - __data_start);
+  pInitialState = malloc(StateSize);
+  oldAccess.pState = malloc(StateSize);
+  newAccess.pState = malloc(StateSize);
+  (void)memcpy(pInitialState, __data_start, StateSize);
+  for (motorID = 0U; motorID <= 1U; motorID++)
+  {
+    for (regID = 0U; regID <= UINT16_MAX; regID += (REG_MASK & -REG_MASK))
+    {
+      if (!IsAdded((uint16_t)regID))
+      {
+        for (i = 0U; i < (uint16_t)(sizeof(Patterns) / sizeof(Patterns[0])); i++)
+        {
+          Run(oldSet[motorID], (uint16_t)regID, Patterns[i], (int16_t)DATA_SIZE, &oldAccess);
+          Run(newSet[motorID], (uint16_t)regID, Patterns[i], (int16_t)DATA_SIZE, &newAccess);
+          HT_CHECK(SameAccess(&oldAccess, &newAccess, (uint16_t)regID, (0U == motorID) ? "set global" : "set M1"));
+        }
+        for (i = 0U; i < (uint16_t)(sizeof(FreeSpaces) / sizeof(FreeSpaces[0])); i++)
+        {
+          Run(oldGet[motorID], (uint16_t)regID, Patterns[1], FreeSpaces[i], &oldAccess);
+          Run(newGet[motorID], (uint16_t)regID, Patterns[1], FreeSpaces[i], &newAccess);
+          HT_CHECK(SameAccess(&oldAccess, &newAccess, (uint16_t)regID, (0U == motorID) ? "get global" : "get M1"));
+        }
+        compared++;
+      }
+      else
+      {
+        /* Nothing to do, the register did not exist */
+      }
+    }
+  }
+  printf("%u register IDs compared with the baseline\n", compared);
+
+  return (HT_RESULT((NBR_OF_MOTORS > 1) ? "test_ri_lookup_m2" : "test_ri_lookup"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
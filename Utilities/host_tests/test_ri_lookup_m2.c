@@ -0,0 +1,17 @@
+/**
+  ******************************************************************************
+  * @file    test_ri_lookup_m2.c
+  * @author  LenseDrive
+  * @brief   test_ri_lookup built with the two motor register tables, see the
+  *          NBR_OF_MOTORS definition of this test in the Makefile.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include "test_ri_lookup.c"
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
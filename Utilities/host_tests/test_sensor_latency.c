@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    test_sensor_latency.c
+  * @author  LenseDrive
+  * @brief   Host test of the fault detection latency of the bus voltage and
+  *          temperature sensors of motor 1.
+  *
+  *          The sensors are configured as in mc_config.c and fed one sample
+  *          per safety task period. After a step of the input, the number of
+  *          periods before the fault must match the filter of each sensor:
+  *          the length of the Vbus moving average, and the time constant of
+  *          the first order temperature filter. The running sum of the Vbus
+  *          average must also stay equal to the sum of its buffer.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "host_test.h"
+#include "parameters_conversion.h"
+#include "r_divider_bus_voltage_sensor.h"
+#include "ntc_temperature_sensor.h"
+
+#define SAFETY_TASK_RATE_HZ  1000U   /* vTaskDelay(1) at configTICK_RATE_HZ */
+#define MAX_PERIODS          10000U
+#define TEMP_AMBIENT_C       25.0
+#define TEMP_STEP_C          120.0    /* Within the ADC range of the sensor */
+#define TEMP_TAU             ((double)M1_TEMP_SW_FILTER_BW_FACTOR)
+
+static uint16_t VbusBuffer[M1_VBUS_SW_FILTER_BW_FACTOR];
+
+static RDivider_Handle_t Vbus =
+{
+  ._Super =
+  {
+    .SensorType               = REAL_SENSOR,
+    .ConversionFactor         = (uint16_t)(ADC_REFERENCE_VOLTAGE / VBUS_PARTITIONING_FACTOR),
+  },
+
+  .LowPassFilterBW            = M1_VBUS_SW_FILTER_BW_FACTOR,
+  .OverVoltageThreshold       = OVERVOLTAGE_THRESHOLD_d,
+  .OverVoltageThresholdLow    = OVERVOLTAGE_THRESHOLD_d,
+  .OverVoltageHysteresisUpDir = true,
+  .UnderVoltageThreshold      = UNDERVOLTAGE_THRESHOLD_d,
+  .aBuffer                    = VbusBuffer,
+};
+
+static NTC_Handle_t Temp =
+{
+  .bSensorType             = REAL_SENSOR,
+  .hLowPassFilterBW        = M1_TEMP_SW_FILTER_BW_FACTOR,
+  .hOverTempThreshold      = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d),
+  .hOverTempDeactThreshold = (uint16_t)(OV_TEMPERATURE_THRESHOLD_d - OV_TEMPERATURE_HYSTERESIS_d),
+  .hSensitivity            = (int16_t)(ADC_REFERENCE_VOLTAGE / dV_dT),
+  .wV0                     = (uint16_t)((V0_V * 65536) / ADC_REFERENCE_VOLTAGE),
+  .hT0                     = T0_C,
+};
+
+/* u16 ADC reading of a bus voltage in Volts */
+static uint16_t VbusRaw(double volts)
+{
+  return ((uint16_t)((volts * VBUS_PARTITIONING_FACTOR * 65536.0) / ADC_REFERENCE_VOLTAGE));
+}
+
+/* u16 ADC reading of the sensor at a temperature in Celsius */
+static uint16_t TempRaw(double celsius)
+{
+  return ((uint16_t)(((V0_V + (dV_dT * (celsius - T0_C))) * 65536.0) / ADC_REFERENCE_VOLTAGE));
+}
+
+/* Restarts the Vbus filter and fills it with a constant bus voltage, returns the fault state */
+static uint16_t VbusSettle(double volts)
+{
+  uint16_t fault = MC_NO_ERROR;
+  uint8_t i;
+
+  RVBS_Clear(&Vbus);
+  for (i = 0U; i < M1_VBUS_SW_FILTER_BW_FACTOR; i++)
+  {
+    fault = RVBS_CalcAvVbus(&Vbus, VbusRaw(volts));
+  }
+  return (fault);
+}
+
+/* Feeds the bus voltage until the fault is reported, returns the number of safety task periods */
+static uint32_t VbusPeriods(double volts, uint16_t fault)
+{
+  uint32_t periods = 0U;
+
+  do
+  {
+    periods++;
+  } while ((RVBS_CalcAvVbus(&Vbus, VbusRaw(volts)) != fault) && (periods < MAX_PERIODS));
+  return (periods);
+}
+
+/* Feeds the temperature until the fault state is reached, returns the number of safety task periods */
+static uint32_t TempPeriods(double celsius, uint16_t fault)
+{
+  uint32_t periods = 0U;
+
+  do
+  {
+    periods++;
+  } while ((NTC_CalcAvTemp(&Temp, TempRaw(celsius)) != fault) && (periods < MAX_PERIODS));
+  return (periods);
+}
+
+/* Periods of the first order filter of time constant tau to cover the share x of a step */
+static double FirstOrderPeriods(double tau, double x)
+{
+  return (log(1.0 - x) / log(1.0 - (1.0 / tau)));
+}
+
+int main(void)
+{
+  const double share = (OV_TEMPERATURE_THRESHOLD_C - TEMP_AMBIENT_C) / (TEMP_STEP_C - TEMP_AMBIENT_C);
+  uint32_t periods;
+  uint32_t sum;
+  uint8_t i;
+
+  /* Vbus: a step above the threshold is seen after at most the length of the moving average */
+  RVBS_Init(&Vbus);
+  HT_CHECK(MC_NO_ERROR == VbusSettle(NOMINAL_BUS_VOLTAGE_V));
+  periods = VbusPeriods(OV_VOLTAGE_THRESHOLD_V + 6.0, MC_OVER_VOLT);
+  printf("Vbus %2u V -> %2u V: over voltage after %u ms\n", NOMINAL_BUS_VOLTAGE_V, OV_VOLTAGE_THRESHOLD_V + 6,
+         (unsigned)((periods * 1000U) / SAFETY_TASK_RATE_HZ));
+  HT_CHECK((periods > 1U) && (periods <= M1_VBUS_SW_FILTER_BW_FACTOR));
+
+  HT_CHECK(MC_NO_ERROR == VbusSettle(NOMINAL_BUS_VOLTAGE_V));
+  periods = VbusPeriods(UD_VOLTAGE_THRESHOLD_V - 2.0, MC_UNDER_VOLT);
+  printf("Vbus %2u V -> %2u V: under voltage after %u ms\n", NOMINAL_BUS_VOLTAGE_V, UD_VOLTAGE_THRESHOLD_V - 2,
+         (unsigned)((periods * 1000U) / SAFETY_TASK_RATE_HZ));
+  HT_CHECK((periods > 1U) && (periods <= M1_VBUS_SW_FILTER_BW_FACTOR));
+
+  /* Vbus: a single sample spike is filtered out */
+  HT_CHECK(MC_NO_ERROR == VbusSettle(NOMINAL_BUS_VOLTAGE_V));
+  HT_CHECK(MC_NO_ERROR == RVBS_CalcAvVbus(&Vbus, VbusRaw(OV_VOLTAGE_THRESHOLD_V + 6.0)));
+  HT_CHECK(MC_NO_ERROR == RVBS_CalcAvVbus(&Vbus, VbusRaw(NOMINAL_BUS_VOLTAGE_V)));
+
+  /* Vbus: the running sum stays the sum of the buffer */
+  for (periods = 0U; periods < 1000U; periods++)
+  {
+    (void)RVBS_CalcAvVbus(&Vbus, (uint16_t)((periods * 7919U) & 0xFFFEU));
+  }
+  sum = 0U;
+  for (i = 0U; i < M1_VBUS_SW_FILTER_BW_FACTOR; i++)
+  {
+    sum += VbusBuffer[i];
+  }
+  HT_CHECK(sum == Vbus.SumBuffer);
+  HT_CHECK((sum / M1_VBUS_SW_FILTER_BW_FACTOR) == VBS_GetAvBusVoltage_d(&Vbus._Super));
+
+  /* Temperature: the filter time constant is the configured one, rounded down to a power of 2 */
+  NTC_Init(&Temp);
+  HT_CHECK((1U << Temp.bLowPassFilterShift) == M1_TEMP_SW_FILTER_BW_FACTOR);
+  for (periods = 0U; periods < (8U * M1_TEMP_SW_FILTER_BW_FACTOR); periods++)
+  {
+    (void)NTC_CalcAvTemp(&Temp, TempRaw(TEMP_AMBIENT_C));
+  }
+  HT_CHECK(abs(NTC_GetAvTemp_C(&Temp) - (int16_t)TEMP_AMBIENT_C) <= 1);
+
+  /* Temperature: a step from Ta to Tb trips after -tau.ln(1 - (Tth - Ta) / (Tb - Ta)) periods */
+  periods = TempPeriods(TEMP_STEP_C, MC_OVER_TEMP);
+  printf("Temperature %.0f C -> %.0f C: over temperature after %u ms, model %.0f ms\n", TEMP_AMBIENT_C, TEMP_STEP_C,
+         (unsigned)((periods * 1000U) / SAFETY_TASK_RATE_HZ),
+         (-TEMP_TAU * log(1.0 - share) * 1000.0) / SAFETY_TASK_RATE_HZ);
+  HT_CHECK(fabs(periods - FirstOrderPeriods(TEMP_TAU, share)) <= 2.0);
+  HT_CHECK(fabs(periods - (-TEMP_TAU * log(1.0 - share))) <= (0.01 * periods));
+
+  /* Temperature: the fault is released below the hysteresis only */
+  HT_CHECK(MC_OVER_TEMP == NTC_CalcAvTemp(&Temp, TempRaw(OV_TEMPERATURE_THRESHOLD_C - 1.0)));
+  (void)TempPeriods(TEMP_AMBIENT_C, MC_NO_ERROR);
+  HT_CHECK(NTC_GetAvTemp_C(&Temp) < (OV_TEMPERATURE_THRESHOLD_C - OV_TEMPERATURE_HYSTERESIS_C));
+  HT_CHECK(NTC_GetAvTemp_C(&Temp) >= (OV_TEMPERATURE_THRESHOLD_C - OV_TEMPERATURE_HYSTERESIS_C - 2));
+
+  return (HT_RESULT("test_sensor_latency"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    test_sps.c
+  * @author  LenseDrive
+  * @brief   Host test of the hand-over between the Setpoint Stream component
+  *          and the other position commands.
+  *
+  *          A stream feeds the position controller at every MF tick until it
+  *          is done. A move or follow command accepted in the meantime, or an
+  *          abort block sent by the host, must stop it for good: the stream
+  *          may no longer overwrite the setpoint afterwards.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdint.h>
+#include <string.h>
+#include "host_test.h"
+#include "setpoint_stream.h"
+#include "mcp.h"
+
+#define SAMPLING_TIME  0.001f
+#define DEPTH          16U
+#define PREFILL        4U
+
+static SPS_Sample_t Buffer[DEPTH];
+static PosCtrl_Handle_t PosCtrl =
+{
+  .SamplingTime  = SAMPLING_TIME,
+  .SysTickPeriod = SAMPLING_TIME,
+};
+static SPS_Handle_t Sps =
+{
+  .pBuffer      = Buffer,
+  .BufferSize   = DEPTH,
+  .PrefillLevel = PREFILL,
+};
+
+/* Sends a block of position only samples, one every MF tick, position n is n radians */
+static uint8_t SendBlock(uint8_t flags, uint32_t timestamp, uint8_t nbrOfSamples)
+{
+  uint8_t block[SPS_BLOCK_HEADER_SIZE + (DEPTH * 4U)];
+  uint16_t period = 1U;
+  uint8_t i;
+
+  block[0] = flags;
+  block[1] = nbrOfSamples;
+  (void)memcpy(&block[2], &period, 2);
+  (void)memcpy(&block[4], &timestamp, 4);
+  for (i = 0U; i < nbrOfSamples; i++)
+  {
+    float position = (float)(timestamp + i);
+    (void)memcpy(&block[SPS_BLOCK_HEADER_SIZE + (4U * i)], &position, 4);
+  }
+  return (SPS_WriteBlock(&Sps, block, SPS_BLOCK_HEADER_SIZE + (4U * nbrOfSamples)));
+}
+
+/* Runs MF ticks */
+static void Run(uint16_t ticks)
+{
+  uint16_t i;
+
+  for (i = 0U; i < ticks; i++)
+  {
+    SPS_Exec(&Sps);
+  }
+}
+
+int main(void)
+{
+  uint8_t abortBlock[SPS_BLOCK_HEADER_SIZE] = {SPS_FLAG_ABORT};
+  float theta;
+
+  TC_Init(&PosCtrl, MC_NULL, MC_NULL, MC_NULL);
+  SPS_Init(&Sps, &PosCtrl);
+
+  /* The stream drives the position controller once prefilled */
+  HT_CHECK(MCP_CMD_OK == SendBlock(SPS_FLAG_RESTART, 0U, 8U));
+  Run(3U);
+  HT_CHECK(SPS_PLAYING == SPS_GetState(&Sps));
+  HT_CHECK(TC_STREAMING_ON_GOING == PosCtrl.PositionCtrlStatus);
+  HT_CHECK_NEAR(PosCtrl.Theta, 2.0, 1e-6);
+
+  /* A follow command cancels a playing stream */
+  TC_FollowCommand(&PosCtrl, -1.0f);
+  Run(10U);
+  HT_CHECK(SPS_IDLE == SPS_GetState(&Sps));
+  HT_CHECK(TC_FOLLOWING_ON_GOING == PosCtrl.PositionCtrlStatus);
+  HT_CHECK_NEAR(PosCtrl.Theta, -1.0, 1e-6);
+
+  /* A move command cancels a stream in underrun, which holds its last sample otherwise */
+  HT_CHECK(MCP_CMD_OK == SendBlock(SPS_FLAG_RESTART, 0U, 4U));
+  Run(10U);
+  HT_CHECK(SPS_UNDERRUN == SPS_GetState(&Sps));
+  HT_CHECK_NEAR(PosCtrl.Theta, 3.0, 1e-6);
+  HT_CHECK(TC_MoveCommand(&PosCtrl, 3.0f, 2.0f, 1.0f));
+  Run(10U);
+  HT_CHECK(SPS_IDLE == SPS_GetState(&Sps));
+  HT_CHECK(TC_MOVEMENT_ON_GOING == PosCtrl.PositionCtrlStatus);
+  HT_CHECK_NEAR(PosCtrl.Theta, 3.0, 1e-6);
+
+  /* Blocks received after the cancellation start a new stream */
+  HT_CHECK(MCP_CMD_OK == SendBlock(0U, 100U, 8U));
+  Run(2U);
+  HT_CHECK(SPS_PLAYING == SPS_GetState(&Sps));
+  HT_CHECK_NEAR(PosCtrl.Theta, 101.0, 1e-6);
+
+  /* An abort block stops the stream at the current setpoint, without stopping the position loop */
+  theta = PosCtrl.Theta;
+  HT_CHECK(MCP_CMD_OK == SPS_WriteBlock(&Sps, abortBlock, sizeof(abortBlock)));
+  Run(10U);
+  HT_CHECK(SPS_IDLE == SPS_GetState(&Sps));
+  HT_CHECK(0U == SPS_GetLevel(&Sps));
+  HT_CHECK(TC_TARGET_POSITION_REACHED == PosCtrl.PositionCtrlStatus);
+  HT_CHECK(ENABLE == PosCtrl.PositionControlRegulation);
+  HT_CHECK_NEAR(PosCtrl.Theta, theta, 1e-6);
+  HT_CHECK_NEAR(PosCtrl.Omega, 0.0, 1e-6);
+  HT_CHECK_NEAR(PosCtrl.Acceleration, 0.0, 1e-6);
+
+  /* An abort block before the stream plays only flushes it */
+  HT_CHECK(MCP_CMD_OK == SendBlock(SPS_FLAG_RESTART, 200U, 2U));
+  HT_CHECK(MCP_CMD_OK == SPS_WriteBlock(&Sps, abortBlock, sizeof(abortBlock)));
+  Run(1U);
+  HT_CHECK(SPS_IDLE == SPS_GetState(&Sps));
+  HT_CHECK_NEAR(PosCtrl.Theta, theta, 1e-6);
+
+  return (HT_RESULT("test_sps"));
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
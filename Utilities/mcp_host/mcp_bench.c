@@ -0,0 +1,313 @@
+/**
+  ******************************************************************************
+  * @file    mcp_bench.c
+  * @author  LenseDrive
+  * @brief   Benchmark of the ASPEP/MCP protocol stack, built on the MCP host
+  *          library. Measures the request round-trip latency, the sustained
+  *          register read throughput and the asynchronous stream bandwidth.
+  *
+  *          Usage: mcp_bench <device> [-b baudrate] [-n requests] [-t seconds]
+  *                           [-e encoding] [--no-crc]
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mcp_host.h"
+
+/* Motor 1 registers used by the benchmark, see register_interface.h */
+#define BENCH_REG_I_A            ((31U << 6U) | MCPH_TYPE_16BIT | 1U)
+#define BENCH_REG_I_B            ((32U << 6U) | MCPH_TYPE_16BIT | 1U)
+#define BENCH_REG_I_Q_MEAS       ((35U << 6U) | MCPH_TYPE_16BIT | 1U)
+#define BENCH_REG_I_D_MEAS       ((36U << 6U) | MCPH_TYPE_16BIT | 1U)
+#define BENCH_REG_BUS_VOLTAGE    ((22U << 6U) | MCPH_TYPE_16BIT | 1U)
+#define BENCH_REG_SPEED_MEAS     ((1U << 6U) | MCPH_TYPE_32BIT | 1U)
+
+#define BENCH_ASYNC_MARK         0x5AU
+
+typedef struct
+{
+  MCPH_AsyncConfig_t config;
+  uint32_t frames;
+  uint32_t errors;
+} Bench_Async_t;
+
+/**
+  * @brief Returns the monotonic time in microseconds
+  */
+static uint64_t Bench_Now(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U));
+}
+
+static int Bench_Compare(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return ((x > y) - (x < y));
+}
+
+/**
+  * @brief Decodes each async packet, counts the frames and the packets that do not match the configuration
+  */
+static void Bench_AsyncPacket(void *pUser, const uint8_t *payload, uint16_t length)
+{
+  Bench_Async_t *pAsync = (Bench_Async_t *)pUser;
+  int frames;
+
+  if ((length > 0U) && (MCPH_ASYNC_ID_EVENTS == payload[length - 1U]))
+  {
+    /* Event packet, not part of the stream */
+    frames = 0;
+  }
+  else
+  {
+    frames = MCPH_DecodeAsync(&pAsync->config, payload, length, NULL, NULL);
+  }
+  if (frames < 0)
+  {
+    pAsync->errors++;
+  }
+  else
+  {
+    pAsync->frames += (uint32_t)frames;
+  }
+}
+
+/**
+  * @brief Round-trip latency of GET_MCP_VERSION, the smallest request
+  */
+static int Bench_Latency(MCPH_Handle_t *pHandle, uint32_t requests)
+{
+  uint64_t *samples = malloc(requests * sizeof(uint64_t));
+  uint64_t start;
+  uint64_t sum = 0U;
+  uint8_t answer[8];
+  uint16_t size;
+  uint8_t status;
+  uint32_t i;
+  int result = MCPH_OK;
+
+  for (i = 0U; (i < requests) && (MCPH_OK == result); i++)
+  {
+    start = Bench_Now();
+    result = MCPH_Request(pHandle, MCPH_CMD_GET_MCP_VERSION, 1U, NULL, 0U, answer, sizeof(answer), &size, &status);
+    samples[i] = Bench_Now() - start;
+    sum += samples[i];
+  }
+  if (MCPH_OK == result)
+  {
+    qsort(samples, requests, sizeof(uint64_t), &Bench_Compare);
+    printf("latency    %u requests: min %llu us, median %llu us, p99 %llu us, max %llu us, mean %.1f us\n",
+           requests, (unsigned long long)samples[0], (unsigned long long)samples[requests / 2U],
+           (unsigned long long)samples[(requests * 99U) / 100U], (unsigned long long)samples[requests - 1U],
+           (double)sum / requests);
+  }
+  free(samples);
+  return (result);
+}
+
+/**
+  * @brief Sustained register reads, as many registers per request as the sync payloads allow
+  */
+static int Bench_Registers(MCPH_Handle_t *pHandle, uint32_t seconds)
+{
+  static const uint16_t regs[] =
+  {
+    BENCH_REG_I_A, BENCH_REG_I_B, BENCH_REG_I_Q_MEAS, BENCH_REG_I_D_MEAS, BENCH_REG_BUS_VOLTAGE, BENCH_REG_SPEED_MEAS
+  };
+  uint16_t ids[255];
+  uint8_t values[MCPH_MAX_PAYLOAD];
+  uint16_t requestSize = 2U;
+  uint16_t answerSize = 1U;
+  uint16_t size;
+  uint8_t status;
+  uint8_t nbr = 0U;
+  uint8_t regSize;
+  uint32_t reads = 0U;
+  uint64_t bytes = 0U;
+  uint64_t start;
+  uint64_t elapsed;
+  int result = MCPH_OK;
+
+  /* Fills the request up to the smallest of the request and answer payloads */
+  for (;;)
+  {
+    regSize = ((regs[nbr % 6U] & MCPH_TYPE_MASK) == MCPH_TYPE_32BIT) ? 4U : 2U;
+    if ((nbr == 255U) || ((requestSize + 2U) > pHandle->rxMaxPayload)
+        || ((answerSize + regSize) > pHandle->txSyncMaxPayload))
+    {
+      break;
+    }
+    ids[nbr] = regs[nbr % 6U];
+    requestSize += 2U;
+    answerSize += regSize;
+    nbr++;
+  }
+
+  start = Bench_Now();
+  do
+  {
+    result = MCPH_GetRegisters(pHandle, ids, nbr, values, sizeof(values), &size, &status);
+    if ((MCPH_OK == result) && (status != 0U))
+    {
+      printf("registers  read failed, MCP status 0x%02x\n", status);
+      result = MCPH_ERROR_PROTOCOL;
+    }
+    reads += nbr;
+    bytes += size;
+    elapsed = Bench_Now() - start;
+  } while ((MCPH_OK == result) && (elapsed < ((uint64_t)seconds * 1000000U)));
+
+  if (MCPH_OK == result)
+  {
+    printf("registers  %u per request: %.0f registers/s, %.1f kB/s of values\n", nbr,
+           (double)reads * 1e6 / (double)elapsed, (double)bytes * 1e3 / (double)elapsed);
+  }
+  return (result);
+}
+
+/**
+  * @brief Async stream bandwidth, two HF current channels at the HF task rate
+  */
+static int Bench_Async(MCPH_Handle_t *pHandle, uint32_t seconds, uint8_t encoding)
+{
+  Bench_Async_t async;
+  uint8_t status;
+  uint64_t start;
+  uint64_t elapsed;
+  int result;
+
+  (void)memset(&async, 0, sizeof(async));
+  async.config.bufferSize = pHandle->txAsyncMaxPayload;
+  async.config.HFRate = 0U;
+  async.config.HFNum = 2U;
+  async.config.MFRate = MCPH_ASYNC_MF_ONCE;
+  async.config.MFNum = 1U;
+  async.config.channelID[0] = BENCH_REG_I_A;
+  async.config.channelID[1] = BENCH_REG_I_B;
+  async.config.channelID[2] = BENCH_REG_BUS_VOLTAGE;
+  async.config.mark = BENCH_ASYNC_MARK;
+  async.config.encoding = encoding;
+
+  pHandle->fAsync = &Bench_AsyncPacket;
+  pHandle->pAsyncUser = &async;
+  pHandle->asyncPackets = 0U;
+  pHandle->asyncBytes = 0U;
+
+  result = MCPH_ConfigAsync(pHandle, &async.config, &status);
+  if ((MCPH_OK == result) && (status != 0U))
+  {
+    printf("async      configuration failed, MCP status 0x%02x\n", status);
+    result = MCPH_ERROR_PROTOCOL;
+  }
+  if (MCPH_OK == result)
+  {
+    start = Bench_Now();
+    do
+    {
+      result = MCPH_Poll(pHandle, 100U);
+      elapsed = Bench_Now() - start;
+    } while ((MCPH_OK == result) && (elapsed < ((uint64_t)seconds * 1000000U)));
+
+    async.config.bufferSize = 0U;
+    (void)MCPH_ConfigAsync(pHandle, &async.config, &status);
+    printf("async      %s: %.1f packets/s, %.1f kB/s, %.0f frames/s, %u bad packets, %u decoding errors\n",
+           (MCPH_ASYNC_RAW == encoding) ? "raw"
+           : ((MCPH_ASYNC_DELTA_VARINT == encoding) ? "delta varint" : "bit packed"),
+           (double)pHandle->asyncPackets * 1e6 / (double)elapsed,
+           (double)pHandle->asyncBytes * 1e3 / (double)elapsed, (double)async.frames * 1e6 / (double)elapsed,
+           pHandle->badPackets, async.errors);
+  }
+  pHandle->fAsync = NULL;
+  return (result);
+}
+
+int main(int argc, char *argv[])
+{
+  static MCPH_Handle_t handle;
+  MCPH_Transport_t transport;
+  const char *device = NULL;
+  uint32_t baudrate = 1843200U;
+  uint32_t requests = 1000U;
+  uint32_t seconds = 5U;
+  uint8_t encoding = 1U;
+  bool dataCRC = true;
+  int result;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+    {
+      baudrate = (uint32_t)strtoul(argv[++i], NULL, 0);
+    }
+    else if ((0 == strcmp(argv[i], "-n")) && ((i + 1) < argc))
+    {
+      requests = (uint32_t)strtoul(argv[++i], NULL, 0);
+    }
+    else if ((0 == strcmp(argv[i], "-t")) && ((i + 1) < argc))
+    {
+      seconds = (uint32_t)strtoul(argv[++i], NULL, 0);
+    }
+    else if ((0 == strcmp(argv[i], "-e")) && ((i + 1) < argc))
+    {
+      encoding = (uint8_t)strtoul(argv[++i], NULL, 0);
+    }
+    else if (0 == strcmp(argv[i], "--no-crc"))
+    {
+      dataCRC = false;
+    }
+    else
+    {
+      device = argv[i];
+    }
+  }
+  if ((NULL == device) || (0U == requests))
+  {
+    fprintf(stderr, "usage: %s <device> [-b baudrate] [-n requests] [-t seconds] [-e encoding] [--no-crc]\n",
+            argv[0]);
+    return (2);
+  }
+
+  result = MCPH_SerialOpen(&transport, device, baudrate);
+  if (result != MCPH_OK)
+  {
+    fprintf(stderr, "cannot open %s\n", device);
+    return (1);
+  }
+  MCPH_Init(&handle, &transport, 500U);
+  result = MCPH_Connect(&handle, dataCRC);
+  if (MCPH_OK == result)
+  {
+    printf("connected  data CRC %s, request %u B, answer %u B, async %u B\n", handle.dataCRC ? "on" : "off",
+           handle.rxMaxPayload, handle.txSyncMaxPayload, handle.txAsyncMaxPayload);
+    result = Bench_Latency(&handle, requests);
+  }
+  if (MCPH_OK == result)
+  {
+    result = Bench_Registers(&handle, seconds);
+  }
+  if (MCPH_OK == result)
+  {
+    result = Bench_Async(&handle, seconds, encoding);
+  }
+  if (result != MCPH_OK)
+  {
+    fprintf(stderr, "failed with error %d (last NACK %u)\n", result, handle.lastNack);
+  }
+  MCPH_SerialClose(&transport);
+  return ((MCPH_OK == result) ? 0 : 1);
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
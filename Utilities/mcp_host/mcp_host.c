@@ -0,0 +1,895 @@
+/**
+  ******************************************************************************
+  * @file    mcp_host.c
+  * @author  LenseDrive
+  * @brief   This file provides the host side (controller) of the ASPEP and MCP
+  *          protocols: beacon and ping handshake, synchronous requests and
+  *          decoding of the asynchronous (MCPA) stream.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <string.h>
+#include <time.h>
+#include "mcp_host.h"
+
+/* ASPEP packet types, see aspep.h and mcptl.h */
+#define MCPH_DATA_PACKET          0x9U   /* Request from the host, async packet from the performer */
+#define MCPH_SYNC_PACKET          0xAU   /* Answer from the performer */
+#define MCPH_PING                 0x6U
+#define MCPH_BEACON               0x5U
+#define MCPH_NACK                 0xFU
+
+#define MCPH_HEADER_SIZE          4U
+#define MCPH_DATACRC_SIZE         2U
+
+#define MCPH_REG_ASYNC_UARTA      ((20U << 6U) | MCPH_TYPE_RAW | 1U)
+#define MCPH_FLUSH_IDLE_MS        20U
+
+/**
+  * @brief CRC-4 lookup tables, identical to the performer ones (see aspep.c)
+  */
+static const uint8_t CRC4_Lookup8[] =
+{
+  0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x07, 0x05, 0x03, 0x01, 0x0f, 0x0d, 0x0b, 0x09,
+  0x07, 0x05, 0x03, 0x01, 0x0f, 0x0d, 0x0b, 0x09, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e,
+  0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00, 0x09, 0x0b, 0x0d, 0x0f, 0x01, 0x03, 0x05, 0x07,
+  0x09, 0x0b, 0x0d, 0x0f, 0x01, 0x03, 0x05, 0x07, 0x0e, 0x0c, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x00,
+  0x0b, 0x09, 0x0f, 0x0d, 0x03, 0x01, 0x07, 0x05, 0x0c, 0x0e, 0x08, 0x0a, 0x04, 0x06, 0x00, 0x02,
+  0x0c, 0x0e, 0x08, 0x0a, 0x04, 0x06, 0x00, 0x02, 0x0b, 0x09, 0x0f, 0x0d, 0x03, 0x01, 0x07, 0x05,
+  0x05, 0x07, 0x01, 0x03, 0x0d, 0x0f, 0x09, 0x0b, 0x02, 0x00, 0x06, 0x04, 0x0a, 0x08, 0x0e, 0x0c,
+  0x02, 0x00, 0x06, 0x04, 0x0a, 0x08, 0x0e, 0x0c, 0x05, 0x07, 0x01, 0x03, 0x0d, 0x0f, 0x09, 0x0b,
+  0x01, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0d, 0x0f, 0x06, 0x04, 0x02, 0x00, 0x0e, 0x0c, 0x0a, 0x08,
+  0x06, 0x04, 0x02, 0x00, 0x0e, 0x0c, 0x0a, 0x08, 0x01, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0d, 0x0f,
+  0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01, 0x08, 0x0a, 0x0c, 0x0e, 0x00, 0x02, 0x04, 0x06,
+  0x08, 0x0a, 0x0c, 0x0e, 0x00, 0x02, 0x04, 0x06, 0x0f, 0x0d, 0x0b, 0x09, 0x07, 0x05, 0x03, 0x01,
+  0x0a, 0x08, 0x0e, 0x0c, 0x02, 0x00, 0x06, 0x04, 0x0d, 0x0f, 0x09, 0x0b, 0x05, 0x07, 0x01, 0x03,
+  0x0d, 0x0f, 0x09, 0x0b, 0x05, 0x07, 0x01, 0x03, 0x0a, 0x08, 0x0e, 0x0c, 0x02, 0x00, 0x06, 0x04,
+  0x04, 0x06, 0x00, 0x02, 0x0c, 0x0e, 0x08, 0x0a, 0x03, 0x01, 0x07, 0x05, 0x0b, 0x09, 0x0f, 0x0d,
+  0x03, 0x01, 0x07, 0x05, 0x0b, 0x09, 0x0f, 0x0d, 0x04, 0x06, 0x00, 0x02, 0x0c, 0x0e, 0x08, 0x0a
+};
+
+static const uint8_t CRC4_Lookup4[] =
+{
+  0x00, 0x07, 0x0e, 0x09, 0x0b, 0x0c, 0x05, 0x02, 0x01, 0x06, 0x0f, 0x08, 0x0a, 0x0d, 0x04, 0x03
+};
+
+/**
+  * @brief Returns @p header with its CRC-4 in bits 28 to 31
+  */
+static uint32_t MCPH_AddHeaderCRC(uint32_t header)
+{
+  uint8_t crc = 0U;
+
+  crc = CRC4_Lookup8[crc ^ (uint8_t)(header & 0xffU)];
+  crc = CRC4_Lookup8[crc ^ (uint8_t)((header >> 8U) & 0xffU)];
+  crc = CRC4_Lookup8[crc ^ (uint8_t)((header >> 16U) & 0xffU)];
+  crc = CRC4_Lookup4[crc ^ (uint8_t)((header >> 24U) & 0x0fU)];
+  return ((header & 0x0FFFFFFFU) | ((uint32_t)crc << 28U));
+}
+
+/**
+  * @brief Returns true if the CRC-4 of @p header is valid
+  */
+static bool MCPH_CheckHeaderCRC(uint32_t header)
+{
+  uint8_t crc = 0U;
+
+  crc = CRC4_Lookup8[crc ^ (uint8_t)(header & 0xffU)];
+  crc = CRC4_Lookup8[crc ^ (uint8_t)((header >> 8U) & 0xffU)];
+  crc = CRC4_Lookup8[crc ^ (uint8_t)((header >> 16U) & 0xffU)];
+  crc = CRC4_Lookup8[crc ^ (uint8_t)((header >> 24U) & 0xffU)];
+  return (0U == crc);
+}
+
+/**
+  * @brief Returns the CRC-16 of a data payload: polynomial 0x1021, initial value 0xFFFF, no reflection
+  */
+static uint16_t MCPH_DataCRC(const uint8_t *data, uint16_t length)
+{
+  uint16_t crc = 0xFFFFU;
+  uint16_t i;
+  uint8_t bit;
+
+  for (i = 0U; i < length; i++)
+  {
+    crc ^= (uint16_t)((uint16_t)data[i] << 8U);
+    for (bit = 0U; bit < 8U; bit++)
+    {
+      crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1U) ^ 0x1021U) : (uint16_t)(crc << 1U);
+    }
+  }
+  return (crc);
+}
+
+/**
+  * @brief Returns the monotonic time in milliseconds
+  */
+static uint64_t MCPH_Now(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000U) + ((uint64_t)ts.tv_nsec / 1000000U));
+}
+
+/**
+  * @brief Reads exactly @p length bytes before @p deadline
+  */
+static int MCPH_ReadExact(MCPH_Handle_t *pHandle, uint8_t *data, uint16_t length, uint64_t deadline)
+{
+  int result = MCPH_OK;
+  uint16_t done = 0U;
+  uint64_t now;
+  int n;
+
+  while ((MCPH_OK == result) && (done < length))
+  {
+    now = MCPH_Now();
+    if (now >= deadline)
+    {
+      result = MCPH_ERROR_TIMEOUT;
+    }
+    else
+    {
+      n = pHandle->transport.fRead(pHandle->transport.pCtx, &data[done], length - done, (uint32_t)(deadline - now));
+      if (n < 0)
+      {
+        result = MCPH_ERROR_IO;
+      }
+      else
+      {
+        done += (uint16_t)n;
+      }
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief Drops the bytes received until the line is idle, to resynchronize on the next header
+  */
+static void MCPH_Flush(MCPH_Handle_t *pHandle)
+{
+  uint8_t dummy[64];
+  uint64_t deadline = MCPH_Now() + pHandle->timeoutMs;
+
+  /* Bounded by the timeout, the line may never be idle while an async stream is running */
+  while ((pHandle->transport.fRead(pHandle->transport.pCtx, dummy, sizeof(dummy), MCPH_FLUSH_IDLE_MS) > 0)
+         && (MCPH_Now() < deadline))
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief Sends a packet: header, payload and, for data packets, the data CRC
+  */
+static int MCPH_SendPacket(MCPH_Handle_t *pHandle, uint32_t header, const uint8_t *payload, uint16_t length)
+{
+  uint8_t *tx = pHandle->txBuffer;
+  uint32_t full = MCPH_AddHeaderCRC(header);
+  uint16_t size = MCPH_HEADER_SIZE;
+  uint16_t crc;
+
+  tx[0] = (uint8_t)full;
+  tx[1] = (uint8_t)(full >> 8U);
+  tx[2] = (uint8_t)(full >> 16U);
+  tx[3] = (uint8_t)(full >> 24U);
+  if (length > 0U)
+  {
+    (void)memcpy(&tx[MCPH_HEADER_SIZE], payload, length);
+    size += length;
+  }
+  if (((header & 0xFU) == MCPH_DATA_PACKET) && pHandle->dataCRC)
+  {
+    crc = MCPH_DataCRC(payload, length);
+    tx[size] = (uint8_t)crc;
+    tx[size + 1U] = (uint8_t)(crc >> 8U);
+    size += MCPH_DATACRC_SIZE;
+  }
+  return ((0 == pHandle->transport.fWrite(pHandle->transport.pCtx, tx, size)) ? MCPH_OK : MCPH_ERROR_IO);
+}
+
+/**
+  * @brief Receives one packet. Data packets are stored in rxBuffer.
+  *
+  *  The packet must start before @p deadline. Once started, it is completed within the answer timeout,
+  * so that a short polling timeout does not cut a packet and lose the header synchronization.
+  *
+  * @param  pHeader Header of the packet
+  * @param  pLength Payload length of data packets, 0 otherwise
+  */
+static int MCPH_ReceivePacket(MCPH_Handle_t *pHandle, uint64_t deadline, uint32_t *pHeader, uint16_t *pLength)
+{
+  uint8_t raw[MCPH_HEADER_SIZE];
+  uint32_t header;
+  uint32_t type;
+  uint16_t length = 0U;
+  uint16_t crc;
+  uint64_t packetDeadline = 0U;
+  int result;
+
+  result = MCPH_ReadExact(pHandle, raw, 1U, deadline);
+  if (MCPH_OK == result)
+  {
+    packetDeadline = MCPH_Now() + pHandle->timeoutMs;
+    result = MCPH_ReadExact(pHandle, &raw[1], MCPH_HEADER_SIZE - 1U, packetDeadline);
+  }
+  if (MCPH_OK == result)
+  {
+    header = (uint32_t)raw[0] | ((uint32_t)raw[1] << 8U) | ((uint32_t)raw[2] << 16U) | ((uint32_t)raw[3] << 24U);
+    type = header & 0xFU;
+    if (false == MCPH_CheckHeaderCRC(header))
+    {
+      pHandle->badPackets++;
+      MCPH_Flush(pHandle);
+      result = MCPH_ERROR_PROTOCOL;
+    }
+    else if ((MCPH_DATA_PACKET == type) || (MCPH_SYNC_PACKET == type))
+    {
+      length = (uint16_t)((header >> 4U) & 0x1FFFU);
+      result = MCPH_ReadExact(pHandle, pHandle->rxBuffer,
+                              length + (pHandle->dataCRC ? MCPH_DATACRC_SIZE : 0U), packetDeadline);
+      if ((MCPH_OK == result) && pHandle->dataCRC)
+      {
+        crc = (uint16_t)pHandle->rxBuffer[length] | (uint16_t)((uint16_t)pHandle->rxBuffer[length + 1U] << 8U);
+        if (crc != MCPH_DataCRC(pHandle->rxBuffer, length))
+        {
+          pHandle->badPackets++;
+          result = MCPH_ERROR_PROTOCOL;
+        }
+      }
+    }
+    else
+    {
+      /* Control packet, header only */
+    }
+    *pHeader = header;
+    *pLength = length;
+  }
+  return (result);
+}
+
+/**
+  * @brief Waits for a packet of type @p expected. Async packets received meanwhile are passed to fAsync.
+  */
+static int MCPH_WaitPacket(MCPH_Handle_t *pHandle, uint32_t expected, uint32_t timeoutMs, uint32_t *pHeader,
+                           uint16_t *pLength)
+{
+  uint64_t deadline = MCPH_Now() + timeoutMs;
+  uint32_t type;
+  int result;
+
+  do
+  {
+    result = MCPH_ReceivePacket(pHandle, deadline, pHeader, pLength);
+    if (MCPH_OK == result)
+    {
+      type = *pHeader & 0xFU;
+      if (type == expected)
+      {
+        break;
+      }
+      else if (MCPH_NACK == type)
+      {
+        pHandle->lastNack = (uint8_t)(*pHeader >> 8U);
+        result = MCPH_ERROR_NACK;
+      }
+      else if (MCPH_DATA_PACKET == type)
+      {
+        pHandle->asyncPackets++;
+        pHandle->asyncBytes += *pLength;
+        if (pHandle->fAsync != NULL)
+        {
+          pHandle->fAsync(pHandle->pAsyncUser, pHandle->rxBuffer, *pLength);
+        }
+      }
+      else
+      {
+        /* Nothing to do, stale control packet */
+      }
+    }
+  } while ((MCPH_OK == result) || (MCPH_ERROR_PROTOCOL == result));
+  return (result);
+}
+
+/**
+  * @brief  Initializes the handle.
+  *
+  * @param  pHandle Handle of the connection
+  * @param  pTransport Byte stream to the performer
+  * @param  timeoutMs Answer timeout
+  */
+void MCPH_Init(MCPH_Handle_t *pHandle, const MCPH_Transport_t *pTransport, uint32_t timeoutMs)
+{
+  (void)memset(pHandle, 0, sizeof(MCPH_Handle_t));
+  pHandle->transport = *pTransport;
+  pHandle->timeoutMs = timeoutMs;
+}
+
+/**
+  * @brief  Negotiates the capabilities and connects to the performer.
+  *
+  * The host offers its largest capabilities in a beacon. The performer answers with the minimum of both;
+  * the host then sends these back so that the performer accepts them, and connects with a ping.
+  *
+  * @param  pHandle Handle of the connection
+  * @param  dataCRC Requests the data CRC, kept only if the performer supports it
+  *
+  * @retval MCPH_OK once connected, an MCPH_ERROR_xxx code otherwise.
+  */
+int MCPH_Connect(MCPH_Handle_t *pHandle, bool dataCRC)
+{
+  uint32_t caps = ((dataCRC ? 1U : 0U) << 7U) | (0x3FU << 8U) | (0x7FU << 14U) | (0x7FU << 21U);
+  uint32_t header = 0U;
+  uint16_t length;
+  uint8_t attempt;
+  int result = MCPH_ERROR_PROTOCOL;
+
+  pHandle->dataCRC = dataCRC;
+  MCPH_Flush(pHandle);
+  for (attempt = 0U; attempt < 3U; attempt++)
+  {
+    result = MCPH_SendPacket(pHandle, MCPH_BEACON | caps, NULL, 0U);
+    if (MCPH_OK == result)
+    {
+      result = MCPH_WaitPacket(pHandle, MCPH_BEACON, pHandle->timeoutMs, &header, &length);
+    }
+    if (MCPH_OK == result)
+    {
+      if ((header & 0x0FFFFFF0U) == caps)
+      {
+        break;
+      }
+      caps = header & 0x0FFFFFF0U; /* Performer capabilities, already the minimum of both */
+      result = MCPH_ERROR_PROTOCOL;
+    }
+  }
+
+  if (MCPH_OK == result)
+  {
+    pHandle->dataCRC = ((caps >> 7U) & 0x1U) != 0U;
+    pHandle->rxMaxPayload = (uint16_t)((((caps >> 8U) & 0x3FU) + 1U) * 32U);
+    pHandle->txSyncMaxPayload = (uint16_t)((((caps >> 14U) & 0x7FU) + 1U) * 32U);
+    pHandle->txAsyncMaxPayload = (uint16_t)(((caps >> 21U) & 0x7FU) * 64U);
+    result = MCPH_SendPacket(pHandle, MCPH_PING | ((uint32_t)pHandle->pingNumber << 12U), NULL, 0U);
+    pHandle->pingNumber++;
+    if (MCPH_OK == result)
+    {
+      result = MCPH_WaitPacket(pHandle, MCPH_PING, pHandle->timeoutMs, &header, &length);
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief  Sends an MCP command and waits for its answer.
+  *
+  * @param  pHandle Handle of the connection
+  * @param  command MCP command, see mcp.h
+  * @param  motor Targeted motor, starting at 1
+  * @param  data Payload of the command
+  * @param  length Size of the payload
+  * @param  answer Payload of the answer, MCP status excluded
+  * @param  maxSize Size of @p answer
+  * @param  pSize Size of the answer payload
+  * @param  pStatus MCP status of the answer
+  *
+  * @retval MCPH_OK if an answer was received, an MCPH_ERROR_xxx code otherwise.
+  */
+int MCPH_Request(MCPH_Handle_t *pHandle, uint16_t command, uint8_t motor, const uint8_t *data, uint16_t length,
+                 uint8_t *answer, uint16_t maxSize, uint16_t *pSize, uint8_t *pStatus)
+{
+  uint8_t request[MCPH_MAX_PAYLOAD];
+  uint16_t cmd = (uint16_t)(command | (motor & 0x7U));
+  uint32_t header;
+  uint16_t rxLength = 0U;
+  int result;
+
+  if ((length + 2U) > pHandle->rxMaxPayload)
+  {
+    result = MCPH_ERROR_SIZE;
+  }
+  else
+  {
+    request[0] = (uint8_t)cmd;
+    request[1] = (uint8_t)(cmd >> 8U);
+    if (length > 0U)
+    {
+      (void)memcpy(&request[2], data, length);
+    }
+    result = MCPH_SendPacket(pHandle, MCPH_DATA_PACKET | ((uint32_t)(length + 2U) << 4U), request, length + 2U);
+    if (MCPH_OK == result)
+    {
+      result = MCPH_WaitPacket(pHandle, MCPH_SYNC_PACKET, pHandle->timeoutMs, &header, &rxLength);
+    }
+    if (MCPH_OK == result)
+    {
+      if ((0U == rxLength) || ((rxLength - 1U) > maxSize))
+      {
+        result = MCPH_ERROR_SIZE;
+      }
+      else
+      {
+        if ((answer != NULL) && (rxLength > 1U))
+        {
+          (void)memcpy(answer, pHandle->rxBuffer, rxLength - 1U);
+        }
+        *pSize = rxLength - 1U;
+        *pStatus = pHandle->rxBuffer[rxLength - 1U];
+      }
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief  Reads registers with a single GET_DATA_ELEMENT command.
+  *
+  * @param  pIDs Register IDs, motor included
+  * @param  nbr Number of registers
+  * @param  values Values, back to back in the MCP format
+  */
+int MCPH_GetRegisters(MCPH_Handle_t *pHandle, const uint16_t *pIDs, uint8_t nbr, uint8_t *values,
+                      uint16_t maxSize, uint16_t *pSize, uint8_t *pStatus)
+{
+  uint8_t ids[2U * 255U];
+  uint8_t i;
+
+  for (i = 0U; i < nbr; i++)
+  {
+    ids[2U * i] = (uint8_t)pIDs[i];
+    ids[(2U * i) + 1U] = (uint8_t)(pIDs[i] >> 8U);
+  }
+  return (MCPH_Request(pHandle, MCPH_CMD_GET_DATA_ELEMENT, 1U, ids, (uint16_t)(2U * nbr), values, maxSize, pSize, pStatus));
+}
+
+/**
+  * @brief  Writes one register with a SET_DATA_ELEMENT command.
+  *
+  * @param  regID Register ID, motor included
+  * @param  value Value, without the size prefix for RAW registers
+  * @param  size Size of @p value
+  */
+int MCPH_SetRegister(MCPH_Handle_t *pHandle, uint16_t regID, const void *value, uint16_t size, uint8_t *pStatus)
+{
+  uint8_t data[MCPH_MAX_PAYLOAD];
+  uint16_t length = 2U;
+  uint16_t answerSize;
+  int result;
+
+  if ((size + 4U) > sizeof(data))
+  {
+    result = MCPH_ERROR_SIZE;
+  }
+  else
+  {
+    data[0] = (uint8_t)regID;
+    data[1] = (uint8_t)(regID >> 8U);
+    if ((regID & MCPH_TYPE_MASK) == MCPH_TYPE_RAW)
+    {
+      data[2] = (uint8_t)size;
+      data[3] = (uint8_t)(size >> 8U);
+      length += 2U;
+    }
+    (void)memcpy(&data[length], value, size);
+    length += size;
+    result = MCPH_Request(pHandle, MCPH_CMD_SET_DATA_ELEMENT, 1U, data, length, NULL, 0U, &answerSize, pStatus);
+  }
+  return (result);
+}
+
+/**
+  * @brief  Configures the asynchronous stream of the performer, see MCPA_cfgLog().
+  */
+int MCPH_ConfigAsync(MCPH_Handle_t *pHandle, const MCPH_AsyncConfig_t *pConfig, uint8_t *pStatus)
+{
+  uint8_t cfg[8U + (2U * MCPH_ASYNC_MAX_CHANNELS)];
+  uint16_t size = 6U;
+  uint8_t i;
+  int result;
+
+  if ((pConfig->HFNum + pConfig->MFNum) > MCPH_ASYNC_MAX_CHANNELS)
+  {
+    result = MCPH_ERROR_SIZE;
+  }
+  else
+  {
+    cfg[0] = (uint8_t)pConfig->bufferSize;
+    cfg[1] = (uint8_t)(pConfig->bufferSize >> 8U);
+    cfg[2] = pConfig->HFRate;
+    cfg[3] = pConfig->HFNum;
+    cfg[4] = pConfig->MFRate;
+    cfg[5] = pConfig->MFNum;
+    for (i = 0U; i < (pConfig->HFNum + pConfig->MFNum); i++)
+    {
+      cfg[size] = (uint8_t)pConfig->channelID[i];
+      cfg[size + 1U] = (uint8_t)(pConfig->channelID[i] >> 8U);
+      size += 2U;
+    }
+    cfg[size] = pConfig->mark;
+    cfg[size + 1U] = pConfig->encoding;
+    size += 2U;
+    result = MCPH_SetRegister(pHandle, MCPH_REG_ASYNC_UARTA, cfg, size, pStatus);
+  }
+  return (result);
+}
+
+/**
+  * @brief  Processes the packets received within @p timeoutMs, async packets are passed to fAsync.
+  *
+  * @retval MCPH_OK, or MCPH_ERROR_IO on a transport error.
+  */
+int MCPH_Poll(MCPH_Handle_t *pHandle, uint32_t timeoutMs)
+{
+  uint32_t header;
+  uint16_t length;
+  int result;
+
+  /* No packet type 0 exists: every packet is processed until the timeout */
+  result = MCPH_WaitPacket(pHandle, 0U, timeoutMs, &header, &length);
+  return (((MCPH_ERROR_TIMEOUT == result) || (MCPH_ERROR_NACK == result)) ? MCPH_OK : result);
+}
+
+/**
+  * @brief  Returns the size of the value of register @p regID
+  */
+static uint8_t MCPH_RegSize(uint16_t regID)
+{
+  uint8_t size;
+
+  switch (regID & MCPH_TYPE_MASK)
+  {
+    case MCPH_TYPE_8BIT:
+      size = 1U;
+      break;
+    case MCPH_TYPE_16BIT:
+      size = 2U;
+      break;
+    case MCPH_TYPE_32BIT:
+      size = 4U;
+      break;
+    default:
+      size = 0U;
+      break;
+  }
+  return (size);
+}
+
+/**
+  * @brief  Reads the MF values of a frame
+  */
+static int MCPH_ReadMF(const MCPH_AsyncConfig_t *pConfig, const uint8_t *payload, uint16_t *pPos, uint16_t end,
+                       uint32_t *mf)
+{
+  int result = MCPH_OK;
+  uint8_t i;
+  uint8_t b;
+  uint8_t size;
+
+  for (i = 0U; (i < pConfig->MFNum) && (MCPH_OK == result); i++)
+  {
+    size = MCPH_RegSize(pConfig->channelID[pConfig->HFNum + i]);
+    if ((*pPos + size) > end)
+    {
+      result = MCPH_ERROR_PROTOCOL;
+    }
+    else
+    {
+      mf[i] = 0U;
+      for (b = 0U; b < size; b++)
+      {
+        mf[i] |= (uint32_t)payload[*pPos + b] << (8U * b);
+      }
+      *pPos += size;
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief  Bit reader of a bit packed async packet
+  */
+typedef struct
+{
+  const uint8_t *payload;
+  uint16_t pos;           /* Next byte to read */
+  uint16_t end;           /* End of the HF and MF values */
+  uint32_t bits;          /* Bits read, not used yet */
+  uint8_t count;          /* Number of bits in bits */
+} MCPH_BitReader_t;
+
+/**
+  * @brief  Reads @p width bits, least significant bit first
+  */
+static int MCPH_GetBits(MCPH_BitReader_t *pReader, uint8_t width, uint16_t *pValue)
+{
+  int result = MCPH_OK;
+
+  while ((MCPH_OK == result) && (pReader->count < width))
+  {
+    if (pReader->pos >= pReader->end)
+    {
+      result = MCPH_ERROR_PROTOCOL;
+    }
+    else
+    {
+      pReader->bits |= (uint32_t)pReader->payload[pReader->pos] << pReader->count;
+      pReader->pos++;
+      pReader->count += 8U;
+    }
+  }
+  if (MCPH_OK == result)
+  {
+    *pValue = (uint16_t)(pReader->bits & ((1UL << width) - 1UL));
+    pReader->bits >>= width;
+    pReader->count -= width;
+  }
+  return (result);
+}
+
+/**
+  * @brief  Decodes the frames of a bit packed async packet, see MCPA_startPacking()
+  *
+  * @retval Number of frames decoded, or MCPH_ERROR_PROTOCOL if the packet does not match the configuration.
+  */
+static int MCPH_DecodePacked(const MCPH_AsyncConfig_t *pConfig, const uint8_t *payload, uint16_t end,
+                             uint16_t tail, MCPH_frame_cb_t fFrame, void *pUser)
+{
+  MCPH_BitReader_t reader = {0};
+  uint16_t hf[MCPH_ASYNC_MAX_CHANNELS] = {0};
+  uint16_t delta[MCPH_ASYNC_MAX_CHANNELS] = {0};
+  uint8_t width[MCPH_ASYNC_MAX_CHANNELS];
+  uint8_t order[MCPH_ASYNC_MAX_CHANNELS];
+  uint32_t mf[MCPH_ASYNC_MAX_CHANNELS];
+  uint32_t timestamp;
+  uint16_t frames = 0U;
+  uint16_t code;
+  uint16_t pos;
+  uint16_t i;
+  uint16_t f;
+  bool withMF;
+  int result = MCPH_OK;
+
+  if (end < (6U + pConfig->HFNum))
+  {
+    result = MCPH_ERROR_PROTOCOL;
+  }
+  else
+  {
+    timestamp = (uint32_t)payload[0] | ((uint32_t)payload[1] << 8U) | ((uint32_t)payload[2] << 16U)
+              | ((uint32_t)payload[3] << 24U);
+    frames = (uint16_t)payload[4] | (uint16_t)((uint16_t)payload[5] << 8U);
+    for (i = 0U; i < pConfig->HFNum; i++)
+    {
+      width[i] = payload[6U + i] & 0x1FU;
+      order[i] = ((payload[6U + i] & 0x80U) != 0U) ? 2U : 1U;
+      if ((0U == width[i]) || (width[i] > 16U))
+      {
+        result = MCPH_ERROR_PROTOCOL;
+      }
+    }
+    reader.payload = payload;
+    reader.pos = 6U + pConfig->HFNum;
+    reader.end = end;
+  }
+
+  for (f = 0U; (f < frames) && (MCPH_OK == result); f++)
+  {
+    for (i = 0U; (i < pConfig->HFNum) && (MCPH_OK == result); i++)
+    {
+      if (f < order[i])
+      {
+        /* First frames: the values, start of the prediction */
+        code = hf[i];
+        result = MCPH_GetBits(&reader, 16U, &hf[i]);
+        delta[i] = (0U == f) ? 0U : (uint16_t)(hf[i] - code);
+      }
+      else
+      {
+        result = MCPH_GetBits(&reader, width[i], &code);
+        if (MCPH_OK != result)
+        {
+          /* Nothing to do */
+        }
+        else if ((width[i] < 16U) && (code == (uint16_t)((1U << width[i]) - 1U)))
+        {
+          /* Escape code: the value follows */
+          code = hf[i];
+          result = MCPH_GetBits(&reader, 16U, &hf[i]);
+          delta[i] = (uint16_t)(hf[i] - code);
+        }
+        else
+        {
+          code = (uint16_t)((code >> 1U) ^ (uint16_t)(0U - (code & 1U)));
+          delta[i] = (2U == order[i]) ? (uint16_t)(delta[i] + code) : code;
+          hf[i] = (uint16_t)(hf[i] + delta[i]);
+        }
+      }
+    }
+
+    withMF = (pConfig->MFRate < MCPH_ASYNC_MF_ONCE) && ((f % (pConfig->MFRate + 1U)) == pConfig->MFRate);
+    if ((MCPH_OK == result) && withMF)
+    {
+      /* MF values start on a byte */
+      reader.bits = 0U;
+      reader.count = 0U;
+      result = MCPH_ReadMF(pConfig, payload, &reader.pos, end, mf);
+    }
+    if ((MCPH_OK == result) && (MCPH_ASYNC_MF_ONCE == pConfig->MFRate) && ((f + 1U) == frames))
+    {
+      /* Last frame, carries the MF values sent once per packet */
+      pos = end;
+      result = MCPH_ReadMF(pConfig, payload, &pos, end + tail, mf);
+      withMF = true;
+    }
+    if ((MCPH_OK == result) && (fFrame != NULL))
+    {
+      fFrame(pUser, timestamp, hf, withMF ? mf : NULL);
+    }
+  }
+  if ((MCPH_OK == result) && (reader.pos != end))
+  {
+    /* Only the padding of the last byte is left */
+    result = MCPH_ERROR_PROTOCOL;
+  }
+  return ((MCPH_OK == result) ? (int)frames : result);
+}
+
+/**
+  * @brief  Decodes the frames of an async packet.
+  *
+  * Packet layout: timestamp (u32), frames of HFNum values (raw u16 or zig-zag varint deltas, see
+  * MCPA_putVarint()), MF values once per packet when MFRate is MCPH_ASYNC_MF_ONCE, then the mark and
+  * the async ID. Otherwise the MF values follow one frame out of MFRate+1: the performer restarts its
+  * MF counter at each packet and sends them after frames MFRate, 2*MFRate+1, ... (counted from 0).
+  * Bit packed packets have a header after the timestamp, see MCPA_startPacking().
+  *
+  * @retval Number of frames decoded, or MCPH_ERROR_PROTOCOL if the packet does not match the configuration.
+  */
+int MCPH_DecodeAsync(const MCPH_AsyncConfig_t *pConfig, const uint8_t *payload, uint16_t length,
+                     MCPH_frame_cb_t fFrame, void *pUser)
+{
+  uint16_t hf[MCPH_ASYNC_MAX_CHANNELS] = {0};
+  uint32_t mf[MCPH_ASYNC_MAX_CHANNELS];
+  uint32_t timestamp;
+  uint16_t pos = 4U;
+  uint16_t end;
+  uint16_t tail = 0U;
+  uint16_t zz;
+  uint8_t shift;
+  uint8_t b;
+  uint8_t i;
+  bool withMF;
+  int frames = 0;
+  int result = MCPH_OK;
+
+  for (i = 0U; i < pConfig->MFNum; i++)
+  {
+    tail += MCPH_RegSize(pConfig->channelID[pConfig->HFNum + i]);
+  }
+  if (length < (6U + ((MCPH_ASYNC_MF_ONCE == pConfig->MFRate) ? tail : 0U)))
+  {
+    result = MCPH_ERROR_PROTOCOL;
+  }
+  else
+  {
+    timestamp = (uint32_t)payload[0] | ((uint32_t)payload[1] << 8U) | ((uint32_t)payload[2] << 16U)
+              | ((uint32_t)payload[3] << 24U);
+    end = length - 2U - ((MCPH_ASYNC_MF_ONCE == pConfig->MFRate) ? tail : 0U);
+    if (MCPH_ASYNC_BIT_PACKED == pConfig->encoding)
+    {
+      /* The loop below decodes the byte aligned encodings */
+      frames = MCPH_DecodePacked(pConfig, payload, end, tail, fFrame, pUser);
+      result = (frames < 0) ? frames : MCPH_OK;
+      pos = end;
+    }
+    while ((MCPH_OK == result) && (pos < end))
+    {
+      for (i = 0U; (i < pConfig->HFNum) && (MCPH_OK == result); i++)
+      {
+        if (0U == pConfig->encoding)
+        {
+          if ((pos + 2U) > end)
+          {
+            result = MCPH_ERROR_PROTOCOL;
+          }
+          else
+          {
+            hf[i] = (uint16_t)payload[pos] | (uint16_t)((uint16_t)payload[pos + 1U] << 8U);
+            pos += 2U;
+          }
+        }
+        else
+        {
+          zz = 0U;
+          shift = 0U;
+          do
+          {
+            if ((pos >= end) || (shift > 14U))
+            {
+              result = MCPH_ERROR_PROTOCOL;
+              b = 0U;
+            }
+            else
+            {
+              b = payload[pos];
+              pos++;
+              zz |= (uint16_t)((uint16_t)(b & 0x7FU) << shift);
+              shift += 7U;
+            }
+          } while ((b & 0x80U) != 0U);
+          hf[i] = (uint16_t)(hf[i] + (uint16_t)((zz >> 1U) ^ (uint16_t)(0U - (zz & 1U))));
+        }
+      }
+
+      withMF = (pConfig->MFRate < MCPH_ASYNC_MF_ONCE) && ((frames % (pConfig->MFRate + 1)) == pConfig->MFRate);
+      if ((MCPH_OK == result) && withMF)
+      {
+        result = MCPH_ReadMF(pConfig, payload, &pos, end, mf);
+      }
+      if ((MCPH_OK == result) && (MCPH_ASYNC_MF_ONCE == pConfig->MFRate) && (pos >= end))
+      {
+        /* Last frame, carries the MF values sent once per packet */
+        pos = end;
+        result = MCPH_ReadMF(pConfig, payload, &pos, end + tail, mf);
+        withMF = true;
+        pos = end;
+      }
+      if (MCPH_OK == result)
+      {
+        if (fFrame != NULL)
+        {
+          fFrame(pUser, timestamp, hf, withMF ? mf : NULL);
+        }
+        frames++;
+      }
+    }
+  }
+  return ((MCPH_OK == result) ? frames : result);
+}
+
+/**
+  * @brief  Decodes the events of an event packet, see mcp_events.h.
+  *
+  * Packet layout: events of 8 bytes (timestamp u32, class and motor u8, code u8, data u16), then 0 and
+  * MCPH_ASYNC_ID_EVENTS.
+  *
+  * @retval Number of events decoded, or MCPH_ERROR_PROTOCOL if the packet is not an event packet.
+  */
+int MCPH_DecodeEvents(const uint8_t *payload, uint16_t length, MCPH_event_cb_t fEvent, void *pUser)
+{
+  MCPH_Event_t event;
+  uint16_t pos;
+  int result;
+
+  if ((length < 2U) || (((length - 2U) % 8U) != 0U) || (payload[length - 1U] != MCPH_ASYNC_ID_EVENTS))
+  {
+    result = MCPH_ERROR_PROTOCOL;
+  }
+  else
+  {
+    for (pos = 0U; pos < (length - 2U); pos += 8U)
+    {
+      event.timestamp = (uint32_t)payload[pos] | ((uint32_t)payload[pos + 1U] << 8U)
+                      | ((uint32_t)payload[pos + 2U] << 16U) | ((uint32_t)payload[pos + 3U] << 24U);
+      event.eventClass = payload[pos + 4U] >> 4U;
+      event.motor = payload[pos + 4U] & 0x0FU;
+      event.code = payload[pos + 5U];
+      event.data = (uint16_t)payload[pos + 6U] | (uint16_t)((uint16_t)payload[pos + 7U] << 8U);
+      if (fEvent != NULL)
+      {
+        fEvent(pUser, &event);
+      }
+    }
+    result = (int)((length - 2U) / 8U);
+  }
+  return (result);
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
@@ -0,0 +1,192 @@
+/**
+  ******************************************************************************
+  * @file    mcp_host.h
+  * @author  LenseDrive
+  * @brief   This file provides the definitions and functions prototypes of the
+  *          host side (controller) of the ASPEP and MCP protocols.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+
+#ifndef MCP_HOST_H
+#define MCP_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Return codes of the MCPH functions */
+#define MCPH_OK                   0
+#define MCPH_ERROR_TIMEOUT        (-1)   /* No answer from the performer */
+#define MCPH_ERROR_IO             (-2)   /* Transport error */
+#define MCPH_ERROR_NACK           (-3)   /* The performer rejected the packet, see lastNack */
+#define MCPH_ERROR_PROTOCOL       (-4)   /* Unexpected or corrupted packet */
+#define MCPH_ERROR_SIZE           (-5)   /* Request or answer does not fit */
+
+/* MCP commands used by the library, see mcp.h */
+#define MCPH_CMD_GET_MCP_VERSION  0x00U
+#define MCPH_CMD_SET_DATA_ELEMENT 0x08U
+#define MCPH_CMD_GET_DATA_ELEMENT 0x10U
+
+/* Largest ASPEP payload: 13 bits length field */
+#define MCPH_MAX_PAYLOAD          8191U
+
+/* Register ID fields, see register_interface.h */
+#define MCPH_TYPE_MASK            0x38U
+#define MCPH_TYPE_8BIT            0x08U
+#define MCPH_TYPE_16BIT           0x10U
+#define MCPH_TYPE_32BIT           0x18U
+#define MCPH_TYPE_STRING          0x20U
+#define MCPH_TYPE_RAW             0x28U
+
+/* MCPA configuration */
+#define MCPH_ASYNC_MAX_CHANNELS   16U
+#define MCPH_ASYNC_MF_ONCE        254U   /* MF values sent once per packet, before the mark */
+#define MCPH_ASYNC_MF_NONE        255U   /* MF values not sent */
+#define MCPH_ASYNC_RAW            0U     /* Encodings of the HF values, see MCPA_ENCODING_xxx */
+#define MCPH_ASYNC_DELTA_VARINT   1U
+#define MCPH_ASYNC_BIT_PACKED     2U
+
+/* Last byte of the async packets */
+#define MCPH_ASYNC_ID_MCPA        0U     /* MCPA stream packet */
+#define MCPH_ASYNC_ID_EVENTS      1U     /* Event packet */
+
+/* Event classes, bit N of the event mask register subscribes to class N, see mcp_events.h */
+#define MCPH_EVENT_FAULT          0U     /* Code 1: faults set, 2: faults cleared, data holds the fault bits */
+#define MCPH_EVENT_STATE          1U     /* Code is the new state, data the previous one */
+#define MCPH_EVENT_MOTION         2U     /* Code 1: target position reached */
+#define MCPH_REG_EVENT_MASK       ((10U << 6U) | MCPH_TYPE_8BIT)
+
+/**
+  * @brief Byte stream between the host and the performer
+  */
+typedef struct
+{
+  void *pCtx;                                                      /**< Passed to both functions */
+  int (*fWrite)(void *pCtx, const uint8_t *data, uint16_t length); /**< Returns 0 once all bytes are written */
+  int (*fRead)(void *pCtx, uint8_t *data, uint16_t length,
+               uint32_t timeoutMs);                                /**< Returns the bytes read, 0 on timeout */
+} MCPH_Transport_t;
+
+/**
+  * @brief Asynchronous (MCPA) stream configuration, see MCPA_cfgLog()
+  */
+typedef struct
+{
+  uint16_t bufferSize;                         /**< Size of the async packets, 0 stops the stream */
+  uint8_t HFRate;                              /**< One HF frame every HFRate+1 HF task periods */
+  uint8_t HFNum;                               /**< Number of HF channels, first in channelID */
+  uint8_t MFRate;                              /**< MF values after every MFRate+1 HF frames, or MCPH_ASYNC_MF_xxx */
+  uint8_t MFNum;                               /**< Number of MF channels, after the HF ones in channelID */
+  uint16_t channelID[MCPH_ASYNC_MAX_CHANNELS]; /**< Register IDs, HF ones must be 16 bits registers */
+  uint8_t mark;                                /**< Stream mark, echoed at the end of each packet, 0 stops */
+  uint8_t encoding;                            /**< HF values encoding, MCPH_ASYNC_RAW, _DELTA_VARINT or _BIT_PACKED */
+} MCPH_AsyncConfig_t;
+
+/**
+  * @brief Called for each async packet received while waiting for a sync answer or polling
+  */
+typedef void (*MCPH_async_cb_t)(void *pUser, const uint8_t *payload, uint16_t length);
+
+/**
+  * @brief Called for each frame decoded by MCPH_DecodeAsync()
+  *
+  * @p hf holds HFNum values. @p mf holds MFNum values when the frame carries MF values, NULL otherwise.
+  */
+typedef void (*MCPH_frame_cb_t)(void *pUser, uint32_t timestamp, const uint16_t *hf, const uint32_t *mf);
+
+/**
+  * @brief Event pushed by the performer
+  */
+typedef struct
+{
+  uint32_t timestamp;   /**< High frequency task period count when the event occurred */
+  uint8_t eventClass;   /**< MCPH_EVENT_xxx */
+  uint8_t motor;        /**< 0 for Motor 1 */
+  uint8_t code;         /**< Meaning depends on the class */
+  uint16_t data;        /**< Meaning depends on the class */
+} MCPH_Event_t;
+
+/**
+  * @brief Called for each event decoded by MCPH_DecodeEvents()
+  */
+typedef void (*MCPH_event_cb_t)(void *pUser, const MCPH_Event_t *pEvent);
+
+/**
+  * @brief Handle of a connection to a performer
+  */
+typedef struct
+{
+  MCPH_Transport_t transport;      /**< Byte stream to the performer */
+  uint32_t timeoutMs;              /**< Answer timeout */
+  MCPH_async_cb_t fAsync;          /**< Async packet handler, may be NULL */
+  void *pAsyncUser;                /**< Passed to fAsync */
+
+  bool dataCRC;                    /**< Negotiated data CRC */
+  uint16_t rxMaxPayload;           /**< Largest request payload the performer accepts */
+  uint16_t txSyncMaxPayload;       /**< Largest sync answer payload */
+  uint16_t txAsyncMaxPayload;      /**< Largest async packet payload */
+  uint16_t pingNumber;             /**< Number of the next ping */
+  uint8_t lastNack;                /**< Error code of the last NACK received */
+
+  uint32_t asyncPackets;           /**< Async packets received */
+  uint32_t asyncBytes;             /**< Async payload bytes received */
+  uint32_t badPackets;             /**< Packets dropped on a header or data CRC error */
+
+  uint8_t rxBuffer[MCPH_MAX_PAYLOAD + 2U];
+  uint8_t txBuffer[MCPH_MAX_PAYLOAD + 6U];
+} MCPH_Handle_t;
+
+/* Initializes the handle, to be called before MCPH_Connect() */
+void MCPH_Init(MCPH_Handle_t *pHandle, const MCPH_Transport_t *pTransport, uint32_t timeoutMs);
+
+/* Negotiates the capabilities with beacons and connects with a ping */
+int MCPH_Connect(MCPH_Handle_t *pHandle, bool dataCRC);
+
+/* Sends an MCP command and waits for its answer */
+int MCPH_Request(MCPH_Handle_t *pHandle, uint16_t command, uint8_t motor, const uint8_t *data, uint16_t length,
+                 uint8_t *answer, uint16_t maxSize, uint16_t *pSize, uint8_t *pStatus);
+
+/* Reads registers, values are returned back to back in the MCP format */
+int MCPH_GetRegisters(MCPH_Handle_t *pHandle, const uint16_t *pIDs, uint8_t nbr, uint8_t *values,
+                      uint16_t maxSize, uint16_t *pSize, uint8_t *pStatus);
+
+/* Writes one register, RAW values are prefixed with their size */
+int MCPH_SetRegister(MCPH_Handle_t *pHandle, uint16_t regID, const void *value, uint16_t size,
+                     uint8_t *pStatus);
+
+/* Configures the asynchronous stream */
+int MCPH_ConfigAsync(MCPH_Handle_t *pHandle, const MCPH_AsyncConfig_t *pConfig, uint8_t *pStatus);
+
+/* Processes the packets received within the timeout, async packets are passed to fAsync */
+int MCPH_Poll(MCPH_Handle_t *pHandle, uint32_t timeoutMs);
+
+/* Decodes the frames of an async packet */
+int MCPH_DecodeAsync(const MCPH_AsyncConfig_t *pConfig, const uint8_t *payload, uint16_t length,
+                     MCPH_frame_cb_t fFrame, void *pUser);
+
+/* Decodes the events of an event packet */
+int MCPH_DecodeEvents(const uint8_t *payload, uint16_t length, MCPH_event_cb_t fEvent, void *pUser);
+
+/* Opens a serial port (or pseudo-terminal) as transport, Linux only */
+int MCPH_SerialOpen(MCPH_Transport_t *pTransport, const char *device, uint32_t baudrate);
+
+/* Closes a transport opened with MCPH_SerialOpen() */
+void MCPH_SerialClose(MCPH_Transport_t *pTransport);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MCP_HOST_H */
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/
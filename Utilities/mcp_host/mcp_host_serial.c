@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    mcp_host_serial.c
+  * @author  LenseDrive
+  * @brief   This file provides the Linux serial port transport of the MCP host
+  *          library. Pseudo-terminals are accepted, for performer simulators.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 LenseDrive project.
+  * All rights reserved.
+  *
+  ******************************************************************************
+  */
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <asm/termbits.h>  /* termios2: arbitrary baudrates such as the 1843200 bps of the performer */
+#include "mcp_host.h"
+
+/**
+  * @brief Writes all bytes, returns 0 on success
+  */
+static int MCPH_SerialWrite(void *pCtx, const uint8_t *data, uint16_t length)
+{
+  int fd = (int)(intptr_t)pCtx;
+  uint16_t done = 0U;
+  ssize_t n;
+  int result = 0;
+
+  while ((0 == result) && (done < length))
+  {
+    n = write(fd, &data[done], length - done);
+    if (n < 0)
+    {
+      result = -1;
+    }
+    else
+    {
+      done += (uint16_t)n;
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief Reads up to @p length bytes, returns the bytes read, 0 on timeout, -1 on error
+  */
+static int MCPH_SerialRead(void *pCtx, uint8_t *data, uint16_t length, uint32_t timeoutMs)
+{
+  struct pollfd pfd;
+  ssize_t n;
+  int result;
+
+  pfd.fd = (int)(intptr_t)pCtx;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+  result = poll(&pfd, 1, (int)timeoutMs);
+  if (result > 0)
+  {
+    n = read(pfd.fd, data, length);
+    result = (n < 0) ? -1 : (int)n;
+  }
+  return (result);
+}
+
+/**
+  * @brief  Opens @p device in raw mode, 8N1, no flow control.
+  *
+  * @param  pTransport Transport to initialize
+  * @param  device Path of the serial port
+  * @param  baudrate Baudrate, ignored by pseudo-terminals
+  *
+  * @retval MCPH_OK, or MCPH_ERROR_IO if the port cannot be opened or configured.
+  */
+int MCPH_SerialOpen(MCPH_Transport_t *pTransport, const char *device, uint32_t baudrate)
+{
+  struct termios2 tio;
+  int fd;
+  int result = MCPH_ERROR_IO;
+
+  fd = open(device, O_RDWR | O_NOCTTY);
+  if (fd >= 0)
+  {
+    if (0 == ioctl(fd, TCGETS2, &tio))
+    {
+      tio.c_iflag = 0U;
+      tio.c_oflag = 0U;
+      tio.c_lflag = 0U;
+      tio.c_cflag = CS8 | CREAD | CLOCAL | BOTHER;
+      tio.c_ispeed = baudrate;
+      tio.c_ospeed = baudrate;
+      tio.c_cc[VMIN] = 1U;
+      tio.c_cc[VTIME] = 0U;
+      if (0 == ioctl(fd, TCSETS2, &tio))
+      {
+        pTransport->pCtx = (void *)(intptr_t)fd;
+        pTransport->fWrite = &MCPH_SerialWrite;
+        pTransport->fRead = &MCPH_SerialRead;
+        result = MCPH_OK;
+      }
+    }
+    if (result != MCPH_OK)
+    {
+      (void)close(fd);
+    }
+  }
+  return (result);
+}
+
+/**
+  * @brief  Closes a transport opened with MCPH_SerialOpen().
+  */
+void MCPH_SerialClose(MCPH_Transport_t *pTransport)
+{
+  (void)close((int)(intptr_t)pTransport->pCtx);
+  pTransport->pCtx = NULL;
+}
+
+/******************* (C) COPYRIGHT 2026 LenseDrive project *****END OF FILE****/